@@ -28,7 +28,7 @@ struct ConstantBuffer {
 // Vertex shader with MVP transformation
 const char* vertexShaderSource = R"(
 cbuffer ConstantBuffer : register(b0) {
-    matrix mvpMatrix;
+    row_major matrix mvpMatrix;
 };
 
 struct VSInput {
@@ -130,7 +130,8 @@ int main() {
     ID3D11Device* device = d3d11Renderer->getDevice();
     ID3D11DeviceContext* deviceContext = d3d11Renderer->getDeviceContext();
 
-    // Create shader
+    // Create shader; compiled bytecode is reused on later launches
+    ogde::graphics::ShaderCache shaderCache("shader_cache");
     ogde::graphics::Shader shader;
     D3D11_INPUT_ELEMENT_DESC inputLayout[] = {
         { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -138,7 +139,7 @@ int main() {
     };
 
     if (!shader.createFromSource(device, vertexShaderSource, pixelShaderSource, 
-                                 inputLayout, ARRAYSIZE(inputLayout))) {
+                                 inputLayout, ARRAYSIZE(inputLayout), &shaderCache)) {
         ogde::core::Logger::error("Failed to create shader!");
         return 1;
     }
@@ -220,13 +221,13 @@ int main() {
         // Get view-projection matrix from camera
         const float* vpMatrix = camera.getViewProjectionMatrix();
 
-        // Calculate MVP = VP * Model (matrix multiplication)
+        // Calculate MVP = Model * VP (row vectors: clip = v * Model * View * Projection)
         ConstantBuffer cb;
         for (int i = 0; i < 4; ++i) {
             for (int j = 0; j < 4; ++j) {
                 cb.mvpMatrix[i * 4 + j] = 0.0f;
                 for (int k = 0; k < 4; ++k) {
-                    cb.mvpMatrix[i * 4 + j] += vpMatrix[i * 4 + k] * modelMatrix[k * 4 + j];
+                    cb.mvpMatrix[i * 4 + j] += modelMatrix[i * 4 + k] * vpMatrix[k * 4 + j];
                 }
             }
         }
@@ -110,7 +110,8 @@ int main() {
     ID3D11Device* device = d3d11Renderer->getDevice();
     ID3D11DeviceContext* deviceContext = d3d11Renderer->getDeviceContext();
 
-    // Create shader
+    // Create shader; compiled bytecode is reused on later launches
+    ogde::graphics::ShaderCache shaderCache("shader_cache");
     ogde::graphics::Shader shader;
     D3D11_INPUT_ELEMENT_DESC inputLayout[] = {
         { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
@@ -118,7 +119,7 @@ int main() {
     };
 
     if (!shader.createFromSource(device, vertexShaderSource, pixelShaderSource, 
-                                 inputLayout, ARRAYSIZE(inputLayout))) {
+                                 inputLayout, ARRAYSIZE(inputLayout), &shaderCache)) {
         ogde::core::Logger::error("Failed to create shader!");
         return 1;
     }
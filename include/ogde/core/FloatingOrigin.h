@@ -0,0 +1,129 @@
+/**
+ * @file FloatingOrigin.h
+ * @brief Floating origin for large-world coordinates
+ */
+
+#ifndef OGDE_CORE_FLOATINGORIGIN_H
+#define OGDE_CORE_FLOATINGORIGIN_H
+
+#include "ogde/core/Math.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ogde {
+namespace core {
+
+/**
+ * @class FloatingOrigin
+ * @brief Maps double-precision world positions to float positions near a moving origin
+ *
+ * Authoritative positions (cameras, entities) are kept in world space as Vector3d.
+ * Rendering and physics work in float "local" space, which is world space minus
+ * the origin. When the focus point (usually the main camera) moves farther than
+ * the rebase distance from the origin, the origin jumps to the focus, snapped to a
+ * grid of the rebase distance, and listeners shift their float data by the same
+ * amount. Local coordinates therefore stay within a few kilometres of zero, where
+ * float precision is sub-millimetre, regardless of how large the world is.
+ */
+class FloatingOrigin {
+public:
+    /**
+     * @brief Called after a rebase
+     * @param newOrigin The new origin in world space
+     * @param shift Offset to add to existing local positions (old origin - new origin)
+     */
+    using RebaseCallback = std::function<void(const Vector3d& newOrigin, const Vector3& shift)>;
+
+    /**
+     * @brief Create a floating origin at world zero
+     * @param rebaseDistance Distance from the origin (per axis) that triggers a rebase
+     */
+    explicit FloatingOrigin(double rebaseDistance = 1024.0);
+
+    /**
+     * @brief Get the current origin in world space
+     */
+    const Vector3d& getOrigin() const { return m_origin; }
+
+    /**
+     * @brief Move the origin and notify listeners
+     * @param origin New origin in world space
+     */
+    void setOrigin(const Vector3d& origin);
+
+    /**
+     * @brief Rebase if the focus point has moved too far from the origin
+     * @param focus Focus point in world space (e.g. the main camera position)
+     * @return true if the origin moved
+     */
+    bool update(const Vector3d& focus);
+
+    /**
+     * @brief Convert a world position to local (origin-relative) float space
+     */
+    Vector3 toLocal(const Vector3d& world) const {
+        return Vector3(static_cast<float>(world.x - m_origin.x),
+                       static_cast<float>(world.y - m_origin.y),
+                       static_cast<float>(world.z - m_origin.z));
+    }
+
+    /**
+     * @brief Convert a local float position back to world space
+     */
+    Vector3d toWorld(const Vector3& local) const {
+        return Vector3d(m_origin.x + local.x, m_origin.y + local.y, m_origin.z + local.z);
+    }
+
+    /**
+     * @brief Convert many world positions to local space
+     * @param world Input positions
+     * @param outLocal Output positions (may not alias world)
+     * @param count Number of positions
+     */
+    void toLocal(const Vector3d* world, Vector3* outLocal, uint32_t count) const;
+
+    /**
+     * @brief Add a rebase shift to an array of local positions
+     * @param positions Local positions to update in place
+     * @param count Number of positions
+     * @param shift Shift passed to a RebaseCallback
+     */
+    static void applyShift(Vector3* positions, uint32_t count, const Vector3& shift);
+
+    /**
+     * @brief Register a callback that runs after every rebase
+     * @return Listener id for removeListener()
+     */
+    uint32_t addListener(RebaseCallback callback);
+
+    /**
+     * @brief Remove a listener registered with addListener()
+     */
+    void removeListener(uint32_t id);
+
+    double getRebaseDistance() const { return m_rebaseDistance; }
+    void setRebaseDistance(double distance) { m_rebaseDistance = distance; }
+
+    /**
+     * @brief Number of rebases since creation
+     */
+    uint32_t getRebaseCount() const { return m_rebaseCount; }
+
+private:
+    struct Listener {
+        uint32_t id;
+        RebaseCallback callback;
+    };
+
+    Vector3d m_origin;
+    double m_rebaseDistance;
+    uint32_t m_rebaseCount;
+    uint32_t m_nextListenerId;
+    std::vector<Listener> m_listeners;
+};
+
+} // namespace core
+} // namespace ogde
+
+#endif // OGDE_CORE_FLOATINGORIGIN_H
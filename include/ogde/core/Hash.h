@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OGDE {
+namespace Core {
+
+/**
+ * @brief 64-bit non-cryptographic hash of a byte range (xxHash64, seed 0)
+ *
+ * Fast enough to hash whole files while loading them. Used as a content key by
+ * the texture and shader caches; equal hashes do not prove equal contents.
+ * @param data Bytes to hash
+ * @param size Number of bytes
+ * @return Hash value
+ */
+uint64_t Hash64(const uint8_t* data, size_t size);
+
+} // namespace Core
+} // namespace OGDE
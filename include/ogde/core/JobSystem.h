@@ -0,0 +1,88 @@
+/**
+ * @file JobSystem.h
+ * @brief Worker thread pool for data-parallel work
+ */
+
+#ifndef OGDE_CORE_JOBSYSTEM_H
+#define OGDE_CORE_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ogde {
+namespace core {
+
+/**
+ * @class JobSystem
+ * @brief Persistent worker threads that execute parallel-for loops
+ *
+ * The calling thread participates in every loop, so a JobSystem with zero
+ * workers simply runs the loop inline. Loops issued from inside a running
+ * loop body execute inline on the issuing thread.
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Create the worker threads
+     * @param workerCount Number of workers (0 = one less than the hardware thread count)
+     */
+    explicit JobSystem(uint32_t workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Get the number of worker threads (not counting the caller)
+     */
+    uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+    /**
+     * @brief Get the number of threads that execute a loop (workers + caller)
+     */
+    uint32_t getThreadCount() const { return getWorkerCount() + 1; }
+
+    /**
+     * @brief Run fn over [0, count) split into ranges of grainSize, blocking until all ranges finish
+     * @param count Number of items
+     * @param grainSize Items per range (0 picks a size that gives each thread a few ranges)
+     * @param fn Called with [begin, end) item ranges, possibly concurrently
+     */
+    void parallelFor(uint32_t count, uint32_t grainSize,
+                     const std::function<void(uint32_t begin, uint32_t end)>& fn);
+
+    /**
+     * @brief Get a process-wide job system sized to the machine
+     */
+    static JobSystem& shared();
+
+private:
+    void workerLoop();
+    void runRanges();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::mutex m_submitMutex;          // One loop at a time
+
+    // Current loop
+    const std::function<void(uint32_t, uint32_t)>* m_function;
+    uint32_t m_count;
+    uint32_t m_grainSize;
+    uint32_t m_rangeCount;
+    std::atomic<uint32_t> m_nextRange;
+    uint32_t m_pendingWorkers;         // Workers that have not finished the current loop
+    uint64_t m_generation;
+    bool m_shutdown;
+};
+
+} // namespace core
+} // namespace ogde
+
+#endif // OGDE_CORE_JOBSYSTEM_H
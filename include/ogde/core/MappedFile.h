@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OGDE {
+namespace Core {
+
+/**
+ * @brief Read-only memory-mapped file
+ *
+ * Maps a whole file into the address space so its contents can be used in place
+ * without copying. Pages are loaded by the OS on first access. The mapping stays
+ * valid until Close() or destruction; pointers into it must not outlive the object.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Disable copy
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Allow move
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Map a file for reading, closing any previous mapping
+     * @param filepath Path to the file to map
+     * @return true if successful, false if the file is missing or empty
+     */
+    bool Open(const std::string& filepath);
+
+    /**
+     * @brief Unmap the file
+     */
+    void Close();
+
+    /**
+     * @brief Check if a file is mapped
+     * @return true if GetData() is valid
+     */
+    bool IsOpen() const { return data_ != nullptr; }
+
+    /**
+     * @brief Get the mapped contents
+     * @return Pointer to the first byte (page aligned), or nullptr if not open
+     */
+    const uint8_t* GetData() const { return data_; }
+
+    /**
+     * @brief Get the size of the mapping
+     * @return File size in bytes
+     */
+    size_t GetSize() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
+
+} // namespace Core
+} // namespace OGDE
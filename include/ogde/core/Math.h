@@ -31,6 +31,17 @@ struct Vector3 {
     Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
 };
 
+/**
+ * @struct Vector3d
+ * @brief Double-precision 3D vector for world positions in large worlds
+ */
+struct Vector3d {
+    double x, y, z;
+    
+    Vector3d() : x(0.0), y(0.0), z(0.0) {}
+    Vector3d(double x, double y, double z) : x(x), y(y), z(z) {}
+};
+
 /**
  * @struct Vector4
  * @brief 4D vector
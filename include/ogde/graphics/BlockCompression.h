@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ogde {
+namespace core {
+class JobSystem;
+}
+}
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief GPU block-compressed formats (4x4 pixel blocks)
+ */
+enum class BlockFormat {
+    BC1,    ///< RGB, 8 bytes per block (4 bpp); alpha ignored
+    BC3,    ///< RGBA, 16 bytes per block: BC1 color + BC4 alpha
+    BC4,    ///< Single channel (R), 8 bytes per block
+    BC5,    ///< Two channels (RG), 16 bytes per block; normal maps
+    BC7     ///< High quality RGBA, 16 bytes per block
+};
+
+/**
+ * @brief Encoder effort
+ */
+enum class CompressionQuality {
+    Fast,   ///< Principal-axis endpoints only
+    Normal, ///< One least-squares endpoint refinement
+    High    ///< Several refinements; BC7 also tries separate-alpha mode 5
+};
+
+/**
+ * @brief Options for block compression
+ */
+struct CompressionSettings {
+    BlockFormat format = BlockFormat::BC7;
+    CompressionQuality quality = CompressionQuality::Normal;
+
+    /// Optional job system to encode block rows in parallel (nullptr = calling thread only)
+    ogde::core::JobSystem* jobSystem = nullptr;
+};
+
+/**
+ * @brief CPU encoder and decoder for BC1/BC3/BC4/BC5/BC7
+ *
+ * Input pixels are 1-4 channel 8-bit images. They are expanded to RGBA the same
+ * way the GPU sees uncompressed textures: 1 channel -> (v, v, v, 255),
+ * 2 channels -> (r, g, 0, 255), 3 channels -> (r, g, b, 255). Images that are not
+ * a multiple of 4 pixels are padded by repeating edge pixels.
+ *
+ * The BC7 encoder emits mode 6, plus mode 5 at High quality when it has lower
+ * error; the decoder accepts the single-subset modes 4, 5 and 6 and reports
+ * failure for partitioned blocks.
+ */
+class BlockCompressor {
+public:
+    /**
+     * @brief Bytes per 4x4 block (8 or 16)
+     */
+    static size_t GetBlockSize(BlockFormat format);
+
+    /**
+     * @brief Bytes needed for an image of the given size
+     */
+    static size_t GetCompressedSize(BlockFormat format, int width, int height);
+
+    /**
+     * @brief Number of channels that carry data in the format (used for PSNR)
+     */
+    static int GetChannelCount(BlockFormat format);
+
+    /**
+     * @brief Compress an image
+     * @param pixels Source pixels (tightly packed)
+     * @param width Image width
+     * @param height Image height
+     * @param channels Channels per source pixel (1-4)
+     * @param settings Format, quality and threading
+     * @param outBlocks Destination of GetCompressedSize() bytes, blocks in row-major order
+     * @return true on success
+     */
+    static bool Encode(const uint8_t* pixels, int width, int height, int channels,
+                       const CompressionSettings& settings, uint8_t* outBlocks);
+
+    /**
+     * @brief Decompress an image to RGBA
+     * @param blocks Compressed blocks
+     * @param width Image width
+     * @param height Image height
+     * @param format Block format
+     * @param outRgba Destination of width * height * 4 bytes
+     * @return false if the data contains blocks the decoder does not support
+     */
+    static bool Decode(const uint8_t* blocks, int width, int height, BlockFormat format, uint8_t* outRgba);
+
+    /**
+     * @brief Peak signal-to-noise ratio between two RGBA images
+     * @param a First image (RGBA)
+     * @param b Second image (RGBA)
+     * @param width Image width
+     * @param height Image height
+     * @param channelCount Number of leading channels to compare (1-4)
+     * @return PSNR in dB (capped at 99 for identical images)
+     */
+    static double ComputePsnr(const uint8_t* a, const uint8_t* b, int width, int height, int channelCount);
+
+    /**
+     * @brief Expand a 1-4 channel image to RGBA using the convention above
+     */
+    static void ExpandToRgba(const uint8_t* pixels, int width, int height, int channels, uint8_t* outRgba);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -6,6 +6,8 @@
 #ifndef OGDE_GRAPHICS_CAMERA_H
 #define OGDE_GRAPHICS_CAMERA_H
 
+#include "ogde/graphics/Frustum.h"
+
 #ifdef _WIN32
 #include <DirectXMath.h>
 #endif
@@ -50,7 +52,7 @@ public:
     void setOrthographic(float width, float height, float nearPlane = -1.0f, float farPlane = 1.0f);
 
     /**
-     * @brief Set camera position
+     * @brief Set camera position in render space (relative to the world origin)
      * @param x X coordinate
      * @param y Y coordinate
      * @param z Z coordinate
@@ -65,6 +67,32 @@ public:
      */
     void setRotation(float pitch, float yaw, float roll);
 
+    /**
+     * @brief Set camera position in double-precision world space
+     *
+     * The render-space position becomes the offset from the world origin, so the
+     * view matrix stays precise however far the camera is from world zero.
+     */
+    void setWorldPosition(double x, double y, double z);
+
+    /**
+     * @brief Get camera position in double-precision world space
+     */
+    void getWorldPosition(double& outX, double& outY, double& outZ) const;
+
+    /**
+     * @brief Set the world-space point that maps to render-space zero
+     *
+     * Keeps the world position and recomputes the render-space position; normally
+     * driven by core::FloatingOrigin.
+     */
+    void setWorldOrigin(double x, double y, double z);
+
+    /**
+     * @brief Get the world-space point that maps to render-space zero
+     */
+    void getWorldOrigin(double& outX, double& outY, double& outZ) const;
+
     /**
      * @brief Set camera to look at a target
      * @param eyeX Camera position X
@@ -94,13 +122,19 @@ public:
     const float* getProjectionMatrix() const;
 
     /**
-     * @brief Get the view-projection matrix (projection * view)
+     * @brief Get the view-projection matrix (view * projection, row vectors: clip = v * VP)
      * @return Pointer to combined matrix data (16 floats, column-major)
      */
     const float* getViewProjectionMatrix() const;
 
     /**
-     * @brief Get camera position
+     * @brief Get the view frustum (extracted whenever the view-projection matrix updates)
+     * @return Frustum in world space
+     */
+    const Frustum& getFrustum() const { return m_frustum; }
+
+    /**
+     * @brief Get camera position in render space
      * @param outX Output X coordinate
      * @param outY Output Y coordinate
      * @param outZ Output Z coordinate
@@ -133,15 +167,55 @@ public:
 
     /**
      * @brief Update camera matrices (call after changing position/rotation)
+     *
+     * Does nothing if neither the view nor the projection changed since the last update.
      */
     void update();
 
+    /**
+     * @brief Check if the camera has changes that update() has not applied yet
+     * @return true if the view or projection is dirty
+     */
+    bool isDirty() const { return m_viewDirty || m_projectionDirty; }
+
     /**
      * @brief Get the projection type
      * @return Current projection type
      */
     ProjectionType getProjectionType() const { return m_projectionType; }
 
+    /**
+     * @brief Get the perspective field of view
+     * @return Vertical field of view in degrees
+     */
+    float getFieldOfView() const { return m_fov; }
+
+    /**
+     * @brief Get the perspective aspect ratio
+     * @return Width / height ratio
+     */
+    float getAspectRatio() const { return m_aspectRatio; }
+
+    /**
+     * @brief Get the near clipping plane distance
+     */
+    float getNearPlane() const { return m_nearPlane; }
+
+    /**
+     * @brief Get the far clipping plane distance
+     */
+    float getFarPlane() const { return m_farPlane; }
+
+    /**
+     * @brief Get the orthographic viewport width
+     */
+    float getOrthoWidth() const { return m_orthoWidth; }
+
+    /**
+     * @brief Get the orthographic viewport height
+     */
+    float getOrthoHeight() const { return m_orthoHeight; }
+
 private:
     void updateViewMatrix();
     void updateProjectionMatrix();
@@ -150,7 +224,9 @@ private:
     ProjectionType m_projectionType;
     
     // Position and orientation
-    float m_position[3];        // x, y, z
+    float m_position[3];        // x, y, z relative to m_worldOrigin
+    double m_worldPosition[3];  // Authoritative position in world space
+    double m_worldOrigin[3];    // World point at render-space zero
     float m_rotation[3];        // pitch, yaw, roll (degrees)
     float m_forward[3];         // forward vector
     float m_right[3];           // right vector
@@ -169,6 +245,8 @@ private:
     float m_projectionMatrix[16];
     float m_viewProjectionMatrix[16];
 
+    Frustum m_frustum;          // Planes of m_viewProjectionMatrix
+
     bool m_viewDirty;           // View matrix needs update
     bool m_projectionDirty;     // Projection matrix needs update
 };
@@ -0,0 +1,197 @@
+/**
+ * @file CameraSet.h
+ * @brief Batched management and culling of multiple camera views
+ */
+
+#ifndef OGDE_GRAPHICS_CAMERASET_H
+#define OGDE_GRAPHICS_CAMERASET_H
+
+#include "ogde/graphics/Camera.h"
+#include "ogde/graphics/Frustum.h"
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+namespace graphics {
+
+/**
+ * @enum ViewType
+ * @brief Purpose of a view in a CameraSet
+ */
+enum class ViewType {
+    Main,           ///< Primary scene view
+    ShadowCascade,  ///< Directional light shadow cascade
+    SplitScreen,    ///< Additional player view
+    Reflection      ///< Planar reflection view
+};
+
+/**
+ * @struct Viewport
+ * @brief Normalized viewport rectangle (0-1 range of the render target)
+ */
+struct Viewport {
+    float x = 0.0f;
+    float y = 0.0f;
+    float width = 1.0f;
+    float height = 1.0f;
+};
+
+/**
+ * @class CameraSet
+ * @brief Owns many views, updates only the dirty ones and culls against all of them in one pass
+ *
+ * Views are addressed by index. Storage is reserved up front, so references returned by
+ * getCamera() stay valid for the lifetime of the set.
+ */
+class CameraSet {
+public:
+    static constexpr uint32_t kMaxViews = 32;
+    static constexpr uint32_t kInvalidView = 0xFFFFFFFFu;
+
+    CameraSet();
+    ~CameraSet();
+
+    /**
+     * @brief Add a view
+     * @param type View purpose
+     * @param viewport Normalized viewport rectangle
+     * @return View index, or kInvalidView if kMaxViews views already exist
+     */
+    uint32_t addView(ViewType type, const Viewport& viewport = Viewport());
+
+    /**
+     * @brief Remove all views
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of views
+     */
+    uint32_t getViewCount() const { return static_cast<uint32_t>(m_views.size()); }
+
+    /**
+     * @brief Access the camera of a view (changes mark the view dirty)
+     */
+    Camera& getCamera(uint32_t view) { return m_views[view].camera; }
+    const Camera& getCamera(uint32_t view) const { return m_views[view].camera; }
+
+    ViewType getViewType(uint32_t view) const { return m_views[view].type; }
+    const Viewport& getViewport(uint32_t view) const { return m_views[view].viewport; }
+    void setViewport(uint32_t view, const Viewport& viewport) { m_views[view].viewport = viewport; }
+
+    /**
+     * @brief Enable or disable a view (disabled views are skipped by update and cull)
+     */
+    void setViewEnabled(uint32_t view, bool enabled) { m_views[view].enabled = enabled; }
+    bool isViewEnabled(uint32_t view) const { return m_views[view].enabled; }
+
+    /**
+     * @brief Update the matrices and frustums of dirty, enabled views
+     * @return Number of views that were updated
+     */
+    uint32_t update();
+
+    /**
+     * @brief Move the world origin of every view (see Camera::setWorldOrigin)
+     *
+     * Call from a core::FloatingOrigin listener so all views share one render space.
+     */
+    void setWorldOrigin(double x, double y, double z);
+
+    /**
+     * @brief Cull boxes against all enabled views in a single pass
+     * @param boxes Boxes to test
+     * @param outMasks Resized to boxes.size(); bit v is set if the box is visible in view v
+     */
+    void cull(const AabbBatch& boxes, std::vector<uint32_t>& outMasks) const;
+
+    /**
+     * @brief Cull spheres against all enabled views in a single pass
+     * @param spheres Spheres to test
+     * @param outMasks Resized to spheres.size(); bit v is set if the sphere is visible in view v
+     */
+    void cull(const SphereBatch& spheres, std::vector<uint32_t>& outMasks) const;
+
+    /**
+     * @brief Extract the indices visible in one view from cull() output
+     * @param masks Visibility masks from cull()
+     * @param view View index
+     * @param outVisible Receives the indices whose mask contains the view bit
+     */
+    static void collectVisible(const std::vector<uint32_t>& masks, uint32_t view,
+                               std::vector<uint32_t>& outVisible);
+
+    /**
+     * @brief Add shadow cascade views
+     * @param count Number of cascades
+     * @return Index of the first cascade view, or kInvalidView if there is no room
+     */
+    uint32_t addShadowCascades(uint32_t count);
+
+    /**
+     * @brief Fit the shadow cascade views to slices of a viewer's frustum
+     * @param viewer Camera the cascades cover (orthographic viewers always use uniform splits)
+     * @param lightDirX Light direction X (direction the light travels)
+     * @param lightDirY Light direction Y
+     * @param lightDirZ Light direction Z
+     * @param lambda Blend between uniform (0) and logarithmic (1) split distribution
+     * @param maxDistance Shadow distance (0 uses the viewer's far plane)
+     * @param shadowMapResolution Shadow map size in texels, used to snap cascades to texels
+     */
+    void updateShadowCascades(const Camera& viewer,
+                              float lightDirX, float lightDirY, float lightDirZ,
+                              float lambda = 0.75f, float maxDistance = 0.0f,
+                              uint32_t shadowMapResolution = 2048);
+
+    /**
+     * @brief Get the far split distance of a cascade (valid after updateShadowCascades)
+     */
+    float getCascadeSplit(uint32_t cascade) const { return m_cascadeSplits[cascade + 1]; }
+
+    /**
+     * @brief Number of cascades added with addShadowCascades()
+     */
+    uint32_t getCascadeCount() const { return m_cascadeCount; }
+
+    /**
+     * @brief Mirror a source camera across a horizontal plane into a reflection view
+     * @param view Reflection view index
+     * @param source Camera to mirror
+     * @param planeHeight World-space Y of the reflection plane
+     */
+    void updateReflectionView(uint32_t view, const Camera& source, float planeHeight);
+
+    /**
+     * @brief Compute practical split scheme distances for cascaded shadow maps
+     * @param nearPlane Near distance
+     * @param farPlane Far distance
+     * @param cascadeCount Number of cascades
+     * @param lambda Blend between uniform (0) and logarithmic (1) distribution
+     * @param outSplits Receives cascadeCount + 1 distances from nearPlane to farPlane
+     */
+    static void computeCascadeSplits(float nearPlane, float farPlane, uint32_t cascadeCount,
+                                     float lambda, float* outSplits);
+
+    /**
+     * @brief Compute the viewport of one player in an evenly divided split screen (1-4 players)
+     */
+    static Viewport splitScreenViewport(uint32_t player, uint32_t playerCount);
+
+private:
+    struct View {
+        Camera camera;
+        ViewType type = ViewType::Main;
+        Viewport viewport;
+        bool enabled = true;
+    };
+
+    std::vector<View> m_views;
+    uint32_t m_firstCascade;
+    uint32_t m_cascadeCount;
+    float m_cascadeSplits[kMaxViews + 1];
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_CAMERASET_H
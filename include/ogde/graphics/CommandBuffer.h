@@ -0,0 +1,201 @@
+/**
+ * @file CommandBuffer.h
+ * @brief Backend-agnostic command recording for multithreaded rendering
+ */
+
+#ifndef OGDE_GRAPHICS_COMMANDBUFFER_H
+#define OGDE_GRAPHICS_COMMANDBUFFER_H
+
+#include "ogde/graphics/RenderQueue.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ogde {
+namespace graphics {
+
+/**
+ * @brief Kinds of recorded commands
+ */
+enum class CommandType : uint16_t {
+    BindPass,
+    BindShader,
+    BindMaterial,
+    BindGeometry,
+    Draw,
+    UpdateBuffer,
+    DrawIndexedInstanced    ///< Indexed and/or instanced draw (the full DrawItem range)
+};
+
+/**
+ * @class CommandSink
+ * @brief Consumer of the command stream (a backend, or another recorder)
+ *
+ * Extends the RenderQueue interface with buffer updates, so a sorted
+ * RenderQueue can be submitted straight into a CommandBuffer.
+ */
+class CommandSink : public RenderQueueSink {
+public:
+    /**
+     * @brief Write data into a backend buffer
+     * @param buffer Backend buffer id
+     * @param offset Byte offset in the buffer
+     * @param data Source bytes, only valid for the duration of the call
+     * @param size Number of bytes
+     */
+    virtual void updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) = 0;
+};
+
+/**
+ * @class CommandBuffer
+ * @brief Linear, append-only recording of rendering commands
+ *
+ * Commands are packed back to back into one byte array (an 8-byte header
+ * plus payload, 4-byte aligned); buffer updates copy their data inline, so
+ * the caller's memory can be reused right after recording. Replaying walks
+ * the array once and calls the sink for each command. Draws are replayed
+ * with the pass, shader, material and geometry bound before them filled in.
+ * Plain draws take 12 bytes of payload; indexed or instanced draws store
+ * their full range.
+ *
+ * A CommandBuffer is recorded by one thread at a time; clear() keeps its
+ * memory for the next frame.
+ */
+class CommandBuffer : public CommandSink {
+public:
+    CommandBuffer();
+    ~CommandBuffer() override;
+
+    // Recording
+    void bindPass(uint32_t pass) override;
+    void bindShader(uint32_t shader) override;
+    void bindMaterial(uint32_t material) override;
+    void bindGeometry(uint32_t geometry) override;
+    void draw(const DrawItem& item) override;
+    void updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) override;
+
+    /**
+     * @brief Record a non-indexed draw with the currently bound state
+     */
+    void draw(uint32_t vertexCount, uint32_t startVertex = 0, uint32_t userData = 0);
+
+    /**
+     * @brief Record an indexed draw from the bound geometry's index buffer
+     * @param indexCount Number of indices
+     * @param startIndex First index
+     * @param baseVertex Value added to each index
+     * @param userData Per-draw payload
+     */
+    void drawIndexed(uint32_t indexCount, uint32_t startIndex = 0, uint32_t baseVertex = 0, uint32_t userData = 0);
+
+    /**
+     * @brief Append every command of another buffer
+     */
+    void append(const CommandBuffer& other);
+
+    /**
+     * @brief Play the commands back in recording order
+     * @param sink Receiver of the commands
+     */
+    void replay(CommandSink& sink) const;
+
+    /**
+     * @brief Drop all commands, keeping capacity
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of recorded commands
+     */
+    uint32_t getCommandCount() const { return m_commandCount; }
+
+    /**
+     * @brief Get the recorded size in bytes
+     */
+    size_t getSize() const { return m_data.size(); }
+
+    bool isEmpty() const { return m_commandCount == 0; }
+
+private:
+    uint8_t* allocate(CommandType type, uint32_t payloadSize);
+    void recordValue(CommandType type, uint32_t value);
+
+    std::vector<uint8_t> m_data;
+    uint32_t m_commandCount;
+};
+
+/**
+ * @class CommandRecorder
+ * @brief Hands out command buffers to recording threads and merges them deterministically
+ *
+ * Each unit of work (a job range, a view, a render pass) asks for the buffer
+ * of its own order key with begin() and records into it without locking.
+ * merge() and replay() visit buffers in ascending key order, so the final
+ * command stream does not depend on which thread finished first.
+ *
+ * A buffer must not rely on state bound in another buffer: after the merge
+ * its predecessor depends on key order, not recording order.
+ *
+ * begin() is thread-safe; two threads must not record with the same key at
+ * the same time. reset() keeps all buffer memory for the next frame.
+ */
+class CommandRecorder {
+public:
+    CommandRecorder();
+    ~CommandRecorder();
+
+    CommandRecorder(const CommandRecorder&) = delete;
+    CommandRecorder& operator=(const CommandRecorder&) = delete;
+
+    /**
+     * @brief Get the buffer for an order key, creating it on first use
+     * @param order Position of this buffer in the merged stream
+     * @return Buffer that stays valid until reset()
+     */
+    CommandBuffer& begin(uint32_t order);
+
+    /**
+     * @brief Concatenate all buffers in key order
+     * @param out Receives the merged commands (appended)
+     */
+    void merge(CommandBuffer& out) const;
+
+    /**
+     * @brief Replay all buffers in key order without merging them first
+     */
+    void replay(CommandSink& sink) const;
+
+    /**
+     * @brief Release all buffers for reuse, keeping their memory
+     */
+    void reset();
+
+    /**
+     * @brief Get the number of buffers handed out since reset()
+     */
+    uint32_t getBufferCount() const;
+
+    /**
+     * @brief Get the total number of commands recorded since reset()
+     */
+    uint32_t getCommandCount() const;
+
+private:
+    struct Entry {
+        uint32_t order;
+        CommandBuffer* buffer;
+    };
+
+    std::vector<const Entry*> sortedEntries() const;
+
+    mutable std::mutex m_mutex;
+    std::vector<Entry> m_active;
+    std::vector<std::unique_ptr<CommandBuffer>> m_buffers;   // Owns every buffer, active first
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_COMMANDBUFFER_H
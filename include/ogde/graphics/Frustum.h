@@ -0,0 +1,229 @@
+/**
+ * @file Frustum.h
+ * @brief View frustum planes and batched visibility culling
+ */
+
+#ifndef OGDE_GRAPHICS_FRUSTUM_H
+#define OGDE_GRAPHICS_FRUSTUM_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+namespace graphics {
+
+/**
+ * @struct Plane
+ * @brief Plane in the form nx*x + ny*y + nz*z + d = 0 (normal points inside)
+ */
+struct Plane {
+    float nx = 0.0f;
+    float ny = 0.0f;
+    float nz = 0.0f;
+    float d = 0.0f;
+
+    /**
+     * @brief Signed distance from a point to the plane
+     */
+    float distance(float x, float y, float z) const { return nx * x + ny * y + nz * z + d; }
+};
+
+/**
+ * @class Frustum
+ * @brief Six clipping planes extracted from a view-projection matrix
+ */
+class Frustum {
+public:
+    /**
+     * @enum PlaneIndex
+     * @brief Index of each plane in the frustum
+     */
+    enum PlaneIndex {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        PlaneCount
+    };
+
+    Frustum();
+
+    /**
+     * @brief Extract normalized planes from a view-projection matrix
+     * @param viewProjection 16 floats in the Camera layout (row vectors, clip = v * VP, z in [0, 1])
+     */
+    void extractFromMatrix(const float* viewProjection);
+
+    /**
+     * @brief Get a frustum plane
+     * @param index Plane index
+     * @return Plane reference
+     */
+    const Plane& getPlane(PlaneIndex index) const { return m_planes[index]; }
+
+    /**
+     * @brief Test a point against the frustum
+     * @return true if the point is inside or on the boundary
+     */
+    bool containsPoint(float x, float y, float z) const;
+
+    /**
+     * @brief Test a sphere against the frustum
+     * @return true if the sphere is at least partially inside
+     */
+    bool intersectsSphere(float x, float y, float z, float radius) const;
+
+    /**
+     * @brief Test an axis-aligned box against the frustum
+     * @return true if the box is at least partially inside
+     */
+    bool intersectsAabb(float minX, float minY, float minZ,
+                        float maxX, float maxY, float maxZ) const;
+
+private:
+    Plane m_planes[PlaneCount];
+};
+
+/**
+ * @class AabbBatch
+ * @brief Axis-aligned boxes in structure-of-arrays form for batched culling
+ *
+ * Boxes are stored as center/half-extent arrays padded to a multiple of
+ * kLaneWidth so the culling kernels can always load full SIMD lanes.
+ */
+class AabbBatch {
+public:
+    static constexpr uint32_t kLaneWidth = 8;
+
+    AabbBatch();
+
+    /**
+     * @brief Append a box given its min/max corners
+     * @return Index of the new box
+     */
+    uint32_t add(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+
+    /**
+     * @brief Replace an existing box
+     */
+    void set(uint32_t index, float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+
+    /**
+     * @brief Reserve storage for a number of boxes
+     */
+    void reserve(uint32_t count);
+
+    /**
+     * @brief Remove all boxes
+     */
+    void clear();
+
+    /**
+     * @brief Number of boxes
+     */
+    uint32_t size() const { return m_count; }
+
+    const float* centerX() const { return m_centerX.data(); }
+    const float* centerY() const { return m_centerY.data(); }
+    const float* centerZ() const { return m_centerZ.data(); }
+    const float* extentX() const { return m_extentX.data(); }
+    const float* extentY() const { return m_extentY.data(); }
+    const float* extentZ() const { return m_extentZ.data(); }
+
+private:
+    void resizeStorage(uint32_t count);
+
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_extentX;
+    std::vector<float> m_extentY;
+    std::vector<float> m_extentZ;
+    uint32_t m_count;
+};
+
+/**
+ * @class SphereBatch
+ * @brief Bounding spheres in structure-of-arrays form for batched culling
+ */
+class SphereBatch {
+public:
+    static constexpr uint32_t kLaneWidth = 8;
+
+    SphereBatch();
+
+    /**
+     * @brief Append a sphere
+     * @return Index of the new sphere
+     */
+    uint32_t add(float x, float y, float z, float radius);
+
+    /**
+     * @brief Replace an existing sphere
+     */
+    void set(uint32_t index, float x, float y, float z, float radius);
+
+    /**
+     * @brief Reserve storage for a number of spheres
+     */
+    void reserve(uint32_t count);
+
+    /**
+     * @brief Remove all spheres
+     */
+    void clear();
+
+    /**
+     * @brief Number of spheres
+     */
+    uint32_t size() const { return m_count; }
+
+    const float* centerX() const { return m_centerX.data(); }
+    const float* centerY() const { return m_centerY.data(); }
+    const float* centerZ() const { return m_centerZ.data(); }
+    const float* radius() const { return m_radius.data(); }
+
+private:
+    void resizeStorage(uint32_t count);
+
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_radius;
+    uint32_t m_count;
+};
+
+/**
+ * @brief Cull a batch of boxes against a frustum
+ * @param frustum Frustum to test against
+ * @param boxes Boxes to test
+ * @param outVisible Output array receiving the indices of visible boxes (capacity >= boxes.size())
+ * @return Number of visible boxes written to outVisible
+ */
+uint32_t cullAabbs(const Frustum& frustum, const AabbBatch& boxes, uint32_t* outVisible);
+
+/**
+ * @brief Cull a batch of spheres against a frustum
+ * @param frustum Frustum to test against
+ * @param spheres Spheres to test
+ * @param outVisible Output array receiving the indices of visible spheres (capacity >= spheres.size())
+ * @return Number of visible spheres written to outVisible
+ */
+uint32_t cullSpheres(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outVisible);
+
+/**
+ * @brief Cull boxes into a vector of visible indices (resized to the visible count)
+ */
+void cullAabbs(const Frustum& frustum, const AabbBatch& boxes, std::vector<uint32_t>& outVisible);
+
+/**
+ * @brief Cull spheres into a vector of visible indices (resized to the visible count)
+ */
+void cullSpheres(const Frustum& frustum, const SphereBatch& spheres, std::vector<uint32_t>& outVisible);
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_FRUSTUM_H
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Image formats decoded in-tree
+ */
+enum class ImageFormat {
+    Unknown,
+    Png,
+    Qoi
+};
+
+/**
+ * @brief Header information of an encoded image
+ */
+struct ImageInfo {
+    ImageFormat format = ImageFormat::Unknown;
+    int width = 0;
+    int height = 0;
+    int channels = 0;   ///< Channels Decode() writes by default, matching stb_image
+};
+
+/**
+ * @brief Dedicated PNG and QOI decoders for the texture hot path
+ *
+ * PNG decoding inflates the IDAT stream with table-driven Huffman decoding and
+ * 8-byte match copies, then reverses the row filters with SSE2 kernels for
+ * 3- and 4-byte pixels. Rows are reconstructed directly into the caller's
+ * buffer, in its final layout.
+ *
+ * Supported PNGs are non-interlaced with 8-bit channels, 1/2/4-bit grey or
+ * 1/2/4/8-bit palettes (with or without tRNS). ReadInfo() rejects anything
+ * else (16-bit, Adam7, colour-key transparency) so callers can fall back to
+ * stb_image. Output matches stb_image byte for byte. All QOI files are supported.
+ */
+class ImageDecoder {
+public:
+    /**
+     * @brief Identify a PNG or QOI file from its signature
+     */
+    static ImageFormat DetectFormat(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Parse the header and check the image can be decoded in-tree
+     * @param data Encoded file contents
+     * @param size Size of data in bytes
+     * @param info Receives size and channel count
+     * @return false if the format or its variant is not handled here
+     */
+    static bool ReadInfo(const uint8_t* data, size_t size, ImageInfo& info);
+
+    /**
+     * @brief Decode into a caller-provided buffer
+     * @param data Encoded file contents
+     * @param size Size of data in bytes
+     * @param pixels Receives width * height * channels bytes, rows top-down
+     * @param channels 0 for the file's own layout (ImageInfo::channels) or 4 for RGBA
+     * @return false if the image is unsupported or corrupt
+     */
+    static bool Decode(const uint8_t* data, size_t size, uint8_t* pixels, int channels = 0);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,91 @@
+/**
+ * @file LodSelector.h
+ * @brief Screen-space error based level-of-detail selection
+ */
+
+#ifndef OGDE_GRAPHICS_LODSELECTOR_H
+#define OGDE_GRAPHICS_LODSELECTOR_H
+
+#include <cstdint>
+
+namespace ogde {
+namespace graphics {
+
+class Camera;
+
+/**
+ * @class LodSelector
+ * @brief Picks the coarsest level of detail whose error stays under a pixel threshold
+ *
+ * Levels carry their geometric error in mesh units (MeshData::lodErrors,
+ * non-decreasing). The error is projected to pixels at the closest point of
+ * the object's bounding sphere: error * scale / distance for perspective
+ * cameras, error * scale for orthographic ones, where scale is the viewport
+ * height over the view height at distance 1. A camera inside the sphere gets
+ * level 0.
+ */
+class LodSelector {
+public:
+    LodSelector();
+
+    /**
+     * @brief Take the position and projection from a camera
+     * @param camera Camera whose view is being rendered
+     * @param viewportHeight Render target height in pixels
+     */
+    void setCamera(const Camera& camera, float viewportHeight);
+
+    /**
+     * @brief Set the largest acceptable error in pixels (default 1)
+     */
+    void setErrorThreshold(float pixels) { m_threshold = pixels; }
+
+    float getErrorThreshold() const { return m_threshold; }
+
+    /**
+     * @brief Project a geometric error to pixels
+     * @param error Error in world units
+     * @param x Bounding sphere center X (camera space origin as for Camera::getPosition())
+     * @param y Bounding sphere center Y
+     * @param z Bounding sphere center Z
+     * @param radius Bounding sphere radius
+     * @return Error in pixels
+     */
+    float getScreenError(float error, float x, float y, float z, float radius) const;
+
+    /**
+     * @brief Select a level for one object
+     * @param lodErrors Error of each level in mesh units (level 0 first)
+     * @param lodCount Number of levels
+     * @param x Bounding sphere center X
+     * @param y Bounding sphere center Y
+     * @param z Bounding sphere center Z
+     * @param radius Bounding sphere radius
+     * @param scale Object-to-world scale applied to the errors
+     * @return Level index in [0, lodCount)
+     */
+    uint32_t select(const float* lodErrors, uint32_t lodCount, float x, float y, float z, float radius,
+                    float scale = 1.0f) const;
+
+    /**
+     * @brief Select levels for many instances of one mesh
+     * @param spheres Bounding spheres as x, y, z, radius
+     * @param count Number of spheres
+     * @param lodErrors Error of each level in mesh units
+     * @param lodCount Number of levels (at most 256)
+     * @param outLevels Receives count levels
+     */
+    void selectBatch(const float* spheres, uint32_t count, const float* lodErrors, uint32_t lodCount,
+                     uint8_t* outLevels) const;
+
+private:
+    float m_position[3];
+    float m_projectionScale;    // Pixels per world unit at distance 1 (perspective) or anywhere (orthographic)
+    bool m_orthographic;
+    float m_threshold;
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_LODSELECTOR_H
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "ogde/graphics/MaterialTable.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Parameters a MaterialInstance can override
+ *
+ * The texture entries follow the order of Material::TextureType.
+ */
+enum class MaterialParam : uint8_t {
+    DiffuseColor,
+    AmbientColor,
+    SpecularColor,
+    Shininess,
+    Opacity,
+    DiffuseMap,
+    NormalMap,
+    SpecularMap,
+    EmissiveMap,
+    AmbientMap,
+    HeightMap,
+    Count
+};
+
+/**
+ * @brief Lightweight variant of a MaterialTable material
+ *
+ * An instance names a parent material and stores only the parameters it
+ * overrides. Resolve() builds the flat MaterialParams block (parent values
+ * with the overrides applied) on first use and caches it until an override
+ * changes or the parent's version moves on, so resolving every frame costs
+ * one version comparison.
+ *
+ * Overrides and the resolved block live in a shared, copy-on-write record:
+ * copying an instance copies a pointer, and the copies share a single cache
+ * until one of them is modified. An unmodified copy is 24 bytes; a tinted
+ * variant adds one override record instead of a full Material with its
+ * name string and texture map.
+ *
+ * If the parent is destroyed, instances resolve against default parameters.
+ * The table must outlive its instances. Not thread-safe.
+ */
+class MaterialInstance {
+public:
+    /**
+     * @brief Create an instance with no table; Resolve() returns defaults
+     */
+    MaterialInstance();
+
+    /**
+     * @brief Create an instance of a table material with no overrides
+     * @param table Table holding the parent
+     * @param parent Parent material
+     */
+    MaterialInstance(const MaterialTable& table, MaterialHandle parent);
+
+    ~MaterialInstance();
+
+    // Copies share overrides until either side writes
+    MaterialInstance(const MaterialInstance& other);
+    MaterialInstance& operator=(const MaterialInstance& other);
+    MaterialInstance(MaterialInstance&& other) noexcept;
+    MaterialInstance& operator=(MaterialInstance&& other) noexcept;
+
+    /**
+     * @brief Point the instance at another material of the same table, keeping its overrides
+     */
+    void SetParent(MaterialHandle parent);
+
+    /**
+     * @brief Get the parent material
+     */
+    MaterialHandle GetParent() const;
+
+    void SetDiffuseColor(float r, float g, float b, float a = 1.0f);
+    void SetAmbientColor(float r, float g, float b);
+    void SetSpecularColor(float r, float g, float b);
+    void SetShininess(float shininess);
+    void SetOpacity(float opacity);
+
+    /**
+     * @brief Override a texture slot
+     * @param type Slot to override
+     * @param texture Texture handle; kInvalidTextureHandle overrides the slot to unbound
+     */
+    void SetTexture(Material::TextureType type, TextureHandle texture);
+
+    /**
+     * @brief Check whether a parameter is overridden
+     */
+    bool IsOverridden(MaterialParam param) const;
+
+    /**
+     * @brief Drop one override so the parameter follows the parent again
+     */
+    void ClearOverride(MaterialParam param);
+
+    /**
+     * @brief Drop every override
+     */
+    void ClearOverrides();
+
+    /**
+     * @brief Get the number of overridden parameters
+     */
+    uint32_t GetOverrideCount() const;
+
+    /**
+     * @brief Check whether the next Resolve() has to rebuild the cached block
+     */
+    bool NeedsResolve() const;
+
+    /**
+     * @brief Get the parent's parameters with the overrides applied
+     * @return Cached block, valid until the instance or its parent changes
+     */
+    const MaterialParams& Resolve() const;
+
+private:
+    struct Override {
+        MaterialParam param;
+        uint32_t value[4];      // Raw float or handle bits, as many as the parameter uses
+    };
+
+    struct Data {
+        MaterialHandle parent = kInvalidMaterialHandle;
+        uint32_t overrideMask = 0;      // Bit per MaterialParam
+        std::vector<Override> overrides;
+        uint64_t resolvedVersion = 0;   // Parent version the cache was built from
+        bool resolvedValid = false;
+        MaterialParams resolved;
+    };
+
+    Data& MutableData();
+    void SetOverride(MaterialParam param, const void* value);
+
+    const MaterialTable* table_ = nullptr;
+    std::shared_ptr<Data> data_;
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "ogde/graphics/Material.h"
+#include "ogde/graphics/TextureLoader.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Handle to a material stored in a MaterialTable (0 = invalid)
+ */
+using MaterialHandle = uint32_t;
+constexpr MaterialHandle kInvalidMaterialHandle = 0;
+
+/// Texture slots per material, indexed by Material::TextureType
+constexpr int kMaterialTextureSlots = 6;
+
+/**
+ * @brief Parameters of one material in constant-buffer layout
+ *
+ * Members are grouped into 16-byte registers following HLSL cbuffer packing,
+ * so an array of these matches this declaration with no padding fix-ups:
+ *
+ *     struct MaterialParams {
+ *         float4 diffuseColor;
+ *         float3 ambientColor;  float opacity;
+ *         float3 specularColor; float shininess;
+ *         uint4  textures0;     // slots 0-3
+ *         uint2  textures1;     // slots 4-5
+ *         uint   textureMask;
+ *         uint   reserved;
+ *     };
+ */
+struct alignas(16) MaterialParams {
+    float diffuseColor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    float ambientColor[3] = {0.2f, 0.2f, 0.2f};
+    float opacity = 1.0f;
+    float specularColor[3] = {1.0f, 1.0f, 1.0f};
+    float shininess = 32.0f;
+    TextureHandle textures[kMaterialTextureSlots] = {};
+    uint32_t textureMask = 0;   ///< Bit i set when textures[i] is bound
+    uint32_t reserved = 0;
+};
+
+static_assert(sizeof(MaterialParams) == 80, "MaterialParams must stay a whole number of 16-byte registers");
+
+/**
+ * @brief Dense, handle-addressed storage for material parameters
+ *
+ * All materials live in one contiguous MaterialParams array that can be
+ * uploaded to a structured or constant buffer with a single copy. Handles
+ * are 32-bit (24-bit slot index, 8-bit generation), so stale handles to a
+ * destroyed material are rejected rather than aliasing a new one.
+ *
+ * Destroy() keeps the array dense by moving the last material into the hole,
+ * so a material's array index (GetIndex()) can change; resolve indices when
+ * building a frame rather than storing them. Handles never change.
+ *
+ * Every write widens a dirty range that the renderer can upload and then
+ * clear. Textures are referenced by handle only; the table owns no GPU data.
+ * Not thread-safe.
+ */
+class MaterialTable {
+public:
+    /// Maps a Material's texture to a handle when importing
+    using TextureResolver = std::function<TextureHandle(const std::shared_ptr<Texture>& texture)>;
+
+    MaterialTable();
+    ~MaterialTable();
+
+    // Disable copy
+    MaterialTable(const MaterialTable&) = delete;
+    MaterialTable& operator=(const MaterialTable&) = delete;
+
+    /**
+     * @brief Add a material with default parameters
+     * @param name Debug name, kept outside the parameter array
+     * @return Handle valid until Destroy()
+     */
+    MaterialHandle Create(const std::string& name = std::string());
+
+    /**
+     * @brief Add a material with the parameters of a Material
+     * @param material Source material
+     * @param resolveTexture Turns each bound texture into a handle; may be empty to skip textures
+     * @return Handle valid until Destroy()
+     */
+    MaterialHandle Import(const Material& material, const TextureResolver& resolveTexture = TextureResolver());
+
+    /**
+     * @brief Remove a material; the last material takes its array index
+     * @param handle Material to remove (stale handles are ignored)
+     */
+    void Destroy(MaterialHandle handle);
+
+    /**
+     * @brief Check that a handle refers to a live material
+     */
+    bool IsValid(MaterialHandle handle) const;
+
+    /**
+     * @brief Get a material's position in the parameter array
+     * @return Index for GetData(), or UINT32_MAX for a stale handle
+     */
+    uint32_t GetIndex(MaterialHandle handle) const;
+
+    /**
+     * @brief Get the parameters of a material
+     * @return Parameters, or nullptr for a stale handle
+     */
+    const MaterialParams* Get(MaterialHandle handle) const;
+
+    /**
+     * @brief Get writable parameters and mark them dirty
+     *
+     * The material's version is bumped now, so call Edit() again for changes
+     * made after dependants (e.g. MaterialInstance) have resolved it.
+     * @return Parameters, or nullptr for a stale handle
+     */
+    MaterialParams* Edit(MaterialHandle handle);
+
+    void SetDiffuseColor(MaterialHandle handle, float r, float g, float b, float a = 1.0f);
+    void SetAmbientColor(MaterialHandle handle, float r, float g, float b);
+    void SetSpecular(MaterialHandle handle, float r, float g, float b, float shininess);
+    void SetOpacity(MaterialHandle handle, float opacity);
+
+    /**
+     * @brief Bind a texture handle to a slot
+     * @param handle Material to change
+     * @param type Slot to bind
+     * @param texture Texture handle, or kInvalidTextureHandle to clear the slot
+     */
+    void SetTexture(MaterialHandle handle, Material::TextureType type, TextureHandle texture);
+
+    /**
+     * @brief Get the texture bound to a slot
+     * @return Texture handle, or kInvalidTextureHandle if unbound or the material is stale
+     */
+    TextureHandle GetTexture(MaterialHandle handle, Material::TextureType type) const;
+
+    /**
+     * @brief Get a counter that changes whenever a material is written
+     *
+     * Values are unique across the table, so a material destroyed and
+     * recreated in the same slot never repeats an earlier version.
+     * @return Version, or 0 for a stale handle
+     */
+    uint64_t GetVersion(MaterialHandle handle) const;
+
+    /**
+     * @brief Get a material's debug name
+     */
+    const std::string& GetName(MaterialHandle handle) const;
+
+    /**
+     * @brief Get the material handle stored at an array index
+     */
+    MaterialHandle GetHandle(uint32_t index) const;
+
+    /**
+     * @brief Get the parameter array, GetCount() entries long
+     */
+    const MaterialParams* GetData() const { return params_.data(); }
+
+    /**
+     * @brief Get the number of live materials
+     */
+    uint32_t GetCount() const { return static_cast<uint32_t>(params_.size()); }
+
+    /**
+     * @brief Get the size of the parameter array in bytes
+     */
+    size_t GetDataSize() const { return params_.size() * sizeof(MaterialParams); }
+
+    /**
+     * @brief Get the array range written since the last ClearDirty()
+     * @param begin First dirty index
+     * @param end One past the last dirty index (equal to begin when clean)
+     */
+    void GetDirtyRange(uint32_t& begin, uint32_t& end) const;
+
+    /**
+     * @brief Mark the whole array as uploaded
+     */
+    void ClearDirty();
+
+private:
+    struct Slot {
+        uint32_t index = 0;         // Position in params_
+        uint32_t generation = 0;
+        uint64_t version = 0;       // changeCounter_ at the last write
+        bool inUse = false;
+    };
+
+    const Slot* FindSlot(MaterialHandle handle) const;
+    MaterialParams* EditIndex(uint32_t index);
+
+    std::vector<MaterialParams> params_;    // Dense, upload-ready
+    std::vector<MaterialHandle> handles_;   // Handle of each params_ entry
+    std::vector<std::string> names_;        // Parallel to params_, never uploaded
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> freeSlots_;
+    uint32_t dirtyBegin_ = 0;
+    uint32_t dirtyEnd_ = 0;
+    uint64_t changeCounter_ = 0;
+};
+
+} // namespace Graphics
+} // namespace OGDE
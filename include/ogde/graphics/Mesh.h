@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Interleaved vertex of an indexed mesh (32 bytes)
+ */
+struct MeshVertex {
+    float position[3];
+    float normal[3];
+    float texCoord[2];
+};
+
+static_assert(sizeof(MeshVertex) == 32, "MeshVertex is tightly packed");
+
+/**
+ * @brief Compressed GPU vertex (16 bytes)
+ *
+ * Positions are unorm16 within the mesh bounds (R16G16B16A16_UNORM, w unused),
+ * normals are octahedral-encoded snorm16 (R16G16_SNORM) and texture coordinates
+ * are half floats (R16G16_FLOAT). See MeshOptimizer::Quantize().
+ */
+struct QuantizedVertex {
+    uint16_t position[4];
+    int16_t normal[2];
+    uint16_t texCoord[2];
+};
+
+static_assert(sizeof(QuantizedVertex) == 16, "QuantizedVertex is tightly packed");
+
+/**
+ * @brief Small triangle cluster with bounds for per-cluster culling (64 bytes)
+ *
+ * Vertices are meshletVertices[vertexOffset, vertexOffset + vertexCount), indices
+ * into MeshData::vertices. Triangles are triangleCount triples of local vertex
+ * numbers starting at meshletTriangles[triangleOffset * 3]. The cluster faces
+ * away from a camera at position c when dot(normalize(coneApex - c), coneAxis)
+ * >= coneCutoff; a cutoff of 1 or more means the normals spread too wide to cull.
+ * See MeshletBuilder::Build().
+ */
+struct Meshlet {
+    uint32_t vertexOffset;
+    uint32_t triangleOffset;
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    float center[3];            ///< Bounding sphere
+    float radius;
+    float coneApex[3];
+    float coneCutoff;
+    float coneAxis[3];
+    uint32_t reserved;
+};
+
+static_assert(sizeof(Meshlet) == 64, "Meshlet is tightly packed");
+
+/**
+ * @brief Contiguous index range drawn with one material
+ */
+struct SubMesh {
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+    std::string material;       ///< Material name from the source file (may be empty)
+    uint32_t lod = 0;           ///< Level of detail this range belongs to (0 = full detail)
+    uint32_t meshletOffset = 0; ///< First meshlet covering this range (MeshData::meshlets)
+    uint32_t meshletCount = 0;  ///< 0 if meshlets were not built
+};
+
+/**
+ * @brief CPU-side indexed triangle mesh
+ *
+ * Triangle list with 32-bit indices into deduplicated vertices. Sub-meshes
+ * partition the index buffer by material in the order materials first appear.
+ * Simplified levels of detail (MeshSimplifier::GenerateLods()) append their
+ * own sub-meshes and indices, sharing the vertex array with level 0.
+ * Meshlets (MeshletBuilder::Build()) cover each sub-mesh's triangles a second
+ * time, as clusters that can be culled individually.
+ */
+struct MeshData {
+    std::vector<MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<SubMesh> subMeshes;
+    std::vector<QuantizedVertex> quantizedVertices;    ///< GPU format when quantized, parallel to vertices
+    std::vector<float> lodErrors;   ///< Deviation of each level from level 0 in mesh units; empty = level 0 only
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> meshletVertices;     ///< Vertex indices referenced by meshlets
+    std::vector<uint8_t> meshletTriangles;     ///< Local vertex numbers, three per meshlet triangle
+    float boundsMin[3] = { 0.0f, 0.0f, 0.0f };
+    float boundsMax[3] = { 0.0f, 0.0f, 0.0f };
+    bool hasNormals = false;    ///< false if normals are zero
+    bool hasTexCoords = false;  ///< false if texture coordinates are zero
+
+    /// Triangles of all levels of detail together
+    size_t GetTriangleCount() const { return indices.size() / 3; }
+
+    uint32_t GetLodCount() const { return lodErrors.empty() ? 1u : static_cast<uint32_t>(lodErrors.size()); }
+
+    /**
+     * @brief Recompute boundsMin/boundsMax from the vertex positions
+     */
+    void ComputeBounds();
+};
+
+} // namespace Graphics
+} // namespace OGDE
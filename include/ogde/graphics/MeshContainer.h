@@ -0,0 +1,125 @@
+#pragma once
+
+#include "ogde/graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OGDE {
+namespace Graphics {
+
+/// File magic of .ogmesh containers ("OGMS" in little-endian byte order)
+constexpr uint32_t kOgmeshMagic = 0x534D474F;
+
+/// Current .ogmesh version; readers reject any other version
+constexpr uint32_t kOgmeshVersion = 3;
+
+/// Vertex and index arrays start on a cache-line boundary
+constexpr size_t kOgmeshPayloadAlignment = 64;
+
+/// Header flags
+constexpr uint32_t kOgmeshHasNormals = 1u << 0;
+constexpr uint32_t kOgmeshHasTexCoords = 1u << 1;
+constexpr uint32_t kOgmeshQuantized = 1u << 2;     ///< Vertices are QuantizedVertex, positions relative to the bounds
+constexpr uint32_t kOgmeshMeshlets = 1u << 3;      ///< A meshlet section follows the indices
+
+/**
+ * @brief Fixed 64-byte header at the start of an .ogmesh file
+ *
+ * All fields are little-endian. The header is followed by subMeshCount
+ * OgmeshSubMesh entries, then the MeshVertex (or QuantizedVertex) array at
+ * vertexOffset and the uint32 index array at indexOffset. With
+ * kOgmeshMeshlets, an OgmeshMeshletSection starts at the next aligned offset
+ * after the indices, followed by its Meshlet array, the uint32 meshlet
+ * vertices and the byte triangles.
+ */
+struct OgmeshHeader {
+    uint32_t magic = kOgmeshMagic;
+    uint32_t version = kOgmeshVersion;
+    uint32_t vertexCount = 0;
+    uint32_t indexCount = 0;
+    uint32_t subMeshCount = 0;
+    uint32_t flags = 0;         ///< kOgmeshHasNormals | kOgmeshHasTexCoords | kOgmeshQuantized | kOgmeshMeshlets
+    uint64_t vertexOffset = 0;  ///< Byte offset of the vertices from the start of the file
+    uint64_t indexOffset = 0;   ///< Byte offset of the indices from the start of the file
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+};
+
+/**
+ * @brief Sub-mesh table entry; the material name is null-terminated
+ */
+struct OgmeshSubMesh {
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+    uint32_t lod = 0;           ///< Level of detail of this range
+    float lodError = 0.0f;      ///< Error of that level in mesh units (MeshData::lodErrors)
+    uint32_t meshletOffset = 0;
+    uint32_t meshletCount = 0;
+    char material[48] = {};
+};
+
+/**
+ * @brief Counts at the start of the meshlet section
+ */
+struct OgmeshMeshletSection {
+    uint32_t meshletCount = 0;
+    uint32_t vertexCount = 0;   ///< Entries of MeshData::meshletVertices
+    uint32_t triangleCount = 0; ///< Byte triples of MeshData::meshletTriangles
+    uint32_t reserved = 0;
+};
+
+static_assert(sizeof(OgmeshHeader) == 64, "OgmeshHeader layout must not change");
+static_assert(sizeof(OgmeshSubMesh) == 72, "OgmeshSubMesh layout must not change");
+static_assert(sizeof(OgmeshMeshletSection) == 16, "OgmeshMeshletSection layout must not change");
+
+/**
+ * @brief Reader and writer for the engine-native .ogmesh container
+ *
+ * An .ogmesh file holds a mesh exactly as it is uploaded: deduplicated
+ * MeshVertex data and 32-bit triangle-list indices, grouped into sub-meshes.
+ * Reading one is a memory map, header validation and two copies; there is
+ * no text parsing at runtime.
+ */
+class MeshContainer {
+public:
+    /**
+     * @brief Write a mesh to disk
+     * @param filepath Destination path, conventionally with the .ogmesh extension
+     * @param mesh Source mesh; material names longer than 47 characters are truncated.
+     *             Its quantized vertices are written instead of the floats when present,
+     *             and its meshlets when built.
+     * @return true if successful
+     */
+    static bool Write(const std::string& filepath, const MeshData& mesh);
+
+    /**
+     * @brief Validate an .ogmesh image in memory and copy it out
+     *
+     * Checks the magic, version, that both arrays lie inside the buffer, that
+     * every index references a vertex and that sub-meshes stay in the index range.
+     * Meshlets must stay inside their arrays and reference valid vertices.
+     * Quantized files fill both quantizedVertices and the decoded vertices.
+     * @param data Start of the file contents
+     * @param size Size of the file contents
+     * @param outMesh Receives the mesh
+     * @return true if the data is a valid container
+     */
+    static bool Parse(const uint8_t* data, size_t size, MeshData& outMesh);
+
+    /**
+     * @brief Memory-map and parse an .ogmesh file
+     * @param filepath Path to the .ogmesh file
+     * @param outMesh Receives the mesh
+     * @return true if successful
+     */
+    static bool Read(const std::string& filepath, MeshData& outMesh);
+
+    /**
+     * @brief Check whether a path has the .ogmesh extension (case-insensitive)
+     */
+    static bool IsContainerPath(const std::string& filepath);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "ogde/graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Steps run by MeshOptimizer::Optimize()
+ */
+struct MeshOptimizeSettings {
+    /// Reorder triangles for the post-transform vertex cache (Tipsify)
+    bool vertexCache = true;
+
+    /// Reorder triangle clusters so outward-facing ones draw first
+    bool overdraw = true;
+
+    /// ACMR the overdraw pass may give up, as a factor of the cache-optimized ACMR
+    float overdrawThreshold = 1.05f;
+
+    /// Reorder vertices in first-use order and drop unreferenced ones
+    bool vertexFetch = true;
+
+    /// Fill MeshData::quantizedVertices
+    bool quantize = false;
+
+    /// Cache size the triangle order is tuned for
+    uint32_t cacheSize = 16;
+};
+
+/**
+ * @brief Before/after figures of MeshOptimizer::Optimize()
+ */
+struct MeshOptimizeReport {
+    float acmrBefore = 0.0f;        ///< Vertex shader invocations per triangle
+    float acmrAfter = 0.0f;
+    float atvrBefore = 0.0f;        ///< Vertex shader invocations per vertex (1.0 is optimal)
+    float atvrAfter = 0.0f;
+    uint32_t verticesBefore = 0;
+    uint32_t verticesAfter = 0;
+    uint32_t clusters = 0;          ///< Triangle clusters sorted by the overdraw pass
+    size_t vertexBytesBefore = 0;
+    size_t vertexBytesAfter = 0;    ///< Quantized size if quantization ran
+};
+
+/**
+ * @brief Offline mesh optimization for GPU vertex processing
+ *
+ * Optimize() runs, per sub-mesh:
+ * 1. Tipsify (Sander et al. 2007): fans around a moving vertex and
+ *    picks the next vertex by cache age and remaining valence, giving near
+ *    optimal ACMR in linear time without tuning for one cache model.
+ * 2. Overdraw ordering: the cache-optimized order is cut into clusters,
+ *    split further while the ACMR stays within the threshold, and the
+ *    clusters are sorted so the ones facing away from the mesh center
+ *    (the likely occluders) are drawn first.
+ * 3. Vertex fetch: vertices are renumbered in first-use order of the
+ *    final index buffer, so vertex fetches walk memory linearly.
+ *
+ * Triangle winding is preserved; only the order of triangles and vertices changes.
+ */
+class MeshOptimizer {
+public:
+    /**
+     * @brief Run the configured steps on a mesh
+     * @param mesh Mesh to optimize in place
+     * @param settings Steps to run
+     * @param outReport Receives before/after figures (optional)
+     */
+    static void Optimize(MeshData& mesh, const MeshOptimizeSettings& settings = MeshOptimizeSettings(),
+                         MeshOptimizeReport* outReport = nullptr);
+
+    /**
+     * @brief Reorder the triangles of an index list for the vertex cache (Tipsify)
+     * @param indices Triangle list, reordered in place
+     * @param indexCount Number of indices (a multiple of 3)
+     * @param vertexCount One past the largest index
+     * @param cacheSize Cache size to tune for
+     */
+    static void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = 16);
+
+    /**
+     * @brief Reorder cache-optimized triangle clusters to reduce overdraw
+     * @param indices Triangle list already ordered by OptimizeVertexCache(), reordered in place
+     * @param indexCount Number of indices (a multiple of 3)
+     * @param vertices Vertex positions
+     * @param vertexCount Number of vertices
+     * @param threshold Allowed ACMR increase factor (1.0 keeps the cache-optimal clusters)
+     * @param cacheSize Cache size used to find cluster boundaries
+     * @return Number of clusters
+     */
+    static uint32_t OptimizeOverdraw(uint32_t* indices, size_t indexCount, const MeshVertex* vertices,
+                                     size_t vertexCount, float threshold = 1.05f, uint32_t cacheSize = 16);
+
+    /**
+     * @brief Renumber vertices in first-use order and drop unreferenced ones
+     * @param mesh Mesh whose vertices, indices and meshlet vertices are rewritten
+     * @return New vertex count
+     */
+    static uint32_t OptimizeVertexFetch(MeshData& mesh);
+
+    /**
+     * @brief Average cache miss ratio of an index list with a FIFO cache
+     * @param indices Triangle list
+     * @param indexCount Number of indices
+     * @param vertexCount One past the largest index
+     * @param cacheSize FIFO entries
+     * @return Vertex shader invocations per triangle (0.5 is the limit for grids, 3.0 the worst)
+     */
+    static float ComputeACMR(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize = 16);
+
+    /**
+     * @brief Fill mesh.quantizedVertices from the float vertices
+     *
+     * Positions are quantized within the mesh bounds, which must be current.
+     */
+    static void Quantize(MeshData& mesh);
+
+    /**
+     * @brief Decode quantized vertices back to floats
+     * @param packed Quantized vertices
+     * @param count Number of vertices
+     * @param boundsMin Bounds the positions were quantized in
+     * @param boundsMax Bounds the positions were quantized in
+     * @param outVertices Receives count vertices
+     */
+    static void Dequantize(const QuantizedVertex* packed, size_t count, const float boundsMin[3],
+                           const float boundsMax[3], MeshVertex* outVertices);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "ogde/graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Options for one simplification
+ */
+struct SimplifySettings {
+    /// Fraction of the triangles to keep
+    float targetRatio = 0.5f;
+
+    /// Largest allowed deviation, relative to the bounding box diagonal
+    float maxError = 0.02f;
+
+    /// Keep vertices on open boundaries in place, so neighboring meshes and sub-meshes do not crack
+    bool lockBorders = true;
+
+    /// Weight of normal differences against position error (positions are normalized to the mesh size)
+    float normalWeight = 0.25f;
+
+    /// Weight of texture coordinate differences against position error
+    float texCoordWeight = 0.5f;
+};
+
+/**
+ * @brief Options for building a LOD chain
+ */
+struct LodSettings {
+    /// Levels including level 0
+    uint32_t maxLevels = 4;
+
+    /// Triangle ratio between consecutive levels
+    float reduction = 0.5f;
+
+    /// Simplification limits; targetRatio is derived from reduction per level
+    SimplifySettings simplify;
+
+    /// Stop when a level would keep more than this fraction of the previous level's triangles
+    float minReduction = 0.85f;
+};
+
+/**
+ * @brief Quadric error metric mesh simplification
+ *
+ * Edges are collapsed onto one of their vertices (half-edge collapses), so
+ * simplified index lists reuse the source vertices and every level of detail
+ * shares one vertex buffer. Costs come from generalized quadrics (Garland &
+ * Heckbert 1998) over position, normal and texture coordinate, so collapses
+ * that smear attributes are postponed. Vertices on attribute seams (one
+ * position, several vertices) never move, keeping seams sharp. With
+ * lockBorders, vertices on open boundaries never move either; otherwise they
+ * may only slide along the boundary. Collapses that flip a triangle are
+ * rejected.
+ *
+ * The reported error is the deviation from the source surface in mesh units,
+ * measured with plain plane quadrics.
+ */
+class MeshSimplifier {
+public:
+    /**
+     * @brief Simplify a triangle list
+     * @param mesh Source vertices (positions, normals, texture coordinates)
+     * @param indices Triangle list referencing mesh.vertices
+     * @param indexCount Number of indices
+     * @param settings Target and limits
+     * @param outIndices Receives the simplified triangle list (a subset of the source vertices)
+     * @return Geometric error of the result in mesh units
+     */
+    static float Simplify(const MeshData& mesh, const uint32_t* indices, size_t indexCount,
+                          const SimplifySettings& settings, std::vector<uint32_t>& outIndices);
+
+    /**
+     * @brief Append simplified levels of detail to a mesh
+     *
+     * Each level simplifies every level-0 sub-mesh separately from the
+     * original triangles, appends the results to the index buffer as
+     * sub-meshes tagged with the level, and records the level's error in
+     * mesh.lodErrors (non-decreasing). Existing levels other than 0 are
+     * replaced, and meshlets are dropped; build them after the LODs.
+     * @param mesh Mesh to extend
+     * @param settings Chain length and limits
+     * @return Number of levels including level 0
+     */
+    static uint32_t GenerateLods(MeshData& mesh, const LodSettings& settings = LodSettings());
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ogde/graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Limits and preferences for meshlet building
+ */
+struct MeshletSettings {
+    /// Vertices per meshlet (at most 256, local indices are bytes)
+    uint32_t maxVertices = 64;
+
+    /// Triangles per meshlet (124 keeps 64-vertex meshlets inside common mesh shader limits)
+    uint32_t maxTriangles = 124;
+
+    /// Preference for triangles facing like the meshlet over ones adding no vertices (0 = ignore
+    /// normals); tighter normal cones let more clusters be backface culled
+    float coneWeight = 0.5f;
+};
+
+/**
+ * @brief Splits mesh triangles into small clusters with culling bounds
+ *
+ * Every sub-mesh is covered separately, so a meshlet never mixes materials or
+ * levels of detail. A meshlet grows from a seed triangle by repeatedly adding
+ * the neighboring triangle that needs the fewest new vertices, with ties
+ * broken by how closely its normal follows the meshlet's, until either limit
+ * is reached. Each meshlet gets a bounding sphere and a normal cone
+ * (axis, cutoff and apex) for backface culling of the whole cluster.
+ *
+ * The index buffer is left untouched; meshlets reference the same vertices.
+ */
+class MeshletBuilder {
+public:
+    /**
+     * @brief Build meshlets for every sub-mesh, replacing existing ones
+     * @param mesh Mesh whose meshlets, meshletVertices, meshletTriangles and
+     *             sub-mesh meshlet ranges are filled
+     * @param settings Limits
+     * @return Number of meshlets
+     */
+    static size_t Build(MeshData& mesh, const MeshletSettings& settings = MeshletSettings());
+
+    /**
+     * @brief Recompute the bounding sphere and normal cone of a meshlet from its triangles
+     * @param mesh Mesh holding the vertices and meshlet arrays
+     * @param meshlet Meshlet whose bounds are written
+     */
+    static void ComputeBounds(const MeshData& mesh, Meshlet& meshlet);
+};
+
+} // namespace Graphics
+} // namespace OGDE
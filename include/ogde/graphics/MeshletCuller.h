@@ -0,0 +1,124 @@
+/**
+ * @file MeshletCuller.h
+ * @brief Per-cluster frustum and backface culling of meshlets on the CPU
+ */
+
+#ifndef OGDE_GRAPHICS_MESHLETCULLER_H
+#define OGDE_GRAPHICS_MESHLETCULLER_H
+
+#include "ogde/graphics/Frustum.h"
+#include "ogde/graphics/Mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+
+namespace core {
+class JobSystem;
+}
+
+namespace graphics {
+
+class Camera;
+
+/**
+ * @struct MeshletCullStats
+ * @brief Counters accumulated since the last setCamera()
+ */
+struct MeshletCullStats {
+    uint32_t testedMeshlets = 0;
+    uint32_t frustumCulled = 0;         ///< Bounding sphere outside a frustum plane
+    uint32_t backfaceCulled = 0;        ///< Every triangle faces away from the camera
+    uint32_t visibleTriangles = 0;      ///< Triangles written to the output index lists
+};
+
+/**
+ * @class MeshletCuller
+ * @brief Culls the meshlets of a sub-mesh and writes the survivors as one index list
+ *
+ * Usage per frame: setCamera(), then cull() once per drawn sub-mesh. Each
+ * meshlet's bounding sphere is tested against the camera frustum and its
+ * normal cone against the camera position (the view direction for
+ * orthographic cameras). Surviving triangles are expanded to a plain
+ * triangle list of mesh vertex indices, ready to upload and draw in place of
+ * the sub-mesh's static index range.
+ *
+ * Frustum tests are exact under any affine object transform; cone tests
+ * assume the transform has no non-uniform scale.
+ */
+class MeshletCuller {
+public:
+    MeshletCuller();
+
+    /**
+     * @brief Set the job system used for large sub-meshes (nullptr = single-threaded)
+     */
+    void setJobSystem(core::JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
+    /**
+     * @brief Enable or disable the normal cone test (default enabled)
+     *
+     * Disable it for materials rendered without backface culling.
+     */
+    void setBackfaceCulling(bool enabled) { m_backfaceCulling = enabled; }
+
+    /**
+     * @brief Capture the frustum and position of a camera and reset the stats
+     * @param camera Camera to cull for (must be updated)
+     */
+    void setCamera(const Camera& camera);
+
+    /**
+     * @brief Cull the meshlets of one sub-mesh
+     * @param mesh Mesh with meshlets built (MeshletBuilder::Build())
+     * @param subMesh Sub-mesh of mesh whose meshlets are tested
+     * @param outIndices Receives the visible triangles (capacity >= subMesh.indexCount)
+     * @param worldMatrix Optional 4x4 object-to-world matrix in the Camera layout
+     * @return Number of indices written
+     */
+    uint32_t cull(const OGDE::Graphics::MeshData& mesh, const OGDE::Graphics::SubMesh& subMesh,
+                  uint32_t* outIndices, const float* worldMatrix = nullptr);
+
+    /**
+     * @brief Cull into a vector of indices (resized to the visible count)
+     */
+    void cull(const OGDE::Graphics::MeshData& mesh, const OGDE::Graphics::SubMesh& subMesh,
+              std::vector<uint32_t>& outIndices, const float* worldMatrix = nullptr);
+
+    /**
+     * @brief Test one meshlet in world space
+     * @return true if the meshlet may be visible
+     */
+    bool isVisible(const OGDE::Graphics::Meshlet& meshlet) const;
+
+    const MeshletCullStats& getStats() const { return m_stats; }
+
+private:
+    // Camera state in the space of the meshlets being culled
+    struct View {
+        Plane planes[Frustum::PlaneCount];
+        float position[3];
+        float direction[3];
+    };
+
+    enum Result {
+        Visible,
+        OutsideFrustum,
+        Backfacing
+    };
+
+    Result test(const View& view, const OGDE::Graphics::Meshlet& meshlet) const;
+    void makeObjectView(const float* worldMatrix, View& outView) const;
+
+    View m_world;
+    bool m_orthographic;
+    bool m_backfaceCulling;
+    core::JobSystem* m_jobSystem;
+    MeshletCullStats m_stats;
+    std::vector<uint8_t> m_visible;    // Per-meshlet result of the current cull()
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_MESHLETCULLER_H
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+namespace core {
+class JobSystem;
+}
+}
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Downsampling filter used for mip generation
+ */
+enum class MipFilter {
+    Box,    ///< 2x2 average; fastest, slightly blurry
+    Kaiser  ///< Kaiser-windowed sinc over 12 taps; sharper, less aliasing
+};
+
+/**
+ * @brief Options for mip chain generation
+ */
+struct MipSettings {
+    MipFilter filter = MipFilter::Box;
+
+    /// Color channels are sRGB-encoded and are filtered in linear space.
+    /// Alpha (the 2nd channel of 2-channel and 4th of 4-channel images) is always linear.
+    bool srgb = true;
+
+    /// Maximum number of levels including the base level (0 = full chain down to 1x1)
+    int maxLevels = 0;
+
+    /// Kaiser window shape; larger values trade sharpness for less ringing
+    float kaiserAlpha = 4.0f;
+
+    /// Optional job system to filter rows in parallel (nullptr = calling thread only)
+    ogde::core::JobSystem* jobSystem = nullptr;
+};
+
+/**
+ * @brief Location of one mip level inside a contiguous pixel buffer
+ */
+struct MipLevel {
+    int width = 0;
+    int height = 0;
+    size_t offset = 0;  ///< Byte offset of the level in the buffer
+    size_t size = 0;    ///< Byte size of the level (tightly packed rows)
+};
+
+/**
+ * @brief Builds mip chains for 8-bit textures on the CPU
+ *
+ * Level sizes follow the D3D convention: each level is max(1, floor(previous / 2)).
+ * Filters run on SSE2/AVX2 when available. Used by Texture at load time and by
+ * the asset pipeline.
+ */
+class MipGenerator {
+public:
+    /**
+     * @brief Number of levels in a full chain for the given size
+     */
+    static int CalculateLevelCount(int width, int height);
+
+    /**
+     * @brief Downsample one level into the next
+     * @param src Source pixels (tightly packed, channels bytes per pixel)
+     * @param srcWidth Source width
+     * @param srcHeight Source height
+     * @param channels Channels per pixel (1-4)
+     * @param dst Destination for max(1, srcWidth / 2) x max(1, srcHeight / 2) pixels
+     * @param settings Filter settings
+     * @return true on success
+     */
+    static bool Downsample(const uint8_t* src, int srcWidth, int srcHeight, int channels,
+                           uint8_t* dst, const MipSettings& settings = MipSettings());
+
+    /**
+     * @brief Generate a complete mip chain
+     * @param base Base level pixels
+     * @param width Base width
+     * @param height Base height
+     * @param channels Channels per pixel (1-4)
+     * @param settings Filter settings
+     * @param outPixels Receives all levels, base level first, tightly packed
+     * @param outLevels Receives the location of each level in outPixels
+     * @return true on success
+     */
+    static bool GenerateChain(const uint8_t* base, int width, int height, int channels,
+                              const MipSettings& settings,
+                              std::vector<uint8_t>& outPixels, std::vector<MipLevel>& outLevels);
+};
+
+} // namespace Graphics
+} // namespace OGDE
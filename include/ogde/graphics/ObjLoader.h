@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ogde/graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ogde {
+namespace core {
+class JobSystem;
+}
+}
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Options for loading Wavefront OBJ files
+ */
+struct ObjLoadSettings {
+    /// Optional job system to parse chunks in parallel (nullptr = calling thread only)
+    ogde::core::JobSystem* jobSystem = nullptr;
+
+    /// Target bytes per parse chunk; chunks end at line boundaries
+    size_t chunkSize = 1 << 20;
+
+    /// Compute area-weighted smooth normals when the file has none
+    bool generateNormals = true;
+};
+
+/**
+ * @brief Counters from the last parse
+ */
+struct ObjLoadStats {
+    uint32_t chunks = 0;
+    uint32_t positions = 0;         ///< v lines
+    uint32_t texCoords = 0;         ///< vt lines
+    uint32_t normals = 0;           ///< vn lines
+    uint32_t faces = 0;             ///< f lines (polygons are fan-triangulated)
+    uint32_t corners = 0;           ///< Triangle corners before deduplication
+    uint32_t skippedTriangles = 0;  ///< Triangles with missing or out-of-range references
+};
+
+/**
+ * @brief Wavefront OBJ parser producing indexed meshes
+ *
+ * The file is memory-mapped and split into chunks at line boundaries. Chunks
+ * are parsed in parallel into v/vt/vn arrays and face corners, with a
+ * hand-written float parser instead of strtof. Negative (relative) indices
+ * are resolved once the chunk offsets are known. Corners are then
+ * deduplicated on their (v, vt, vn) triple with an open-addressing hash
+ * table, so vertices appear in first-use order and the result does not
+ * depend on the chunk size or thread count.
+ *
+ * Supported: v, vt, vn, f (any polygon size, all index forms), usemtl.
+ * Other statements (o, g, s, mtllib, l, p, ...) are ignored.
+ */
+class ObjLoader {
+public:
+    /**
+     * @brief Load an OBJ file
+     * @param filepath Path to the .obj file
+     * @param outMesh Receives the mesh
+     * @param settings Parallelism and normal generation
+     * @param outStats Receives parse counters (optional)
+     * @return true if the file was read and contained at least one triangle
+     */
+    static bool Load(const std::string& filepath, MeshData& outMesh,
+                     const ObjLoadSettings& settings = ObjLoadSettings(), ObjLoadStats* outStats = nullptr);
+
+    /**
+     * @brief Parse OBJ text in memory
+     * @param data OBJ text (not necessarily null-terminated)
+     * @param size Size of the text in bytes
+     * @param outMesh Receives the mesh
+     * @param settings Parallelism and normal generation
+     * @param outStats Receives parse counters (optional)
+     * @return true if the text contained at least one triangle
+     */
+    static bool Parse(const char* data, size_t size, MeshData& outMesh,
+                      const ObjLoadSettings& settings = ObjLoadSettings(), ObjLoadStats* outStats = nullptr);
+
+    /**
+     * @brief Parse a decimal float ("-1.5", "2e-3", ".5", "nan", ...)
+     *
+     * Up to 15 significant digits with a small exponent (the usual OBJ case)
+     * are converted with one correctly rounded multiply or divide by a power
+     * of ten; anything else (long mantissas, large exponents, nan, inf) falls
+     * back to strtof, so the result always equals strtof's.
+     * @param begin First character
+     * @param end One past the last readable character
+     * @param outValue Receives the value
+     * @return Pointer after the number, or begin if there is none
+     */
+    static const char* ParseFloat(const char* begin, const char* end, float& outValue);
+};
+
+} // namespace Graphics
+} // namespace OGDE
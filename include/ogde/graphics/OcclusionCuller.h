@@ -0,0 +1,152 @@
+/**
+ * @file OcclusionCuller.h
+ * @brief CPU software occlusion culling with a hierarchical depth buffer
+ */
+
+#ifndef OGDE_GRAPHICS_OCCLUSIONCULLER_H
+#define OGDE_GRAPHICS_OCCLUSIONCULLER_H
+
+#include "ogde/graphics/Frustum.h"
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+
+namespace core {
+class JobSystem;
+}
+
+namespace graphics {
+
+class Camera;
+
+/**
+ * @struct OcclusionStats
+ * @brief Counters from the last frame of occlusion culling
+ */
+struct OcclusionStats {
+    uint32_t occluderTriangles = 0;     ///< Triangles submitted as occluders
+    uint32_t rasterizedTriangles = 0;   ///< Triangles that survived near-plane and screen rejection
+    uint32_t testedObjects = 0;         ///< Objects tested against the depth pyramid
+    uint32_t occludedObjects = 0;       ///< Objects found to be hidden
+};
+
+/**
+ * @class OcclusionCuller
+ * @brief Rasterizes occluders into a low-resolution depth buffer and tests bounds against it
+ *
+ * Usage per frame: beginFrame(), addOccluder()/addOccluderBox() for large solid geometry,
+ * rasterize(), then test objects with isVisible() or testAabbs(). Depth follows the Camera
+ * convention (0 = near plane, 1 = far plane). Triangles that cross the near plane are
+ * skipped, which can only make the culler less aggressive, never wrong.
+ */
+class OcclusionCuller {
+public:
+    /**
+     * @brief Create a culler with a depth buffer of the given size
+     * @param width Depth buffer width (rounded up to a multiple of 8)
+     * @param height Depth buffer height (rounded up to a multiple of 8)
+     */
+    explicit OcclusionCuller(uint32_t width = 256, uint32_t height = 128);
+    ~OcclusionCuller();
+
+    /**
+     * @brief Set the job system used for rasterization and testing (nullptr = single-threaded)
+     */
+    void setJobSystem(core::JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
+    /**
+     * @brief Start a frame: clear occluders and depth, capture the camera matrices
+     * @param camera Camera to cull for (must be updated)
+     */
+    void beginFrame(const Camera& camera);
+
+    /**
+     * @brief Add an indexed triangle mesh as an occluder
+     * @param positions Vertex positions (3 floats per vertex)
+     * @param vertexCount Number of vertices
+     * @param indices Triangle list indices
+     * @param indexCount Number of indices (multiple of 3)
+     * @param worldMatrix Optional 4x4 object-to-world matrix in the Camera layout
+     */
+    void addOccluder(const float* positions, uint32_t vertexCount,
+                     const uint32_t* indices, uint32_t indexCount,
+                     const float* worldMatrix = nullptr);
+
+    /**
+     * @brief Add a solid axis-aligned box as an occluder (e.g. a filled voxel chunk)
+     */
+    void addOccluderBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+
+    /**
+     * @brief Rasterize all occluders and build the depth pyramid
+     */
+    void rasterize();
+
+    /**
+     * @brief Test one box against the depth pyramid
+     * @return false only if the box is certainly hidden behind occluders
+     */
+    bool isVisible(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) const;
+
+    /**
+     * @brief Test a list of boxes, typically the output of frustum culling
+     * @param boxes Box bounds
+     * @param candidates Indices into boxes to test
+     * @param candidateCount Number of candidate indices
+     * @param outVisible Receives the candidates that are not occluded, in input order
+     * @return Number of indices written to outVisible
+     */
+    uint32_t testAabbs(const AabbBatch& boxes, const uint32_t* candidates, uint32_t candidateCount,
+                       uint32_t* outVisible);
+
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+
+    /**
+     * @brief Number of levels in the depth pyramid (level 0 is the full-resolution buffer)
+     */
+    uint32_t getLevelCount() const { return static_cast<uint32_t>(m_levels.size()); }
+
+    /**
+     * @brief Get one level of the max-depth pyramid
+     * @param level Pyramid level
+     * @param outWidth Level width
+     * @param outHeight Level height
+     * @return Row-major depth values
+     */
+    const float* getDepthLevel(uint32_t level, uint32_t& outWidth, uint32_t& outHeight) const;
+
+    const OcclusionStats& getStats() const { return m_stats; }
+
+private:
+    struct ScreenTriangle {
+        float x[3];
+        float y[3];
+        float z[3];
+    };
+
+    struct Level {
+        uint32_t width;
+        uint32_t height;
+        std::vector<float> depth;
+    };
+
+    void rasterizeBand(uint32_t band);
+    void rasterizeTriangle(const ScreenTriangle& tri, uint32_t rowBegin, uint32_t rowEnd);
+    void buildPyramid();
+
+    uint32_t m_width;
+    uint32_t m_height;
+    float m_viewProjection[16];
+    std::vector<Level> m_levels;
+    std::vector<ScreenTriangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_bandBins;   // Triangle indices per row band
+    core::JobSystem* m_jobSystem;
+    OcclusionStats m_stats;
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_OCCLUSIONCULLER_H
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Pixel format conversion kernels
+ *
+ * Every function processes a tightly packed run of pixels and picks an
+ * AVX2, SSSE3 or scalar kernel at runtime. All results are bit-identical
+ * across paths. Functions documented as in-place safe accept dst == src.
+ *
+ * sRGB conversions treat the alpha channel (the 2nd of 2-channel and the 4th
+ * of 4-channel pixels) as linear, matching MipGenerator.
+ */
+class PixelConverter {
+public:
+    /**
+     * @brief Expand RGB to RGBA
+     * @param src pixelCount * 3 bytes
+     * @param dst pixelCount * 4 bytes; must not overlap src (see RgbToRgbaInPlace)
+     * @param pixelCount Number of pixels
+     * @param alpha Value written to the alpha channel
+     */
+    static void RgbToRgba(const uint8_t* src, uint8_t* dst, size_t pixelCount, uint8_t alpha = 255);
+
+    /**
+     * @brief Expand RGB to RGBA inside one buffer
+     * @param buffer pixelCount * 4 bytes holding pixelCount * 3 bytes of RGB at the start
+     * @param pixelCount Number of pixels
+     * @param alpha Value written to the alpha channel
+     */
+    static void RgbToRgbaInPlace(uint8_t* buffer, size_t pixelCount, uint8_t alpha = 255);
+
+    /**
+     * @brief Swap the R and B channels of 4-channel pixels (RGBA <-> BGRA); in-place safe
+     */
+    static void SwizzleRgbaBgra(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+    /**
+     * @brief Multiply color channels by alpha with exact rounding; in-place safe
+     * @param src RGBA pixels
+     * @param dst RGBA pixels
+     * @param pixelCount Number of pixels
+     */
+    static void PremultiplyAlpha(const uint8_t* src, uint8_t* dst, size_t pixelCount);
+
+    /**
+     * @brief Convert 8-bit unorm values to float in [0, 1]
+     * @param src valueCount bytes
+     * @param dst valueCount floats
+     * @param valueCount Number of channel values (pixels * channels)
+     */
+    static void UnormToFloat(const uint8_t* src, float* dst, size_t valueCount);
+
+    /**
+     * @brief Convert floats to 8-bit unorm, clamping to [0, 1] and rounding to nearest
+     */
+    static void FloatToUnorm(const float* src, uint8_t* dst, size_t valueCount);
+
+    /**
+     * @brief Decode sRGB-encoded 8-bit pixels to linear float
+     * @param src pixelCount * channels bytes
+     * @param dst pixelCount * channels floats
+     * @param pixelCount Number of pixels
+     * @param channels Channels per pixel (1-4)
+     */
+    static void SrgbToLinear(const uint8_t* src, float* dst, size_t pixelCount, int channels);
+
+    /**
+     * @brief Encode linear float pixels to sRGB 8-bit, clamping to [0, 1]
+     * @param src pixelCount * channels floats
+     * @param dst pixelCount * channels bytes
+     * @param pixelCount Number of pixels
+     * @param channels Channels per pixel (1-4)
+     */
+    static void LinearToSrgb(const float* src, uint8_t* dst, size_t pixelCount, int channels);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,240 @@
+/**
+ * @file RenderQueue.h
+ * @brief Sort-key based draw queue with state-change elision
+ */
+
+#ifndef OGDE_GRAPHICS_RENDERQUEUE_H
+#define OGDE_GRAPHICS_RENDERQUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ogde {
+namespace graphics {
+
+/**
+ * @brief Builders for 64-bit draw sort keys
+ *
+ * Opaque layout (most significant first):
+ *     pass:4 | layer:8 | shader:12 | material:16 | depth:24
+ * so draws group by state and go front to back within a material.
+ *
+ * Translucent layout:
+ *     pass:4 | layer:8 | ~depth:24 | shader:12 | material:16
+ * so draws go back to front and state only breaks ties.
+ *
+ * Shader and material ids are truncated to their field width. That only
+ * affects grouping: submission compares the full ids stored in the item.
+ */
+namespace RenderKey {
+
+constexpr uint32_t kPassBits = 4;
+constexpr uint32_t kLayerBits = 8;
+constexpr uint32_t kShaderBits = 12;
+constexpr uint32_t kMaterialBits = 16;
+constexpr uint32_t kDepthBits = 24;
+
+/**
+ * @brief Quantize a normalized depth (0 = near, 1 = far) to kDepthBits; out-of-range values clamp
+ */
+uint32_t quantizeDepth(float depth);
+
+/**
+ * @brief Key for an opaque draw: state first, then front to back
+ */
+uint64_t opaque(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, float depth);
+
+/**
+ * @brief Key for a translucent draw: back to front, then state
+ */
+uint64_t translucent(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, float depth);
+
+/**
+ * @brief Key for an opaque draw that may be instanced
+ *
+ * Same as opaque() with the geometry id in place of the depth, so draws of
+ * one mesh with one material sort next to each other and
+ * RenderQueue::submitInstanced() can merge them. Gives up front-to-back
+ * order within a material.
+ */
+uint64_t instanced(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, uint32_t geometry);
+
+/**
+ * @brief Extract the pass field of a key
+ */
+inline uint32_t pass(uint64_t key) { return static_cast<uint32_t>(key >> (64 - kPassBits)); }
+
+/**
+ * @brief Extract the layer field of a key
+ */
+inline uint32_t layer(uint64_t key) {
+    return static_cast<uint32_t>(key >> (64 - kPassBits - kLayerBits)) & ((1u << kLayerBits) - 1);
+}
+
+} // namespace RenderKey
+
+/**
+ * @struct DrawItem
+ * @brief One queued draw with the state it needs
+ *
+ * State ids are opaque to the queue; the backend maps them to its own
+ * objects (e.g. a MaterialTable index for material).
+ */
+struct DrawItem {
+    uint64_t key = 0;           ///< Sort key from RenderKey
+    uint32_t pass = 0;          ///< Render pass (target/viewport setup)
+    uint32_t shader = 0;        ///< Shader program id
+    uint32_t material = 0;      ///< Material parameters and textures id
+    uint32_t geometry = 0;      ///< Vertex/index buffer id
+    uint32_t vertexCount = 0;   ///< Vertices to draw when indexCount is 0
+    uint32_t startVertex = 0;   ///< First vertex, or the base vertex added to each index
+    uint32_t userData = 0;      ///< Per-draw payload, e.g. a transform index
+    uint32_t indexCount = 0;    ///< Indices to draw from the geometry's index buffer (0 = non-indexed)
+    uint32_t startIndex = 0;
+    uint32_t instanceCount = 1;
+    uint32_t startInstance = 0; ///< First element of the per-instance stream
+};
+
+/**
+ * @struct RenderQueueStats
+ * @brief State changes emitted by the last RenderQueue::submit()
+ */
+struct RenderQueueStats {
+    uint32_t draws = 0;
+    uint32_t passChanges = 0;
+    uint32_t shaderChanges = 0;
+    uint32_t materialChanges = 0;
+    uint32_t geometryChanges = 0;
+    uint32_t instances = 0;         ///< Instances drawn (equal to draws without instancing)
+};
+
+/**
+ * @class RenderQueueSink
+ * @brief Receives the sorted draw stream; implemented by a rendering backend
+ *
+ * Bind calls arrive only when the value differs from the previous draw's.
+ * Changing the pass resets the tracked state, so every bind is re-emitted
+ * after bindPass().
+ */
+class RenderQueueSink {
+public:
+    virtual ~RenderQueueSink() = default;
+
+    virtual void bindPass(uint32_t pass) = 0;
+    virtual void bindShader(uint32_t shader) = 0;
+    virtual void bindMaterial(uint32_t material) = 0;
+    virtual void bindGeometry(uint32_t geometry) = 0;
+    virtual void draw(const DrawItem& item) = 0;
+};
+
+/**
+ * @class RenderQueue
+ * @brief Collects draws for a frame, sorts them by key and submits them with minimal state changes
+ *
+ * Usage per frame: clear(), add() every visible draw, sort(), submit().
+ * sort() is a stable LSD radix sort on the 64-bit keys (11-bit digits, with
+ * passes skipped when every key shares a digit), so draws with equal keys
+ * keep their submission order. Storage is kept between frames.
+ */
+class RenderQueue {
+public:
+    RenderQueue();
+    ~RenderQueue();
+
+    /**
+     * @brief Remove all draws, keeping capacity
+     */
+    void clear();
+
+    /**
+     * @brief Reserve space for a number of draws
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Queue a draw
+     */
+    void add(const DrawItem& item);
+
+    /**
+     * @brief Sort the queued draws by key
+     */
+    void sort();
+
+    /**
+     * @brief Walk the sorted draws, emitting binds only on state changes
+     * @param sink Backend receiving binds and draws
+     * @return Draw and state change counts
+     */
+    RenderQueueStats submit(RenderQueueSink& sink) const;
+
+    /**
+     * @brief Submit a range of the sorted draws
+     *
+     * The first draw of the range binds all of its state, so ranges can be
+     * recorded independently (e.g. into per-thread command buffers).
+     * @param sink Backend receiving binds and draws
+     * @param first Index of the first sorted draw
+     * @param count Number of draws, clamped to the queue size
+     * @return Draw and state change counts for the range
+     */
+    RenderQueueStats submit(RenderQueueSink& sink, size_t first, size_t count) const;
+
+    /**
+     * @brief Submit the sorted draws, merging runs of identical draws into instanced draws
+     *
+     * Consecutive draws with the same pass, shader, material, geometry and
+     * vertex/index range become one draw. The userData of every queued draw
+     * is appended to instanceIds in draw order, and each emitted draw gets
+     * instanceCount and startInstance for its range of that array, so the
+     * caller can build the per-instance stream (e.g. transforms gathered by
+     * id) and bind it before replay. Every draw reads the stream, including
+     * runs of one. The instanceCount and startInstance of queued items are
+     * ignored. Sort with RenderKey::instanced() keys to make runs long.
+     * @param sink Backend receiving binds and draws
+     * @param instanceIds Receives the userData of each instance (cleared first)
+     * @return Draw, state change and instance counts
+     */
+    RenderQueueStats submitInstanced(RenderQueueSink& sink, std::vector<uint32_t>& instanceIds) const;
+
+    /**
+     * @brief Get the number of queued draws
+     */
+    size_t size() const { return m_items.size(); }
+
+    /**
+     * @brief Get the i-th draw in sorted order (valid after sort())
+     */
+    const DrawItem& getSorted(size_t i) const { return m_items[m_order[i].index]; }
+
+    /**
+     * @brief Key and payload index moved together by radixSort()
+     */
+    struct SortEntry {
+        uint64_t key;
+        uint32_t index;
+        uint32_t padding;
+    };
+
+    /**
+     * @brief Stable radix sort of (key, index) pairs
+     * @param entries Keys and payload indices to sort in place
+     * @param scratch Temporary storage, resized to entries.size()
+     */
+    static void radixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+
+private:
+    // Emit the binds needed between previous (nullptr for none) and item
+    static void bindState(RenderQueueSink& sink, const DrawItem* previous, const DrawItem& item,
+                          RenderQueueStats& stats);
+
+    std::vector<DrawItem> m_items;
+    std::vector<SortEntry> m_order;
+    std::vector<SortEntry> m_scratch;
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_RENDERQUEUE_H
@@ -18,13 +18,20 @@ typedef HWND__* HWND;
 namespace ogde {
 namespace graphics {
 
+class CommandBuffer;
+
 #ifdef _WIN32
 class RendererD3D11;
+#else
+class RendererSoftware;
 #endif
 
 /**
  * @class Renderer
  * @brief Main rendering system for graphics (platform abstraction)
+ *
+ * Uses Direct3D 11 on Windows and the headless software rasterizer
+ * elsewhere, so rendering code and tests also run on Linux servers.
  */
 class Renderer {
 public:
@@ -33,7 +40,7 @@ public:
 
     /**
      * @brief Initialize the renderer
-     * @param windowHandle Platform-specific window handle (HWND on Windows)
+     * @param windowHandle Platform-specific window handle (HWND on Windows, ignored by the software renderer)
      * @param width Window width
      * @param height Window height
      * @param vsync Enable vertical synchronization
@@ -72,6 +79,12 @@ public:
      */
     void resize(uint32_t width, uint32_t height);
 
+    /**
+     * @brief Replay recorded commands on the backend (main thread)
+     * @param commands Merged command stream, e.g. from CommandRecorder::merge()
+     */
+    void execute(const CommandBuffer& commands);
+
     /**
      * @brief Check if the renderer is initialized
      * @return true if initialized
@@ -84,11 +97,19 @@ public:
      * @return Pointer to RendererD3D11 (Windows only)
      */
     RendererD3D11* getD3D11Renderer() const;
+#else
+    /**
+     * @brief Get the headless software renderer
+     * @return Pointer to RendererSoftware (non-Windows platforms)
+     */
+    RendererSoftware* getSoftwareRenderer() const;
 #endif
 
 private:
 #ifdef _WIN32
     std::unique_ptr<RendererD3D11> m_rendererD3D11;
+#else
+    std::unique_ptr<RendererSoftware> m_rendererSoftware;
 #endif
 };
 
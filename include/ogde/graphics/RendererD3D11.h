@@ -8,9 +8,13 @@
 
 #ifdef _WIN32
 
+#include "ogde/graphics/CommandBuffer.h"
+#include "ogde/graphics/UploadRing.h"
 #include <d3d11.h>
+#include <d3d11_1.h>
 #include <dxgi.h>
 #include <wrl/client.h>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -21,6 +25,24 @@ typedef HWND__* HWND;
 namespace ogde {
 namespace graphics {
 
+/**
+ * @brief Which per-frame upload buffer a dynamic upload goes to
+ */
+enum class DynamicBufferKind {
+    Geometry,   ///< Vertex and index data
+    Constants   ///< Constant buffer data (256-byte aligned)
+};
+
+/**
+ * @struct DynamicBufferSlice
+ * @brief Range of a per-frame upload buffer, valid until the end of the frame
+ */
+struct DynamicBufferSlice {
+    ID3D11Buffer* buffer = nullptr;
+    uint32_t offset = 0;    ///< Byte offset in buffer
+    uint32_t size = 0;      ///< Bytes uploaded
+};
+
 /**
  * @class RendererD3D11
  * @brief DirectX 11 rendering implementation
@@ -91,6 +113,9 @@ public:
 
     /**
      * @brief Create a vertex buffer
+     *
+     * Creates a new GPU buffer per call; data that changes every
+     * frame should go through uploadDynamic() instead.
      * @param vertices Pointer to vertex data
      * @param vertexSize Size of a single vertex in bytes
      * @param vertexCount Number of vertices
@@ -100,6 +125,15 @@ public:
     bool createVertexBuffer(const void* vertices, uint32_t vertexSize, uint32_t vertexCount, 
                            ID3D11Buffer** outBuffer);
 
+    /**
+     * @brief Create an index buffer of 32-bit indices
+     * @param indices Pointer to index data
+     * @param indexCount Number of indices
+     * @param outBuffer Output pointer to store the created index buffer
+     * @return true if successful
+     */
+    bool createIndexBuffer(const uint32_t* indices, uint32_t indexCount, ID3D11Buffer** outBuffer);
+
     /**
      * @brief Draw vertices using the current vertex buffer
      * @param vertexCount Number of vertices to draw
@@ -115,6 +149,112 @@ public:
      */
     void setVertexBuffer(ID3D11Buffer* buffer, uint32_t vertexSize, uint32_t offset = 0);
 
+    /**
+     * @brief Draw indexed vertices using the current vertex and index buffers
+     * @param indexCount Number of indices to draw
+     * @param startIndex First index to read
+     * @param baseVertex Value added to each index
+     */
+    void drawIndexed(uint32_t indexCount, uint32_t startIndex = 0, int32_t baseVertex = 0);
+
+    /**
+     * @brief Draw several instances of the current vertex buffer
+     * @param vertexCount Number of vertices per instance
+     * @param instanceCount Number of instances
+     * @param startVertex Starting vertex index
+     * @param startInstance First element read from the instance stream
+     */
+    void drawInstanced(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex = 0,
+                       uint32_t startInstance = 0);
+
+    /**
+     * @brief Draw several instances through the current index buffer
+     * @param indexCount Number of indices per instance
+     * @param instanceCount Number of instances
+     * @param startIndex First index to read
+     * @param baseVertex Value added to each index
+     * @param startInstance First element read from the instance stream
+     */
+    void drawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex = 0,
+                              int32_t baseVertex = 0, uint32_t startInstance = 0);
+
+    /**
+     * @brief Bind the per-instance vertex stream (input slot 1)
+     *
+     * The shader's input layout declares the per-instance elements with
+     * D3D11_INPUT_PER_INSTANCE_DATA on slot 1. Per-frame instance data can
+     * be uploaded with uploadDynamic() and bound with the slice's buffer
+     * and offset.
+     * @param buffer Instance buffer
+     * @param instanceSize Size of one instance in bytes
+     * @param offset Offset in bytes from the start of the buffer
+     */
+    void setInstanceBuffer(ID3D11Buffer* buffer, uint32_t instanceSize, uint32_t offset = 0);
+
+    /**
+     * @brief Copy per-frame data into a shared upload buffer
+     *
+     * Data is sub-allocated from a ring buffer that is mapped with
+     * NO_OVERWRITE; space is reused once the GPU has finished the frame that
+     * used it. If the ring is full the buffer is renamed with a discard, and
+     * it grows at the next frame boundary. The slice is only valid for the
+     * current frame.
+     * @param kind Geometry (vertices and indices) or constants
+     * @param data Source data
+     * @param size Bytes to copy
+     * @param outSlice Receives the buffer range holding the data
+     * @return true if successful
+     */
+    bool uploadDynamic(DynamicBufferKind kind, const void* data, uint32_t size, DynamicBufferSlice& outSlice);
+
+    /**
+     * @brief Bind an uploaded slice as the vertex buffer
+     * @param slice Slice from uploadDynamic(DynamicBufferKind::Geometry, ...)
+     * @param vertexSize Size of a single vertex in bytes
+     */
+    void setDynamicVertexBuffer(const DynamicBufferSlice& slice, uint32_t vertexSize);
+
+    /**
+     * @brief Bind an uploaded slice as the index buffer
+     * @param slice Slice from uploadDynamic(DynamicBufferKind::Geometry, ...)
+     * @param format DXGI_FORMAT_R16_UINT or DXGI_FORMAT_R32_UINT
+     */
+    void setDynamicIndexBuffer(const DynamicBufferSlice& slice, DXGI_FORMAT format);
+
+    /**
+     * @brief Bind an uploaded slice as a vertex and pixel shader constant buffer
+     * @param slot Constant buffer register (b#)
+     * @param slice Slice from uploadDynamic(DynamicBufferKind::Constants, ...)
+     */
+    void setDynamicConstantBuffer(uint32_t slot, const DynamicBufferSlice& slice);
+
+    /**
+     * @brief Get the allocation counters of an upload buffer
+     */
+    const UploadRingStats& getDynamicBufferStats(DynamicBufferKind kind) const;
+
+    /**
+     * @brief Register a vertex buffer so recorded commands can refer to it
+     * @param buffer Vertex buffer (the renderer keeps a reference)
+     * @param vertexSize Size of a single vertex in bytes
+     * @param indexBuffer Index buffer bound with the geometry for indexed draws (optional)
+     * @param indexFormat DXGI_FORMAT_R16_UINT or DXGI_FORMAT_R32_UINT
+     * @return Geometry id for CommandBuffer::bindGeometry and updateBuffer
+     */
+    uint32_t registerVertexBuffer(ID3D11Buffer* buffer, uint32_t vertexSize, ID3D11Buffer* indexBuffer = nullptr,
+                                  DXGI_FORMAT indexFormat = DXGI_FORMAT_R32_UINT);
+
+    /**
+     * @brief Replay recorded commands on the immediate context
+     *
+     * Geometry binds, draws and buffer updates map to registered vertex
+     * buffers; indexed and instanced draws use the geometry's index buffer
+     * and the bound instance buffer. Pass, shader and material binds are
+     * ignored until the renderer manages those resources.
+     * @param commands Merged command stream
+     */
+    void execute(const CommandBuffer& commands);
+
 private:
     /**
      * @brief Create the render target view
@@ -135,6 +275,29 @@ private:
      */
     bool createDepthStencil(uint32_t width, uint32_t height);
 
+    // One ring-allocated upload buffer (see uploadDynamic)
+    struct DynamicBuffer {
+        Microsoft::WRL::ComPtr<ID3D11Buffer> buffer;
+        UploadRing ring;
+        UINT bindFlags = 0;
+        uint32_t alignment = 16;
+        uint64_t overflowsSeen = 0;     // Ring overflow count at the last frame boundary
+        bool discardNext = true;        // Next Map must discard (new or renamed buffer)
+    };
+
+    /**
+     * @brief (Re)create an upload buffer and reset its ring
+     * @param dynamic Buffer to create
+     * @param capacity Size in bytes
+     * @return true if successful
+     */
+    bool createDynamicBuffer(DynamicBuffer& dynamic, uint64_t capacity);
+
+    /**
+     * @brief Release the upload space of frames the GPU has finished
+     */
+    void retireCompletedFrames();
+
     bool m_initialized;
     bool m_vsyncEnabled;
     uint32_t m_width;
@@ -148,6 +311,25 @@ private:
     Microsoft::WRL::ComPtr<ID3D11Texture2D> m_depthStencilBuffer;
     Microsoft::WRL::ComPtr<ID3D11DepthStencilView> m_depthStencilView;
     Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_rasterizerState;
+
+    // Vertex buffers addressable from command buffers, indexed by geometry id
+    std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>> m_vertexBuffers;
+    std::vector<uint32_t> m_vertexStrides;
+    std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>> m_indexBuffers;
+    std::vector<DXGI_FORMAT> m_indexFormats;
+
+    // Per-frame upload buffers, fenced with one event query per frame
+    Microsoft::WRL::ComPtr<ID3D11DeviceContext1> m_deviceContext1;  // For constant buffer offsets (11.1)
+    DynamicBuffer m_dynamicGeometry;
+    DynamicBuffer m_dynamicConstants;
+    bool m_dynamicConstantsSupported;
+    struct FrameFence {
+        uint64_t value;
+        Microsoft::WRL::ComPtr<ID3D11Query> query;
+    };
+    std::deque<FrameFence> m_pendingFences;
+    std::vector<Microsoft::WRL::ComPtr<ID3D11Query>> m_freeQueries;
+    uint64_t m_nextFence;
 };
 
 } // namespace graphics
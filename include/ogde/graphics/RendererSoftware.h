@@ -0,0 +1,332 @@
+/**
+ * @file RendererSoftware.h
+ * @brief Headless multithreaded software rasterizer
+ */
+
+#ifndef OGDE_GRAPHICS_RENDERERSOFTWARE_H
+#define OGDE_GRAPHICS_RENDERERSOFTWARE_H
+
+#include "ogde/graphics/CommandBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+class MaterialTable;
+}
+}
+
+namespace ogde {
+
+namespace core {
+class JobSystem;
+}
+
+namespace graphics {
+
+/**
+ * @struct SoftwareVertexFormat
+ * @brief Layout of a software vertex buffer
+ *
+ * Positions are three floats at offset 0. Normals (three floats) and colors
+ * (four floats, multiplied into the material color) are optional.
+ */
+struct SoftwareVertexFormat {
+    uint32_t stride = 12;       ///< Bytes per vertex
+    int32_t normalOffset = -1;  ///< Byte offset of the normal, or -1 for flat face normals
+    int32_t colorOffset = -1;   ///< Byte offset of an RGBA color, or -1
+};
+
+/**
+ * @struct SoftwareInstanceFormat
+ * @brief Layout of the per-instance stream
+ *
+ * A 4x4 row-major object-to-world matrix (replacing setWorldMatrix() for
+ * the instance) and an RGBA color multiplied into the surface color, both
+ * optional.
+ */
+struct SoftwareInstanceFormat {
+    uint32_t stride = 64;           ///< Bytes per instance
+    int32_t transformOffset = 0;    ///< Byte offset of the 16-float matrix, or -1
+    int32_t colorOffset = -1;       ///< Byte offset of an RGBA color, or -1
+};
+
+/**
+ * @struct SoftwareRenderStats
+ * @brief Counters since the last beginFrame()
+ */
+struct SoftwareRenderStats {
+    uint32_t trianglesSubmitted = 0;
+    uint32_t trianglesCulled = 0;       ///< Outside the view, degenerate, or smaller than a sample
+    uint32_t trianglesRasterized = 0;   ///< Triangles after clipping that reached tile binning
+    uint32_t tileBinEntries = 0;        ///< Triangle/tile pairs rasterized
+    uint64_t pixelsWritten = 0;         ///< Samples that passed the depth test
+};
+
+/**
+ * @class RendererSoftware
+ * @brief CPU rasterizer that renders into an offscreen RGBA8 + depth buffer
+ *
+ * Draws are transformed, lit per vertex and clipped (near plane and a guard
+ * band) on the calling thread, then queued. flush() (called by endFrame(),
+ * saveImage() and the buffer accessors) bins the queued triangles into 64x64
+ * tiles and rasterizes the tiles in parallel on the job system. Each tile
+ * processes its triangles in submission order, so the image is identical
+ * for any thread count.
+ *
+ * Coverage uses fixed-point edge functions with 4 bits of subpixel
+ * precision and a top-left fill rule, evaluated four pixels at a time with
+ * SSE2, so triangles sharing an edge never leave cracks or touch a pixel
+ * twice. Depth follows the Camera convention (0 near, 1 far) with a
+ * less-than test. Shading is Lambert diffuse plus ambient, computed per
+ * vertex and interpolated perspective-correctly. There is no culling of
+ * back faces, matching the D3D11 backend.
+ *
+ * Matrices use the Camera convention: row vectors, clip = v * M.
+ * The renderer is driven from one thread; only rasterization fans out.
+ */
+class RendererSoftware : public CommandSink {
+public:
+    RendererSoftware();
+    ~RendererSoftware() override;
+
+    RendererSoftware(const RendererSoftware&) = delete;
+    RendererSoftware& operator=(const RendererSoftware&) = delete;
+
+    /**
+     * @brief Allocate the offscreen buffers
+     * @param width Width in pixels (1 - 8192)
+     * @param height Height in pixels (1 - 8192)
+     * @return true if the size is valid
+     */
+    bool initialize(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Release buffers and geometry
+     */
+    void shutdown();
+
+    /**
+     * @brief Begin a new frame (resets the statistics)
+     */
+    void beginFrame();
+
+    /**
+     * @brief Rasterize everything queued and write the frame dump if enabled
+     */
+    void endFrame();
+
+    /**
+     * @brief Clear color to the given value and depth to 1, dropping queued triangles
+     */
+    void clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f);
+
+    /**
+     * @brief Reallocate the buffers at a new size (contents are cleared)
+     */
+    void resize(uint32_t width, uint32_t height);
+
+    bool isInitialized() const { return m_initialized; }
+
+    /**
+     * @brief Set the job system used to rasterize tiles (nullptr = single-threaded)
+     */
+    void setJobSystem(core::JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
+    /**
+     * @brief Copy vertices into a new vertex buffer
+     * @param vertices Vertex data laid out as described by format
+     * @param vertexCount Number of vertices
+     * @param format Vertex layout
+     * @return Geometry id for setVertexBuffer() and bindGeometry()
+     */
+    uint32_t createVertexBuffer(const void* vertices, uint32_t vertexCount,
+                                const SoftwareVertexFormat& format = SoftwareVertexFormat());
+
+    /**
+     * @brief Select the vertex buffer used by draw()
+     */
+    void setVertexBuffer(uint32_t geometry);
+
+    /**
+     * @brief Attach 32-bit indices to a vertex buffer for indexed draws
+     * @param geometry Id from createVertexBuffer()
+     * @param indices Triangle list indices (copied)
+     * @param indexCount Number of indices
+     * @return false if the geometry id is unknown
+     */
+    bool setIndexBuffer(uint32_t geometry, const uint32_t* indices, uint32_t indexCount);
+
+    /**
+     * @brief Set the per-instance data read by instanced draws
+     *
+     * Instance i of a draw reads element startInstance + i. Without a stream
+     * every instance uses the world matrix.
+     * @param data Instance data laid out as described by format (copied; nullptr clears)
+     * @param instanceCount Number of elements
+     * @param format Instance layout
+     */
+    void setInstanceStream(const void* data, uint32_t instanceCount,
+                           const SoftwareInstanceFormat& format = SoftwareInstanceFormat());
+
+    /**
+     * @brief Set the view-projection matrix (e.g. Camera::getViewProjectionMatrix())
+     */
+    void setViewProjection(const float* matrix);
+
+    /**
+     * @brief Set the object-to-world matrix for following draws (nullptr = identity)
+     */
+    void setWorldMatrix(const float* matrix);
+
+    /**
+     * @brief Set the direction the light travels in world space
+     */
+    void setLightDirection(float x, float y, float z);
+
+    /**
+     * @brief Use a material table so bindMaterial() takes its array indices
+     */
+    void setMaterialTable(const OGDE::Graphics::MaterialTable* table) { m_materialTable = table; }
+
+    /**
+     * @brief Draw with a flat diffuse color, unbinding any material
+     */
+    void setColor(float r, float g, float b, float a = 1.0f);
+
+    /**
+     * @brief Draw a triangle list from the current vertex buffer
+     * @param vertexCount Number of vertices (a multiple of 3)
+     * @param startVertex First vertex
+     */
+    void draw(uint32_t vertexCount, uint32_t startVertex = 0);
+
+    /**
+     * @brief Draw a triangle list through the current vertex buffer's indices
+     * @param indexCount Number of indices (a multiple of 3)
+     * @param startIndex First index
+     * @param baseVertex Value added to each index
+     */
+    void drawIndexed(uint32_t indexCount, uint32_t startIndex = 0, uint32_t baseVertex = 0);
+
+    /**
+     * @brief Replay recorded commands (material ids index the material table)
+     */
+    void execute(const CommandBuffer& commands);
+
+    // CommandSink (draw() handles indexed and instanced items)
+    void bindPass(uint32_t pass) override;
+    void bindShader(uint32_t shader) override;
+    void bindMaterial(uint32_t material) override;
+    void bindGeometry(uint32_t geometry) override;
+    void draw(const DrawItem& item) override;
+    void updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) override;
+
+    /**
+     * @brief Rasterize all queued triangles
+     */
+    void flush();
+
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+
+    /**
+     * @brief Get the color buffer (RGBA8 bytes, getStride() pixels per row), flushing first
+     */
+    const uint32_t* getColorBuffer();
+
+    /**
+     * @brief Get the depth buffer (getStride() floats per row), flushing first
+     */
+    const float* getDepthBuffer();
+
+    /**
+     * @brief Get the row pitch of both buffers in pixels
+     */
+    uint32_t getStride() const { return m_stride; }
+
+    /**
+     * @brief Write the color buffer to an image file
+     * @param path .tga (32-bit) or .ppm (24-bit) file
+     * @return true on success
+     */
+    bool saveImage(const std::string& path);
+
+    /**
+     * @brief Write every frame to prefix_NNNNNN.tga in endFrame() (empty disables)
+     */
+    void setFrameDumpPrefix(const std::string& prefix) { m_dumpPrefix = prefix; }
+
+    const SoftwareRenderStats& getStats() const { return m_stats; }
+
+private:
+    struct VertexBuffer {
+        std::vector<uint8_t> data;
+        uint32_t vertexCount = 0;
+        SoftwareVertexFormat format;
+        std::vector<uint32_t> indices;
+    };
+
+    // Post-transform vertex: clip position and lit color
+    struct ClipVertex {
+        float position[4];
+        float color[4];
+    };
+
+    // Triangle ready for binning: fixed-point edges and attribute planes
+    struct Triangle {
+        int32_t edgeA[3];
+        int32_t edgeB[3];
+        int64_t edgeC[3];           // Includes the fill-rule bias
+        int32_t minX, minY, maxX, maxY;
+        float originX, originY;     // Vertex 0 in pixels; planes are relative to it
+        float planes[6][3];         // z, 1/w, r/w, g/w, b/w, a/w: value, d/dx, d/dy
+    };
+
+    // Transform, light and queue count/3 triangles; indices == nullptr reads vertices in order
+    void drawTriangles(const VertexBuffer& buffer, const uint32_t* indices, uint32_t count, uint32_t vertexBase,
+                       const float* worldMatrix, const float* colorScale);
+    void queueTriangle(const ClipVertex* vertices);
+    void setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2);
+    void rasterizeTile(uint32_t tile);
+    uint64_t rasterizeTriangle(const Triangle& tri, int32_t rectMinX, int32_t rectMinY,
+                               int32_t rectMaxX, int32_t rectMaxY);
+
+    bool m_initialized;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_stride;
+    uint32_t m_tilesX;
+    uint32_t m_tilesY;
+    std::vector<uint32_t> m_color;
+    std::vector<float> m_depth;
+
+    std::vector<VertexBuffer> m_vertexBuffers;
+    uint32_t m_currentBuffer;
+    std::vector<uint8_t> m_instanceData;
+    uint32_t m_instanceCount;
+    SoftwareInstanceFormat m_instanceFormat;
+    float m_viewProjection[16];
+    float m_world[16];
+    float m_lightDirection[3];
+    float m_color4[4];
+    float m_ambient[3];
+    const OGDE::Graphics::MaterialTable* m_materialTable;
+    uint32_t m_material;        // Material table index, UINT32_MAX for the flat color
+
+    std::vector<Triangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_tileBins;
+    std::vector<uint64_t> m_tilePixels;
+    core::JobSystem* m_jobSystem;
+
+    SoftwareRenderStats m_stats;
+    std::string m_dumpPrefix;
+    uint32_t m_frameIndex;
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_RENDERERSOFTWARE_H
@@ -8,6 +8,7 @@
 
 #ifdef _WIN32
 
+#include "ogde/graphics/ShaderCache.h"
 #include <d3d11.h>
 #include <wrl/client.h>
 #include <string>
@@ -32,6 +33,7 @@ public:
      * @param pixelShaderSource Pixel shader source code (HLSL)
      * @param inputLayoutDesc Input layout description
      * @param numElements Number of elements in the input layout
+     * @param cache Bytecode cache consulted before compiling (nullptr always compiles)
      * @return true if successful
      */
     bool createFromSource(
@@ -39,9 +41,20 @@ public:
         const std::string& vertexShaderSource,
         const std::string& pixelShaderSource,
         const D3D11_INPUT_ELEMENT_DESC* inputLayoutDesc,
-        UINT numElements
+        UINT numElements,
+        ShaderCache* cache = nullptr
     );
 
+    /**
+     * @brief Compile HLSL with D3DCompile (a ShaderCompileFunction)
+     * @param request Source, entry point, target, defines and D3DCOMPILE_* flags
+     * @param bytecode Receives the compiled bytecode
+     * @param errors Receives the compiler output on failure
+     * @return true if successful
+     */
+    static bool compileBytecode(const ShaderCompileRequest& request, std::vector<uint8_t>& bytecode,
+                                std::string& errors);
+
     /**
      * @brief Bind the shader for rendering
      * @param deviceContext DirectX device context
@@ -65,18 +78,20 @@ public:
 
 private:
     /**
-     * @brief Compile shader from source code
+     * @brief Compile shader from source code, through the cache if there is one
      * @param source Shader source code
      * @param entryPoint Entry point function name
      * @param target Shader target (e.g., "vs_5_0", "ps_5_0")
-     * @param blob Output compiled shader blob
+     * @param cache Bytecode cache, or nullptr
+     * @param bytecode Output compiled bytecode
      * @return true if successful
      */
     bool compileShader(
         const std::string& source,
         const char* entryPoint,
         const char* target,
-        ID3DBlob** blob
+        ShaderCache* cache,
+        std::vector<uint8_t>& bytecode
     );
 
     Microsoft::WRL::ComPtr<ID3D11VertexShader> m_vertexShader;
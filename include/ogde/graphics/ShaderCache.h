@@ -0,0 +1,204 @@
+/**
+ * @file ShaderCache.h
+ * @brief Disk cache for compiled shader bytecode and permutation compiling
+ */
+
+#ifndef OGDE_GRAPHICS_SHADERCACHE_H
+#define OGDE_GRAPHICS_SHADERCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ogde {
+
+namespace core {
+class JobSystem;
+}
+
+namespace graphics {
+
+/**
+ * @struct ShaderDefine
+ * @brief Preprocessor macro passed to the shader compiler
+ */
+struct ShaderDefine {
+    std::string name;
+    std::string value;
+};
+
+/**
+ * @struct ShaderCompileRequest
+ * @brief Everything that determines the compiled bytecode
+ */
+struct ShaderCompileRequest {
+    std::string source;
+    std::string entryPoint;             ///< e.g. "VSMain"
+    std::string target;                 ///< e.g. "vs_5_0"
+    std::vector<ShaderDefine> defines;  ///< Order does not matter
+    uint32_t flags = 0;                 ///< Compiler flags (e.g. D3DCOMPILE_*)
+    std::string compiler;               ///< Compiler name and version; change it whenever the output may change
+    std::string name;                   ///< Source name for error messages; not part of the key
+};
+
+/**
+ * @brief Compiler backend: fills bytecode, or errors on failure
+ *
+ * Must be safe to call from several threads at once when used with
+ * compileShaderPermutations() and a job system.
+ */
+using ShaderCompileFunction =
+    std::function<bool(const ShaderCompileRequest& request, std::vector<uint8_t>& bytecode, std::string& errors)>;
+
+/**
+ * @struct ShaderCacheStats
+ * @brief Lookup counters
+ */
+struct ShaderCacheStats {
+    uint64_t memoryHits = 0;
+    uint64_t diskHits = 0;
+    uint64_t misses = 0;
+    uint64_t compileFailures = 0;
+    uint64_t rejectedFiles = 0;     ///< Cache files that were truncated, corrupt or from another key
+};
+
+/**
+ * @class ShaderCache
+ * @brief Content-addressed store of compiled shader bytecode
+ *
+ * The key is a 64-bit hash of the source, entry point, target, compiler,
+ * flags and the defines sorted by name, so any change to the inputs,
+ * including a compiler upgrade, selects a new entry and stale bytecode is
+ * never returned. Entries live in memory and,
+ * when a directory is given, in one file per key (<key>.ogsc) so later
+ * launches and the asset pipeline share them. Files carry a header and a
+ * payload hash; damaged files count as misses and are rewritten.
+ *
+ * The cache does not compile by itself: getOrCompile() takes the compiler
+ * as a function, which keeps the cache platform-independent (D3DCompile on
+ * Windows, an offline compiler in the tools, a stub in tests).
+ *
+ * #include directives are not followed: sources that include other files
+ * must be expanded before lookup, or the includes added to the source.
+ *
+ * All methods are thread-safe. Compiling happens outside the lock, so two
+ * threads asking for the same new key may both compile it.
+ */
+class ShaderCache {
+public:
+    /**
+     * @brief Create a cache
+     * @param directory Directory for cache files (created on first store); empty keeps entries in memory only
+     */
+    explicit ShaderCache(const std::string& directory = std::string());
+    ~ShaderCache();
+
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+
+    /**
+     * @brief Compute the cache key of a request
+     */
+    static uint64_t computeKey(const ShaderCompileRequest& request);
+
+    /**
+     * @brief Look up bytecode in memory, then on disk
+     * @param key Key from computeKey()
+     * @param bytecode Receives the bytecode on a hit
+     * @return true on a hit
+     */
+    bool load(uint64_t key, std::vector<uint8_t>& bytecode);
+
+    /**
+     * @brief Add bytecode to memory and write its cache file
+     * @return false if the cache file could not be written (the memory entry is kept)
+     */
+    bool store(uint64_t key, const uint8_t* bytecode, size_t size);
+
+    /**
+     * @brief Return cached bytecode, compiling and storing it on a miss
+     * @param request Shader inputs
+     * @param compiler Called only on a miss
+     * @param bytecode Receives the bytecode
+     * @param errors Receives compiler errors on failure (optional)
+     * @return true if bytecode is available
+     */
+    bool getOrCompile(const ShaderCompileRequest& request, const ShaderCompileFunction& compiler,
+                      std::vector<uint8_t>& bytecode, std::string* errors = nullptr);
+
+    /**
+     * @brief Drop the in-memory entries (files are kept)
+     */
+    void clearMemory();
+
+    /**
+     * @brief Get the cache file path of a key (empty without a directory)
+     */
+    std::string getFilePath(uint64_t key) const;
+
+    const std::string& getDirectory() const { return m_directory; }
+
+    ShaderCacheStats getStats() const;
+
+private:
+    bool loadFile(uint64_t key, std::vector<uint8_t>& bytecode);
+
+    std::string m_directory;
+    mutable std::mutex m_mutex;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> m_entries;
+    ShaderCacheStats m_stats;
+};
+
+/**
+ * @struct ShaderOption
+ * @brief One permutation axis: a define and the values it takes
+ *
+ * An empty value leaves the define out, so { "USE_FOG", { "", "1" } }
+ * builds variants with and without USE_FOG.
+ */
+struct ShaderOption {
+    std::string name;
+    std::vector<std::string> values;
+};
+
+/**
+ * @struct ShaderPermutation
+ * @brief Result of compiling one permutation
+ */
+struct ShaderPermutation {
+    std::vector<ShaderDefine> defines;  ///< Base defines followed by this permutation's options
+    uint64_t key = 0;
+    std::vector<uint8_t> bytecode;
+    std::string errors;
+    bool compiled = false;
+};
+
+/**
+ * @brief Enumerate every combination of option values
+ * @param options Permutation axes; an axis without values is ignored
+ * @return Define lists, the first option varying slowest
+ */
+std::vector<std::vector<ShaderDefine>> enumerateShaderPermutations(const std::vector<ShaderOption>& options);
+
+/**
+ * @brief Compile every permutation of a shader through a cache
+ * @param cache Cache consulted and filled for each permutation
+ * @param base Source, entry point, target, flags and defines shared by all permutations
+ * @param options Permutation axes
+ * @param compiler Compiler for cache misses
+ * @param jobSystem Job system to compile on (nullptr = on the calling thread)
+ * @return One result per permutation, in enumerateShaderPermutations() order
+ */
+std::vector<ShaderPermutation> compileShaderPermutations(ShaderCache& cache, const ShaderCompileRequest& base,
+                                                         const std::vector<ShaderOption>& options,
+                                                         const ShaderCompileFunction& compiler,
+                                                         core::JobSystem* jobSystem = nullptr);
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_SHADERCACHE_H
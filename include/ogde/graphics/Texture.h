@@ -5,9 +5,13 @@
 #include <wrl/client.h>
 #endif
 
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/core/MappedFile.h"
 #include <string>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace OGDE {
 namespace Graphics {
@@ -16,8 +20,10 @@ namespace Graphics {
  * @brief Texture resource for graphics rendering
  * 
  * Handles loading and management of 2D textures with support for:
- * - Multiple image formats (PNG, JPG, BMP, etc. via stb_image)
- * - Automatic mipmap generation
+ * - PNG and QOI via the in-tree ImageDecoder, other formats (JPG, BMP, TGA, ...) via stb_image
+ * - Memory-mapped .ogtex containers with pre-built mips, no decode at load
+ * - CPU mipmap generation (box / Kaiser, sRGB-aware)
+ * - BC1/BC3/BC4/BC5/BC7 block compression
  * - DirectX 11 shader resource views
  */
 class Texture {
@@ -35,6 +41,9 @@ public:
 
     /**
      * @brief Load texture from file
+     *
+     * Files with the .ogtex extension are memory-mapped and used in place
+     * (see TextureContainer); anything else is decoded like LoadFromEncodedMemory().
      * @param filepath Path to image file
      * @return true if loaded successfully
      */
@@ -50,6 +59,49 @@ public:
      */
     bool LoadFromMemory(const uint8_t* data, int width, int height, int channels);
 
+    /**
+     * @brief Decode an encoded image (PNG, JPG, TGA, ...) held in memory
+     *
+     * PNG and QOI go through ImageDecoder straight into the texture's buffer;
+     * other formats and PNG variants it does not handle fall back to stb_image.
+     * @param data Encoded file contents
+     * @param size Size of data in bytes
+     * @param name Name used in log messages
+     * @return true if decoded successfully
+     */
+    bool LoadFromEncodedMemory(const uint8_t* data, size_t size, const std::string& name);
+
+    /**
+     * @brief Get the number of bytes held by all mip levels
+     * @return Pixel or block bytes, mapped or owned
+     */
+    size_t GetMemorySize() const;
+
+    /**
+     * @brief Build the mip chain from the base level on the CPU
+     * @param settings Filter, sRGB and level count options
+     * @return true if the chain was generated
+     */
+    bool GenerateMipmaps(const MipSettings& settings = MipSettings());
+
+    /**
+     * @brief Multiply color by alpha in every mip level (RGBA textures only)
+     *
+     * Call before GenerateMipmaps() so filtering happens on premultiplied colors.
+     * @return true if the texture was converted
+     */
+    bool PremultiplyAlpha();
+
+    /**
+     * @brief Block-compress every mip level in place
+     *
+     * Generate mipmaps first; a compressed texture cannot be filtered again.
+     * The base level must be a multiple of 4 pixels in both dimensions.
+     * @param settings Format, quality and threading
+     * @return true if the texture was compressed
+     */
+    bool Compress(const CompressionSettings& settings);
+
     /**
      * @brief Initialize DirectX 11 texture resources
      * @param device DirectX 11 device
@@ -82,11 +134,51 @@ public:
      */
     int GetChannels() const { return channels_; }
 
+    /**
+     * @brief Check if the pixel data is block-compressed
+     * @return true after a successful Compress()
+     */
+    bool IsCompressed() const { return compressed_; }
+
+    /**
+     * @brief Get the block format (only meaningful if IsCompressed())
+     * @return Block format
+     */
+    BlockFormat GetBlockFormat() const { return blockFormat_; }
+
+    /**
+     * @brief Check if the pixel data points into a memory-mapped .ogtex file
+     * @return true until the data is modified (mipmaps, compression) or released
+     */
+    bool IsMapped() const { return mappedFile_.IsOpen(); }
+
     /**
      * @brief Check if texture is loaded
      * @return true if texture has valid data
      */
-    bool IsLoaded() const { return data_ != nullptr; }
+    bool IsLoaded() const { return !mipLevels_.empty(); }
+
+    /**
+     * @brief Get number of mip levels held on the CPU (1 until mipmaps are generated)
+     * @return Mip level count
+     */
+    int GetMipLevelCount() const { return static_cast<int>(mipLevels_.size()); }
+
+    /**
+     * @brief Get size and location of a mip level
+     * @param level Mip level (0 = base)
+     * @return Level description
+     */
+    const MipLevel& GetMipLevel(int level) const { return mipLevels_[level]; }
+
+    /**
+     * @brief Get pixel data of a mip level
+     * @param level Mip level (0 = base)
+     * @return Tightly packed pixels or blocks, or nullptr if not loaded
+     */
+    const uint8_t* GetData(int level = 0) const {
+        return IsLoaded() ? data_ + mipLevels_[level].offset : nullptr;
+    }
 
 #ifdef _WIN32
     /**
@@ -110,7 +202,13 @@ private:
     int width_ = 0;
     int height_ = 0;
     int channels_ = 0;
-    uint8_t* data_ = nullptr;
+    std::vector<uint8_t> pixels_;       // All mip levels, base level first (empty when mapped)
+    std::unique_ptr<uint8_t[]> decoded_;    // Base level decoded in place, used instead of pixels_ (not zero-filled)
+    const uint8_t* data_ = nullptr;     // pixels_.data(), decoded_ or the mapped payload
+    Core::MappedFile mappedFile_;
+    std::vector<MipLevel> mipLevels_;
+    bool compressed_ = false;
+    BlockFormat blockFormat_ = BlockFormat::BC7;
     std::string filepath_;
 
 #ifdef _WIN32
@@ -119,6 +217,9 @@ private:
 #endif
 
     void FreeImageData();
+    void SetBaseLevel(const uint8_t* data, int width, int height, int channels);
+    void SetOwnedPixels(std::vector<uint8_t> pixels, std::vector<MipLevel> levels);
+    bool LoadContainer(const std::string& filepath);
 };
 
 } // namespace Graphics
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "ogde/graphics/Texture.h"
+#include <cstdint>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Pixel rectangle inside an atlas page
+ */
+struct AtlasRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+};
+
+/**
+ * @brief MaxRects bin packer (best short side fit)
+ *
+ * Keeps the list of maximal free rectangles of a fixed-size bin. Each insert
+ * picks the free rectangle that leaves the smallest leftover on its shorter
+ * side, then splits every free rectangle the new one overlaps.
+ */
+class AtlasPacker {
+public:
+    AtlasPacker(int width, int height);
+
+    /**
+     * @brief Place a rectangle
+     * @param width Rectangle width
+     * @param height Rectangle height
+     * @param outRect Receives the placement
+     * @return false if the rectangle does not fit
+     */
+    bool Insert(int width, int height, AtlasRect& outRect);
+
+    /**
+     * @brief Fraction of the bin covered by placed rectangles
+     */
+    float GetOccupancy() const;
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+private:
+    void SplitFreeRects(const AtlasRect& used);
+    void PruneFreeRects();
+
+    int width_;
+    int height_;
+    int64_t usedArea_ = 0;
+    std::vector<AtlasRect> freeRects_;
+};
+
+/**
+ * @brief How a TextureAtlas lays out its images
+ */
+enum class AtlasLayout {
+    Atlas,  ///< Images packed into as few 2D pages as possible
+    Array   ///< One image per layer of a texture array; images must share a size
+};
+
+/**
+ * @brief Options for building an atlas
+ */
+struct AtlasSettings {
+    AtlasLayout layout = AtlasLayout::Atlas;
+
+    /// Largest page width or height; more pages are created when images do not fit
+    int maxSize = 4096;
+
+    /// Border, in pixels, filled by repeating each image's edge pixels
+    int padding = 4;
+
+    /// Generate mips for each page (limited so every level keeps at least one border texel)
+    bool generateMipmaps = true;
+
+    /// Mip options; Atlas pages always use the box filter, whose 2x2 footprint stays inside each cell
+    MipSettings mipSettings;
+};
+
+/**
+ * @brief Where an image ended up: UV rectangle and page / array layer
+ */
+struct AtlasRegion {
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+    int page = 0;
+    AtlasRect rect;     ///< Pixel rectangle of the image, excluding padding
+};
+
+/**
+ * @brief Combines many small textures into atlas pages or texture array layers
+ *
+ * Meant for voxel block textures: a chunk binds a single page (or array) and
+ * remaps each face's UVs through the region table. In the Atlas layout every
+ * image is surrounded by an extruded border and placed on a grid aligned to
+ * the mip count, so downsampled texels never mix neighbouring images. The
+ * Array layout needs no border since each layer wraps on its own.
+ *
+ * Pages are always RGBA. Build() is used at runtime; the asset pipeline calls
+ * the same code and writes each page as an .ogtex.
+ */
+class TextureAtlas {
+public:
+    /**
+     * @brief Pack the images and build the pages
+     * @param images Loaded, uncompressed textures (base level is used)
+     * @param settings Layout, size and padding
+     * @return true if every image was placed
+     */
+    bool Build(const std::vector<const Texture*>& images, const AtlasSettings& settings = AtlasSettings());
+
+    /**
+     * @brief Get the number of atlas pages or array layers
+     */
+    int GetPageCount() const { return static_cast<int>(pages_.size()); }
+
+    /**
+     * @brief Get a page (RGBA, with mips if requested)
+     */
+    const Texture& GetPage(int page) const { return pages_[page]; }
+
+    /**
+     * @brief Get the UV remap entry of an input image
+     * @param image Index into the images passed to Build()
+     */
+    const AtlasRegion& GetRegion(int image) const { return regions_[image]; }
+
+    /**
+     * @brief Get the number of regions (one per input image)
+     */
+    int GetRegionCount() const { return static_cast<int>(regions_.size()); }
+
+    /**
+     * @brief Map a UV inside an image to the atlas
+     * @param image Index into the images passed to Build()
+     * @param u Image-local U in [0, 1]
+     * @param v Image-local V in [0, 1]
+     * @param outU Receives atlas U
+     * @param outV Receives atlas V
+     */
+    void RemapUV(int image, float u, float v, float& outU, float& outV) const;
+
+private:
+    bool BuildAtlas(const std::vector<const Texture*>& images, const AtlasSettings& settings);
+    bool BuildArray(const std::vector<const Texture*>& images, const AtlasSettings& settings);
+
+    std::vector<Texture> pages_;
+    std::vector<AtlasRegion> regions_;
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "ogde/graphics/Texture.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Options for a TextureCache
+ */
+struct TextureCacheSettings {
+    /// Memory the cache tries to stay under; textures still referenced elsewhere are never evicted
+    size_t budgetBytes = 256u * 1024u * 1024u;
+
+    /// Build mips for decoded images that have none (containers keep their own chain)
+    bool generateMipmaps = true;
+    MipSettings mipSettings;
+};
+
+/**
+ * @brief Cache counters
+ */
+struct TextureCacheStats {
+    uint32_t textureCount = 0;      ///< Unique textures held
+    uint32_t referencedCount = 0;   ///< Textures also held outside the cache
+    size_t budgetBytes = 0;
+    size_t totalBytes = 0;          ///< Pixel bytes of all cached textures
+    size_t referencedBytes = 0;     ///< Pixel bytes of textures held outside the cache
+    uint64_t pathHits = 0;          ///< Loads answered from the path table without touching the file
+    uint64_t contentHits = 0;       ///< Loads of a new path whose contents were already cached
+    uint64_t misses = 0;            ///< Loads that decoded or mapped a file
+    uint64_t evictions = 0;
+};
+
+/**
+ * @brief Description of one cached texture
+ */
+struct TextureCacheEntryInfo {
+    std::vector<std::string> paths; ///< Normalized paths resolving to this texture
+    uint64_t contentHash = 0;
+    size_t bytes = 0;
+    long references = 0;            ///< Owners outside the cache
+    uint64_t lastUsed = 0;          ///< Load counter value at the last hit
+};
+
+/**
+ * @brief Deduplicating texture cache with shared ownership
+ *
+ * Textures are looked up by normalized absolute path first. On a path miss
+ * the file is mapped and hashed, and files whose hash matches are compared
+ * byte for byte, so the same image under two names (copies, symlinks,
+ * relative vs absolute paths) is decoded once. Callers receive a
+ * std::shared_ptr that can go straight into Material::SetTexture.
+ *
+ * A texture is evictable once the cache holds the only reference. Whenever
+ * the total exceeds the budget, evictable textures are dropped least recently
+ * used first; referenced textures stay and may keep the cache over budget.
+ * Releasing a handle does not notify the cache, so eviction happens on the
+ * next Load() or Trim().
+ *
+ * Path hits do not re-read the file: call Remove() after changing a texture
+ * on disk. All methods are thread-safe; decoding happens under the cache lock.
+ */
+class TextureCache {
+public:
+    explicit TextureCache(const TextureCacheSettings& settings = TextureCacheSettings());
+    ~TextureCache();
+
+    // Disable copy
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    /**
+     * @brief Get a texture, loading it on the first request
+     * @param filepath Image or .ogtex path; relative paths resolve against the working directory
+     * @return Shared texture, or nullptr if the file could not be loaded
+     */
+    std::shared_ptr<Texture> Load(const std::string& filepath);
+
+    /**
+     * @brief Get an already cached texture without loading
+     * @param filepath Path previously passed to Load()
+     * @return Shared texture, or nullptr if not cached
+     */
+    std::shared_ptr<Texture> Find(const std::string& filepath);
+
+    /**
+     * @brief Forget a path; its texture is dropped once no other path or owner uses it
+     * @param filepath Path previously passed to Load()
+     */
+    void Remove(const std::string& filepath);
+
+    /**
+     * @brief Evict unreferenced textures until the cache is under budget
+     * @return Number of textures evicted
+     */
+    size_t Trim();
+
+    /**
+     * @brief Evict every unreferenced texture regardless of budget
+     * @return Number of textures evicted
+     */
+    size_t Clear();
+
+    /**
+     * @brief Change the budget and trim to it
+     * @param budgetBytes New budget in bytes
+     */
+    void SetBudget(size_t budgetBytes);
+
+    /**
+     * @brief Get counters and memory totals
+     */
+    TextureCacheStats GetStats() const;
+
+    /**
+     * @brief Describe every cached texture, most recently used first
+     */
+    std::vector<TextureCacheEntryInfo> GetEntries() const;
+
+    /**
+     * @brief Get the normalized absolute form of a path used as the cache key
+     */
+    static std::string MakeKey(const std::string& filepath);
+
+private:
+    struct Entry {
+        std::shared_ptr<Texture> texture;
+        std::vector<std::string> paths;
+        uint64_t contentHash = 0;
+        size_t fileSize = 0;
+        size_t bytes = 0;
+        uint64_t lastUsed = 0;
+    };
+    using EntryList = std::list<Entry>;
+
+    std::shared_ptr<Texture> Touch(EntryList::iterator entry);
+    size_t EvictLocked(size_t budgetBytes);
+    void EraseLocked(EntryList::iterator entry);
+
+    TextureCacheSettings settings_;
+    mutable std::mutex mutex_;
+    EntryList entries_;     // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> byPath_;
+    std::unordered_multimap<uint64_t, EntryList::iterator> byContent_;
+    size_t totalBytes_ = 0;
+    uint64_t clock_ = 0;
+    uint64_t pathHits_ = 0;
+    uint64_t contentHits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+} // namespace Graphics
+} // namespace OGDE
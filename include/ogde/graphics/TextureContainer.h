@@ -0,0 +1,106 @@
+#pragma once
+
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/MipGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+class Texture;
+
+/// File magic of .ogtex containers ("OGTX" in little-endian byte order)
+constexpr uint32_t kOgtexMagic = 0x5854474F;
+
+/// Current .ogtex version; readers reject any other version
+constexpr uint32_t kOgtexVersion = 1;
+
+/// The payload starts on a cache-line boundary so mapped pixels can be read with aligned SIMD loads
+constexpr size_t kOgtexPayloadAlignment = 64;
+
+/**
+ * @brief Fixed 64-byte header at the start of an .ogtex file
+ *
+ * All fields are little-endian. The header is followed by mipCount OgtexLevel
+ * entries and then, at payloadOffset, the pixel data of every level.
+ */
+struct OgtexHeader {
+    uint32_t magic = kOgtexMagic;
+    uint32_t version = kOgtexVersion;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t channels = 0;      ///< Channels of the source image (1-4)
+    uint32_t format = 0;        ///< 0 = uncompressed 8-bit, otherwise BlockFormat + 1
+    uint32_t mipCount = 0;
+    uint32_t flags = 0;         ///< Reserved, must be 0
+    uint64_t payloadOffset = 0; ///< Byte offset of the payload from the start of the file
+    uint64_t payloadSize = 0;   ///< Byte size of all levels
+    uint8_t reserved[16] = {};
+};
+
+/**
+ * @brief Level table entry; offset is relative to the payload
+ */
+struct OgtexLevel {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+static_assert(sizeof(OgtexHeader) == 64, "OgtexHeader layout must not change");
+static_assert(sizeof(OgtexLevel) == 24, "OgtexLevel layout must not change");
+
+/**
+ * @brief Description of a validated .ogtex image
+ */
+struct OgtexInfo {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    bool compressed = false;
+    BlockFormat blockFormat = BlockFormat::BC7;
+    const uint8_t* payload = nullptr;   ///< Points into the parsed buffer
+    std::vector<MipLevel> levels;
+};
+
+/**
+ * @brief Reader and writer for the engine-native .ogtex texture container
+ *
+ * An .ogtex file stores pixels exactly as the GPU consumes them: decoded 8-bit
+ * pixels or BC blocks, every mip level, tightly packed rows. Loading one is a
+ * memory map plus header validation; there is no decode step at runtime.
+ */
+class TextureContainer {
+public:
+    /**
+     * @brief Write a loaded texture (with its mip chain and compression) to disk
+     * @param filepath Destination path, conventionally with the .ogtex extension
+     * @param texture Source texture
+     * @return true if successful
+     */
+    static bool Write(const std::string& filepath, const Texture& texture);
+
+    /**
+     * @brief Validate an .ogtex image in memory
+     *
+     * Checks the magic, version and that every level lies inside the buffer with
+     * the size its dimensions and format require.
+     * @param data Start of the file contents
+     * @param size Size of the file contents
+     * @param outInfo Receives the description; its payload pointer aliases data
+     * @return true if the data is a valid container
+     */
+    static bool Parse(const uint8_t* data, size_t size, OgtexInfo& outInfo);
+
+    /**
+     * @brief Check whether a path has the .ogtex extension (case-insensitive)
+     */
+    static bool IsContainerPath(const std::string& filepath);
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/graphics/Texture.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ogde {
+namespace graphics {
+class Camera;
+}
+}
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Handle to a texture owned by a TextureLoader (0 = invalid)
+ */
+using TextureHandle = uint32_t;
+constexpr TextureHandle kInvalidTextureHandle = 0;
+
+/**
+ * @brief Lifecycle of an asynchronously loaded texture
+ */
+enum class TextureLoadState {
+    Queued,     ///< Waiting for a decode thread
+    Decoding,   ///< Being decoded on a background thread
+    Decoded,    ///< GPU-ready data waiting for an upload slot
+    Resident,   ///< Published by ProcessUploads(); GetTexture() returns it
+    Failed      ///< The file could not be loaded; the placeholder stays in use
+};
+
+/**
+ * @brief Per-request options applied on the decode thread
+ */
+struct TextureLoadOptions {
+    bool generateMipmaps = true;
+    MipSettings mipSettings;
+};
+
+/**
+ * @brief Snapshot of the loader's queues
+ */
+struct TextureLoaderStats {
+    uint32_t queued = 0;
+    uint32_t decoding = 0;
+    uint32_t decoded = 0;
+    uint32_t resident = 0;
+    uint32_t failed = 0;
+    size_t residentBytes = 0;
+    size_t lastUploadBytes = 0;     ///< Bytes published by the last ProcessUploads()
+    uint32_t lastUploadCount = 0;   ///< Textures published by the last ProcessUploads()
+};
+
+/**
+ * @brief Decodes textures on background threads
+ *
+ * Load() returns a handle immediately; until the texture becomes resident
+ * GetTexture() returns a small placeholder. Decode threads always pick the
+ * queued request with the highest priority, and priorities can be raised or
+ * lowered while a request waits (e.g. every frame from ComputeScreenPriority()).
+ *
+ * Decoded textures are not visible to the renderer until ProcessUploads() is
+ * called at a frame boundary. It publishes them in priority order under a byte
+ * budget so a burst of completions cannot stall a single frame.
+ *
+ * Load(), Unload(), SetPriority(), ProcessUploads() and GetTexture() are meant
+ * to be called from the main thread.
+ */
+class TextureLoader {
+public:
+    /// Called for each texture published by ProcessUploads(), e.g. to create GPU resources
+    using UploadCallback = std::function<void(TextureHandle handle, Texture& texture)>;
+
+    /**
+     * @brief Start the decode threads
+     * @param threadCount Number of background decode threads (at least 1)
+     */
+    explicit TextureLoader(uint32_t threadCount = 2);
+    ~TextureLoader();
+
+    // Disable copy
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    /**
+     * @brief Queue a texture for decoding
+     * @param filepath Image or .ogtex file
+     * @param priority Larger values are decoded and uploaded first
+     * @param options Mipmap generation options
+     * @return Handle that is valid until Unload(), or kInvalidTextureHandle if every handle slot is taken
+     */
+    TextureHandle Load(const std::string& filepath, float priority = 0.0f,
+                       const TextureLoadOptions& options = TextureLoadOptions());
+
+    /**
+     * @brief Change the priority of a queued or decoded texture
+     */
+    void SetPriority(TextureHandle handle, float priority);
+
+    /**
+     * @brief Release a texture; in-flight decodes are discarded when they finish
+     */
+    void Unload(TextureHandle handle);
+
+    /**
+     * @brief Publish decoded textures, highest priority first
+     *
+     * Stops before the texture that would exceed the budget. At least one texture
+     * is published per call so textures larger than the budget still arrive.
+     * @param byteBudget Maximum bytes of pixel data to publish this frame
+     * @param upload Optional callback run on each published texture
+     * @return Bytes published
+     */
+    size_t ProcessUploads(size_t byteBudget, const UploadCallback& upload = nullptr);
+
+    /**
+     * @brief Block until no texture is queued or decoding
+     */
+    void WaitIdle();
+
+    /**
+     * @brief Get the state of a texture
+     * @return Failed for invalid or unloaded handles
+     */
+    TextureLoadState GetState(TextureHandle handle) const;
+
+    /**
+     * @brief Get the texture to render with
+     * @return The resident texture, or the placeholder if it is not resident yet
+     */
+    const Texture& GetTexture(TextureHandle handle) const;
+
+    /**
+     * @brief Get the placeholder (a 2x2 grey checker) shown while textures load
+     */
+    const Texture& GetPlaceholder() const { return placeholder_; }
+
+    /**
+     * @brief Get queue and residency counters
+     */
+    TextureLoaderStats GetStats() const;
+
+    /**
+     * @brief Priority from projected size: the bounding sphere's diameter in pixels
+     *
+     * Near, large objects get high priorities; objects the camera is inside of
+     * get the full viewport height.
+     * @param camera Camera the object is seen from
+     * @param viewportHeight Viewport height in pixels
+     * @param x Sphere center X (same space as the camera position)
+     * @param y Sphere center Y
+     * @param z Sphere center Z
+     * @param radius Sphere radius
+     */
+    static float ComputeScreenPriority(const ogde::graphics::Camera& camera, float viewportHeight,
+                                       float x, float y, float z, float radius);
+
+private:
+    struct Slot {
+        std::string filepath;
+        TextureLoadOptions options;
+        TextureLoadState state = TextureLoadState::Failed;
+        float priority = 0.0f;
+        uint32_t generation = 0;
+        uint32_t version = 0;       // Bumped on every priority change; stale queue entries are skipped
+        bool inUse = false;
+        Texture decoded;            // Written by a decode thread
+        Texture resident;           // Only touched on the main thread
+    };
+
+    struct QueueEntry {
+        float priority;
+        uint32_t index;
+        uint32_t version;
+        bool operator<(const QueueEntry& other) const { return priority < other.priority; }
+    };
+
+    void WorkerLoop();
+    Slot* FindSlot(TextureHandle handle);
+    const Slot* FindSlot(TextureHandle handle) const;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::vector<std::thread> workers_;
+    bool shutdown_ = false;
+
+    std::deque<Slot> slots_;                // Deque keeps references stable as it grows
+    std::vector<uint32_t> freeSlots_;
+    std::priority_queue<QueueEntry> queue_;
+    std::vector<uint32_t> completed_;       // Slots in the Decoded state
+    uint32_t pending_ = 0;                  // Queued + decoding
+
+    Texture placeholder_;
+    size_t lastUploadBytes_ = 0;
+    uint32_t lastUploadCount_ = 0;
+};
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "ogde/graphics/Texture.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+/**
+ * @brief Handle to a texture registered with a TextureStreamer (0 = invalid)
+ *
+ * Handles pack a 24-bit slot index with an 8-bit generation, so a handle kept
+ * past Unregister() is rejected instead of reaching the slot's next texture.
+ */
+using StreamedTextureHandle = uint32_t;
+constexpr StreamedTextureHandle kInvalidStreamedTexture = 0;
+
+/**
+ * @brief Options for mip streaming
+ */
+struct StreamingSettings {
+    /// Resident bytes the streamer tries to stay under (mip tails always stay resident)
+    size_t budgetBytes = 256u * 1024u * 1024u;
+
+    /// Levels whose width and height are both at most this size form the always-resident tail
+    int tailSize = 16;
+
+    /// Upper bound on bytes streamed in by one Update() call, to bound frame time
+    size_t maxLoadBytesPerUpdate = 16u * 1024u * 1024u;
+};
+
+/**
+ * @brief Per-texture residency, as shown by debug overlays
+ */
+struct TextureResidency {
+    int mipCount = 0;
+    int residentMip = 0;        ///< Most detailed resident level
+    int desiredMip = 0;         ///< Most detailed level requested by usage feedback
+    int tailMip = 0;            ///< First level of the pinned tail
+    size_t residentBytes = 0;
+    size_t fullBytes = 0;       ///< Bytes with every level resident
+    uint64_t lastUsedFrame = 0;
+    uint32_t loads = 0;         ///< Levels streamed in over the texture's lifetime
+    uint32_t evictions = 0;     ///< Levels evicted over the texture's lifetime
+};
+
+/**
+ * @brief Totals for the whole streamer
+ */
+struct StreamingStats {
+    uint32_t textureCount = 0;
+    size_t budgetBytes = 0;
+    size_t residentBytes = 0;
+    uint32_t pendingTextures = 0;       ///< Textures whose desired level is not resident
+    uint32_t loadsLastUpdate = 0;
+    uint32_t evictionsLastUpdate = 0;
+    size_t bytesLoadedLastUpdate = 0;
+};
+
+/**
+ * @brief Keeps only the mip levels that are actually needed resident
+ *
+ * Textures are registered from .ogtex containers, which are memory-mapped,
+ * so any level can be read without decoding the rest. Registration streams in
+ * only the small mip tail. Each frame the renderer reports the most detailed
+ * level it sampled for a texture (ReportUsage(), e.g. from ComputeDesiredMip()),
+ * and Update() streams in finer levels one at a time, largest deficit first.
+ *
+ * When a load would exceed the budget, levels are evicted finest-first from
+ * textures that hold more detail than requested or that were least recently
+ * used. Levels requested by a texture in use this frame are never evicted to
+ * make room for another one; that request waits instead.
+ *
+ * All methods are meant to be called from the main thread.
+ */
+class TextureStreamer {
+public:
+    explicit TextureStreamer(const StreamingSettings& settings = StreamingSettings());
+    ~TextureStreamer();
+
+    // Disable copy
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    /**
+     * @brief Register an .ogtex texture and make its mip tail resident
+     * @param filepath Path to an .ogtex container with a mip chain
+     * @return Handle, or kInvalidStreamedTexture if the file cannot be mapped or every handle slot is taken
+     */
+    StreamedTextureHandle Register(const std::string& filepath);
+
+    /**
+     * @brief Release every resident level and the mapping
+     */
+    void Unregister(StreamedTextureHandle handle);
+
+    /**
+     * @brief Usage feedback: the texture was sampled this frame down to a level
+     * @param handle Texture
+     * @param desiredMip Most detailed level needed (0 = full resolution)
+     */
+    void ReportUsage(StreamedTextureHandle handle, int desiredMip);
+
+    /**
+     * @brief Stream in requested levels and evict to stay under budget; call once per frame
+     */
+    void Update();
+
+    /**
+     * @brief Change the budget; eviction happens on the next Update()
+     */
+    void SetBudget(size_t budgetBytes) { settings_.budgetBytes = budgetBytes; }
+
+    /**
+     * @brief Get a resident level
+     * @return Pixels or blocks of the level, or nullptr if it is not resident
+     */
+    const uint8_t* GetLevelData(StreamedTextureHandle handle, int level) const;
+
+    /**
+     * @brief Get the source texture (width, format, level layout)
+     */
+    const Texture& GetSource(StreamedTextureHandle handle) const;
+
+    /**
+     * @brief Get residency information for a texture
+     */
+    TextureResidency GetResidency(StreamedTextureHandle handle) const;
+
+    /**
+     * @brief Get totals for the last Update()
+     */
+    StreamingStats GetStats() const;
+
+    /**
+     * @brief Most detailed level worth sampling for a texture covering the given pixels
+     * @param width Texture width
+     * @param height Texture height
+     * @param projectedPixels Screen size of the surface along its larger axis
+     * @return Level in [0, mip count)
+     */
+    static int ComputeDesiredMip(int width, int height, float projectedPixels);
+
+private:
+    struct Entry {
+        Texture source;                             // Mapped .ogtex; never read unless streaming
+        std::vector<std::vector<uint8_t>> levels;   // Resident copies, empty when not resident
+        int residentMip = 0;
+        int desiredMip = 0;
+        int tailMip = 0;
+        uint64_t lastUsedFrame = 0;
+        uint32_t loads = 0;
+        uint32_t evictions = 0;
+    };
+
+    Entry* FindEntry(StreamedTextureHandle handle);
+    const Entry* FindEntry(StreamedTextureHandle handle) const;
+    bool MakeRoom(size_t bytes, const Entry* requester);
+    void LoadLevel(Entry& entry, int level);
+    void EvictLevel(Entry& entry);
+
+    StreamingSettings settings_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+    std::vector<uint32_t> generations_;     // Per slot, bumped by Unregister()
+    std::vector<uint32_t> freeEntries_;
+    uint64_t frame_ = 1;
+    size_t residentBytes_ = 0;
+
+    uint32_t loadsLastUpdate_ = 0;
+    uint32_t evictionsLastUpdate_ = 0;
+    size_t bytesLoadedLastUpdate_ = 0;
+    uint32_t pendingLastUpdate_ = 0;
+};
+
+} // namespace Graphics
+} // namespace OGDE
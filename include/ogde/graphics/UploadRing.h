@@ -0,0 +1,145 @@
+/**
+ * @file UploadRing.h
+ * @brief Fenced ring sub-allocator for per-frame dynamic GPU data
+ */
+
+#ifndef OGDE_GRAPHICS_UPLOADRING_H
+#define OGDE_GRAPHICS_UPLOADRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace ogde {
+namespace graphics {
+
+/**
+ * @struct UploadAllocation
+ * @brief Byte range handed out by UploadRing::allocate()
+ */
+struct UploadAllocation {
+    uint64_t offset = 0;    ///< Byte offset in the backing buffer, aligned as requested
+    uint64_t size = 0;
+    bool valid = false;     ///< false when the ring had no room (see UploadRing)
+};
+
+/**
+ * @struct UploadRingStats
+ * @brief Usage counters
+ */
+struct UploadRingStats {
+    uint64_t frameBytes = 0;        ///< Bytes (with alignment padding) allocated in the open frame
+    uint64_t peakFrameDemand = 0;   ///< Most bytes requested in one closed frame, including overflowed requests
+    uint64_t allocations = 0;
+    uint64_t overflows = 0;         ///< allocate() calls that found no room
+    uint64_t wraps = 0;             ///< Times the head wrapped to the start
+};
+
+/**
+ * @class UploadRing
+ * @brief Allocation policy for a ring buffer shared by CPU writes and GPU reads
+ *
+ * The ring only manages offsets; the backend owns the actual buffer. Each
+ * frame allocates from the head, then endFrame() closes the frame with a
+ * fence value the backend signals once the GPU is done with it. retire()
+ * with the latest completed fence releases the space of every frame up to
+ * that fence, so memory the GPU may still read is never handed out again.
+ * Allocations are contiguous: one that does not fit before the end of the
+ * buffer skips the remainder and starts at offset 0.
+ *
+ * When the ring is full, allocate() returns an invalid allocation and
+ * counts an overflow. The backend then either waits for
+ * getOldestPendingFence() and retires it, or (D3D11) renames the buffer
+ * with a discard and calls reset(). getRecommendedCapacity() gives a size
+ * that would have avoided overflow, for growing the buffer at a frame
+ * boundary.
+ *
+ * Fence values must increase from frame to frame. Not thread-safe: the
+ * render thread owns the ring.
+ */
+class UploadRing {
+public:
+    /**
+     * @brief Create a ring
+     * @param capacity Size of the backing buffer in bytes
+     */
+    explicit UploadRing(uint64_t capacity = 0);
+    ~UploadRing();
+
+    /**
+     * @brief Forget all allocations and frames and set a new capacity
+     *
+     * Used after the backend replaced or renamed its buffer, so nothing
+     * from before is in use anymore.
+     */
+    void reset(uint64_t capacity);
+
+    /**
+     * @brief Allocate a contiguous range in the open frame
+     * @param size Bytes needed
+     * @param alignment Power-of-two alignment of the returned offset
+     * @return Allocation, invalid if the range does not fit right now (or size is 0)
+     */
+    UploadAllocation allocate(uint64_t size, uint64_t alignment = 16);
+
+    /**
+     * @brief Close the open frame
+     * @param fence Value that the backend signals when the GPU has finished the frame
+     */
+    void endFrame(uint64_t fence);
+
+    /**
+     * @brief Release the space of every closed frame whose fence is <= completedFence
+     */
+    void retire(uint64_t completedFence);
+
+    /**
+     * @brief Check whether closed frames are still waiting on their fence
+     */
+    bool hasPendingFrames() const { return !m_frames.empty(); }
+
+    /**
+     * @brief Get the fence of the oldest closed frame still in use (0 if none)
+     */
+    uint64_t getOldestPendingFence() const;
+
+    /**
+     * @brief Get the number of closed frames still in use
+     */
+    uint32_t getPendingFrameCount() const { return static_cast<uint32_t>(m_frames.size()); }
+
+    /**
+     * @brief Get the bytes in use by pending frames and the open frame, including padding
+     */
+    uint64_t getUsedBytes() const { return m_head - m_tail; }
+
+    uint64_t getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Get a capacity that holds the peak frame for every frame in flight
+     * @param framesInFlight Frames the GPU may lag behind the CPU, plus the one being recorded
+     * @return Power of two, at least the current capacity
+     */
+    uint64_t getRecommendedCapacity(uint32_t framesInFlight) const;
+
+    const UploadRingStats& getStats() const { return m_stats; }
+
+private:
+    struct Frame {
+        uint64_t fence;
+        uint64_t end;       // Head position when the frame closed
+    };
+
+    uint64_t m_capacity;
+    uint64_t m_head;        // Positions grow monotonically; offsets are taken modulo capacity
+    uint64_t m_tail;
+    uint64_t m_frameStart;
+    uint64_t m_frameDemand;     // Requested bytes of the open frame, successful or not
+    std::deque<Frame> m_frames;
+    UploadRingStats m_stats;
+};
+
+} // namespace graphics
+} // namespace ogde
+
+#endif // OGDE_GRAPHICS_UPLOADRING_H
@@ -0,0 +1,60 @@
+/**
+ * @file CpuFeatures.h
+ * @brief Runtime CPU instruction set detection
+ */
+
+#ifndef OGDE_PLATFORM_CPUFEATURES_H
+#define OGDE_PLATFORM_CPUFEATURES_H
+
+// Instruction set availability at compile time (x86/x64 only)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define OGDE_ARCH_X86
+#endif
+
+// Function-level target attributes so SIMD kernels can be compiled without
+// raising the baseline architecture of the whole build. MSVC allows any
+// intrinsic in any function, so the attributes expand to nothing there.
+#if defined(OGDE_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define OGDE_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #define OGDE_TARGET_SSE41 __attribute__((target("sse4.1")))
+    #define OGDE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+    #define OGDE_TARGET_SSSE3
+    #define OGDE_TARGET_SSE41
+    #define OGDE_TARGET_AVX2
+#endif
+
+namespace ogde {
+namespace platform {
+
+/**
+ * @class CpuFeatures
+ * @brief Queries which SIMD instruction sets the host CPU and OS support
+ *
+ * Results are detected once and cached. SSE2 is assumed on all x86-64 targets.
+ */
+class CpuFeatures {
+public:
+    /**
+     * @brief Check for SSSE3 support (byte shuffles)
+     * @return true if SSSE3 is available
+     */
+    static bool hasSSSE3();
+
+    /**
+     * @brief Check for SSE4.1 support
+     * @return true if SSE4.1 is available
+     */
+    static bool hasSSE41();
+
+    /**
+     * @brief Check for AVX2 and FMA support (including OS YMM state support)
+     * @return true if AVX2 and FMA are available
+     */
+    static bool hasAVX2();
+};
+
+} // namespace platform
+} // namespace ogde
+
+#endif // OGDE_PLATFORM_CPUFEATURES_H
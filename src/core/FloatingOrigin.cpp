@@ -0,0 +1,88 @@
+/**
+ * Floating Origin Implementation
+ */
+
+#include "ogde/core/FloatingOrigin.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ogde {
+namespace core {
+
+FloatingOrigin::FloatingOrigin(double rebaseDistance)
+    : m_rebaseDistance(rebaseDistance)
+    , m_rebaseCount(0)
+    , m_nextListenerId(1)
+{
+}
+
+void FloatingOrigin::setOrigin(const Vector3d& origin) {
+    if (origin.x == m_origin.x && origin.y == m_origin.y && origin.z == m_origin.z) {
+        return;
+    }
+
+    // Origins are normally grid-snapped, so this difference is exact in float
+    Vector3 shift(static_cast<float>(m_origin.x - origin.x),
+                  static_cast<float>(m_origin.y - origin.y),
+                  static_cast<float>(m_origin.z - origin.z));
+    m_origin = origin;
+    m_rebaseCount++;
+
+    for (const Listener& listener : m_listeners) {
+        listener.callback(m_origin, shift);
+    }
+}
+
+bool FloatingOrigin::update(const Vector3d& focus) {
+    if (m_rebaseDistance <= 0.0) {
+        return false;
+    }
+
+    double dx = std::abs(focus.x - m_origin.x);
+    double dy = std::abs(focus.y - m_origin.y);
+    double dz = std::abs(focus.z - m_origin.z);
+    if (std::max(dx, std::max(dy, dz)) <= m_rebaseDistance) {
+        return false;
+    }
+
+    // Snap so that the same focus always produces the same origin
+    double cell = m_rebaseDistance;
+    setOrigin(Vector3d(std::round(focus.x / cell) * cell,
+                       std::round(focus.y / cell) * cell,
+                       std::round(focus.z / cell) * cell));
+    return true;
+}
+
+void FloatingOrigin::toLocal(const Vector3d* world, Vector3* outLocal, uint32_t count) const {
+    const double ox = m_origin.x;
+    const double oy = m_origin.y;
+    const double oz = m_origin.z;
+    for (uint32_t i = 0; i < count; ++i) {
+        outLocal[i].x = static_cast<float>(world[i].x - ox);
+        outLocal[i].y = static_cast<float>(world[i].y - oy);
+        outLocal[i].z = static_cast<float>(world[i].z - oz);
+    }
+}
+
+void FloatingOrigin::applyShift(Vector3* positions, uint32_t count, const Vector3& shift) {
+    for (uint32_t i = 0; i < count; ++i) {
+        positions[i].x += shift.x;
+        positions[i].y += shift.y;
+        positions[i].z += shift.z;
+    }
+}
+
+uint32_t FloatingOrigin::addListener(RebaseCallback callback) {
+    uint32_t id = m_nextListenerId++;
+    m_listeners.push_back({ id, std::move(callback) });
+    return id;
+}
+
+void FloatingOrigin::removeListener(uint32_t id) {
+    m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(),
+                                     [id](const Listener& listener) { return listener.id == id; }),
+                      m_listeners.end());
+}
+
+} // namespace core
+} // namespace ogde
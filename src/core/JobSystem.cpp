@@ -0,0 +1,125 @@
+/**
+ * Job System Implementation
+ */
+
+#include "ogde/core/JobSystem.h"
+#include <algorithm>
+
+namespace ogde {
+namespace core {
+
+namespace {
+// Set while a thread is executing loop ranges so nested loops run inline
+thread_local bool t_insideLoop = false;
+}
+
+JobSystem::JobSystem(uint32_t workerCount)
+    : m_function(nullptr)
+    , m_count(0)
+    , m_grainSize(1)
+    , m_rangeCount(0)
+    , m_nextRange(0)
+    , m_pendingWorkers(0)
+    , m_generation(0)
+    , m_shutdown(false)
+{
+    if (workerCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void JobSystem::parallelFor(uint32_t count, uint32_t grainSize,
+                            const std::function<void(uint32_t begin, uint32_t end)>& fn) {
+    if (count == 0) {
+        return;
+    }
+
+    if (grainSize == 0) {
+        // A few ranges per thread balances uneven work without much overhead
+        grainSize = std::max(1u, count / (getThreadCount() * 4));
+    }
+
+    if (m_workers.empty() || t_insideLoop || count <= grainSize) {
+        fn(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_function = &fn;
+        m_count = count;
+        m_grainSize = grainSize;
+        m_rangeCount = (count + grainSize - 1) / grainSize;
+        m_nextRange.store(0);
+        m_pendingWorkers = getWorkerCount();
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    runRanges();
+
+    // Every worker must leave the loop before its state can be reused
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_pendingWorkers == 0; });
+    m_function = nullptr;
+}
+
+void JobSystem::runRanges() {
+    t_insideLoop = true;
+    for (;;) {
+        uint32_t range = m_nextRange.fetch_add(1);
+        if (range >= m_rangeCount) {
+            break;
+        }
+        uint32_t begin = range * m_grainSize;
+        uint32_t end = std::min(begin + m_grainSize, m_count);
+        (*m_function)(begin, end);
+    }
+    t_insideLoop = false;
+}
+
+void JobSystem::workerLoop() {
+    uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&]() { return m_shutdown || m_generation != seenGeneration; });
+            if (m_shutdown) {
+                return;
+            }
+            seenGeneration = m_generation;
+        }
+        runRanges();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_pendingWorkers == 0) {
+            m_done.notify_all();
+        }
+    }
+}
+
+JobSystem& JobSystem::shared() {
+    static JobSystem s_jobSystem;
+    return s_jobSystem;
+}
+
+} // namespace core
+} // namespace ogde
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <ctime>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 
 namespace ogde {
@@ -14,6 +15,7 @@ namespace core {
 
 static std::ofstream g_logFile;
 static bool g_fileLoggingEnabled = false;
+static std::mutex g_logMutex;  // Background loaders log from worker threads
 
 static std::string getCurrentTimestamp() {
     auto now = std::time(nullptr);
@@ -55,6 +57,7 @@ void Logger::shutdownFileLogging() {
 }
 
 void Logger::log(LogLevel level, const std::string& message) {
+    std::lock_guard<std::mutex> lock(g_logMutex);
     std::string timestamp = getCurrentTimestamp();
     std::string levelStr = getLevelString(level);
     std::string fullMessage = "[" + timestamp + "] [" + levelStr + "] " + message;
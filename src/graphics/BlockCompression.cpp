@@ -0,0 +1,1007 @@
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// BC7 interpolation weights (out of 64) for 2, 3 and 4-bit indices
+const int kWeights2[4] = { 0, 21, 43, 64 };
+const int kWeights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+const int kWeights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+
+struct Block {
+    uint8_t rgba[16][4];
+};
+
+int RefineIterations(CompressionQuality quality) {
+    switch (quality) {
+        case CompressionQuality::Fast:
+            return 0;
+        case CompressionQuality::Normal:
+            return 1;
+        case CompressionQuality::High:
+        default:
+            return 4;
+    }
+}
+
+inline int Clamp255(int v) {
+    return std::min(255, std::max(0, v));
+}
+
+inline void ExpandPixel(const uint8_t* p, int channels, uint8_t* out) {
+    switch (channels) {
+        case 1:
+            out[0] = out[1] = out[2] = p[0];
+            out[3] = 255;
+            break;
+        case 2:
+            out[0] = p[0];
+            out[1] = p[1];
+            out[2] = 0;
+            out[3] = 255;
+            break;
+        case 3:
+            out[0] = p[0];
+            out[1] = p[1];
+            out[2] = p[2];
+            out[3] = 255;
+            break;
+        default:
+            std::memcpy(out, p, 4);
+            break;
+    }
+}
+
+void LoadBlock(const uint8_t* pixels, int width, int height, int channels, int bx, int by, Block& block) {
+    for (int y = 0; y < 4; ++y) {
+        int sy = std::min(by * 4 + y, height - 1);
+        for (int x = 0; x < 4; ++x) {
+            int sx = std::min(bx * 4 + x, width - 1);
+            ExpandPixel(pixels + (static_cast<size_t>(sy) * width + sx) * channels, channels, block.rgba[y * 4 + x]);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Endpoint fitting shared by all formats
+// ---------------------------------------------------------------------------
+
+/**
+ * Mean and dominant direction of the block's colors, by power iteration on the
+ * covariance matrix. Returns the projection range along the axis.
+ */
+void FitPrincipalAxis(const float points[16][4], int dims, float mean[4], float axis[4],
+                      float& outMin, float& outMax) {
+    float low[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+    float high[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int c = 0; c < 4; ++c) {
+        mean[c] = 0.0f;
+        axis[c] = 0.0f;
+    }
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < dims; ++c) {
+            mean[c] += points[i][c];
+            low[c] = std::min(low[c], points[i][c]);
+            high[c] = std::max(high[c], points[i][c]);
+        }
+    }
+    for (int c = 0; c < dims; ++c) {
+        mean[c] /= 16.0f;
+    }
+
+    float covariance[4][4] = {};
+    for (int i = 0; i < 16; ++i) {
+        float d[4];
+        for (int c = 0; c < dims; ++c) {
+            d[c] = points[i][c] - mean[c];
+        }
+        for (int r = 0; r < dims; ++r) {
+            for (int c = 0; c < dims; ++c) {
+                covariance[r][c] += d[r] * d[c];
+            }
+        }
+    }
+
+    // Start from the bounding box diagonal, which is usually close already
+    for (int c = 0; c < dims; ++c) {
+        axis[c] = high[c] - low[c];
+    }
+    for (int iteration = 0; iteration < 8; ++iteration) {
+        float next[4] = {};
+        float length = 0.0f;
+        for (int r = 0; r < dims; ++r) {
+            for (int c = 0; c < dims; ++c) {
+                next[r] += covariance[r][c] * axis[c];
+            }
+            length += next[r] * next[r];
+        }
+        if (length < 1e-12f) {
+            break;
+        }
+        length = 1.0f / std::sqrt(length);
+        for (int c = 0; c < dims; ++c) {
+            axis[c] = next[c] * length;
+        }
+    }
+
+    float axisLength = 0.0f;
+    for (int c = 0; c < dims; ++c) {
+        axisLength += axis[c] * axis[c];
+    }
+    if (axisLength < 1e-12f) {
+        outMin = outMax = 0.0f;
+        return;
+    }
+    axisLength = 1.0f / std::sqrt(axisLength);
+    for (int c = 0; c < dims; ++c) {
+        axis[c] *= axisLength;
+    }
+
+    outMin = 1e30f;
+    outMax = -1e30f;
+    for (int i = 0; i < 16; ++i) {
+        float t = 0.0f;
+        for (int c = 0; c < dims; ++c) {
+            t += (points[i][c] - mean[c]) * axis[c];
+        }
+        outMin = std::min(outMin, t);
+        outMax = std::max(outMax, t);
+    }
+}
+
+/**
+ * Least-squares endpoints for fixed interpolation factors: each point is
+ * modelled as (1 - t) * e0 + t * e1. Returns false if the system is singular.
+ */
+bool FitEndpointsLeastSquares(const float points[16][4], int dims, const float t[16], float e0[4], float e1[4]) {
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ap[4] = {}, bp[4] = {};
+    for (int i = 0; i < 16; ++i) {
+        float a = 1.0f - t[i];
+        float b = t[i];
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (int c = 0; c < dims; ++c) {
+            ap[c] += a * points[i][c];
+            bp[c] += b * points[i][c];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if (std::abs(det) < 1e-6f) {
+        return false;
+    }
+    float invDet = 1.0f / det;
+    for (int c = 0; c < dims; ++c) {
+        e0[c] = std::min(255.0f, std::max(0.0f, (bb * ap[c] - ab * bp[c]) * invDet));
+        e1[c] = std::min(255.0f, std::max(0.0f, (aa * bp[c] - ab * ap[c]) * invDet));
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// BC1 color blocks
+// ---------------------------------------------------------------------------
+
+uint16_t PackRgb565(const float c[3]) {
+    int r = std::min(31, std::max(0, static_cast<int>(c[0] * (31.0f / 255.0f) + 0.5f)));
+    int g = std::min(63, std::max(0, static_cast<int>(c[1] * (63.0f / 255.0f) + 0.5f)));
+    int b = std::min(31, std::max(0, static_cast<int>(c[2] * (31.0f / 255.0f) + 0.5f)));
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void UnpackRgb565(uint16_t v, int out[3]) {
+    int r = (v >> 11) & 31;
+    int g = (v >> 5) & 63;
+    int b = v & 31;
+    out[0] = (r << 3) | (r >> 2);
+    out[1] = (g << 2) | (g >> 4);
+    out[2] = (b << 3) | (b >> 2);
+}
+
+void Bc1Palette(uint16_t c0, uint16_t c1, bool fourColor, int palette[4][4]) {
+    int a[3], b[3];
+    UnpackRgb565(c0, a);
+    UnpackRgb565(c1, b);
+    for (int c = 0; c < 3; ++c) {
+        palette[0][c] = a[c];
+        palette[1][c] = b[c];
+        if (fourColor) {
+            palette[2][c] = (2 * a[c] + b[c] + 1) / 3;
+            palette[3][c] = (a[c] + 2 * b[c] + 1) / 3;
+        } else {
+            palette[2][c] = (a[c] + b[c] + 1) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[0][3] = palette[1][3] = palette[2][3] = 255;
+    palette[3][3] = fourColor ? 255 : 0;
+}
+
+int AssignBc1Indices(const Block& block, uint16_t c0, uint16_t c1, uint8_t indices[16]) {
+    int palette[4][4];
+    Bc1Palette(c0, c1, true, palette);
+    int total = 0;
+    for (int i = 0; i < 16; ++i) {
+        int best = 0x7fffffff;
+        for (int p = 0; p < 4; ++p) {
+            int dr = block.rgba[i][0] - palette[p][0];
+            int dg = block.rgba[i][1] - palette[p][1];
+            int db = block.rgba[i][2] - palette[p][2];
+            int error = dr * dr + dg * dg + db * db;
+            if (error < best) {
+                best = error;
+                indices[i] = static_cast<uint8_t>(p);
+            }
+        }
+        total += best;
+    }
+    return total;
+}
+
+void EncodeBc1Block(const Block& block, int refineIterations, uint8_t* out) {
+    float points[16][4];
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            points[i][c] = block.rgba[i][c];
+        }
+    }
+
+    float mean[4], axis[4], tMin, tMax;
+    FitPrincipalAxis(points, 3, mean, axis, tMin, tMax);
+    float e0[4], e1[4];
+    for (int c = 0; c < 3; ++c) {
+        e0[c] = mean[c] + axis[c] * tMax;
+        e1[c] = mean[c] + axis[c] * tMin;
+    }
+
+    uint16_t c0 = PackRgb565(e0);
+    uint16_t c1 = PackRgb565(e1);
+    uint8_t indices[16];
+    int error = AssignBc1Indices(block, c0, c1, indices);
+
+    // Index i of the 4-color palette sits at this fraction of the way from c0 to c1
+    static const float kFactors[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+    for (int iteration = 0; iteration < refineIterations && error > 0; ++iteration) {
+        float t[16];
+        for (int i = 0; i < 16; ++i) {
+            t[i] = kFactors[indices[i]];
+        }
+        if (!FitEndpointsLeastSquares(points, 3, t, e0, e1)) {
+            break;
+        }
+        uint16_t n0 = PackRgb565(e0);
+        uint16_t n1 = PackRgb565(e1);
+        uint8_t candidate[16];
+        int candidateError = AssignBc1Indices(block, n0, n1, candidate);
+        if (candidateError >= error) {
+            break;
+        }
+        c0 = n0;
+        c1 = n1;
+        error = candidateError;
+        std::memcpy(indices, candidate, sizeof(indices));
+    }
+
+    // color0 > color1 selects the 4-color palette; swapping endpoints swaps index pairs
+    if (c0 < c1) {
+        std::swap(c0, c1);
+        for (int i = 0; i < 16; ++i) {
+            indices[i] ^= 1;
+        }
+    } else if (c0 == c1) {
+        std::memset(indices, 0, sizeof(indices));
+    }
+
+    uint32_t packed = 0;
+    for (int i = 0; i < 16; ++i) {
+        packed |= static_cast<uint32_t>(indices[i]) << (i * 2);
+    }
+    out[0] = static_cast<uint8_t>(c0 & 0xff);
+    out[1] = static_cast<uint8_t>(c0 >> 8);
+    out[2] = static_cast<uint8_t>(c1 & 0xff);
+    out[3] = static_cast<uint8_t>(c1 >> 8);
+    for (int b = 0; b < 4; ++b) {
+        out[4 + b] = static_cast<uint8_t>(packed >> (b * 8));
+    }
+}
+
+void DecodeBc1Block(const uint8_t* in, bool forceFourColor, uint8_t out[16][4]) {
+    uint16_t c0 = static_cast<uint16_t>(in[0] | (in[1] << 8));
+    uint16_t c1 = static_cast<uint16_t>(in[2] | (in[3] << 8));
+    int palette[4][4];
+    Bc1Palette(c0, c1, forceFourColor || c0 > c1, palette);
+    uint32_t packed = in[4] | (in[5] << 8) | (in[6] << 16) | (static_cast<uint32_t>(in[7]) << 24);
+    for (int i = 0; i < 16; ++i) {
+        const int* color = palette[(packed >> (i * 2)) & 3];
+        for (int c = 0; c < 4; ++c) {
+            out[i][c] = static_cast<uint8_t>(color[c]);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BC4 single-channel blocks (also BC3 alpha and both BC5 channels)
+// ---------------------------------------------------------------------------
+
+void Bc4Palette(int e0, int e1, int palette[8]) {
+    palette[0] = e0;
+    palette[1] = e1;
+    if (e0 > e1) {
+        for (int i = 1; i <= 6; ++i) {
+            palette[i + 1] = ((7 - i) * e0 + i * e1 + 3) / 7;
+        }
+    } else {
+        for (int i = 1; i <= 4; ++i) {
+            palette[i + 1] = ((5 - i) * e0 + i * e1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+int AssignBc4Indices(const uint8_t values[16], int e0, int e1, uint8_t indices[16]) {
+    int palette[8];
+    Bc4Palette(e0, e1, palette);
+    int total = 0;
+    for (int i = 0; i < 16; ++i) {
+        int best = 0x7fffffff;
+        for (int p = 0; p < 8; ++p) {
+            int d = values[i] - palette[p];
+            if (d * d < best) {
+                best = d * d;
+                indices[i] = static_cast<uint8_t>(p);
+            }
+        }
+        total += best;
+    }
+    return total;
+}
+
+void EncodeBc4Block(const uint8_t values[16], int refineIterations, uint8_t* out) {
+    int low = 255, high = 0;
+    for (int i = 0; i < 16; ++i) {
+        low = std::min(low, static_cast<int>(values[i]));
+        high = std::max(high, static_cast<int>(values[i]));
+    }
+
+    uint8_t indices[16] = {};
+    int e0 = high;
+    int e1 = low;
+    if (high > low) {
+        int error = AssignBc4Indices(values, e0, e1, indices);
+
+        // Index i of the 8-value palette sits at this fraction of the way from e0 to e1
+        static const float kFactors[8] = { 0.0f, 1.0f, 1.0f / 7, 2.0f / 7, 3.0f / 7, 4.0f / 7, 5.0f / 7, 6.0f / 7 };
+        float points[16][4];
+        for (int i = 0; i < 16; ++i) {
+            points[i][0] = values[i];
+        }
+        for (int iteration = 0; iteration < refineIterations && error > 0; ++iteration) {
+            float t[16], f0[4], f1[4];
+            for (int i = 0; i < 16; ++i) {
+                t[i] = kFactors[indices[i]];
+            }
+            if (!FitEndpointsLeastSquares(points, 1, t, f0, f1)) {
+                break;
+            }
+            int n0 = Clamp255(static_cast<int>(f0[0] + 0.5f));
+            int n1 = Clamp255(static_cast<int>(f1[0] + 0.5f));
+            if (n0 <= n1) {
+                break;  // Would switch to the 6-value palette
+            }
+            uint8_t candidate[16];
+            int candidateError = AssignBc4Indices(values, n0, n1, candidate);
+            if (candidateError >= error) {
+                break;
+            }
+            e0 = n0;
+            e1 = n1;
+            error = candidateError;
+            std::memcpy(indices, candidate, sizeof(indices));
+        }
+    }
+
+    uint64_t packed = 0;
+    for (int i = 0; i < 16; ++i) {
+        packed |= static_cast<uint64_t>(indices[i]) << (i * 3);
+    }
+    out[0] = static_cast<uint8_t>(e0);
+    out[1] = static_cast<uint8_t>(e1);
+    for (int b = 0; b < 6; ++b) {
+        out[2 + b] = static_cast<uint8_t>(packed >> (b * 8));
+    }
+}
+
+void DecodeBc4Block(const uint8_t* in, uint8_t out[16]) {
+    int palette[8];
+    Bc4Palette(in[0], in[1], palette);
+    uint64_t packed = 0;
+    for (int b = 0; b < 6; ++b) {
+        packed |= static_cast<uint64_t>(in[2 + b]) << (b * 8);
+    }
+    for (int i = 0; i < 16; ++i) {
+        out[i] = static_cast<uint8_t>(palette[(packed >> (i * 3)) & 7]);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// BC7 (encodes modes 5 and 6, decodes single-subset modes 4, 5 and 6)
+// ---------------------------------------------------------------------------
+
+class BitWriter {
+public:
+    explicit BitWriter(uint8_t* out) : out_(out), position_(0) { std::memset(out, 0, 16); }
+
+    void Write(uint32_t value, int bits) {
+        for (int i = 0; i < bits; ++i, ++position_) {
+            if ((value >> i) & 1) {
+                out_[position_ >> 3] |= static_cast<uint8_t>(1 << (position_ & 7));
+            }
+        }
+    }
+
+private:
+    uint8_t* out_;
+    int position_;
+};
+
+class BitReader {
+public:
+    explicit BitReader(const uint8_t* in) : in_(in), position_(0) {}
+
+    uint32_t Read(int bits) {
+        uint32_t value = 0;
+        for (int i = 0; i < bits; ++i, ++position_) {
+            value |= static_cast<uint32_t>((in_[position_ >> 3] >> (position_ & 7)) & 1) << i;
+        }
+        return value;
+    }
+
+private:
+    const uint8_t* in_;
+    int position_;
+};
+
+inline int Interpolate64(int e0, int e1, int weight) {
+    return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+}
+
+// Assign each pixel the nearest palette entry over the first `dims` channels starting at `first`
+int AssignIndices(const Block& block, int first, int dims, const int e0[4], const int e1[4],
+                  const int* weights, int count, uint8_t indices[16]) {
+    int palette[16][4];
+    for (int p = 0; p < count; ++p) {
+        for (int c = first; c < first + dims; ++c) {
+            palette[p][c] = Interpolate64(e0[c], e1[c], weights[p]);
+        }
+    }
+    int total = 0;
+    for (int i = 0; i < 16; ++i) {
+        int best = 0x7fffffff;
+        for (int p = 0; p < count; ++p) {
+            int error = 0;
+            for (int c = first; c < first + dims; ++c) {
+                int d = block.rgba[i][c] - palette[p][c];
+                error += d * d;
+            }
+            if (error < best) {
+                best = error;
+                indices[i] = static_cast<uint8_t>(p);
+            }
+        }
+        total += best;
+    }
+    return total;
+}
+
+struct Mode6Endpoints {
+    int quantized[2][4];   // 7-bit
+    int pbit[2];
+
+    void Expand(int out0[4], int out1[4]) const {
+        for (int c = 0; c < 4; ++c) {
+            out0[c] = (quantized[0][c] << 1) | pbit[0];
+            out1[c] = (quantized[1][c] << 1) | pbit[1];
+        }
+    }
+};
+
+// Pick the 7-bit value and shared p-bit that best reproduce an 8-bit RGBA endpoint
+void QuantizeMode6(const float endpoint[4], int quantized[4], int& pbit) {
+    float bestError = 1e30f;
+    for (int p = 0; p < 2; ++p) {
+        int q[4];
+        float error = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            q[c] = std::min(127, std::max(0, static_cast<int>((endpoint[c] - p) * 0.5f + 0.5f)));
+            float d = static_cast<float>((q[c] << 1) | p) - endpoint[c];
+            error += d * d;
+        }
+        if (error < bestError) {
+            bestError = error;
+            pbit = p;
+            std::memcpy(quantized, q, sizeof(q));
+        }
+    }
+}
+
+int EncodeBc7Mode6(const Block& block, const float points[16][4], int refineIterations, uint8_t* out) {
+    float mean[4], axis[4], tMin, tMax;
+    FitPrincipalAxis(points, 4, mean, axis, tMin, tMax);
+    float f0[4], f1[4];
+    for (int c = 0; c < 4; ++c) {
+        f0[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMin));
+        f1[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMax));
+    }
+
+    Mode6Endpoints endpoints;
+    QuantizeMode6(f0, endpoints.quantized[0], endpoints.pbit[0]);
+    QuantizeMode6(f1, endpoints.quantized[1], endpoints.pbit[1]);
+    int e0[4], e1[4];
+    endpoints.Expand(e0, e1);
+    uint8_t indices[16];
+    int error = AssignIndices(block, 0, 4, e0, e1, kWeights4, 16, indices);
+
+    for (int iteration = 0; iteration < refineIterations && error > 0; ++iteration) {
+        float t[16];
+        for (int i = 0; i < 16; ++i) {
+            t[i] = kWeights4[indices[i]] / 64.0f;
+        }
+        if (!FitEndpointsLeastSquares(points, 4, t, f0, f1)) {
+            break;
+        }
+        Mode6Endpoints candidate;
+        QuantizeMode6(f0, candidate.quantized[0], candidate.pbit[0]);
+        QuantizeMode6(f1, candidate.quantized[1], candidate.pbit[1]);
+        candidate.Expand(e0, e1);
+        uint8_t candidateIndices[16];
+        int candidateError = AssignIndices(block, 0, 4, e0, e1, kWeights4, 16, candidateIndices);
+        if (candidateError >= error) {
+            break;
+        }
+        endpoints = candidate;
+        error = candidateError;
+        std::memcpy(indices, candidateIndices, sizeof(indices));
+    }
+
+    // The anchor (first) index has an implicit leading zero bit
+    if (indices[0] & 8) {
+        std::swap(endpoints.quantized[0], endpoints.quantized[1]);
+        std::swap(endpoints.pbit[0], endpoints.pbit[1]);
+        for (int i = 0; i < 16; ++i) {
+            indices[i] = static_cast<uint8_t>(15 - indices[i]);
+        }
+    }
+
+    BitWriter writer(out);
+    writer.Write(1 << 6, 7);
+    for (int c = 0; c < 4; ++c) {
+        writer.Write(endpoints.quantized[0][c], 7);
+        writer.Write(endpoints.quantized[1][c], 7);
+    }
+    writer.Write(endpoints.pbit[0], 1);
+    writer.Write(endpoints.pbit[1], 1);
+    for (int i = 0; i < 16; ++i) {
+        writer.Write(indices[i], i == 0 ? 3 : 4);
+    }
+    return error;
+}
+
+inline int Expand7(int v) {
+    return (v << 1) | (v >> 6);
+}
+
+// Closest 7-bit value after expansion to 8 bits
+int Quantize7(float v) {
+    int q = std::min(127, std::max(0, static_cast<int>(v * (127.0f / 255.0f) + 0.5f)));
+    int best = q;
+    float bestError = std::abs(Expand7(q) - v);
+    for (int candidate = std::max(0, q - 1); candidate <= std::min(127, q + 1); ++candidate) {
+        float error = std::abs(Expand7(candidate) - v);
+        if (error < bestError) {
+            bestError = error;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+// Mode 5: 7-bit RGB and 8-bit alpha endpoints with independent 2-bit index sets
+int EncodeBc7Mode5(const Block& block, const float points[16][4], int refineIterations, uint8_t* out) {
+    float mean[4], axis[4], tMin, tMax;
+    FitPrincipalAxis(points, 3, mean, axis, tMin, tMax);
+    float f0[4], f1[4];
+    for (int c = 0; c < 3; ++c) {
+        f0[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMin));
+        f1[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * tMax));
+    }
+
+    int q0[3], q1[3], e0[4] = {}, e1[4] = {};
+    auto quantizeColor = [&](const float* a, const float* b) {
+        for (int c = 0; c < 3; ++c) {
+            q0[c] = Quantize7(a[c]);
+            q1[c] = Quantize7(b[c]);
+            e0[c] = Expand7(q0[c]);
+            e1[c] = Expand7(q1[c]);
+        }
+    };
+    quantizeColor(f0, f1);
+    uint8_t colorIndices[16];
+    int colorError = AssignIndices(block, 0, 3, e0, e1, kWeights2, 4, colorIndices);
+
+    for (int iteration = 0; iteration < refineIterations && colorError > 0; ++iteration) {
+        float t[16];
+        for (int i = 0; i < 16; ++i) {
+            t[i] = kWeights2[colorIndices[i]] / 64.0f;
+        }
+        if (!FitEndpointsLeastSquares(points, 3, t, f0, f1)) {
+            break;
+        }
+        int saved0[3], saved1[3], savedE0[4], savedE1[4];
+        std::memcpy(saved0, q0, sizeof(q0));
+        std::memcpy(saved1, q1, sizeof(q1));
+        std::memcpy(savedE0, e0, sizeof(e0));
+        std::memcpy(savedE1, e1, sizeof(e1));
+        quantizeColor(f0, f1);
+        uint8_t candidate[16];
+        int candidateError = AssignIndices(block, 0, 3, e0, e1, kWeights2, 4, candidate);
+        if (candidateError >= colorError) {
+            std::memcpy(q0, saved0, sizeof(q0));
+            std::memcpy(q1, saved1, sizeof(q1));
+            std::memcpy(e0, savedE0, sizeof(e0));
+            std::memcpy(e1, savedE1, sizeof(e1));
+            break;
+        }
+        colorError = candidateError;
+        std::memcpy(colorIndices, candidate, sizeof(candidate));
+    }
+
+    // Alpha: full 8-bit endpoints spanning the block's range
+    int alphaLow = 255, alphaHigh = 0;
+    for (int i = 0; i < 16; ++i) {
+        alphaLow = std::min(alphaLow, static_cast<int>(block.rgba[i][3]));
+        alphaHigh = std::max(alphaHigh, static_cast<int>(block.rgba[i][3]));
+    }
+    e0[3] = alphaLow;
+    e1[3] = alphaHigh;
+    uint8_t alphaIndices[16];
+    int alphaError = AssignIndices(block, 3, 1, e0, e1, kWeights2, 4, alphaIndices);
+    int a0 = alphaLow;
+    int a1 = alphaHigh;
+
+    if (colorIndices[0] & 2) {
+        std::swap(q0, q1);
+        for (int i = 0; i < 16; ++i) {
+            colorIndices[i] = static_cast<uint8_t>(3 - colorIndices[i]);
+        }
+    }
+    if (alphaIndices[0] & 2) {
+        std::swap(a0, a1);
+        for (int i = 0; i < 16; ++i) {
+            alphaIndices[i] = static_cast<uint8_t>(3 - alphaIndices[i]);
+        }
+    }
+
+    BitWriter writer(out);
+    writer.Write(1 << 5, 6);
+    writer.Write(0, 2);  // No channel rotation
+    for (int c = 0; c < 3; ++c) {
+        writer.Write(q0[c], 7);
+        writer.Write(q1[c], 7);
+    }
+    writer.Write(a0, 8);
+    writer.Write(a1, 8);
+    for (int i = 0; i < 16; ++i) {
+        writer.Write(colorIndices[i], i == 0 ? 1 : 2);
+    }
+    for (int i = 0; i < 16; ++i) {
+        writer.Write(alphaIndices[i], i == 0 ? 1 : 2);
+    }
+    return colorError + alphaError;
+}
+
+void EncodeBc7Block(const Block& block, CompressionQuality quality, uint8_t* out) {
+    float points[16][4];
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            points[i][c] = block.rgba[i][c];
+        }
+    }
+
+    int refineIterations = RefineIterations(quality);
+    int error = EncodeBc7Mode6(block, points, refineIterations, out);
+    if (quality == CompressionQuality::High && error > 0) {
+        uint8_t candidate[16];
+        if (EncodeBc7Mode5(block, points, refineIterations, candidate) < error) {
+            std::memcpy(out, candidate, 16);
+        }
+    }
+}
+
+bool DecodeBc7Block(const uint8_t* in, uint8_t out[16][4]) {
+    int mode = 0;
+    while (mode < 8 && !((in[0] >> mode) & 1)) {
+        mode++;
+    }
+
+    BitReader reader(in);
+    reader.Read(mode + 1);
+    int e0[4], e1[4];
+    int colorIndices[16], alphaIndices[16];
+    const int* colorWeights = kWeights2;
+    const int* alphaWeights = kWeights2;
+    int rotation = 0;
+
+    if (mode == 6) {
+        int q[2][4];
+        for (int c = 0; c < 4; ++c) {
+            q[0][c] = reader.Read(7);
+            q[1][c] = reader.Read(7);
+        }
+        int p0 = reader.Read(1);
+        int p1 = reader.Read(1);
+        for (int c = 0; c < 4; ++c) {
+            e0[c] = (q[0][c] << 1) | p0;
+            e1[c] = (q[1][c] << 1) | p1;
+        }
+        for (int i = 0; i < 16; ++i) {
+            colorIndices[i] = alphaIndices[i] = reader.Read(i == 0 ? 3 : 4);
+        }
+        colorWeights = alphaWeights = kWeights4;
+    } else if (mode == 5) {
+        rotation = reader.Read(2);
+        for (int c = 0; c < 3; ++c) {
+            e0[c] = Expand7(reader.Read(7));
+            e1[c] = Expand7(reader.Read(7));
+        }
+        e0[3] = reader.Read(8);
+        e1[3] = reader.Read(8);
+        for (int i = 0; i < 16; ++i) {
+            colorIndices[i] = reader.Read(i == 0 ? 1 : 2);
+        }
+        for (int i = 0; i < 16; ++i) {
+            alphaIndices[i] = reader.Read(i == 0 ? 1 : 2);
+        }
+    } else if (mode == 4) {
+        rotation = reader.Read(2);
+        int indexMode = reader.Read(1);
+        for (int c = 0; c < 3; ++c) {
+            int v0 = reader.Read(5);
+            int v1 = reader.Read(5);
+            e0[c] = (v0 << 3) | (v0 >> 2);
+            e1[c] = (v1 << 3) | (v1 >> 2);
+        }
+        int a0 = reader.Read(6);
+        int a1 = reader.Read(6);
+        e0[3] = (a0 << 2) | (a0 >> 4);
+        e1[3] = (a1 << 2) | (a1 >> 4);
+        int twoBit[16], threeBit[16];
+        for (int i = 0; i < 16; ++i) {
+            twoBit[i] = reader.Read(i == 0 ? 1 : 2);
+        }
+        for (int i = 0; i < 16; ++i) {
+            threeBit[i] = reader.Read(i == 0 ? 2 : 3);
+        }
+        if (indexMode == 0) {
+            std::memcpy(colorIndices, twoBit, sizeof(twoBit));
+            std::memcpy(alphaIndices, threeBit, sizeof(threeBit));
+            alphaWeights = kWeights3;
+        } else {
+            std::memcpy(colorIndices, threeBit, sizeof(threeBit));
+            std::memcpy(alphaIndices, twoBit, sizeof(twoBit));
+            colorWeights = kWeights3;
+        }
+    } else {
+        std::memset(out, 0, 64);
+        return false;
+    }
+
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            out[i][c] = static_cast<uint8_t>(Interpolate64(e0[c], e1[c], colorWeights[colorIndices[i]]));
+        }
+        out[i][3] = static_cast<uint8_t>(Interpolate64(e0[3], e1[3], alphaWeights[alphaIndices[i]]));
+        if (rotation != 0) {
+            std::swap(out[i][3], out[i][rotation - 1]);
+        }
+    }
+    return true;
+}
+
+void EncodeBlock(const Block& block, const CompressionSettings& settings, uint8_t* out) {
+    int refineIterations = RefineIterations(settings.quality);
+    uint8_t channel[16];
+    switch (settings.format) {
+        case BlockFormat::BC1:
+            EncodeBc1Block(block, refineIterations, out);
+            break;
+        case BlockFormat::BC3:
+            for (int i = 0; i < 16; ++i) {
+                channel[i] = block.rgba[i][3];
+            }
+            EncodeBc4Block(channel, refineIterations, out);
+            EncodeBc1Block(block, refineIterations, out + 8);
+            break;
+        case BlockFormat::BC4:
+            for (int i = 0; i < 16; ++i) {
+                channel[i] = block.rgba[i][0];
+            }
+            EncodeBc4Block(channel, refineIterations, out);
+            break;
+        case BlockFormat::BC5:
+            for (int c = 0; c < 2; ++c) {
+                for (int i = 0; i < 16; ++i) {
+                    channel[i] = block.rgba[i][c];
+                }
+                EncodeBc4Block(channel, refineIterations, out + c * 8);
+            }
+            break;
+        case BlockFormat::BC7:
+            EncodeBc7Block(block, settings.quality, out);
+            break;
+    }
+}
+
+bool DecodeBlock(const uint8_t* in, BlockFormat format, uint8_t out[16][4]) {
+    uint8_t channel[16];
+    switch (format) {
+        case BlockFormat::BC1:
+            DecodeBc1Block(in, false, out);
+            return true;
+        case BlockFormat::BC3:
+            DecodeBc1Block(in + 8, true, out);
+            DecodeBc4Block(in, channel);
+            for (int i = 0; i < 16; ++i) {
+                out[i][3] = channel[i];
+            }
+            return true;
+        case BlockFormat::BC4:
+            DecodeBc4Block(in, channel);
+            for (int i = 0; i < 16; ++i) {
+                out[i][0] = channel[i];
+                out[i][1] = out[i][2] = 0;
+                out[i][3] = 255;
+            }
+            return true;
+        case BlockFormat::BC5:
+            for (int c = 0; c < 2; ++c) {
+                DecodeBc4Block(in + c * 8, channel);
+                for (int i = 0; i < 16; ++i) {
+                    out[i][c] = channel[i];
+                }
+            }
+            for (int i = 0; i < 16; ++i) {
+                out[i][2] = 0;
+                out[i][3] = 255;
+            }
+            return true;
+        case BlockFormat::BC7:
+            return DecodeBc7Block(in, out);
+    }
+    return false;
+}
+
+} // namespace
+
+size_t BlockCompressor::GetBlockSize(BlockFormat format) {
+    return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+}
+
+size_t BlockCompressor::GetCompressedSize(BlockFormat format, int width, int height) {
+    size_t blocksWide = static_cast<size_t>((width + 3) / 4);
+    size_t blocksHigh = static_cast<size_t>((height + 3) / 4);
+    return blocksWide * blocksHigh * GetBlockSize(format);
+}
+
+int BlockCompressor::GetChannelCount(BlockFormat format) {
+    switch (format) {
+        case BlockFormat::BC1:
+            return 3;
+        case BlockFormat::BC4:
+            return 1;
+        case BlockFormat::BC5:
+            return 2;
+        default:
+            return 4;
+    }
+}
+
+bool BlockCompressor::Encode(const uint8_t* pixels, int width, int height, int channels,
+                             const CompressionSettings& settings, uint8_t* outBlocks) {
+    if (!pixels || !outBlocks || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+        ogde::core::Logger::error("Invalid block compression parameters");
+        return false;
+    }
+
+    const int blocksWide = (width + 3) / 4;
+    const int blocksHigh = (height + 3) / 4;
+    const size_t blockSize = GetBlockSize(settings.format);
+
+    auto encodeRows = [&](uint32_t begin, uint32_t end) {
+        Block block;
+        for (uint32_t by = begin; by < end; ++by) {
+            uint8_t* out = outBlocks + static_cast<size_t>(by) * blocksWide * blockSize;
+            for (int bx = 0; bx < blocksWide; ++bx) {
+                LoadBlock(pixels, width, height, channels, bx, static_cast<int>(by), block);
+                EncodeBlock(block, settings, out + bx * blockSize);
+            }
+        }
+    };
+
+    if (settings.jobSystem) {
+        settings.jobSystem->parallelFor(static_cast<uint32_t>(blocksHigh), 1, encodeRows);
+    } else {
+        encodeRows(0, static_cast<uint32_t>(blocksHigh));
+    }
+    return true;
+}
+
+bool BlockCompressor::Decode(const uint8_t* blocks, int width, int height, BlockFormat format, uint8_t* outRgba) {
+    if (!blocks || !outRgba || width <= 0 || height <= 0) {
+        ogde::core::Logger::error("Invalid block decompression parameters");
+        return false;
+    }
+
+    const int blocksWide = (width + 3) / 4;
+    const int blocksHigh = (height + 3) / 4;
+    const size_t blockSize = GetBlockSize(format);
+    bool supported = true;
+    uint8_t decoded[16][4];
+
+    for (int by = 0; by < blocksHigh; ++by) {
+        for (int bx = 0; bx < blocksWide; ++bx) {
+            const uint8_t* in = blocks + (static_cast<size_t>(by) * blocksWide + bx) * blockSize;
+            supported = DecodeBlock(in, format, decoded) && supported;
+            for (int y = 0; y < 4 && by * 4 + y < height; ++y) {
+                int columns = std::min(4, width - bx * 4);
+                std::memcpy(outRgba + ((static_cast<size_t>(by) * 4 + y) * width + bx * 4) * 4,
+                            decoded[y * 4], columns * 4);
+            }
+        }
+    }
+    return supported;
+}
+
+double BlockCompressor::ComputePsnr(const uint8_t* a, const uint8_t* b, int width, int height, int channelCount) {
+    double sum = 0.0;
+    size_t pixelCount = static_cast<size_t>(width) * height;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        for (int c = 0; c < channelCount; ++c) {
+            double d = static_cast<double>(a[i * 4 + c]) - b[i * 4 + c];
+            sum += d * d;
+        }
+    }
+    double mse = sum / (static_cast<double>(pixelCount) * channelCount);
+    if (mse <= 0.0) {
+        return 99.0;
+    }
+    return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+void BlockCompressor::ExpandToRgba(const uint8_t* pixels, int width, int height, int channels, uint8_t* outRgba) {
+    size_t pixelCount = static_cast<size_t>(width) * height;
+    if (channels == 4) {
+        std::memcpy(outRgba, pixels, pixelCount * 4);
+        return;
+    }
+    if (channels == 3) {
+        PixelConverter::RgbToRgba(pixels, outRgba, pixelCount);
+        return;
+    }
+    for (size_t i = 0; i < pixelCount; ++i) {
+        ExpandPixel(pixels + i * channels, channels, outRgba + i * 4);
+    }
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -52,6 +52,10 @@ Camera::Camera()
     m_position[0] = 0.0f;
     m_position[1] = 0.0f;
     m_position[2] = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        m_worldPosition[i] = 0.0;
+        m_worldOrigin[i] = 0.0;
+    }
 
     // Initialize rotation
     m_rotation[0] = 0.0f;  // pitch
@@ -78,6 +82,7 @@ Camera::Camera()
 
     // Set up default perspective projection
     updateProjectionMatrix();
+    updateViewProjectionMatrix();
 }
 
 Camera::~Camera() {
@@ -105,9 +110,47 @@ void Camera::setPosition(float x, float y, float z) {
     m_position[0] = x;
     m_position[1] = y;
     m_position[2] = z;
+    m_worldPosition[0] = m_worldOrigin[0] + x;
+    m_worldPosition[1] = m_worldOrigin[1] + y;
+    m_worldPosition[2] = m_worldOrigin[2] + z;
     m_viewDirty = true;
 }
 
+void Camera::setWorldPosition(double x, double y, double z) {
+    m_worldPosition[0] = x;
+    m_worldPosition[1] = y;
+    m_worldPosition[2] = z;
+    for (int i = 0; i < 3; ++i) {
+        m_position[i] = static_cast<float>(m_worldPosition[i] - m_worldOrigin[i]);
+    }
+    m_viewDirty = true;
+}
+
+void Camera::getWorldPosition(double& outX, double& outY, double& outZ) const {
+    outX = m_worldPosition[0];
+    outY = m_worldPosition[1];
+    outZ = m_worldPosition[2];
+}
+
+void Camera::setWorldOrigin(double x, double y, double z) {
+    if (x == m_worldOrigin[0] && y == m_worldOrigin[1] && z == m_worldOrigin[2]) {
+        return;
+    }
+    m_worldOrigin[0] = x;
+    m_worldOrigin[1] = y;
+    m_worldOrigin[2] = z;
+    for (int i = 0; i < 3; ++i) {
+        m_position[i] = static_cast<float>(m_worldPosition[i] - m_worldOrigin[i]);
+    }
+    m_viewDirty = true;
+}
+
+void Camera::getWorldOrigin(double& outX, double& outY, double& outZ) const {
+    outX = m_worldOrigin[0];
+    outY = m_worldOrigin[1];
+    outZ = m_worldOrigin[2];
+}
+
 void Camera::setRotation(float pitch, float yaw, float roll) {
     m_rotation[0] = pitch;
     m_rotation[1] = yaw;
@@ -172,6 +215,9 @@ void Camera::lookAt(float eyeX, float eyeY, float eyeZ,
     m_position[0] = eyeX;
     m_position[1] = eyeY;
     m_position[2] = eyeZ;
+    m_worldPosition[0] = m_worldOrigin[0] + eyeX;
+    m_worldPosition[1] = m_worldOrigin[1] + eyeY;
+    m_worldPosition[2] = m_worldOrigin[2] + eyeZ;
 
     // Calculate forward vector (from eye to target)
     m_forward[0] = targetX - eyeX;
@@ -256,6 +302,10 @@ void Camera::getUp(float& outX, float& outY, float& outZ) const {
 }
 
 void Camera::update() {
+    if (!m_viewDirty && !m_projectionDirty) {
+        return;
+    }
+
     if (m_viewDirty) {
         updateViewMatrix();
         m_viewDirty = false;
@@ -324,8 +374,9 @@ void Camera::updateProjectionMatrix() {
 }
 
 void Camera::updateViewProjectionMatrix() {
-    // Multiply projection * view
-    matrixMultiply(m_projectionMatrix, m_viewMatrix, m_viewProjectionMatrix);
+    // Matrices transform row vectors (v * M), so the combined transform is view * projection
+    matrixMultiply(m_viewMatrix, m_projectionMatrix, m_viewProjectionMatrix);
+    m_frustum.extractFromMatrix(m_viewProjectionMatrix);
 }
 
 } // namespace graphics
@@ -0,0 +1,543 @@
+/**
+ * @file CameraSet.cpp
+ * @brief Multi-view camera management implementation
+ */
+
+#include "ogde/graphics/CameraSet.h"
+#include "ogde/platform/CpuFeatures.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+// Planes of one view laid out for broadcasting into SIMD registers
+struct ViewPlanes {
+    float nx[Frustum::PlaneCount];
+    float ny[Frustum::PlaneCount];
+    float nz[Frustum::PlaneCount];
+    float d[Frustum::PlaneCount];
+    uint32_t bit;
+};
+
+inline uint32_t roundUpToLanes(uint32_t count) {
+    return (count + AabbBatch::kLaneWidth - 1) / AabbBatch::kLaneWidth * AabbBatch::kLaneWidth;
+}
+
+#ifndef OGDE_ARCH_X86
+uint32_t aabbMaskScalar(const ViewPlanes* views, uint32_t viewCount, const AabbBatch& boxes, uint32_t i) {
+    uint32_t mask = 0;
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        bool inside = true;
+        for (int p = 0; p < Frustum::PlaneCount && inside; ++p) {
+            float dist = views[v].nx[p] * boxes.centerX()[i] + views[v].ny[p] * boxes.centerY()[i] +
+                         views[v].nz[p] * boxes.centerZ()[i] + views[v].d[p];
+            float radius = std::abs(views[v].nx[p]) * boxes.extentX()[i] +
+                           std::abs(views[v].ny[p]) * boxes.extentY()[i] +
+                           std::abs(views[v].nz[p]) * boxes.extentZ()[i];
+            inside = dist + radius >= 0.0f;
+        }
+        if (inside) {
+            mask |= views[v].bit;
+        }
+    }
+    return mask;
+}
+
+uint32_t sphereMaskScalar(const ViewPlanes* views, uint32_t viewCount, const SphereBatch& spheres, uint32_t i) {
+    uint32_t mask = 0;
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        bool inside = true;
+        for (int p = 0; p < Frustum::PlaneCount && inside; ++p) {
+            float dist = views[v].nx[p] * spheres.centerX()[i] + views[v].ny[p] * spheres.centerY()[i] +
+                         views[v].nz[p] * spheres.centerZ()[i] + views[v].d[p];
+            inside = dist + spheres.radius()[i] >= 0.0f;
+        }
+        if (inside) {
+            mask |= views[v].bit;
+        }
+    }
+    return mask;
+}
+#endif // !OGDE_ARCH_X86
+
+#ifdef OGDE_ARCH_X86
+// Each lane accumulates the view bits of one object; bounds are loaded once for all views
+void cullAabbsSse2(const ViewPlanes* views, uint32_t viewCount, const AabbBatch& boxes, uint32_t* outMasks) {
+    const __m128 zero = _mm_setzero_ps();
+    const uint32_t padded = roundUpToLanes(boxes.size());
+
+    for (uint32_t base = 0; base < padded; base += 4) {
+        __m128 cx = _mm_loadu_ps(boxes.centerX() + base);
+        __m128 cy = _mm_loadu_ps(boxes.centerY() + base);
+        __m128 cz = _mm_loadu_ps(boxes.centerZ() + base);
+        __m128 ex = _mm_loadu_ps(boxes.extentX() + base);
+        __m128 ey = _mm_loadu_ps(boxes.extentY() + base);
+        __m128 ez = _mm_loadu_ps(boxes.extentZ() + base);
+
+        __m128i masks = _mm_setzero_si128();
+        for (uint32_t v = 0; v < viewCount; ++v) {
+            const ViewPlanes& view = views[v];
+            __m128 inside = _mm_cmpeq_ps(zero, zero);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m128 dist = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view.nx[p]), cx), _mm_mul_ps(_mm_set1_ps(view.ny[p]), cy)),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view.nz[p]), cz), _mm_set1_ps(view.d[p])));
+                __m128 radius = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::abs(view.nx[p])), ex),
+                               _mm_mul_ps(_mm_set1_ps(std::abs(view.ny[p])), ey)),
+                    _mm_mul_ps(_mm_set1_ps(std::abs(view.nz[p])), ez));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(dist, radius), zero));
+            }
+            masks = _mm_or_si128(masks, _mm_and_si128(_mm_castps_si128(inside),
+                                                      _mm_set1_epi32(static_cast<int>(view.bit))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outMasks + base), masks);
+    }
+}
+
+void cullSpheresSse2(const ViewPlanes* views, uint32_t viewCount, const SphereBatch& spheres, uint32_t* outMasks) {
+    const __m128 zero = _mm_setzero_ps();
+    const uint32_t padded = roundUpToLanes(spheres.size());
+
+    for (uint32_t base = 0; base < padded; base += 4) {
+        __m128 cx = _mm_loadu_ps(spheres.centerX() + base);
+        __m128 cy = _mm_loadu_ps(spheres.centerY() + base);
+        __m128 cz = _mm_loadu_ps(spheres.centerZ() + base);
+        __m128 r = _mm_loadu_ps(spheres.radius() + base);
+
+        __m128i masks = _mm_setzero_si128();
+        for (uint32_t v = 0; v < viewCount; ++v) {
+            const ViewPlanes& view = views[v];
+            __m128 inside = _mm_cmpeq_ps(zero, zero);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m128 dist = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view.nx[p]), cx), _mm_mul_ps(_mm_set1_ps(view.ny[p]), cy)),
+                    _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view.nz[p]), cz), _mm_set1_ps(view.d[p])));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(dist, r), zero));
+            }
+            masks = _mm_or_si128(masks, _mm_and_si128(_mm_castps_si128(inside),
+                                                      _mm_set1_epi32(static_cast<int>(view.bit))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outMasks + base), masks);
+    }
+}
+
+OGDE_TARGET_AVX2
+void cullAabbsAvx2(const ViewPlanes* views, uint32_t viewCount, const AabbBatch& boxes, uint32_t* outMasks) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const uint32_t padded = roundUpToLanes(boxes.size());
+
+    for (uint32_t base = 0; base < padded; base += 8) {
+        __m256 cx = _mm256_loadu_ps(boxes.centerX() + base);
+        __m256 cy = _mm256_loadu_ps(boxes.centerY() + base);
+        __m256 cz = _mm256_loadu_ps(boxes.centerZ() + base);
+        __m256 ex = _mm256_loadu_ps(boxes.extentX() + base);
+        __m256 ey = _mm256_loadu_ps(boxes.extentY() + base);
+        __m256 ez = _mm256_loadu_ps(boxes.extentZ() + base);
+
+        __m256i masks = _mm256_setzero_si256();
+        for (uint32_t v = 0; v < viewCount; ++v) {
+            const ViewPlanes& view = views[v];
+            __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m256 nx = _mm256_set1_ps(view.nx[p]);
+                __m256 ny = _mm256_set1_ps(view.ny[p]);
+                __m256 nz = _mm256_set1_ps(view.nz[p]);
+                __m256 dist = _mm256_fmadd_ps(nx, cx, _mm256_fmadd_ps(ny, cy,
+                              _mm256_fmadd_ps(nz, cz, _mm256_set1_ps(view.d[p]))));
+                __m256 radius = _mm256_fmadd_ps(_mm256_andnot_ps(signMask, nx), ex,
+                                _mm256_fmadd_ps(_mm256_andnot_ps(signMask, ny), ey,
+                                _mm256_mul_ps(_mm256_andnot_ps(signMask, nz), ez)));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(dist, radius), zero, _CMP_GE_OQ));
+            }
+            masks = _mm256_or_si256(masks, _mm256_and_si256(_mm256_castps_si256(inside),
+                                                            _mm256_set1_epi32(static_cast<int>(view.bit))));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outMasks + base), masks);
+    }
+}
+
+OGDE_TARGET_AVX2
+void cullSpheresAvx2(const ViewPlanes* views, uint32_t viewCount, const SphereBatch& spheres, uint32_t* outMasks) {
+    const __m256 zero = _mm256_setzero_ps();
+    const uint32_t padded = roundUpToLanes(spheres.size());
+
+    for (uint32_t base = 0; base < padded; base += 8) {
+        __m256 cx = _mm256_loadu_ps(spheres.centerX() + base);
+        __m256 cy = _mm256_loadu_ps(spheres.centerY() + base);
+        __m256 cz = _mm256_loadu_ps(spheres.centerZ() + base);
+        __m256 r = _mm256_loadu_ps(spheres.radius() + base);
+
+        __m256i masks = _mm256_setzero_si256();
+        for (uint32_t v = 0; v < viewCount; ++v) {
+            const ViewPlanes& view = views[v];
+            __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m256 dist = _mm256_fmadd_ps(_mm256_set1_ps(view.nx[p]), cx,
+                              _mm256_fmadd_ps(_mm256_set1_ps(view.ny[p]), cy,
+                              _mm256_fmadd_ps(_mm256_set1_ps(view.nz[p]), cz, _mm256_set1_ps(view.d[p]))));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(dist, r), zero, _CMP_GE_OQ));
+            }
+            masks = _mm256_or_si256(masks, _mm256_and_si256(_mm256_castps_si256(inside),
+                                                            _mm256_set1_epi32(static_cast<int>(view.bit))));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outMasks + base), masks);
+    }
+}
+#endif // OGDE_ARCH_X86
+
+void normalize3(float* v) {
+    float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length > 0.0001f) {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+}
+
+void cross3(const float* a, const float* b, float* out) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+float dot3(const float* a, const float* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// Point a camera at a target unless it is already there, so unchanged views stay clean
+void lookAtIfChanged(Camera& camera, const float* eye, const float* forward, const float* up) {
+    float px, py, pz, fx, fy, fz;
+    camera.getPosition(px, py, pz);
+    camera.getForward(fx, fy, fz);
+    // lookAt() re-derives the forward vector from eye and target, so allow for its rounding
+    const float tolerance = 1e-4f;
+    if (px == eye[0] && py == eye[1] && pz == eye[2] &&
+        std::abs(fx - forward[0]) < tolerance && std::abs(fy - forward[1]) < tolerance &&
+        std::abs(fz - forward[2]) < tolerance) {
+        return;
+    }
+    camera.lookAt(eye[0], eye[1], eye[2],
+                  eye[0] + forward[0], eye[1] + forward[1], eye[2] + forward[2],
+                  up[0], up[1], up[2]);
+}
+
+} // namespace
+
+CameraSet::CameraSet()
+    : m_firstCascade(kInvalidView)
+    , m_cascadeCount(0)
+{
+    m_views.reserve(kMaxViews);
+    for (float& split : m_cascadeSplits) {
+        split = 0.0f;
+    }
+}
+
+CameraSet::~CameraSet() {
+}
+
+uint32_t CameraSet::addView(ViewType type, const Viewport& viewport) {
+    if (m_views.size() >= kMaxViews) {
+        return kInvalidView;
+    }
+    View view;
+    view.type = type;
+    view.viewport = viewport;
+    m_views.push_back(view);
+    return static_cast<uint32_t>(m_views.size() - 1);
+}
+
+void CameraSet::clear() {
+    m_views.clear();
+    m_firstCascade = kInvalidView;
+    m_cascadeCount = 0;
+}
+
+uint32_t CameraSet::update() {
+    uint32_t updated = 0;
+    for (View& view : m_views) {
+        if (view.enabled && view.camera.isDirty()) {
+            view.camera.update();
+            updated++;
+        }
+    }
+    return updated;
+}
+
+void CameraSet::setWorldOrigin(double x, double y, double z) {
+    for (View& view : m_views) {
+        view.camera.setWorldOrigin(x, y, z);
+    }
+}
+
+void CameraSet::cull(const AabbBatch& boxes, std::vector<uint32_t>& outMasks) const {
+    ViewPlanes views[kMaxViews];
+    uint32_t viewCount = 0;
+    for (uint32_t v = 0; v < m_views.size(); ++v) {
+        if (!m_views[v].enabled) {
+            continue;
+        }
+        const Frustum& frustum = m_views[v].camera.getFrustum();
+        for (int p = 0; p < Frustum::PlaneCount; ++p) {
+            const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+            views[viewCount].nx[p] = plane.nx;
+            views[viewCount].ny[p] = plane.ny;
+            views[viewCount].nz[p] = plane.nz;
+            views[viewCount].d[p] = plane.d;
+        }
+        views[viewCount].bit = 1u << v;
+        viewCount++;
+    }
+
+    // Kernels write whole lanes, so size for the padded count first
+    outMasks.resize(roundUpToLanes(boxes.size()));
+#ifdef OGDE_ARCH_X86
+    if (platform::CpuFeatures::hasAVX2()) {
+        cullAabbsAvx2(views, viewCount, boxes, outMasks.data());
+    } else {
+        cullAabbsSse2(views, viewCount, boxes, outMasks.data());
+    }
+#else
+    for (uint32_t i = 0; i < boxes.size(); ++i) {
+        outMasks[i] = aabbMaskScalar(views, viewCount, boxes, i);
+    }
+#endif
+    outMasks.resize(boxes.size());
+}
+
+void CameraSet::cull(const SphereBatch& spheres, std::vector<uint32_t>& outMasks) const {
+    ViewPlanes views[kMaxViews];
+    uint32_t viewCount = 0;
+    for (uint32_t v = 0; v < m_views.size(); ++v) {
+        if (!m_views[v].enabled) {
+            continue;
+        }
+        const Frustum& frustum = m_views[v].camera.getFrustum();
+        for (int p = 0; p < Frustum::PlaneCount; ++p) {
+            const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+            views[viewCount].nx[p] = plane.nx;
+            views[viewCount].ny[p] = plane.ny;
+            views[viewCount].nz[p] = plane.nz;
+            views[viewCount].d[p] = plane.d;
+        }
+        views[viewCount].bit = 1u << v;
+        viewCount++;
+    }
+
+    outMasks.resize(roundUpToLanes(spheres.size()));
+#ifdef OGDE_ARCH_X86
+    if (platform::CpuFeatures::hasAVX2()) {
+        cullSpheresAvx2(views, viewCount, spheres, outMasks.data());
+    } else {
+        cullSpheresSse2(views, viewCount, spheres, outMasks.data());
+    }
+#else
+    for (uint32_t i = 0; i < spheres.size(); ++i) {
+        outMasks[i] = sphereMaskScalar(views, viewCount, spheres, i);
+    }
+#endif
+    outMasks.resize(spheres.size());
+}
+
+void CameraSet::collectVisible(const std::vector<uint32_t>& masks, uint32_t view,
+                               std::vector<uint32_t>& outVisible) {
+    outVisible.clear();
+    const uint32_t bit = 1u << view;
+    for (uint32_t i = 0; i < masks.size(); ++i) {
+        if (masks[i] & bit) {
+            outVisible.push_back(i);
+        }
+    }
+}
+
+uint32_t CameraSet::addShadowCascades(uint32_t count) {
+    if (count == 0 || m_cascadeCount != 0 || m_views.size() + count > kMaxViews) {
+        return kInvalidView;
+    }
+    m_firstCascade = static_cast<uint32_t>(m_views.size());
+    m_cascadeCount = count;
+    for (uint32_t i = 0; i < count; ++i) {
+        addView(ViewType::ShadowCascade);
+    }
+    return m_firstCascade;
+}
+
+void CameraSet::updateShadowCascades(const Camera& viewer,
+                                     float lightDirX, float lightDirY, float lightDirZ,
+                                     float lambda, float maxDistance,
+                                     uint32_t shadowMapResolution) {
+    if (m_cascadeCount == 0) {
+        return;
+    }
+
+    // Orthographic depth resolution is uniform, so logarithmic splits would only shrink the near cascades
+    const bool orthographic = viewer.getProjectionType() == ProjectionType::Orthographic;
+    float nearPlane = viewer.getNearPlane();
+    float farPlane = maxDistance > 0.0f ? std::min(maxDistance, viewer.getFarPlane()) : viewer.getFarPlane();
+    computeCascadeSplits(nearPlane, farPlane, m_cascadeCount, orthographic ? 0.0f : lambda, m_cascadeSplits);
+
+    float position[3], forward[3], right[3], up[3];
+    viewer.getPosition(position[0], position[1], position[2]);
+    viewer.getForward(forward[0], forward[1], forward[2]);
+    viewer.getRight(right[0], right[1], right[2]);
+    viewer.getUp(up[0], up[1], up[2]);
+
+    float tanHalfFov = std::tan(viewer.getFieldOfView() * static_cast<float>(M_PI) / 360.0f);
+    float aspect = viewer.getAspectRatio();
+
+    // Light space basis (same handedness as Camera::lookAt)
+    float lightZ[3] = { lightDirX, lightDirY, lightDirZ };
+    normalize3(lightZ);
+    float upHint[3] = { 0.0f, 1.0f, 0.0f };
+    if (std::abs(lightZ[1]) > 0.99f) {
+        upHint[1] = 0.0f;
+        upHint[2] = 1.0f;
+    }
+    float lightX[3], lightY[3];
+    cross3(upHint, lightZ, lightX);
+    normalize3(lightX);
+    cross3(lightZ, lightX, lightY);
+
+    for (uint32_t c = 0; c < m_cascadeCount; ++c) {
+        float corners[8][3];
+        for (int slice = 0; slice < 2; ++slice) {
+            float distance = m_cascadeSplits[c + slice];
+            // Orthographic slices keep the view volume's extents at every distance
+            float halfHeight = orthographic ? viewer.getOrthoHeight() * 0.5f : distance * tanHalfFov;
+            float halfWidth = orthographic ? viewer.getOrthoWidth() * 0.5f : halfHeight * aspect;
+            for (int corner = 0; corner < 4; ++corner) {
+                float sx = (corner & 1) ? halfWidth : -halfWidth;
+                float sy = (corner & 2) ? halfHeight : -halfHeight;
+                float* out = corners[slice * 4 + corner];
+                for (int k = 0; k < 3; ++k) {
+                    out[k] = position[k] + forward[k] * distance + right[k] * sx + up[k] * sy;
+                }
+            }
+        }
+
+        // Bounding sphere of the slice keeps the cascade size constant under rotation
+        float center[3] = { 0.0f, 0.0f, 0.0f };
+        for (const float* corner : corners) {
+            center[0] += corner[0] * 0.125f;
+            center[1] += corner[1] * 0.125f;
+            center[2] += corner[2] * 0.125f;
+        }
+        float radius = 0.0f;
+        for (const float* corner : corners) {
+            float dx = corner[0] - center[0];
+            float dy = corner[1] - center[1];
+            float dz = corner[2] - center[2];
+            radius = std::max(radius, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        // Snap the center to whole shadow map texels to avoid shimmering edges
+        float texelSize = 2.0f * radius / static_cast<float>(std::max(shadowMapResolution, 1u));
+        float lx = dot3(center, lightX);
+        float ly = dot3(center, lightY);
+        float snappedX = std::floor(lx / texelSize) * texelSize;
+        float snappedY = std::floor(ly / texelSize) * texelSize;
+        for (int k = 0; k < 3; ++k) {
+            center[k] += lightX[k] * (snappedX - lx) + lightY[k] * (snappedY - ly);
+        }
+
+        // Pull the eye back so casters in front of the slice are still captured
+        float eye[3];
+        for (int k = 0; k < 3; ++k) {
+            eye[k] = center[k] - lightZ[k] * radius * 2.0f;
+        }
+
+        Camera& camera = m_views[m_firstCascade + c].camera;
+        if (camera.getProjectionType() != ProjectionType::Orthographic ||
+            camera.getOrthoWidth() != 2.0f * radius || camera.getFarPlane() != radius * 3.0f) {
+            camera.setOrthographic(2.0f * radius, 2.0f * radius, 0.0f, radius * 3.0f);
+        }
+        lookAtIfChanged(camera, eye, lightZ, upHint);
+    }
+}
+
+void CameraSet::updateReflectionView(uint32_t view, const Camera& source, float planeHeight) {
+    Camera& camera = m_views[view].camera;
+
+    float position[3], forward[3];
+    source.getPosition(position[0], position[1], position[2]);
+    source.getForward(forward[0], forward[1], forward[2]);
+
+    float eye[3] = { position[0], 2.0f * planeHeight - position[1], position[2] };
+    float mirrored[3] = { forward[0], -forward[1], forward[2] };
+    float up[3] = { 0.0f, 1.0f, 0.0f };
+
+    if (source.getProjectionType() == ProjectionType::Perspective) {
+        if (camera.getProjectionType() != ProjectionType::Perspective ||
+            camera.getFieldOfView() != source.getFieldOfView() ||
+            camera.getAspectRatio() != source.getAspectRatio() ||
+            camera.getNearPlane() != source.getNearPlane() ||
+            camera.getFarPlane() != source.getFarPlane()) {
+            camera.setPerspective(source.getFieldOfView(), source.getAspectRatio(),
+                                  source.getNearPlane(), source.getFarPlane());
+        }
+    } else if (camera.getProjectionType() != ProjectionType::Orthographic ||
+               camera.getOrthoWidth() != source.getOrthoWidth() ||
+               camera.getOrthoHeight() != source.getOrthoHeight() ||
+               camera.getNearPlane() != source.getNearPlane() ||
+               camera.getFarPlane() != source.getFarPlane()) {
+        camera.setOrthographic(source.getOrthoWidth(), source.getOrthoHeight(),
+                               source.getNearPlane(), source.getFarPlane());
+    }
+    lookAtIfChanged(camera, eye, mirrored, up);
+}
+
+void CameraSet::computeCascadeSplits(float nearPlane, float farPlane, uint32_t cascadeCount,
+                                     float lambda, float* outSplits) {
+    if (cascadeCount == 0 || !outSplits) {
+        return;
+    }
+    nearPlane = std::max(nearPlane, 0.0001f);
+    outSplits[0] = nearPlane;
+    for (uint32_t i = 1; i < cascadeCount; ++i) {
+        float fraction = static_cast<float>(i) / static_cast<float>(cascadeCount);
+        float logarithmic = nearPlane * std::pow(farPlane / nearPlane, fraction);
+        float uniform = nearPlane + (farPlane - nearPlane) * fraction;
+        outSplits[i] = lambda * logarithmic + (1.0f - lambda) * uniform;
+    }
+    outSplits[cascadeCount] = farPlane;
+}
+
+Viewport CameraSet::splitScreenViewport(uint32_t player, uint32_t playerCount) {
+    Viewport viewport;
+    if (playerCount <= 1) {
+        return viewport;
+    }
+    if (playerCount == 2) {
+        viewport.height = 0.5f;
+        viewport.y = player == 0 ? 0.0f : 0.5f;
+        return viewport;
+    }
+    // Three players: the first takes the top half and the others the bottom quadrants
+    if (playerCount == 3 && player == 0) {
+        viewport.height = 0.5f;
+        return viewport;
+    }
+    uint32_t slot = playerCount == 3 ? player + 1 : player;
+    viewport.width = 0.5f;
+    viewport.height = 0.5f;
+    viewport.x = static_cast<float>(slot % 2) * 0.5f;
+    viewport.y = static_cast<float>(slot / 2) * 0.5f;
+    return viewport;
+}
+
+} // namespace graphics
+} // namespace ogde
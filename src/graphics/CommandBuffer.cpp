@@ -0,0 +1,260 @@
+/**
+ * @file CommandBuffer.cpp
+ * @brief Command recording and replay implementation
+ */
+
+#include "ogde/graphics/CommandBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+struct CommandHeader {
+    CommandType type;
+    uint16_t reserved;
+    uint32_t payloadSize;   // Bytes after the header, a multiple of 4
+};
+
+static_assert(sizeof(CommandHeader) == 8, "Command headers are packed into 8 bytes");
+
+struct DrawPayload {
+    uint32_t vertexCount;
+    uint32_t startVertex;
+    uint32_t userData;
+};
+
+struct DrawInstancedPayload {
+    uint32_t vertexCount;
+    uint32_t startVertex;
+    uint32_t userData;
+    uint32_t indexCount;
+    uint32_t startIndex;
+    uint32_t instanceCount;
+    uint32_t startInstance;
+};
+
+struct UpdatePayload {
+    uint32_t buffer;
+    uint32_t offset;
+    uint32_t size;          // Followed by the data, padded to 4 bytes
+};
+
+uint32_t alignPayload(uint32_t size) {
+    return (size + 3u) & ~3u;
+}
+
+template <typename T>
+T readPayload(const uint8_t* payload) {
+    T value;
+    std::memcpy(&value, payload, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+CommandBuffer::CommandBuffer()
+    : m_commandCount(0)
+{
+}
+
+CommandBuffer::~CommandBuffer() = default;
+
+void CommandBuffer::bindPass(uint32_t pass) {
+    recordValue(CommandType::BindPass, pass);
+}
+
+void CommandBuffer::bindShader(uint32_t shader) {
+    recordValue(CommandType::BindShader, shader);
+}
+
+void CommandBuffer::bindMaterial(uint32_t material) {
+    recordValue(CommandType::BindMaterial, material);
+}
+
+void CommandBuffer::bindGeometry(uint32_t geometry) {
+    recordValue(CommandType::BindGeometry, geometry);
+}
+
+void CommandBuffer::draw(const DrawItem& item) {
+    if (item.indexCount == 0 && item.instanceCount == 1 && item.startInstance == 0) {
+        draw(item.vertexCount, item.startVertex, item.userData);
+        return;
+    }
+    const DrawInstancedPayload payload = { item.vertexCount, item.startVertex, item.userData, item.indexCount,
+                                           item.startIndex, item.instanceCount, item.startInstance };
+    std::memcpy(allocate(CommandType::DrawIndexedInstanced, sizeof(payload)), &payload, sizeof(payload));
+}
+
+void CommandBuffer::draw(uint32_t vertexCount, uint32_t startVertex, uint32_t userData) {
+    const DrawPayload payload = { vertexCount, startVertex, userData };
+    std::memcpy(allocate(CommandType::Draw, sizeof(payload)), &payload, sizeof(payload));
+}
+
+void CommandBuffer::drawIndexed(uint32_t indexCount, uint32_t startIndex, uint32_t baseVertex, uint32_t userData) {
+    const DrawInstancedPayload payload = { 0, baseVertex, userData, indexCount, startIndex, 1, 0 };
+    std::memcpy(allocate(CommandType::DrawIndexedInstanced, sizeof(payload)), &payload, sizeof(payload));
+}
+
+void CommandBuffer::updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) {
+    const UpdatePayload header = { buffer, offset, size };
+    uint8_t* payload = allocate(CommandType::UpdateBuffer, sizeof(header) + alignPayload(size));
+    std::memcpy(payload, &header, sizeof(header));
+    if (size > 0) {
+        std::memcpy(payload + sizeof(header), data, size);
+    }
+}
+
+void CommandBuffer::append(const CommandBuffer& other) {
+    m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+    m_commandCount += other.m_commandCount;
+}
+
+void CommandBuffer::replay(CommandSink& sink) const {
+    DrawItem item;
+    const uint8_t* cursor = m_data.data();
+    const uint8_t* end = cursor + m_data.size();
+    while (cursor < end) {
+        const CommandHeader header = readPayload<CommandHeader>(cursor);
+        const uint8_t* payload = cursor + sizeof(CommandHeader);
+        cursor = payload + header.payloadSize;
+
+        switch (header.type) {
+        case CommandType::BindPass:
+            item.pass = readPayload<uint32_t>(payload);
+            sink.bindPass(item.pass);
+            break;
+        case CommandType::BindShader:
+            item.shader = readPayload<uint32_t>(payload);
+            sink.bindShader(item.shader);
+            break;
+        case CommandType::BindMaterial:
+            item.material = readPayload<uint32_t>(payload);
+            sink.bindMaterial(item.material);
+            break;
+        case CommandType::BindGeometry:
+            item.geometry = readPayload<uint32_t>(payload);
+            sink.bindGeometry(item.geometry);
+            break;
+        case CommandType::Draw: {
+            const DrawPayload draw = readPayload<DrawPayload>(payload);
+            item.vertexCount = draw.vertexCount;
+            item.startVertex = draw.startVertex;
+            item.userData = draw.userData;
+            item.indexCount = 0;
+            item.startIndex = 0;
+            item.instanceCount = 1;
+            item.startInstance = 0;
+            sink.draw(item);
+            break;
+        }
+        case CommandType::DrawIndexedInstanced: {
+            const DrawInstancedPayload draw = readPayload<DrawInstancedPayload>(payload);
+            item.vertexCount = draw.vertexCount;
+            item.startVertex = draw.startVertex;
+            item.userData = draw.userData;
+            item.indexCount = draw.indexCount;
+            item.startIndex = draw.startIndex;
+            item.instanceCount = draw.instanceCount;
+            item.startInstance = draw.startInstance;
+            sink.draw(item);
+            break;
+        }
+        case CommandType::UpdateBuffer: {
+            const UpdatePayload update = readPayload<UpdatePayload>(payload);
+            sink.updateBuffer(update.buffer, update.offset, payload + sizeof(UpdatePayload), update.size);
+            break;
+        }
+        }
+    }
+}
+
+void CommandBuffer::clear() {
+    m_data.clear();
+    m_commandCount = 0;
+}
+
+uint8_t* CommandBuffer::allocate(CommandType type, uint32_t payloadSize) {
+    const CommandHeader header = { type, 0, payloadSize };
+    const size_t offset = m_data.size();
+    m_data.resize(offset + sizeof(header) + payloadSize);
+    std::memcpy(m_data.data() + offset, &header, sizeof(header));
+    ++m_commandCount;
+    return m_data.data() + offset + sizeof(header);
+}
+
+void CommandBuffer::recordValue(CommandType type, uint32_t value) {
+    std::memcpy(allocate(type, sizeof(value)), &value, sizeof(value));
+}
+
+CommandRecorder::CommandRecorder() = default;
+
+CommandRecorder::~CommandRecorder() = default;
+
+CommandBuffer& CommandRecorder::begin(uint32_t order) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Entry& entry : m_active) {
+        if (entry.order == order) {
+            return *entry.buffer;
+        }
+    }
+
+    // Reuse a buffer released by reset() before allocating a new one
+    if (m_active.size() == m_buffers.size()) {
+        m_buffers.push_back(std::make_unique<CommandBuffer>());
+    }
+    CommandBuffer* buffer = m_buffers[m_active.size()].get();
+    m_active.push_back({ order, buffer });
+    return *buffer;
+}
+
+void CommandRecorder::merge(CommandBuffer& out) const {
+    for (const Entry* entry : sortedEntries()) {
+        out.append(*entry->buffer);
+    }
+}
+
+void CommandRecorder::replay(CommandSink& sink) const {
+    for (const Entry* entry : sortedEntries()) {
+        entry->buffer->replay(sink);
+    }
+}
+
+void CommandRecorder::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const Entry& entry : m_active) {
+        entry.buffer->clear();
+    }
+    m_active.clear();
+}
+
+uint32_t CommandRecorder::getBufferCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<uint32_t>(m_active.size());
+}
+
+uint32_t CommandRecorder::getCommandCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint32_t count = 0;
+    for (const Entry& entry : m_active) {
+        count += entry.buffer->getCommandCount();
+    }
+    return count;
+}
+
+std::vector<const CommandRecorder::Entry*> CommandRecorder::sortedEntries() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<const Entry*> entries;
+    entries.reserve(m_active.size());
+    for (const Entry& entry : m_active) {
+        entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry* a, const Entry* b) { return a->order < b->order; });
+    return entries;
+}
+
+} // namespace graphics
+} // namespace ogde
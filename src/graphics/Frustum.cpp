@@ -0,0 +1,453 @@
+/**
+ * @file Frustum.cpp
+ * @brief View frustum extraction and batched culling implementation
+ */
+
+#include "ogde/graphics/Frustum.h"
+#include "ogde/platform/CpuFeatures.h"
+#include <bit>
+#include <cmath>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+inline uint32_t roundUpToLanes(uint32_t count, uint32_t lanes) {
+    return (count + lanes - 1) / lanes * lanes;
+}
+
+// Bitmask of the lanes in a batch that hold real elements
+inline uint32_t laneMask(uint32_t remaining) {
+    return remaining >= 8 ? 0xFFu : ((1u << remaining) - 1u);
+}
+
+// Append the indices of the set bits in mask to out
+inline uint32_t compactMask(uint32_t mask, uint32_t base, uint32_t* out, uint32_t written) {
+    while (mask != 0) {
+        out[written++] = base + static_cast<uint32_t>(std::countr_zero(mask));
+        mask &= mask - 1;
+    }
+    return written;
+}
+
+#ifndef OGDE_ARCH_X86
+uint32_t cullAabbsScalar(const Frustum& frustum, const AabbBatch& boxes, uint32_t* outVisible) {
+    uint32_t written = 0;
+    for (uint32_t i = 0; i < boxes.size(); ++i) {
+        bool inside = true;
+        for (int p = 0; p < Frustum::PlaneCount && inside; ++p) {
+            const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+            float dist = plane.distance(boxes.centerX()[i], boxes.centerY()[i], boxes.centerZ()[i]);
+            float radius = std::abs(plane.nx) * boxes.extentX()[i] +
+                           std::abs(plane.ny) * boxes.extentY()[i] +
+                           std::abs(plane.nz) * boxes.extentZ()[i];
+            inside = dist + radius >= 0.0f;
+        }
+        if (inside) {
+            outVisible[written++] = i;
+        }
+    }
+    return written;
+}
+
+uint32_t cullSpheresScalar(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outVisible) {
+    uint32_t written = 0;
+    for (uint32_t i = 0; i < spheres.size(); ++i) {
+        if (frustum.intersectsSphere(spheres.centerX()[i], spheres.centerY()[i],
+                                     spheres.centerZ()[i], spheres.radius()[i])) {
+            outVisible[written++] = i;
+        }
+    }
+    return written;
+}
+#endif // !OGDE_ARCH_X86
+
+#ifdef OGDE_ARCH_X86
+// SSE2 kernels process each 8-wide batch as two 4-wide halves
+uint32_t cullAabbsSse2(const Frustum& frustum, const AabbBatch& boxes, uint32_t* outVisible) {
+    __m128 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+    __m128 ax[Frustum::PlaneCount], ay[Frustum::PlaneCount], az[Frustum::PlaneCount];
+    for (int p = 0; p < Frustum::PlaneCount; ++p) {
+        const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+        nx[p] = _mm_set1_ps(plane.nx);
+        ny[p] = _mm_set1_ps(plane.ny);
+        nz[p] = _mm_set1_ps(plane.nz);
+        d[p] = _mm_set1_ps(plane.d);
+        ax[p] = _mm_set1_ps(std::abs(plane.nx));
+        ay[p] = _mm_set1_ps(std::abs(plane.ny));
+        az[p] = _mm_set1_ps(std::abs(plane.nz));
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    const uint32_t count = boxes.size();
+    uint32_t written = 0;
+
+    for (uint32_t base = 0; base < count; base += AabbBatch::kLaneWidth) {
+        uint32_t mask = 0;
+        for (uint32_t half = 0; half < 2; ++half) {
+            const uint32_t offset = base + half * 4;
+            __m128 cx = _mm_loadu_ps(boxes.centerX() + offset);
+            __m128 cy = _mm_loadu_ps(boxes.centerY() + offset);
+            __m128 cz = _mm_loadu_ps(boxes.centerZ() + offset);
+            __m128 ex = _mm_loadu_ps(boxes.extentX() + offset);
+            __m128 ey = _mm_loadu_ps(boxes.extentY() + offset);
+            __m128 ez = _mm_loadu_ps(boxes.extentZ() + offset);
+
+            __m128 inside = _mm_cmpeq_ps(zero, zero);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], cx), _mm_mul_ps(ny[p], cy)),
+                                         _mm_add_ps(_mm_mul_ps(nz[p], cz), d[p]));
+                __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax[p], ex), _mm_mul_ps(ay[p], ey)),
+                                           _mm_mul_ps(az[p], ez));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(dist, radius), zero));
+            }
+            mask |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << (half * 4);
+        }
+        written = compactMask(mask & laneMask(count - base), base, outVisible, written);
+    }
+    return written;
+}
+
+uint32_t cullSpheresSse2(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outVisible) {
+    __m128 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+    for (int p = 0; p < Frustum::PlaneCount; ++p) {
+        const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+        nx[p] = _mm_set1_ps(plane.nx);
+        ny[p] = _mm_set1_ps(plane.ny);
+        nz[p] = _mm_set1_ps(plane.nz);
+        d[p] = _mm_set1_ps(plane.d);
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    const uint32_t count = spheres.size();
+    uint32_t written = 0;
+
+    for (uint32_t base = 0; base < count; base += SphereBatch::kLaneWidth) {
+        uint32_t mask = 0;
+        for (uint32_t half = 0; half < 2; ++half) {
+            const uint32_t offset = base + half * 4;
+            __m128 cx = _mm_loadu_ps(spheres.centerX() + offset);
+            __m128 cy = _mm_loadu_ps(spheres.centerY() + offset);
+            __m128 cz = _mm_loadu_ps(spheres.centerZ() + offset);
+            __m128 r = _mm_loadu_ps(spheres.radius() + offset);
+
+            __m128 inside = _mm_cmpeq_ps(zero, zero);
+            for (int p = 0; p < Frustum::PlaneCount; ++p) {
+                __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx[p], cx), _mm_mul_ps(ny[p], cy)),
+                                         _mm_add_ps(_mm_mul_ps(nz[p], cz), d[p]));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(dist, r), zero));
+            }
+            mask |= static_cast<uint32_t>(_mm_movemask_ps(inside)) << (half * 4);
+        }
+        written = compactMask(mask & laneMask(count - base), base, outVisible, written);
+    }
+    return written;
+}
+
+OGDE_TARGET_AVX2
+uint32_t cullAabbsAvx2(const Frustum& frustum, const AabbBatch& boxes, uint32_t* outVisible) {
+    __m256 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+    __m256 ax[Frustum::PlaneCount], ay[Frustum::PlaneCount], az[Frustum::PlaneCount];
+    for (int p = 0; p < Frustum::PlaneCount; ++p) {
+        const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+        nx[p] = _mm256_set1_ps(plane.nx);
+        ny[p] = _mm256_set1_ps(plane.ny);
+        nz[p] = _mm256_set1_ps(plane.nz);
+        d[p] = _mm256_set1_ps(plane.d);
+        ax[p] = _mm256_set1_ps(std::abs(plane.nx));
+        ay[p] = _mm256_set1_ps(std::abs(plane.ny));
+        az[p] = _mm256_set1_ps(std::abs(plane.nz));
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    const uint32_t count = boxes.size();
+    uint32_t written = 0;
+
+    for (uint32_t base = 0; base < count; base += AabbBatch::kLaneWidth) {
+        __m256 cx = _mm256_loadu_ps(boxes.centerX() + base);
+        __m256 cy = _mm256_loadu_ps(boxes.centerY() + base);
+        __m256 cz = _mm256_loadu_ps(boxes.centerZ() + base);
+        __m256 ex = _mm256_loadu_ps(boxes.extentX() + base);
+        __m256 ey = _mm256_loadu_ps(boxes.extentY() + base);
+        __m256 ez = _mm256_loadu_ps(boxes.extentZ() + base);
+
+        __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < Frustum::PlaneCount; ++p) {
+            __m256 dist = _mm256_fmadd_ps(nx[p], cx, _mm256_fmadd_ps(ny[p], cy, _mm256_fmadd_ps(nz[p], cz, d[p])));
+            __m256 extent = _mm256_fmadd_ps(ax[p], ex, _mm256_fmadd_ps(ay[p], ey, _mm256_mul_ps(az[p], ez)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(dist, extent), zero, _CMP_GE_OQ));
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(inside)) & laneMask(count - base);
+        written = compactMask(mask, base, outVisible, written);
+    }
+    return written;
+}
+
+OGDE_TARGET_AVX2
+uint32_t cullSpheresAvx2(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outVisible) {
+    __m256 nx[Frustum::PlaneCount], ny[Frustum::PlaneCount], nz[Frustum::PlaneCount], d[Frustum::PlaneCount];
+    for (int p = 0; p < Frustum::PlaneCount; ++p) {
+        const Plane& plane = frustum.getPlane(static_cast<Frustum::PlaneIndex>(p));
+        nx[p] = _mm256_set1_ps(plane.nx);
+        ny[p] = _mm256_set1_ps(plane.ny);
+        nz[p] = _mm256_set1_ps(plane.nz);
+        d[p] = _mm256_set1_ps(plane.d);
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+    const uint32_t count = spheres.size();
+    uint32_t written = 0;
+
+    for (uint32_t base = 0; base < count; base += SphereBatch::kLaneWidth) {
+        __m256 cx = _mm256_loadu_ps(spheres.centerX() + base);
+        __m256 cy = _mm256_loadu_ps(spheres.centerY() + base);
+        __m256 cz = _mm256_loadu_ps(spheres.centerZ() + base);
+        __m256 r = _mm256_loadu_ps(spheres.radius() + base);
+
+        __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < Frustum::PlaneCount; ++p) {
+            __m256 dist = _mm256_fmadd_ps(nx[p], cx, _mm256_fmadd_ps(ny[p], cy, _mm256_fmadd_ps(nz[p], cz, d[p])));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(dist, r), zero, _CMP_GE_OQ));
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(inside)) & laneMask(count - base);
+        written = compactMask(mask, base, outVisible, written);
+    }
+    return written;
+}
+#endif // OGDE_ARCH_X86
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Frustum
+// ---------------------------------------------------------------------------
+
+Frustum::Frustum() {
+}
+
+void Frustum::extractFromMatrix(const float* m) {
+    // Clip coordinates are v * M, so each clip component is a column of M.
+    // Gribb/Hartmann extraction for a [0, 1] depth range.
+    auto column = [m](int c, float* out) {
+        out[0] = m[0 * 4 + c];
+        out[1] = m[1 * 4 + c];
+        out[2] = m[2 * 4 + c];
+        out[3] = m[3 * 4 + c];
+    };
+
+    float c0[4], c1[4], c2[4], c3[4];
+    column(0, c0);
+    column(1, c1);
+    column(2, c2);
+    column(3, c3);
+
+    auto setPlane = [this](PlaneIndex index, float a, float b, float c, float d) {
+        float length = std::sqrt(a * a + b * b + c * c);
+        float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+        m_planes[index].nx = a * invLength;
+        m_planes[index].ny = b * invLength;
+        m_planes[index].nz = c * invLength;
+        m_planes[index].d = d * invLength;
+    };
+
+    setPlane(Left,   c3[0] + c0[0], c3[1] + c0[1], c3[2] + c0[2], c3[3] + c0[3]);
+    setPlane(Right,  c3[0] - c0[0], c3[1] - c0[1], c3[2] - c0[2], c3[3] - c0[3]);
+    setPlane(Bottom, c3[0] + c1[0], c3[1] + c1[1], c3[2] + c1[2], c3[3] + c1[3]);
+    setPlane(Top,    c3[0] - c1[0], c3[1] - c1[1], c3[2] - c1[2], c3[3] - c1[3]);
+    setPlane(Near,   c2[0], c2[1], c2[2], c2[3]);
+    setPlane(Far,    c3[0] - c2[0], c3[1] - c2[1], c3[2] - c2[2], c3[3] - c2[3]);
+}
+
+bool Frustum::containsPoint(float x, float y, float z) const {
+    for (const Plane& plane : m_planes) {
+        if (plane.distance(x, y, z) < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersectsSphere(float x, float y, float z, float radius) const {
+    for (const Plane& plane : m_planes) {
+        if (plane.distance(x, y, z) < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersectsAabb(float minX, float minY, float minZ,
+                             float maxX, float maxY, float maxZ) const {
+    for (const Plane& plane : m_planes) {
+        // Test the corner furthest along the plane normal
+        float px = plane.nx >= 0.0f ? maxX : minX;
+        float py = plane.ny >= 0.0f ? maxY : minY;
+        float pz = plane.nz >= 0.0f ? maxZ : minZ;
+        if (plane.distance(px, py, pz) < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// AabbBatch
+// ---------------------------------------------------------------------------
+
+AabbBatch::AabbBatch()
+    : m_count(0)
+{
+}
+
+uint32_t AabbBatch::add(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) {
+    uint32_t index = m_count;
+    resizeStorage(m_count + 1);
+    m_count++;
+    set(index, minX, minY, minZ, maxX, maxY, maxZ);
+    return index;
+}
+
+void AabbBatch::set(uint32_t index, float minX, float minY, float minZ, float maxX, float maxY, float maxZ) {
+    m_centerX[index] = (minX + maxX) * 0.5f;
+    m_centerY[index] = (minY + maxY) * 0.5f;
+    m_centerZ[index] = (minZ + maxZ) * 0.5f;
+    m_extentX[index] = (maxX - minX) * 0.5f;
+    m_extentY[index] = (maxY - minY) * 0.5f;
+    m_extentZ[index] = (maxZ - minZ) * 0.5f;
+}
+
+void AabbBatch::reserve(uint32_t count) {
+    uint32_t padded = roundUpToLanes(count, kLaneWidth);
+    m_centerX.reserve(padded);
+    m_centerY.reserve(padded);
+    m_centerZ.reserve(padded);
+    m_extentX.reserve(padded);
+    m_extentY.reserve(padded);
+    m_extentZ.reserve(padded);
+}
+
+void AabbBatch::clear() {
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_extentX.clear();
+    m_extentY.clear();
+    m_extentZ.clear();
+    m_count = 0;
+}
+
+void AabbBatch::resizeStorage(uint32_t count) {
+    uint32_t padded = roundUpToLanes(count, kLaneWidth);
+    if (padded == m_centerX.size()) {
+        return;
+    }
+    m_centerX.resize(padded, 0.0f);
+    m_centerY.resize(padded, 0.0f);
+    m_centerZ.resize(padded, 0.0f);
+    m_extentX.resize(padded, 0.0f);
+    m_extentY.resize(padded, 0.0f);
+    m_extentZ.resize(padded, 0.0f);
+}
+
+// ---------------------------------------------------------------------------
+// SphereBatch
+// ---------------------------------------------------------------------------
+
+SphereBatch::SphereBatch()
+    : m_count(0)
+{
+}
+
+uint32_t SphereBatch::add(float x, float y, float z, float radius) {
+    uint32_t index = m_count;
+    resizeStorage(m_count + 1);
+    m_count++;
+    set(index, x, y, z, radius);
+    return index;
+}
+
+void SphereBatch::set(uint32_t index, float x, float y, float z, float radius) {
+    m_centerX[index] = x;
+    m_centerY[index] = y;
+    m_centerZ[index] = z;
+    m_radius[index] = radius;
+}
+
+void SphereBatch::reserve(uint32_t count) {
+    uint32_t padded = roundUpToLanes(count, kLaneWidth);
+    m_centerX.reserve(padded);
+    m_centerY.reserve(padded);
+    m_centerZ.reserve(padded);
+    m_radius.reserve(padded);
+}
+
+void SphereBatch::clear() {
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_radius.clear();
+    m_count = 0;
+}
+
+void SphereBatch::resizeStorage(uint32_t count) {
+    uint32_t padded = roundUpToLanes(count, kLaneWidth);
+    if (padded == m_centerX.size()) {
+        return;
+    }
+    m_centerX.resize(padded, 0.0f);
+    m_centerY.resize(padded, 0.0f);
+    m_centerZ.resize(padded, 0.0f);
+    m_radius.resize(padded, 0.0f);
+}
+
+// ---------------------------------------------------------------------------
+// Batched culling
+// ---------------------------------------------------------------------------
+
+uint32_t cullAabbs(const Frustum& frustum, const AabbBatch& boxes, uint32_t* outVisible) {
+    if (boxes.size() == 0 || !outVisible) {
+        return 0;
+    }
+#ifdef OGDE_ARCH_X86
+    if (platform::CpuFeatures::hasAVX2()) {
+        return cullAabbsAvx2(frustum, boxes, outVisible);
+    }
+    return cullAabbsSse2(frustum, boxes, outVisible);
+#else
+    return cullAabbsScalar(frustum, boxes, outVisible);
+#endif
+}
+
+uint32_t cullSpheres(const Frustum& frustum, const SphereBatch& spheres, uint32_t* outVisible) {
+    if (spheres.size() == 0 || !outVisible) {
+        return 0;
+    }
+#ifdef OGDE_ARCH_X86
+    if (platform::CpuFeatures::hasAVX2()) {
+        return cullSpheresAvx2(frustum, spheres, outVisible);
+    }
+    return cullSpheresSse2(frustum, spheres, outVisible);
+#else
+    return cullSpheresScalar(frustum, spheres, outVisible);
+#endif
+}
+
+void cullAabbs(const Frustum& frustum, const AabbBatch& boxes, std::vector<uint32_t>& outVisible) {
+    outVisible.resize(boxes.size());
+    outVisible.resize(cullAabbs(frustum, boxes, outVisible.data()));
+}
+
+void cullSpheres(const Frustum& frustum, const SphereBatch& spheres, std::vector<uint32_t>& outVisible) {
+    outVisible.resize(spheres.size());
+    outVisible.resize(cullSpheres(frustum, spheres, outVisible.data()));
+}
+
+} // namespace graphics
+} // namespace ogde
@@ -0,0 +1,1035 @@
+/**
+ * Image Decoder Implementation
+ */
+
+#include "ogde/graphics/ImageDecoder.h"
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/platform/CpuFeatures.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+constexpr uint32_t kMaxDimension = 1u << 24;
+constexpr uint64_t kMaxPixels = 1ull << 28;
+
+uint32_t ReadBigEndian32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+           (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+bool ValidDimensions(uint32_t width, uint32_t height) {
+    return width > 0 && height > 0 && width <= kMaxDimension && height <= kMaxDimension &&
+           static_cast<uint64_t>(width) * height <= kMaxPixels;
+}
+
+// ---------------------------------------------------------------------------
+// Inflate (RFC 1951)
+// ---------------------------------------------------------------------------
+
+constexpr int kLitLenTableBits = 10;
+constexpr int kDistTableBits = 8;
+constexpr int kCodeLengthTableBits = 7;
+constexpr int kMaxCodeLength = 15;
+
+// Table entries: symbol << 16 | length, or a link to a subtable:
+// offset << 16 | kSubtableFlag | subtable bits << 8
+constexpr uint32_t kSubtableFlag = 0x8000;
+
+constexpr uint16_t kLengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+constexpr uint8_t kLengthExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+constexpr uint16_t kDistBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+constexpr uint8_t kDistExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+constexpr uint8_t kCodeLengthOrder[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+struct HuffmanTable {
+    std::vector<uint32_t> entries;
+    int tableBits = 0;
+};
+
+uint32_t ReverseBits(uint32_t code, int length) {
+    uint32_t result = 0;
+    for (int i = 0; i < length; ++i) {
+        result = (result << 1) | ((code >> i) & 1);
+    }
+    return result;
+}
+
+// Canonical Huffman decode table indexed by the next tableBits input bits
+// (deflate codes arrive most significant bit first, hence the reversal).
+// Longer codes continue in a subtable per primary prefix.
+bool BuildHuffmanTable(const uint8_t* lengths, int count, int tableBits, HuffmanTable& table) {
+    int lengthCounts[kMaxCodeLength + 1] = {};
+    for (int i = 0; i < count; ++i) {
+        ++lengthCounts[lengths[i]];
+    }
+    lengthCounts[0] = 0;
+
+    // Reject over-subscribed codes; incomplete ones leave invalid (zero) entries
+    int left = 1;
+    for (int length = 1; length <= kMaxCodeLength; ++length) {
+        left = (left << 1) - lengthCounts[length];
+        if (left < 0) {
+            return false;
+        }
+    }
+
+    uint32_t nextCode[kMaxCodeLength + 1] = {};
+    uint32_t code = 0;
+    for (int length = 1; length <= kMaxCodeLength; ++length) {
+        code = (code + lengthCounts[length - 1]) << 1;
+        nextCode[length] = code;
+    }
+
+    const uint32_t primarySize = 1u << tableBits;
+    const uint32_t primaryMask = primarySize - 1;
+    std::vector<uint32_t> reversed(count);
+    uint8_t subtableBits[1 << kLitLenTableBits] = {};
+    for (int symbol = 0; symbol < count; ++symbol) {
+        const int length = lengths[symbol];
+        if (length == 0) {
+            continue;
+        }
+        reversed[symbol] = ReverseBits(nextCode[length]++, length);
+        if (length > tableBits) {
+            uint8_t& bits = subtableBits[reversed[symbol] & primaryMask];
+            bits = std::max<uint8_t>(bits, static_cast<uint8_t>(length - tableBits));
+        }
+    }
+
+    table.tableBits = tableBits;
+    table.entries.assign(primarySize, 0);
+    for (uint32_t prefix = 0; prefix < primarySize; ++prefix) {
+        if (subtableBits[prefix]) {
+            const uint32_t offset = static_cast<uint32_t>(table.entries.size());
+            table.entries[prefix] = (offset << 16) | kSubtableFlag | (static_cast<uint32_t>(subtableBits[prefix]) << 8);
+            table.entries.resize(offset + (1u << subtableBits[prefix]), 0);
+        }
+    }
+
+    for (int symbol = 0; symbol < count; ++symbol) {
+        const int length = lengths[symbol];
+        if (length == 0) {
+            continue;
+        }
+        const uint32_t bits = reversed[symbol];
+        if (length <= tableBits) {
+            for (uint32_t i = bits; i < primarySize; i += 1u << length) {
+                table.entries[i] = (static_cast<uint32_t>(symbol) << 16) | static_cast<uint32_t>(length);
+            }
+        } else {
+            const uint32_t link = table.entries[bits & primaryMask];
+            const uint32_t offset = link >> 16;
+            const int subBits = (link >> 8) & 0x7F;
+            const int remaining = length - tableBits;
+            for (uint32_t i = bits >> tableBits; i < (1u << subBits); i += 1u << remaining) {
+                table.entries[offset + i] = (static_cast<uint32_t>(symbol) << 16) | static_cast<uint32_t>(remaining);
+            }
+        }
+    }
+    return true;
+}
+
+const HuffmanTable& FixedLitLenTable() {
+    static const HuffmanTable table = []() {
+        uint8_t lengths[288];
+        std::fill(lengths, lengths + 144, 8);
+        std::fill(lengths + 144, lengths + 256, 9);
+        std::fill(lengths + 256, lengths + 280, 7);
+        std::fill(lengths + 280, lengths + 288, 8);
+        HuffmanTable t;
+        BuildHuffmanTable(lengths, 288, kLitLenTableBits, t);
+        return t;
+    }();
+    return table;
+}
+
+const HuffmanTable& FixedDistTable() {
+    static const HuffmanTable table = []() {
+        uint8_t lengths[32];
+        std::fill(lengths, lengths + 32, 5);
+        HuffmanTable t;
+        BuildHuffmanTable(lengths, 32, kDistTableBits, t);
+        return t;
+    }();
+    return table;
+}
+
+/**
+ * LSB-first bit reader keeping 56-63 bits buffered. Reads past the end
+ * return zeros and are counted so truncated streams can be detected.
+ */
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size)
+        : next_(data)
+        , end_(data + size) {
+    }
+
+    void Refill() {
+        if (end_ - next_ >= 8) {
+            uint64_t word;
+            std::memcpy(&word, next_, sizeof(word));
+            bits_ |= word << count_;
+            next_ += (63 - count_) >> 3;
+            count_ |= 56;
+        } else {
+            while (count_ <= 56) {
+                uint64_t byte = 0;
+                if (next_ < end_) {
+                    byte = *next_++;
+                } else {
+                    ++padding_;
+                }
+                bits_ |= byte << count_;
+                count_ += 8;
+            }
+        }
+    }
+
+    uint32_t Peek(int count) const { return static_cast<uint32_t>(bits_ & ((1ull << count) - 1)); }
+
+    void Consume(int count) {
+        bits_ >>= count;
+        count_ -= count;
+    }
+
+    uint32_t Read(int count) {
+        uint32_t value = Peek(count);
+        Consume(count);
+        return value;
+    }
+
+    // Decode one symbol; needs at least 15 buffered bits. Returns -1 on an invalid code.
+    int Decode(const HuffmanTable& table) { return Decode(table.entries.data(), table.tableBits); }
+
+    int Decode(const uint32_t* entries, int tableBits) {
+        uint32_t entry = entries[Peek(tableBits)];
+        if (entry & kSubtableFlag) {
+            Consume(tableBits);
+            entry = entries[(entry >> 16) + Peek((entry >> 8) & 0x7F)];
+        }
+        const int length = entry & 0xFF;
+        if (length == 0) {
+            return -1;
+        }
+        Consume(length);
+        return static_cast<int>(entry >> 16);
+    }
+
+    void AlignToByte() { Consume(count_ & 7); }
+
+    // Hand out whole buffered bytes, then raw input; false if the input runs out
+    bool CopyBytes(uint8_t* out, size_t count) {
+        while (count > 0 && count_ >= 8) {
+            *out++ = static_cast<uint8_t>(bits_);
+            Consume(8);
+            --count;
+        }
+        if (count == 0) {
+            return true;
+        }
+        if (Overrun() || static_cast<size_t>(end_ - next_) < count) {
+            return false;
+        }
+        std::memcpy(out, next_, count);
+        next_ += count;
+        bits_ = 0;
+        count_ = 0;
+        return true;
+    }
+
+    bool Overrun() const { return padding_ * 8 > count_; }
+
+private:
+    const uint8_t* next_;
+    const uint8_t* end_;
+    uint64_t bits_ = 0;
+    int count_ = 0;
+    int padding_ = 0;
+};
+
+/**
+ * Decode literals and matches until the end-of-block code. Works on local
+ * copies of the reader and tables: byte stores into out could otherwise
+ * alias them and force reloads on every symbol.
+ */
+bool InflateBlock(BitReader& reader, const HuffmanTable& litLenTable, const HuffmanTable& distTable,
+                  uint8_t* out, size_t outSize, size_t& outPos) {
+    BitReader bits = reader;
+    const uint32_t* litLen = litLenTable.entries.data();
+    const uint32_t* dist = distTable.entries.data();
+    const int litLenBits = litLenTable.tableBits;
+    const int distBits = distTable.tableBits;
+    size_t pos = outPos;
+
+    // One refill covers a length code, its extra bits, a distance code and its extra bits (<= 48 bits)
+    while (true) {
+        bits.Refill();
+        int symbol = bits.Decode(litLen, litLenBits);
+        // Up to three literals fit in one refill
+        for (int extra = 0; extra < 2 && symbol < 256; ++extra) {
+            if (symbol < 0 || pos >= outSize) {
+                return false;
+            }
+            out[pos++] = static_cast<uint8_t>(symbol);
+            symbol = bits.Decode(litLen, litLenBits);
+        }
+        if (symbol < 256) {
+            if (symbol < 0 || pos >= outSize) {
+                return false;
+            }
+            out[pos++] = static_cast<uint8_t>(symbol);
+            continue;
+        }
+
+        if (symbol == 256) {
+            break;
+        }
+        if (symbol > 285) {
+            return false;
+        }
+        // A literal run may have used up to 30 bits; top up for the 48-bit worst case
+        bits.Refill();
+        const int lengthIndex = symbol - 257;
+        const size_t length = kLengthBase[lengthIndex] + bits.Read(kLengthExtra[lengthIndex]);
+        const int distSymbol = bits.Decode(dist, distBits);
+        if (distSymbol < 0 || distSymbol > 29) {
+            return false;
+        }
+        const size_t distance = kDistBase[distSymbol] + bits.Read(kDistExtra[distSymbol]);
+        if (distance > pos || length > outSize - pos) {
+            return false;
+        }
+
+        uint8_t* dst = out + pos;
+        const uint8_t* src = dst - distance;
+        pos += length;
+        if (distance >= 8) {
+            // Whole words; may run up to 7 bytes into the slack
+            uint8_t* const dstEnd = dst + length;
+            do {
+                std::memcpy(dst, src, 8);
+                dst += 8;
+                src += 8;
+            } while (dst < dstEnd);
+        } else if (distance == 1) {
+            std::memset(dst, *src, length);
+        } else {
+            for (size_t i = 0; i < length; ++i) {
+                dst[i] = src[i];
+            }
+        }
+    }
+
+    reader = bits;
+    outPos = pos;
+    return true;
+}
+
+// Slack past the expected size so matches can be copied 8 bytes at a time
+constexpr size_t kInflateSlack = 16;
+
+/**
+ * Inflate a zlib stream into out, which must hold outSize + kInflateSlack
+ * bytes. Succeeds only if the stream produces exactly outSize bytes.
+ */
+bool InflateZlib(const uint8_t* data, size_t size, uint8_t* out, size_t outSize) {
+    if (size < 2 || (data[0] & 0x0F) != 8 || (data[0] >> 4) > 7 || (data[1] & 0x20) ||
+        ((data[0] << 8) | data[1]) % 31 != 0) {
+        return false;
+    }
+
+    BitReader reader(data + 2, size - 2);
+    HuffmanTable dynamicLitLen;
+    HuffmanTable dynamicDist;
+    size_t pos = 0;
+    bool finalBlock = false;
+    while (!finalBlock) {
+        reader.Refill();
+        finalBlock = reader.Read(1) != 0;
+        const uint32_t type = reader.Read(2);
+
+        if (type == 0) {
+            reader.AlignToByte();
+            reader.Refill();
+            const uint32_t length = reader.Read(16);
+            const uint32_t inverse = reader.Read(16);
+            if ((length ^ 0xFFFF) != inverse || length > outSize - pos || !reader.CopyBytes(out + pos, length)) {
+                return false;
+            }
+            pos += length;
+            continue;
+        }
+
+        const HuffmanTable* litLen = &FixedLitLenTable();
+        const HuffmanTable* dist = &FixedDistTable();
+        if (type == 2) {
+            const int litLenCount = static_cast<int>(reader.Read(5)) + 257;
+            const int distCount = static_cast<int>(reader.Read(5)) + 1;
+            const int codeLengthCount = static_cast<int>(reader.Read(4)) + 4;
+            uint8_t codeLengthLengths[19] = {};
+            for (int i = 0; i < codeLengthCount; ++i) {
+                reader.Refill();
+                codeLengthLengths[kCodeLengthOrder[i]] = static_cast<uint8_t>(reader.Read(3));
+            }
+            HuffmanTable codeLengthTable;
+            if (litLenCount > 286 || distCount > 30 ||
+                !BuildHuffmanTable(codeLengthLengths, 19, kCodeLengthTableBits, codeLengthTable)) {
+                return false;
+            }
+
+            uint8_t lengths[286 + 30];
+            const int total = litLenCount + distCount;
+            for (int i = 0; i < total;) {
+                reader.Refill();
+                const int symbol = reader.Decode(codeLengthTable);
+                if (symbol < 0) {
+                    return false;
+                }
+                if (symbol < 16) {
+                    lengths[i++] = static_cast<uint8_t>(symbol);
+                    continue;
+                }
+                uint8_t value = 0;
+                int repeat;
+                if (symbol == 16) {
+                    if (i == 0) {
+                        return false;
+                    }
+                    value = lengths[i - 1];
+                    repeat = 3 + static_cast<int>(reader.Read(2));
+                } else if (symbol == 17) {
+                    repeat = 3 + static_cast<int>(reader.Read(3));
+                } else {
+                    repeat = 11 + static_cast<int>(reader.Read(7));
+                }
+                if (i + repeat > total) {
+                    return false;
+                }
+                std::memset(lengths + i, value, repeat);
+                i += repeat;
+            }
+            if (lengths[256] == 0 ||
+                !BuildHuffmanTable(lengths, litLenCount, kLitLenTableBits, dynamicLitLen) ||
+                !BuildHuffmanTable(lengths + litLenCount, distCount, kDistTableBits, dynamicDist)) {
+                return false;
+            }
+            litLen = &dynamicLitLen;
+            dist = &dynamicDist;
+        } else if (type != 1) {
+            return false;
+        }
+
+        if (!InflateBlock(reader, *litLen, *dist, out, outSize, pos)) {
+            return false;
+        }
+        if (reader.Overrun()) {
+            return false;
+        }
+    }
+    return pos == outSize;
+}
+
+// ---------------------------------------------------------------------------
+// PNG row filters
+// ---------------------------------------------------------------------------
+
+inline uint8_t Paeth(int a, int b, int c) {
+    const int pa = std::abs(b - c);
+    const int pb = std::abs(a - c);
+    const int pc = std::abs(a + b - 2 * c);
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    }
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+// Scalar kernels (also handle the tails of SIMD runs and 1/2-byte pixels)
+
+void UnfilterUpScalar(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + prev[i]);
+    }
+}
+
+void UnfilterSubScalar(const uint8_t* src, uint8_t* dst, size_t rowBytes, int bpp) {
+    std::memcpy(dst, src, bpp);
+    for (size_t i = bpp; i < rowBytes; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + dst[i - bpp]);
+    }
+}
+
+void UnfilterAverageScalar(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes, int bpp) {
+    for (int i = 0; i < bpp; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + (prev[i] >> 1));
+    }
+    for (size_t i = bpp; i < rowBytes; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + ((dst[i - bpp] + prev[i]) >> 1));
+    }
+}
+
+void UnfilterPaethScalar(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes, int bpp) {
+    for (int i = 0; i < bpp; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + prev[i]);
+    }
+    for (size_t i = bpp; i < rowBytes; ++i) {
+        dst[i] = static_cast<uint8_t>(src[i] + Paeth(dst[i - bpp], prev[i], prev[i - bpp]));
+    }
+}
+
+#ifdef OGDE_ARCH_X86
+
+// SSE2 is the x86-64 baseline, so these need no runtime dispatch. Sub, Average
+// and Paeth depend on the pixel to the left; one 3- or 4-byte pixel is
+// reconstructed per step with every channel in a 16-bit lane.
+
+// 3-byte pixels are assembled from a 2-byte and a 1-byte access: going
+// through a 3-byte memcpy to a stack word stalls on store forwarding
+template <int Bpp>
+inline __m128i LoadPixel(const uint8_t* p) {
+    int32_t value;
+    if (Bpp == 4) {
+        std::memcpy(&value, p, 4);
+    } else {
+        uint16_t low;
+        std::memcpy(&low, p, 2);
+        value = low | (p[2] << 16);
+    }
+    return _mm_cvtsi32_si128(value);
+}
+
+template <int Bpp>
+inline void StorePixel(uint8_t* p, __m128i pixel) {
+    uint32_t value = static_cast<uint32_t>(_mm_cvtsi128_si32(pixel));
+    if (Bpp == 4) {
+        std::memcpy(p, &value, 4);
+    } else {
+        uint16_t low = static_cast<uint16_t>(value);
+        std::memcpy(p, &low, 2);
+        p[2] = static_cast<uint8_t>(value >> 16);
+    }
+}
+
+void UnfilterUpSse2(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes) {
+    size_t i = 0;
+    for (; i + 16 <= rowBytes; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi8(a, b));
+    }
+    UnfilterUpScalar(src, prev, dst, i, rowBytes);
+}
+
+template <int Bpp>
+void UnfilterSubSse2(const uint8_t* src, uint8_t* dst, size_t rowBytes) {
+    __m128i left = _mm_setzero_si128();
+    for (size_t i = 0; i < rowBytes; i += Bpp) {
+        left = _mm_add_epi8(left, LoadPixel<Bpp>(src + i));
+        StorePixel<Bpp>(dst + i, left);
+    }
+}
+
+template <int Bpp>
+void UnfilterAverageSse2(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes) {
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i left = _mm_setzero_si128();
+    for (size_t i = 0; i < rowBytes; i += Bpp) {
+        __m128i up = LoadPixel<Bpp>(prev + i);
+        // avg_epu8 rounds up; subtract the carry to get the floor PNG wants
+        __m128i average = _mm_avg_epu8(left, up);
+        average = _mm_sub_epi8(average, _mm_and_si128(_mm_xor_si128(left, up), one));
+        left = _mm_add_epi8(average, LoadPixel<Bpp>(src + i));
+        StorePixel<Bpp>(dst + i, left);
+    }
+}
+
+inline __m128i Select(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Branch-free Paeth: with lo/hi the smaller/larger of left and up and
+// t = 3 * upperLeft - (left + up), the predictor is hi if t <= lo, lo if
+// hi <= t, else upperLeft. Equivalent to the distance comparison, with a
+// shorter dependency chain through the left pixel.
+template <int Bpp>
+void UnfilterPaethSse2(const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a = zero;   // left
+    __m128i c = zero;   // upper left
+    for (size_t i = 0; i < rowBytes; i += Bpp) {
+        __m128i b = _mm_unpacklo_epi8(LoadPixel<Bpp>(prev + i), zero);
+        __m128i threshold = _mm_sub_epi16(_mm_add_epi16(c, _mm_add_epi16(c, c)), _mm_add_epi16(a, b));
+        __m128i lo = _mm_min_epi16(a, b);
+        __m128i hi = _mm_max_epi16(a, b);
+        __m128i predictor = Select(_mm_cmpgt_epi16(hi, threshold), c, lo);
+        predictor = Select(_mm_cmpgt_epi16(threshold, lo), predictor, hi);
+        // Channels stay below 256: the byte add wraps and leaves the high bytes zero
+        a = _mm_add_epi8(_mm_unpacklo_epi8(LoadPixel<Bpp>(src + i), zero), predictor);
+        c = b;
+        StorePixel<Bpp>(dst + i, _mm_packus_epi16(a, a));
+    }
+}
+
+template <int Bpp>
+bool UnfilterRowSse2(int filter, const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes) {
+    switch (filter) {
+    case 0:
+        std::memcpy(dst, src, rowBytes);
+        return true;
+    case 1:
+        UnfilterSubSse2<Bpp>(src, dst, rowBytes);
+        return true;
+    case 2:
+        UnfilterUpSse2(src, prev, dst, rowBytes);
+        return true;
+    case 3:
+        UnfilterAverageSse2<Bpp>(src, prev, dst, rowBytes);
+        return true;
+    case 4:
+        UnfilterPaethSse2<Bpp>(src, prev, dst, rowBytes);
+        return true;
+    default:
+        return false;
+    }
+}
+
+#endif
+
+/**
+ * Reverse one row filter. prev is the reconstructed row above (zeros for the
+ * first row); dst must not alias src or prev.
+ */
+bool UnfilterRow(int filter, const uint8_t* src, const uint8_t* prev, uint8_t* dst, size_t rowBytes, int bpp) {
+#ifdef OGDE_ARCH_X86
+    if (bpp == 4) {
+        return UnfilterRowSse2<4>(filter, src, prev, dst, rowBytes);
+    }
+    if (bpp == 3) {
+        return UnfilterRowSse2<3>(filter, src, prev, dst, rowBytes);
+    }
+#endif
+    switch (filter) {
+    case 0:
+        std::memcpy(dst, src, rowBytes);
+        return true;
+    case 1:
+        UnfilterSubScalar(src, dst, rowBytes, bpp);
+        return true;
+    case 2:
+        UnfilterUpScalar(src, prev, dst, 0, rowBytes);
+        return true;
+    case 3:
+        UnfilterAverageScalar(src, prev, dst, rowBytes, bpp);
+        return true;
+    case 4:
+        UnfilterPaethScalar(src, prev, dst, rowBytes, bpp);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// PNG
+// ---------------------------------------------------------------------------
+
+constexpr uint8_t kPngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+struct PngFile {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int bitDepth = 0;
+    int colorType = 0;
+    int fileChannels = 0;       // Samples per pixel as stored
+    int channels = 0;           // stb_image-compatible output channels
+    uint8_t palette[256 * 4];   // RGBA
+    int paletteSize = 0;
+    bool paletteAlpha = false;
+    std::vector<std::pair<const uint8_t*, size_t>> idat;
+};
+
+// Inflated scanlines are kept per thread between decodes so a batch of images
+// does not fault in a fresh buffer every time. Every decode thread holds its
+// buffer for life, so only images up to about 1024x1024 RGBA reuse it; larger
+// ones inflate into a buffer freed when the decode returns.
+constexpr size_t kMaxRetainedScratch = 8u * 1024u * 1024u;
+
+std::vector<uint8_t>& InflateScratch() {
+    thread_local std::vector<uint8_t> scratch;
+    return scratch;
+}
+
+// Walk the chunk list; false for anything the in-tree path does not handle
+bool ParsePng(const uint8_t* data, size_t size, PngFile& png) {
+    if (size < 8 + 25 || std::memcmp(data, kPngSignature, 8) != 0) {
+        return false;
+    }
+
+    size_t offset = 8;
+    bool sawHeader = false;
+    while (offset + 12 <= size) {
+        const uint32_t length = ReadBigEndian32(data + offset);
+        const uint8_t* type = data + offset + 4;
+        const uint8_t* body = data + offset + 8;
+        if (length > size - offset - 12) {
+            return false;
+        }
+        offset += 12 + static_cast<size_t>(length);
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            if (sawHeader || length != 13) {
+                return false;
+            }
+            sawHeader = true;
+            png.width = ReadBigEndian32(body);
+            png.height = ReadBigEndian32(body + 4);
+            png.bitDepth = body[8];
+            png.colorType = body[9];
+            // Compression and filter method 0, no interlacing
+            if (!ValidDimensions(png.width, png.height) || body[10] != 0 || body[11] != 0 || body[12] != 0) {
+                return false;
+            }
+            switch (png.colorType) {
+            case 0: png.fileChannels = 1; break;
+            case 2: png.fileChannels = 3; break;
+            case 3: png.fileChannels = 1; break;
+            case 4: png.fileChannels = 2; break;
+            case 6: png.fileChannels = 4; break;
+            default: return false;
+            }
+            const bool lowDepth = png.bitDepth == 1 || png.bitDepth == 2 || png.bitDepth == 4;
+            if (!(png.bitDepth == 8 || (lowDepth && (png.colorType == 0 || png.colorType == 3)))) {
+                return false;
+            }
+        } else if (!sawHeader) {
+            return false;
+        } else if (std::memcmp(type, "PLTE", 4) == 0) {
+            if (length % 3 != 0 || length / 3 > 256 || length == 0) {
+                return false;
+            }
+            png.paletteSize = static_cast<int>(length / 3);
+            for (int i = 0; i < 256; ++i) {
+                const bool present = i < png.paletteSize;
+                png.palette[i * 4 + 0] = present ? body[i * 3 + 0] : 0;
+                png.palette[i * 4 + 1] = present ? body[i * 3 + 1] : 0;
+                png.palette[i * 4 + 2] = present ? body[i * 3 + 2] : 0;
+                png.palette[i * 4 + 3] = 255;
+            }
+        } else if (std::memcmp(type, "tRNS", 4) == 0) {
+            // Colour-key transparency on grey / RGB is left to stb_image
+            if (png.colorType != 3 || png.paletteSize == 0 || static_cast<int>(length) > png.paletteSize) {
+                return false;
+            }
+            for (uint32_t i = 0; i < length; ++i) {
+                png.palette[i * 4 + 3] = body[i];
+            }
+            png.paletteAlpha = true;
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            png.idat.emplace_back(body, static_cast<size_t>(length));
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        } else if (!(type[0] & 0x20)) {
+            // Unknown critical chunk (e.g. Apple CgBI)
+            return false;
+        }
+    }
+
+    if (!sawHeader || png.idat.empty() || (png.colorType == 3 && png.paletteSize == 0)) {
+        return false;
+    }
+    png.channels = png.colorType == 3 ? (png.paletteAlpha ? 4 : 3) : png.fileChannels;
+    return true;
+}
+
+// Convert a reconstructed row into the output layout; false on an out-of-range palette index
+bool ExpandPngRow(const PngFile& png, const uint8_t* row, uint8_t* out, int outChannels) {
+    const uint32_t width = png.width;
+    const int depth = png.bitDepth;
+    if (png.colorType == 3) {
+        for (uint32_t x = 0; x < width; ++x) {
+            int index;
+            if (depth < 8) {
+                const int perByte = 8 / depth;
+                const int shift = 8 - depth * (static_cast<int>(x % perByte) + 1);
+                index = (row[x / perByte] >> shift) & ((1 << depth) - 1);
+            } else {
+                index = row[x];
+            }
+            if (index >= png.paletteSize) {
+                return false;
+            }
+            std::memcpy(out + static_cast<size_t>(x) * outChannels, png.palette + index * 4, outChannels);
+        }
+        return true;
+    }
+
+    if (depth < 8) {
+        // Low bit-depth grey is scaled to the full 8-bit range
+        const int perByte = 8 / depth;
+        const int scale = depth == 1 ? 0xFF : depth == 2 ? 0x55 : 0x11;
+        for (uint32_t x = 0; x < width; ++x) {
+            const int shift = 8 - depth * (static_cast<int>(x % perByte) + 1);
+            const uint8_t grey = static_cast<uint8_t>(((row[x / perByte] >> shift) & ((1 << depth) - 1)) * scale);
+            uint8_t* p = out + static_cast<size_t>(x) * outChannels;
+            p[0] = grey;
+            if (outChannels == 4) {
+                p[1] = grey;
+                p[2] = grey;
+                p[3] = 255;
+            }
+        }
+        return true;
+    }
+
+    // 8-bit into RGBA
+    switch (png.fileChannels) {
+    case 1:
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* p = out + static_cast<size_t>(x) * 4;
+            p[0] = p[1] = p[2] = row[x];
+            p[3] = 255;
+        }
+        break;
+    case 2:
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* p = out + static_cast<size_t>(x) * 4;
+            p[0] = p[1] = p[2] = row[x * 2];
+            p[3] = row[x * 2 + 1];
+        }
+        break;
+    case 3:
+        PixelConverter::RgbToRgba(row, out, width);
+        break;
+    default:
+        std::memcpy(out, row, static_cast<size_t>(width) * 4);
+        break;
+    }
+    return true;
+}
+
+bool DecodePng(const uint8_t* data, size_t size, uint8_t* pixels, int channels) {
+    PngFile png;
+    if (!ParsePng(data, size, png)) {
+        return false;
+    }
+    const int outChannels = channels == 0 ? png.channels : channels;
+
+    // The zlib stream may be split over several IDAT chunks
+    const uint8_t* stream = png.idat[0].first;
+    size_t streamSize = png.idat[0].second;
+    std::vector<uint8_t> joined;
+    if (png.idat.size() > 1) {
+        for (const auto& chunk : png.idat) {
+            joined.insert(joined.end(), chunk.first, chunk.first + chunk.second);
+        }
+        stream = joined.data();
+        streamSize = joined.size();
+    }
+
+    const size_t rowBytes = (static_cast<size_t>(png.width) * png.fileChannels * png.bitDepth + 7) / 8;
+    const size_t filteredSize = (rowBytes + 1) * png.height;
+    std::vector<uint8_t> local;
+    std::vector<uint8_t>& filtered = filteredSize <= kMaxRetainedScratch ? InflateScratch() : local;
+    if (filtered.size() < filteredSize + kInflateSlack) {
+        filtered.resize(filteredSize + kInflateSlack);
+    }
+    if (!InflateZlib(stream, streamSize, filtered.data(), filteredSize)) {
+        return false;
+    }
+
+    // Rows already in the output layout are reconstructed in place; others
+    // go through two alternating scratch rows and are expanded afterwards
+    const int bpp = std::max(1, png.fileChannels * png.bitDepth / 8);
+    const size_t outStride = static_cast<size_t>(png.width) * outChannels;
+    const bool direct = png.bitDepth == 8 && png.colorType != 3 && outChannels == png.fileChannels;
+    std::vector<uint8_t> zeroRow(rowBytes, 0);
+    std::vector<uint8_t> scratch(direct ? 0 : rowBytes * 2);
+
+    const uint8_t* prev = zeroRow.data();
+    for (uint32_t y = 0; y < png.height; ++y) {
+        const uint8_t* src = filtered.data() + y * (rowBytes + 1);
+        uint8_t* outRow = pixels + y * outStride;
+        uint8_t* row = direct ? outRow : scratch.data() + (y & 1) * rowBytes;
+        if (!UnfilterRow(src[0], src + 1, prev, row, rowBytes, bpp)) {
+            return false;
+        }
+        if (!direct && !ExpandPngRow(png, row, outRow, outChannels)) {
+            return false;
+        }
+        prev = row;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// QOI
+// ---------------------------------------------------------------------------
+
+constexpr size_t kQoiHeaderSize = 14;
+constexpr size_t kQoiEndMarkerSize = 8;
+
+bool ParseQoi(const uint8_t* data, size_t size, ImageInfo& info) {
+    if (size < kQoiHeaderSize + kQoiEndMarkerSize || std::memcmp(data, "qoif", 4) != 0) {
+        return false;
+    }
+    const uint32_t width = ReadBigEndian32(data + 4);
+    const uint32_t height = ReadBigEndian32(data + 8);
+    const int channels = data[12];
+    if (!ValidDimensions(width, height) || (channels != 3 && channels != 4) || data[13] > 1) {
+        return false;
+    }
+    info.format = ImageFormat::Qoi;
+    info.width = static_cast<int>(width);
+    info.height = static_cast<int>(height);
+    info.channels = channels;
+    return true;
+}
+
+// The channel count is a template parameter so each pixel store is a fixed-size move
+template <int OutChannels>
+bool DecodeQoiPixels(const uint8_t* p, const uint8_t* end, uint8_t* out, size_t pixelCount) {
+    uint8_t index[64 * 4] = {};
+    uint8_t px[4] = { 0, 0, 0, 255 };
+    size_t run = 0;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        if (run > 0) {
+            --run;
+        } else {
+            if (p >= end) {
+                return false;
+            }
+            const uint8_t op = *p++;
+            if (op == 0xFE) {
+                if (end - p < 3) {
+                    return false;
+                }
+                px[0] = p[0];
+                px[1] = p[1];
+                px[2] = p[2];
+                p += 3;
+            } else if (op == 0xFF) {
+                if (end - p < 4) {
+                    return false;
+                }
+                std::memcpy(px, p, 4);
+                p += 4;
+            } else {
+                switch (op >> 6) {
+                case 0:
+                    std::memcpy(px, index + (op & 0x3F) * 4, 4);
+                    break;
+                case 1:
+                    px[0] = static_cast<uint8_t>(px[0] + ((op >> 4) & 3) - 2);
+                    px[1] = static_cast<uint8_t>(px[1] + ((op >> 2) & 3) - 2);
+                    px[2] = static_cast<uint8_t>(px[2] + (op & 3) - 2);
+                    break;
+                case 2: {
+                    if (p >= end) {
+                        return false;
+                    }
+                    const int dg = (op & 0x3F) - 32;
+                    const uint8_t next = *p++;
+                    px[0] = static_cast<uint8_t>(px[0] + dg - 8 + (next >> 4));
+                    px[1] = static_cast<uint8_t>(px[1] + dg);
+                    px[2] = static_cast<uint8_t>(px[2] + dg - 8 + (next & 0x0F));
+                    break;
+                }
+                default:
+                    run = op & 0x3F;
+                    break;
+                }
+            }
+            std::memcpy(index + ((px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) & 63) * 4, px, 4);
+        }
+        std::memcpy(out, px, OutChannels);
+        out += OutChannels;
+    }
+    return true;
+}
+
+bool DecodeQoi(const uint8_t* data, size_t size, uint8_t* pixels, int channels) {
+    ImageInfo info;
+    if (!ParseQoi(data, size, info)) {
+        return false;
+    }
+    const uint8_t* begin = data + kQoiHeaderSize;
+    const uint8_t* end = data + size - kQoiEndMarkerSize;
+    const size_t pixelCount = static_cast<size_t>(info.width) * info.height;
+    if ((channels == 0 ? info.channels : channels) == 4) {
+        return DecodeQoiPixels<4>(begin, end, pixels, pixelCount);
+    }
+    return DecodeQoiPixels<3>(begin, end, pixels, pixelCount);
+}
+
+} // namespace
+
+ImageFormat ImageDecoder::DetectFormat(const uint8_t* data, size_t size) {
+    if (size >= 8 && std::memcmp(data, kPngSignature, 8) == 0) {
+        return ImageFormat::Png;
+    }
+    if (size >= 4 && std::memcmp(data, "qoif", 4) == 0) {
+        return ImageFormat::Qoi;
+    }
+    return ImageFormat::Unknown;
+}
+
+bool ImageDecoder::ReadInfo(const uint8_t* data, size_t size, ImageInfo& info) {
+    info = ImageInfo();
+    switch (DetectFormat(data, size)) {
+    case ImageFormat::Png: {
+        PngFile png;
+        if (!ParsePng(data, size, png)) {
+            return false;
+        }
+        info.format = ImageFormat::Png;
+        info.width = static_cast<int>(png.width);
+        info.height = static_cast<int>(png.height);
+        info.channels = png.channels;
+        return true;
+    }
+    case ImageFormat::Qoi:
+        return ParseQoi(data, size, info);
+    default:
+        return false;
+    }
+}
+
+bool ImageDecoder::Decode(const uint8_t* data, size_t size, uint8_t* pixels, int channels) {
+    if (!pixels || (channels != 0 && channels != 4)) {
+        return false;
+    }
+    switch (DetectFormat(data, size)) {
+    case ImageFormat::Png:
+        return DecodePng(data, size, pixels, channels);
+    case ImageFormat::Qoi:
+        return DecodeQoi(data, size, pixels, channels);
+    default:
+        return false;
+    }
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,69 @@
+/**
+ * @file LodSelector.cpp
+ * @brief Screen-space error based level-of-detail selection implementation
+ */
+
+#include "ogde/graphics/LodSelector.h"
+#include "ogde/graphics/Camera.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace ogde {
+namespace graphics {
+
+LodSelector::LodSelector()
+    : m_position{ 0.0f, 0.0f, 0.0f }
+    , m_projectionScale(1.0f)
+    , m_orthographic(false)
+    , m_threshold(1.0f) {
+}
+
+void LodSelector::setCamera(const Camera& camera, float viewportHeight) {
+    camera.getPosition(m_position[0], m_position[1], m_position[2]);
+    m_orthographic = camera.getProjectionType() == ProjectionType::Orthographic;
+    if (m_orthographic) {
+        m_projectionScale = viewportHeight / std::max(camera.getOrthoHeight(), 1e-6f);
+    } else {
+        const float halfFov = camera.getFieldOfView() * 0.5f * 3.14159265f / 180.0f;
+        m_projectionScale = viewportHeight / (2.0f * std::tan(halfFov));
+    }
+}
+
+float LodSelector::getScreenError(float error, float x, float y, float z, float radius) const {
+    if (m_orthographic) {
+        return error * m_projectionScale;
+    }
+    const float dx = x - m_position[0];
+    const float dy = y - m_position[1];
+    const float dz = z - m_position[2];
+    const float distance = std::sqrt(dx * dx + dy * dy + dz * dz) - radius;
+    if (distance <= 0.0f) {
+        return error > 0.0f ? INFINITY : 0.0f;
+    }
+    return error * m_projectionScale / distance;
+}
+
+uint32_t LodSelector::select(const float* lodErrors, uint32_t lodCount, float x, float y, float z, float radius,
+                             float scale) const {
+    // Pixels per unit of error; levels are ordered by error, so walk down from the coarsest
+    const float pixelsPerUnit = getScreenError(scale, x, y, z, radius);
+    for (uint32_t level = lodCount; level-- > 1;) {
+        if (lodErrors[level] * pixelsPerUnit <= m_threshold) {
+            return level;
+        }
+    }
+    return 0;
+}
+
+void LodSelector::selectBatch(const float* spheres, uint32_t count, const float* lodErrors, uint32_t lodCount,
+                              uint8_t* outLevels) const {
+    lodCount = std::min(lodCount, 256u);
+    for (uint32_t i = 0; i < count; ++i) {
+        const float* sphere = spheres + static_cast<size_t>(i) * 4;
+        outLevels[i] = static_cast<uint8_t>(select(lodErrors, lodCount, sphere[0], sphere[1], sphere[2], sphere[3]));
+    }
+}
+
+} // namespace graphics
+} // namespace ogde
@@ -0,0 +1,205 @@
+/**
+ * Material Instance Implementation
+ */
+
+#include "ogde/graphics/MaterialInstance.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+struct ParamLayout {
+    size_t offset;
+    size_t size;
+};
+
+// Where each MaterialParam lives inside MaterialParams
+constexpr size_t kTexturesOffset = offsetof(MaterialParams, textures);
+const ParamLayout kParamLayouts[] = {
+    { offsetof(MaterialParams, diffuseColor), 4 * sizeof(float) },
+    { offsetof(MaterialParams, ambientColor), 3 * sizeof(float) },
+    { offsetof(MaterialParams, specularColor), 3 * sizeof(float) },
+    { offsetof(MaterialParams, shininess), sizeof(float) },
+    { offsetof(MaterialParams, opacity), sizeof(float) },
+    { kTexturesOffset + 0 * sizeof(TextureHandle), sizeof(TextureHandle) },
+    { kTexturesOffset + 1 * sizeof(TextureHandle), sizeof(TextureHandle) },
+    { kTexturesOffset + 2 * sizeof(TextureHandle), sizeof(TextureHandle) },
+    { kTexturesOffset + 3 * sizeof(TextureHandle), sizeof(TextureHandle) },
+    { kTexturesOffset + 4 * sizeof(TextureHandle), sizeof(TextureHandle) },
+    { kTexturesOffset + 5 * sizeof(TextureHandle), sizeof(TextureHandle) },
+};
+
+static_assert(sizeof(kParamLayouts) / sizeof(kParamLayouts[0]) == static_cast<size_t>(MaterialParam::Count),
+              "Every MaterialParam needs a layout entry");
+
+constexpr int kFirstTextureParam = static_cast<int>(MaterialParam::DiffuseMap);
+
+uint32_t ParamBit(MaterialParam param) {
+    return 1u << static_cast<int>(param);
+}
+
+} // namespace
+
+MaterialInstance::MaterialInstance() = default;
+
+MaterialInstance::MaterialInstance(const MaterialTable& table, MaterialHandle parent)
+    : table_(&table)
+    , data_(std::make_shared<Data>())
+{
+    data_->parent = parent;
+}
+
+MaterialInstance::~MaterialInstance() = default;
+
+MaterialInstance::MaterialInstance(const MaterialInstance& other) = default;
+
+MaterialInstance& MaterialInstance::operator=(const MaterialInstance& other) = default;
+
+MaterialInstance::MaterialInstance(MaterialInstance&& other) noexcept = default;
+
+MaterialInstance& MaterialInstance::operator=(MaterialInstance&& other) noexcept = default;
+
+void MaterialInstance::SetParent(MaterialHandle parent) {
+    if (GetParent() != parent) {
+        MutableData().parent = parent;
+    }
+}
+
+MaterialHandle MaterialInstance::GetParent() const {
+    return data_ ? data_->parent : kInvalidMaterialHandle;
+}
+
+void MaterialInstance::SetDiffuseColor(float r, float g, float b, float a) {
+    const float value[4] = {r, g, b, a};
+    SetOverride(MaterialParam::DiffuseColor, value);
+}
+
+void MaterialInstance::SetAmbientColor(float r, float g, float b) {
+    const float value[3] = {r, g, b};
+    SetOverride(MaterialParam::AmbientColor, value);
+}
+
+void MaterialInstance::SetSpecularColor(float r, float g, float b) {
+    const float value[3] = {r, g, b};
+    SetOverride(MaterialParam::SpecularColor, value);
+}
+
+void MaterialInstance::SetShininess(float shininess) {
+    SetOverride(MaterialParam::Shininess, &shininess);
+}
+
+void MaterialInstance::SetOpacity(float opacity) {
+    SetOverride(MaterialParam::Opacity, &opacity);
+}
+
+void MaterialInstance::SetTexture(Material::TextureType type, TextureHandle texture) {
+    const int slot = static_cast<int>(type);
+    if (slot >= 0 && slot < kMaterialTextureSlots) {
+        SetOverride(static_cast<MaterialParam>(kFirstTextureParam + slot), &texture);
+    }
+}
+
+bool MaterialInstance::IsOverridden(MaterialParam param) const {
+    return data_ && (data_->overrideMask & ParamBit(param)) != 0;
+}
+
+void MaterialInstance::ClearOverride(MaterialParam param) {
+    if (!IsOverridden(param)) {
+        return;
+    }
+    Data& data = MutableData();
+    data.overrides.erase(std::find_if(data.overrides.begin(), data.overrides.end(),
+        [param](const Override& entry) { return entry.param == param; }));
+    data.overrideMask &= ~ParamBit(param);
+}
+
+void MaterialInstance::ClearOverrides() {
+    if (GetOverrideCount() == 0) {
+        return;
+    }
+    Data& data = MutableData();
+    data.overrides.clear();
+    data.overrideMask = 0;
+}
+
+uint32_t MaterialInstance::GetOverrideCount() const {
+    return data_ ? static_cast<uint32_t>(data_->overrides.size()) : 0;
+}
+
+bool MaterialInstance::NeedsResolve() const {
+    if (!data_) {
+        return false;
+    }
+    const uint64_t version = table_ ? table_->GetVersion(data_->parent) : 0;
+    return !data_->resolvedValid || data_->resolvedVersion != version;
+}
+
+const MaterialParams& MaterialInstance::Resolve() const {
+    static const MaterialParams defaults;
+    if (!data_) {
+        return defaults;
+    }
+
+    Data& data = *data_;
+    const uint64_t version = table_ ? table_->GetVersion(data.parent) : 0;
+    if (data.resolvedValid && data.resolvedVersion == version) {
+        return data.resolved;
+    }
+
+    const MaterialParams* parent = table_ ? table_->Get(data.parent) : nullptr;
+    data.resolved = parent ? *parent : defaults;
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(&data.resolved);
+    for (const Override& entry : data.overrides) {
+        const ParamLayout& layout = kParamLayouts[static_cast<int>(entry.param)];
+        std::memcpy(bytes + layout.offset, entry.value, layout.size);
+    }
+
+    // Texture overrides may bind or unbind slots
+    for (int slot = 0; slot < kMaterialTextureSlots; ++slot) {
+        if (data.overrideMask & (1u << (kFirstTextureParam + slot))) {
+            if (data.resolved.textures[slot] != kInvalidTextureHandle) {
+                data.resolved.textureMask |= 1u << slot;
+            } else {
+                data.resolved.textureMask &= ~(1u << slot);
+            }
+        }
+    }
+
+    data.resolvedVersion = version;
+    data.resolvedValid = true;
+    return data.resolved;
+}
+
+MaterialInstance::Data& MaterialInstance::MutableData() {
+    // Copy on write: detach from instances sharing the record
+    if (!data_) {
+        data_ = std::make_shared<Data>();
+    } else if (data_.use_count() > 1) {
+        data_ = std::make_shared<Data>(*data_);
+    }
+    data_->resolvedValid = false;
+    return *data_;
+}
+
+void MaterialInstance::SetOverride(MaterialParam param, const void* value) {
+    const ParamLayout& layout = kParamLayouts[static_cast<int>(param)];
+    Data& data = MutableData();
+
+    Override* entry = nullptr;
+    if (data.overrideMask & ParamBit(param)) {
+        entry = &*std::find_if(data.overrides.begin(), data.overrides.end(),
+            [param](const Override& existing) { return existing.param == param; });
+    } else {
+        data.overrides.push_back(Override{param, {}});
+        data.overrideMask |= ParamBit(param);
+        entry = &data.overrides.back();
+    }
+    std::memcpy(entry->value, value, layout.size);
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,229 @@
+/**
+ * Material Table Implementation
+ */
+
+#include "ogde/graphics/MaterialTable.h"
+#include "SlotHandle.h"
+#include <algorithm>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+const std::string& EmptyName() {
+    static const std::string empty;
+    return empty;
+}
+
+} // namespace
+
+MaterialTable::MaterialTable() = default;
+
+MaterialTable::~MaterialTable() = default;
+
+MaterialHandle MaterialTable::Create(const std::string& name) {
+    uint32_t slotIndex;
+    if (!freeSlots_.empty()) {
+        slotIndex = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        if (slots_.size() >= kMaxHandleSlots) {
+            return kInvalidMaterialHandle;
+        }
+        slotIndex = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+
+    Slot& slot = slots_[slotIndex];
+    slot.index = static_cast<uint32_t>(params_.size());
+    slot.inUse = true;
+
+    const MaterialHandle handle = MakeSlotHandle(slotIndex, slot.generation);
+    params_.emplace_back();
+    handles_.push_back(handle);
+    names_.push_back(name);
+    EditIndex(slot.index);
+    return handle;
+}
+
+MaterialHandle MaterialTable::Import(const Material& material, const TextureResolver& resolveTexture) {
+    const MaterialHandle handle = Create(material.GetName());
+    MaterialParams* params = Edit(handle);
+    if (!params) {
+        return kInvalidMaterialHandle;
+    }
+
+    material.GetDiffuseColor(params->diffuseColor[0], params->diffuseColor[1],
+                             params->diffuseColor[2], params->diffuseColor[3]);
+    material.GetAmbientColor(params->ambientColor[0], params->ambientColor[1], params->ambientColor[2]);
+    material.GetSpecular(params->specularColor[0], params->specularColor[1],
+                         params->specularColor[2], params->shininess);
+    params->opacity = material.GetOpacity();
+
+    if (resolveTexture) {
+        for (int i = 0; i < kMaterialTextureSlots; ++i) {
+            std::shared_ptr<Texture> texture = material.GetTexture(static_cast<Material::TextureType>(i));
+            if (texture) {
+                SetTexture(handle, static_cast<Material::TextureType>(i), resolveTexture(texture));
+            }
+        }
+    }
+    return handle;
+}
+
+void MaterialTable::Destroy(MaterialHandle handle) {
+    const Slot* found = FindSlot(handle);
+    if (!found) {
+        return;
+    }
+
+    // Swap-remove keeps the parameter array dense
+    const uint32_t slotIndex = SlotHandleIndex(handle);
+    const uint32_t index = found->index;
+    const uint32_t last = static_cast<uint32_t>(params_.size()) - 1;
+    if (index != last) {
+        params_[index] = params_[last];
+        handles_[index] = handles_[last];
+        names_[index] = std::move(names_[last]);
+        slots_[SlotHandleIndex(handles_[index])].index = index;
+        EditIndex(index);
+    }
+    params_.pop_back();
+    handles_.pop_back();
+    names_.pop_back();
+    dirtyEnd_ = std::min(dirtyEnd_, last);
+    dirtyBegin_ = std::min(dirtyBegin_, dirtyEnd_);
+
+    Slot& slot = slots_[slotIndex];
+    slot.inUse = false;
+    ++slot.generation;
+    freeSlots_.push_back(slotIndex);
+}
+
+bool MaterialTable::IsValid(MaterialHandle handle) const {
+    return FindSlot(handle) != nullptr;
+}
+
+uint32_t MaterialTable::GetIndex(MaterialHandle handle) const {
+    const Slot* slot = FindSlot(handle);
+    return slot ? slot->index : kInvalidIndex;
+}
+
+const MaterialParams* MaterialTable::Get(MaterialHandle handle) const {
+    const Slot* slot = FindSlot(handle);
+    return slot ? &params_[slot->index] : nullptr;
+}
+
+MaterialParams* MaterialTable::Edit(MaterialHandle handle) {
+    const Slot* slot = FindSlot(handle);
+    return slot ? EditIndex(slot->index) : nullptr;
+}
+
+void MaterialTable::SetDiffuseColor(MaterialHandle handle, float r, float g, float b, float a) {
+    if (MaterialParams* params = Edit(handle)) {
+        params->diffuseColor[0] = r;
+        params->diffuseColor[1] = g;
+        params->diffuseColor[2] = b;
+        params->diffuseColor[3] = a;
+    }
+}
+
+void MaterialTable::SetAmbientColor(MaterialHandle handle, float r, float g, float b) {
+    if (MaterialParams* params = Edit(handle)) {
+        params->ambientColor[0] = r;
+        params->ambientColor[1] = g;
+        params->ambientColor[2] = b;
+    }
+}
+
+void MaterialTable::SetSpecular(MaterialHandle handle, float r, float g, float b, float shininess) {
+    if (MaterialParams* params = Edit(handle)) {
+        params->specularColor[0] = r;
+        params->specularColor[1] = g;
+        params->specularColor[2] = b;
+        params->shininess = shininess;
+    }
+}
+
+void MaterialTable::SetOpacity(MaterialHandle handle, float opacity) {
+    if (MaterialParams* params = Edit(handle)) {
+        params->opacity = opacity;
+    }
+}
+
+void MaterialTable::SetTexture(MaterialHandle handle, Material::TextureType type, TextureHandle texture) {
+    const int slot = static_cast<int>(type);
+    MaterialParams* params = Edit(handle);
+    if (!params || slot < 0 || slot >= kMaterialTextureSlots) {
+        return;
+    }
+    params->textures[slot] = texture;
+    if (texture != kInvalidTextureHandle) {
+        params->textureMask |= 1u << slot;
+    } else {
+        params->textureMask &= ~(1u << slot);
+    }
+}
+
+TextureHandle MaterialTable::GetTexture(MaterialHandle handle, Material::TextureType type) const {
+    const int slot = static_cast<int>(type);
+    const MaterialParams* params = Get(handle);
+    if (!params || slot < 0 || slot >= kMaterialTextureSlots) {
+        return kInvalidTextureHandle;
+    }
+    return params->textures[slot];
+}
+
+uint64_t MaterialTable::GetVersion(MaterialHandle handle) const {
+    const Slot* slot = FindSlot(handle);
+    return slot ? slot->version : 0;
+}
+
+const std::string& MaterialTable::GetName(MaterialHandle handle) const {
+    const Slot* slot = FindSlot(handle);
+    return slot ? names_[slot->index] : EmptyName();
+}
+
+MaterialHandle MaterialTable::GetHandle(uint32_t index) const {
+    return index < handles_.size() ? handles_[index] : kInvalidMaterialHandle;
+}
+
+void MaterialTable::GetDirtyRange(uint32_t& begin, uint32_t& end) const {
+    begin = dirtyBegin_;
+    end = dirtyEnd_;
+}
+
+void MaterialTable::ClearDirty() {
+    dirtyBegin_ = 0;
+    dirtyEnd_ = 0;
+}
+
+const MaterialTable::Slot* MaterialTable::FindSlot(MaterialHandle handle) const {
+    const uint32_t slotIndex = SlotHandleIndex(handle);
+    if (handle == kInvalidMaterialHandle || slotIndex >= slots_.size()) {
+        return nullptr;
+    }
+    const Slot& slot = slots_[slotIndex];
+    if (!slot.inUse || !SlotHandleMatches(handle, slot.generation)) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+MaterialParams* MaterialTable::EditIndex(uint32_t index) {
+    slots_[SlotHandleIndex(handles_[index])].version = ++changeCounter_;
+    if (dirtyBegin_ == dirtyEnd_) {
+        dirtyBegin_ = index;
+        dirtyEnd_ = index + 1;
+    } else {
+        dirtyBegin_ = std::min(dirtyBegin_, index);
+        dirtyEnd_ = std::max(dirtyEnd_, index + 1);
+    }
+    return &params_[index];
+}
+
+} // namespace Graphics
+} // namespace OGDE
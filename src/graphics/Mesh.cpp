@@ -0,0 +1,30 @@
+/**
+ * Mesh Implementation
+ */
+
+#include "ogde/graphics/Mesh.h"
+#include <algorithm>
+
+namespace OGDE {
+namespace Graphics {
+
+void MeshData::ComputeBounds() {
+    if (vertices.empty()) {
+        std::fill(boundsMin, boundsMin + 3, 0.0f);
+        std::fill(boundsMax, boundsMax + 3, 0.0f);
+        return;
+    }
+    for (int axis = 0; axis < 3; ++axis) {
+        boundsMin[axis] = vertices[0].position[axis];
+        boundsMax[axis] = vertices[0].position[axis];
+    }
+    for (const MeshVertex& vertex : vertices) {
+        for (int axis = 0; axis < 3; ++axis) {
+            boundsMin[axis] = std::min(boundsMin[axis], vertex.position[axis]);
+            boundsMax[axis] = std::max(boundsMax[axis], vertex.position[axis]);
+        }
+    }
+}
+
+} // namespace Graphics
+} // namespace OGDE
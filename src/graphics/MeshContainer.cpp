@@ -0,0 +1,263 @@
+/**
+ * Mesh Container Implementation
+ */
+
+#include "ogde/graphics/MeshContainer.h"
+#include "ogde/graphics/MeshOptimizer.h"
+#include "ogde/core/Logger.h"
+#include "ogde/core/MappedFile.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+size_t SubMeshTableEnd(uint32_t subMeshCount) {
+    return sizeof(OgmeshHeader) + static_cast<size_t>(subMeshCount) * sizeof(OgmeshSubMesh);
+}
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Copy and validate the meshlet section that follows the indices
+bool ParseMeshlets(const uint8_t* data, size_t size, const OgmeshHeader& header, MeshData& mesh) {
+    const uint64_t sectionOffset =
+        AlignUp(static_cast<size_t>(header.indexOffset + static_cast<uint64_t>(header.indexCount) * sizeof(uint32_t)),
+                kOgmeshPayloadAlignment);
+    OgmeshMeshletSection section;
+    if (sectionOffset > size || size - sectionOffset < sizeof(section)) {
+        ogde::core::Logger::error("Mesh container meshlet section is truncated");
+        return false;
+    }
+    std::memcpy(&section, data + sectionOffset, sizeof(section));
+    const uint64_t meshletBytes = static_cast<uint64_t>(section.meshletCount) * sizeof(Meshlet);
+    const uint64_t vertexBytes = static_cast<uint64_t>(section.vertexCount) * sizeof(uint32_t);
+    const uint64_t triangleBytes = static_cast<uint64_t>(section.triangleCount) * 3;
+    if (meshletBytes + vertexBytes + triangleBytes > size - sectionOffset - sizeof(section)) {
+        ogde::core::Logger::error("Mesh container meshlet section is truncated");
+        return false;
+    }
+
+    const uint8_t* p = data + sectionOffset + sizeof(section);
+    mesh.meshlets.resize(section.meshletCount);
+    mesh.meshletVertices.resize(section.vertexCount);
+    mesh.meshletTriangles.resize(static_cast<size_t>(triangleBytes));
+    std::memcpy(mesh.meshlets.data(), p, static_cast<size_t>(meshletBytes));
+    std::memcpy(mesh.meshletVertices.data(), p + meshletBytes, static_cast<size_t>(vertexBytes));
+    std::memcpy(mesh.meshletTriangles.data(), p + meshletBytes + vertexBytes, static_cast<size_t>(triangleBytes));
+
+    for (uint32_t vertex : mesh.meshletVertices) {
+        if (vertex >= header.vertexCount) {
+            ogde::core::Logger::error("Mesh container meshlet vertex " + std::to_string(vertex) + " is out of range");
+            return false;
+        }
+    }
+    for (size_t i = 0; i < mesh.meshlets.size(); ++i) {
+        const Meshlet& meshlet = mesh.meshlets[i];
+        bool valid = meshlet.vertexCount <= 256 && meshlet.vertexOffset <= section.vertexCount &&
+                     meshlet.vertexCount <= section.vertexCount - meshlet.vertexOffset &&
+                     meshlet.triangleOffset <= section.triangleCount &&
+                     meshlet.triangleCount <= section.triangleCount - meshlet.triangleOffset;
+        const uint8_t* triangles = mesh.meshletTriangles.data() + static_cast<size_t>(meshlet.triangleOffset) * 3;
+        for (uint32_t k = 0; valid && k < meshlet.triangleCount * 3; ++k) {
+            valid = triangles[k] < meshlet.vertexCount;
+        }
+        if (!valid) {
+            ogde::core::Logger::error("Mesh container meshlet " + std::to_string(i) + " is invalid");
+            return false;
+        }
+    }
+    for (size_t i = 0; i < mesh.subMeshes.size(); ++i) {
+        const SubMesh& subMesh = mesh.subMeshes[i];
+        if (subMesh.meshletOffset > section.meshletCount ||
+            subMesh.meshletCount > section.meshletCount - subMesh.meshletOffset) {
+            ogde::core::Logger::error("Mesh container sub-mesh " + std::to_string(i) + " meshlet range is invalid");
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool MeshContainer::Write(const std::string& filepath, const MeshData& mesh) {
+    if (mesh.vertices.empty() || mesh.indices.empty() || mesh.indices.size() % 3 != 0) {
+        ogde::core::Logger::error("Cannot write an empty mesh: " + filepath);
+        return false;
+    }
+
+    OgmeshHeader header;
+    header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+    header.subMeshCount = static_cast<uint32_t>(mesh.subMeshes.size());
+    const bool quantized = mesh.quantizedVertices.size() == mesh.vertices.size();
+    const bool meshlets = !mesh.meshlets.empty();
+    header.flags = (mesh.hasNormals ? kOgmeshHasNormals : 0) | (mesh.hasTexCoords ? kOgmeshHasTexCoords : 0) |
+                   (quantized ? kOgmeshQuantized : 0) | (meshlets ? kOgmeshMeshlets : 0);
+    header.vertexOffset = AlignUp(SubMeshTableEnd(header.subMeshCount), kOgmeshPayloadAlignment);
+    const size_t vertexBytes = mesh.vertices.size() * (quantized ? sizeof(QuantizedVertex) : sizeof(MeshVertex));
+    const void* vertexData = quantized ? static_cast<const void*>(mesh.quantizedVertices.data()) : mesh.vertices.data();
+    header.indexOffset = AlignUp(header.vertexOffset + vertexBytes, kOgmeshPayloadAlignment);
+    std::copy(mesh.boundsMin, mesh.boundsMin + 3, header.boundsMin);
+    std::copy(mesh.boundsMax, mesh.boundsMax + 3, header.boundsMax);
+
+    std::vector<OgmeshSubMesh> table(mesh.subMeshes.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+        const SubMesh& subMesh = mesh.subMeshes[i];
+        table[i].indexOffset = subMesh.indexOffset;
+        table[i].indexCount = subMesh.indexCount;
+        table[i].lod = subMesh.lod;
+        table[i].lodError = subMesh.lod < mesh.lodErrors.size() ? mesh.lodErrors[subMesh.lod] : 0.0f;
+        table[i].meshletOffset = meshlets ? subMesh.meshletOffset : 0;
+        table[i].meshletCount = meshlets ? subMesh.meshletCount : 0;
+        std::memcpy(table[i].material, subMesh.material.data(),
+                    std::min(subMesh.material.size(), sizeof(table[i].material) - 1));
+    }
+
+    std::ofstream file(filepath, std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        ogde::core::Logger::error("Failed to open file for writing: " + filepath);
+        return false;
+    }
+
+    const char padding[kOgmeshPayloadAlignment] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(OgmeshSubMesh)));
+    file.write(padding, static_cast<std::streamsize>(header.vertexOffset - SubMeshTableEnd(header.subMeshCount)));
+    file.write(static_cast<const char*>(vertexData), static_cast<std::streamsize>(vertexBytes));
+    file.write(padding, static_cast<std::streamsize>(header.indexOffset - header.vertexOffset - vertexBytes));
+    file.write(reinterpret_cast<const char*>(mesh.indices.data()),
+               static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint32_t)));
+    if (meshlets) {
+        const size_t indexEnd = header.indexOffset + mesh.indices.size() * sizeof(uint32_t);
+        OgmeshMeshletSection section;
+        section.meshletCount = static_cast<uint32_t>(mesh.meshlets.size());
+        section.vertexCount = static_cast<uint32_t>(mesh.meshletVertices.size());
+        section.triangleCount = static_cast<uint32_t>(mesh.meshletTriangles.size() / 3);
+        file.write(padding, static_cast<std::streamsize>(AlignUp(indexEnd, kOgmeshPayloadAlignment) - indexEnd));
+        file.write(reinterpret_cast<const char*>(&section), sizeof(section));
+        file.write(reinterpret_cast<const char*>(mesh.meshlets.data()),
+                   static_cast<std::streamsize>(mesh.meshlets.size() * sizeof(Meshlet)));
+        file.write(reinterpret_cast<const char*>(mesh.meshletVertices.data()),
+                   static_cast<std::streamsize>(mesh.meshletVertices.size() * sizeof(uint32_t)));
+        file.write(reinterpret_cast<const char*>(mesh.meshletTriangles.data()),
+                   static_cast<std::streamsize>(section.triangleCount * 3));
+    }
+
+    if (!file.good()) {
+        ogde::core::Logger::error("Failed to write mesh container: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+bool MeshContainer::Parse(const uint8_t* data, size_t size, MeshData& outMesh) {
+    OgmeshHeader header;
+    if (!data || size < sizeof(header)) {
+        ogde::core::Logger::error("Mesh container is truncated");
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != kOgmeshMagic) {
+        ogde::core::Logger::error("Not a mesh container (bad magic)");
+        return false;
+    }
+    if (header.version != kOgmeshVersion) {
+        ogde::core::Logger::error("Unsupported mesh container version: " + std::to_string(header.version));
+        return false;
+    }
+    if (header.vertexCount == 0 || header.indexCount == 0 || header.indexCount % 3 != 0 ||
+        (header.flags & ~(kOgmeshHasNormals | kOgmeshHasTexCoords | kOgmeshQuantized | kOgmeshMeshlets)) != 0) {
+        ogde::core::Logger::error("Mesh container header is invalid");
+        return false;
+    }
+    const bool quantized = (header.flags & kOgmeshQuantized) != 0;
+    const uint64_t vertexBytes =
+        static_cast<uint64_t>(header.vertexCount) * (quantized ? sizeof(QuantizedVertex) : sizeof(MeshVertex));
+    const uint64_t indexBytes = static_cast<uint64_t>(header.indexCount) * sizeof(uint32_t);
+    if (header.vertexOffset < SubMeshTableEnd(header.subMeshCount) || header.vertexOffset > size ||
+        vertexBytes > size - header.vertexOffset || header.indexOffset < header.vertexOffset + vertexBytes ||
+        header.indexOffset > size || indexBytes > size - header.indexOffset) {
+        ogde::core::Logger::error("Mesh container is truncated");
+        return false;
+    }
+
+    MeshData mesh;
+    mesh.subMeshes.resize(header.subMeshCount);
+    for (uint32_t i = 0; i < header.subMeshCount; ++i) {
+        OgmeshSubMesh entry;
+        std::memcpy(&entry, data + sizeof(header) + i * sizeof(OgmeshSubMesh), sizeof(entry));
+        if (entry.indexOffset > header.indexCount || entry.indexCount > header.indexCount - entry.indexOffset ||
+            entry.indexOffset % 3 != 0 || entry.indexCount % 3 != 0 || entry.lod > header.subMeshCount ||
+            !(entry.lodError >= 0.0f) || (entry.meshletCount != 0 && (header.flags & kOgmeshMeshlets) == 0)) {
+            ogde::core::Logger::error("Mesh container sub-mesh " + std::to_string(i) + " is invalid");
+            return false;
+        }
+        mesh.subMeshes[i].indexOffset = entry.indexOffset;
+        mesh.subMeshes[i].indexCount = entry.indexCount;
+        mesh.subMeshes[i].material.assign(entry.material, strnlen(entry.material, sizeof(entry.material)));
+        mesh.subMeshes[i].lod = entry.lod;
+        mesh.subMeshes[i].meshletOffset = entry.meshletOffset;
+        mesh.subMeshes[i].meshletCount = entry.meshletCount;
+        if (entry.lod > 0) {
+            mesh.lodErrors.resize(std::max<size_t>(mesh.lodErrors.size(), entry.lod + 1), 0.0f);
+            mesh.lodErrors[entry.lod] = std::max(mesh.lodErrors[entry.lod], entry.lodError);
+        }
+    }
+
+    mesh.indices.resize(header.indexCount);
+    std::memcpy(mesh.indices.data(), data + header.indexOffset, static_cast<size_t>(indexBytes));
+    const uint32_t maxIndex = *std::max_element(mesh.indices.begin(), mesh.indices.end());
+    if (maxIndex >= header.vertexCount) {
+        ogde::core::Logger::error("Mesh container index " + std::to_string(maxIndex) + " is out of range");
+        return false;
+    }
+
+    if ((header.flags & kOgmeshMeshlets) != 0 && !ParseMeshlets(data, size, header, mesh)) {
+        return false;
+    }
+
+    mesh.vertices.resize(header.vertexCount);
+    if (quantized) {
+        mesh.quantizedVertices.resize(header.vertexCount);
+        std::memcpy(mesh.quantizedVertices.data(), data + header.vertexOffset, static_cast<size_t>(vertexBytes));
+        MeshOptimizer::Dequantize(mesh.quantizedVertices.data(), header.vertexCount, header.boundsMin,
+                                  header.boundsMax, mesh.vertices.data());
+    } else {
+        std::memcpy(mesh.vertices.data(), data + header.vertexOffset, static_cast<size_t>(vertexBytes));
+    }
+    std::copy(header.boundsMin, header.boundsMin + 3, mesh.boundsMin);
+    std::copy(header.boundsMax, header.boundsMax + 3, mesh.boundsMax);
+    mesh.hasNormals = (header.flags & kOgmeshHasNormals) != 0;
+    mesh.hasTexCoords = (header.flags & kOgmeshHasTexCoords) != 0;
+
+    outMesh = std::move(mesh);
+    return true;
+}
+
+bool MeshContainer::Read(const std::string& filepath, MeshData& outMesh) {
+    Core::MappedFile file;
+    if (!file.Open(filepath)) {
+        ogde::core::Logger::error("Failed to open mesh container: " + filepath);
+        return false;
+    }
+    return Parse(file.GetData(), file.GetSize(), outMesh);
+}
+
+bool MeshContainer::IsContainerPath(const std::string& filepath) {
+    const std::string extension = ".ogmesh";
+    if (filepath.size() < extension.size()) {
+        return false;
+    }
+    return std::equal(extension.begin(), extension.end(), filepath.end() - extension.size(),
+                      [](char a, char b) { return a == std::tolower(static_cast<unsigned char>(b)); });
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,472 @@
+/**
+ * Mesh Optimizer Implementation
+ */
+
+#include "ogde/graphics/MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// FIFO post-transform cache; entries older than cacheSize stamps are evicted
+class CacheSimulator {
+public:
+    CacheSimulator(size_t vertexCount, uint32_t cacheSize)
+        : m_stamps(vertexCount, 0), m_time(cacheSize + 1), m_cacheSize(cacheSize) {}
+
+    uint32_t triangle(const uint32_t* corners) {
+        uint32_t misses = 0;
+        for (int i = 0; i < 3; ++i) {
+            uint32_t& stamp = m_stamps[corners[i]];
+            if (m_time - stamp > m_cacheSize) {
+                stamp = m_time++;
+                ++misses;
+            }
+        }
+        return misses;
+    }
+
+    void flush() {
+        m_time += m_cacheSize + 1;
+    }
+
+private:
+    std::vector<uint32_t> m_stamps;
+    uint32_t m_time;
+    uint32_t m_cacheSize;
+};
+
+uint16_t FloatToHalf(float value) {
+    // Round-to-nearest-even conversion, after F. Giesen's float_to_half_fast3_rtne
+    const uint32_t infinity = 255u << 23;
+    const uint32_t halfOverflow = (127u + 16u) << 23;
+    const uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint16_t result;
+    if (bits >= halfOverflow) {
+        result = bits > infinity ? 0x7E00 : 0x7C00;
+    } else if (bits < (113u << 23)) {
+        float magic;
+        float magnitude;
+        std::memcpy(&magic, &denormMagic, sizeof(magic));
+        std::memcpy(&magnitude, &bits, sizeof(magnitude));
+        magnitude += magic;
+        uint32_t sum;
+        std::memcpy(&sum, &magnitude, sizeof(sum));
+        result = static_cast<uint16_t>(sum - denormMagic);
+    } else {
+        const uint32_t mantissaOdd = (bits >> 13) & 1;
+        bits += ((15u - 127u) << 23) + 0xFFF;
+        bits += mantissaOdd;
+        result = static_cast<uint16_t>(bits >> 13);
+    }
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+float HalfToFloat(uint16_t value) {
+    const uint32_t shiftedExponent = 0x7C00u << 13;
+    uint32_t bits = (value & 0x7FFFu) << 13;
+    const uint32_t exponent = bits & shiftedExponent;
+    bits += (127u - 15u) << 23;
+
+    float result;
+    if (exponent == shiftedExponent) {
+        bits += (128u - 16u) << 23;     // Inf and NaN
+        std::memcpy(&result, &bits, sizeof(result));
+    } else if (exponent == 0) {
+        bits += 1u << 23;               // Zero and subnormals
+        const uint32_t magicBits = 113u << 23;
+        float magic;
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        std::memcpy(&result, &bits, sizeof(result));
+        result -= magic;
+    } else {
+        std::memcpy(&result, &bits, sizeof(result));
+    }
+    return (value & 0x8000u) ? -result : result;
+}
+
+inline float SignNotZero(float value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+inline int16_t ToSnorm16(float value) {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+struct IndexRange {
+    uint32_t offset;
+    uint32_t count;
+};
+
+std::vector<IndexRange> SubMeshRanges(const MeshData& mesh) {
+    std::vector<IndexRange> ranges;
+    for (const SubMesh& subMesh : mesh.subMeshes) {
+        ranges.push_back({ subMesh.indexOffset, subMesh.indexCount });
+    }
+    if (ranges.empty()) {
+        ranges.push_back({ 0, static_cast<uint32_t>(mesh.indices.size()) });
+    }
+    return ranges;
+}
+
+} // namespace
+
+void MeshOptimizer::Optimize(MeshData& mesh, const MeshOptimizeSettings& settings, MeshOptimizeReport* outReport) {
+    MeshOptimizeReport report;
+    const size_t vertexCount = mesh.vertices.size();
+    report.verticesBefore = static_cast<uint32_t>(vertexCount);
+    report.acmrBefore = ComputeACMR(mesh.indices.data(), mesh.indices.size(), vertexCount, settings.cacheSize);
+    report.atvrBefore = vertexCount ? report.acmrBefore * mesh.GetTriangleCount() / vertexCount : 0.0f;
+    report.vertexBytesBefore = vertexCount * sizeof(MeshVertex);
+
+    for (const IndexRange& range : SubMeshRanges(mesh)) {
+        uint32_t* indices = mesh.indices.data() + range.offset;
+        if (settings.vertexCache) {
+            OptimizeVertexCache(indices, range.count, vertexCount, settings.cacheSize);
+        }
+        if (settings.overdraw) {
+            report.clusters += OptimizeOverdraw(indices, range.count, mesh.vertices.data(), vertexCount,
+                                                settings.overdrawThreshold, settings.cacheSize);
+        }
+    }
+    if (settings.vertexFetch) {
+        OptimizeVertexFetch(mesh);
+    }
+    if (settings.quantize) {
+        mesh.ComputeBounds();
+        Quantize(mesh);
+    }
+
+    report.verticesAfter = static_cast<uint32_t>(mesh.vertices.size());
+    report.acmrAfter = ComputeACMR(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size(), settings.cacheSize);
+    report.atvrAfter = mesh.vertices.empty() ? 0.0f
+                                             : report.acmrAfter * mesh.GetTriangleCount() / mesh.vertices.size();
+    report.vertexBytesAfter = mesh.quantizedVertices.empty() ? mesh.vertices.size() * sizeof(MeshVertex)
+                                                             : mesh.quantizedVertices.size() * sizeof(QuantizedVertex);
+    if (outReport) {
+        *outReport = report;
+    }
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // Vertex -> triangle adjacency, and how many unemitted triangles each vertex has left
+    std::vector<uint32_t> live(vertexCount, 0);
+    for (size_t i = 0; i < indexCount; ++i) {
+        ++live[indices[i]];
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        offsets[v + 1] = offsets[v] + live[v];
+    }
+    std::vector<uint32_t> adjacency(indexCount);
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < indexCount; ++i) {
+        adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+
+    std::vector<uint32_t> stamps(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnds;
+    deadEnds.reserve(indexCount);
+    std::vector<uint32_t> result;
+    result.reserve(indexCount);
+    uint32_t cursor = 0;
+
+    uint32_t fanning = 0;
+    while (fanning < vertexCount && live[fanning] == 0) {
+        ++fanning;
+    }
+    while (fanning < vertexCount) {
+        // Emit every remaining triangle around the fanning vertex
+        const size_t firstCandidate = result.size();
+        for (uint32_t a = offsets[fanning]; a < offsets[fanning + 1]; ++a) {
+            const uint32_t triangle = adjacency[a];
+            if (emitted[triangle]) {
+                continue;
+            }
+            emitted[triangle] = 1;
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = indices[triangle * 3 + k];
+                result.push_back(v);
+                deadEnds.push_back(v);
+                --live[v];
+                if (time - stamps[v] > cacheSize) {
+                    stamps[v] = time++;
+                }
+            }
+        }
+
+        // Prefer the oldest candidate that will still be cached after its fan
+        uint32_t next = UINT32_MAX;
+        int64_t bestPriority = -1;
+        for (size_t i = firstCandidate; i < result.size(); ++i) {
+            const uint32_t v = result[i];
+            if (live[v] == 0) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (time - stamps[v] + 2 * live[v] <= cacheSize) {
+                priority = time - stamps[v];
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                next = v;
+            }
+        }
+
+        // Dead end: recently used vertices first, then the next unfinished one in input order
+        while (next == UINT32_MAX && !deadEnds.empty()) {
+            const uint32_t v = deadEnds.back();
+            deadEnds.pop_back();
+            if (live[v] > 0) {
+                next = v;
+            }
+        }
+        while (next == UINT32_MAX && cursor < vertexCount) {
+            if (live[cursor] > 0) {
+                next = cursor;
+            }
+            ++cursor;
+        }
+        fanning = next == UINT32_MAX ? static_cast<uint32_t>(vertexCount) : next;
+    }
+
+    std::copy(result.begin(), result.end(), indices);
+}
+
+uint32_t MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const MeshVertex* vertices,
+                                         size_t vertexCount, float threshold, uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return 0;
+    }
+
+    // Hard boundaries: triangles that miss on all three vertices start a new fan sequence
+    std::vector<uint32_t> hard;
+    {
+        CacheSimulator cache(vertexCount, cacheSize);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            if (cache.triangle(indices + t * 3) == 3) {
+                hard.push_back(static_cast<uint32_t>(t));
+            }
+        }
+        hard.push_back(static_cast<uint32_t>(triangleCount));
+    }
+
+    // Soft boundaries: split a cluster as soon as its prefix is within threshold of its own ACMR
+    std::vector<uint32_t> clusters;
+    CacheSimulator cache(vertexCount, cacheSize);
+    for (size_t h = 0; h + 1 < hard.size(); ++h) {
+        const uint32_t begin = hard[h];
+        const uint32_t end = hard[h + 1];
+        uint32_t misses = 0;
+        cache.flush();
+        for (uint32_t t = begin; t < end; ++t) {
+            misses += cache.triangle(indices + t * 3);
+        }
+        const float limit = static_cast<float>(misses) / (end - begin) * threshold;
+
+        cache.flush();
+        uint32_t start = begin;
+        misses = 0;
+        for (uint32_t t = begin; t < end; ++t) {
+            misses += cache.triangle(indices + t * 3);
+            if (t + 1 < end && static_cast<float>(misses) / (t + 1 - start) <= limit) {
+                clusters.push_back(start);
+                start = t + 1;
+                misses = 0;
+                cache.flush();
+            }
+        }
+        clusters.push_back(start);
+    }
+    const uint32_t clusterCount = static_cast<uint32_t>(clusters.size());
+    clusters.push_back(static_cast<uint32_t>(triangleCount));
+
+    // Area-weighted centroid and normal of each cluster and of the whole mesh
+    std::vector<float> centroids(static_cast<size_t>(clusterCount) * 3, 0.0f);
+    std::vector<float> normals(static_cast<size_t>(clusterCount) * 3, 0.0f);
+    std::vector<float> areas(clusterCount, 0.0f);
+    float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+    float meshArea = 0.0f;
+    for (uint32_t c = 0; c < clusterCount; ++c) {
+        for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+            const float* p0 = vertices[indices[t * 3 + 0]].position;
+            const float* p1 = vertices[indices[t * 3 + 1]].position;
+            const float* p2 = vertices[indices[t * 3 + 2]].position;
+            const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                                 e1[0] * e2[1] - e1[1] * e2[0] };
+            const float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int a = 0; a < 3; ++a) {
+                const float center = (p0[a] + p1[a] + p2[a]) / 3.0f;
+                centroids[c * 3 + a] += center * area;
+                normals[c * 3 + a] += n[a];
+                meshCentroid[a] += center * area;
+            }
+            areas[c] += area;
+            meshArea += area;
+        }
+    }
+    for (int a = 0; a < 3; ++a) {
+        meshCentroid[a] = meshArea > 0.0f ? meshCentroid[a] / meshArea : 0.0f;
+    }
+
+    // Clusters pointing away from the center occlude the rest, so they draw first
+    std::vector<float> keys(clusterCount, 0.0f);
+    for (uint32_t c = 0; c < clusterCount; ++c) {
+        const float* n = &normals[c * 3];
+        const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (areas[c] <= 0.0f || length <= 0.0f) {
+            continue;
+        }
+        float dot = 0.0f;
+        for (int a = 0; a < 3; ++a) {
+            dot += (centroids[c * 3 + a] / areas[c] - meshCentroid[a]) * n[a] / length;
+        }
+        keys[c] = dot;
+    }
+    std::vector<uint32_t> order(clusterCount);
+    for (uint32_t c = 0; c < clusterCount; ++c) {
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+    std::vector<uint32_t> source(indices, indices + triangleCount * 3);
+    uint32_t* out = indices;
+    for (uint32_t c : order) {
+        out = std::copy(source.begin() + clusters[c] * 3, source.begin() + clusters[c + 1] * 3, out);
+    }
+    return clusterCount;
+}
+
+uint32_t MeshOptimizer::OptimizeVertexFetch(MeshData& mesh) {
+    std::vector<uint32_t> remap(mesh.vertices.size(), UINT32_MAX);
+    uint32_t next = 0;
+    for (uint32_t& index : mesh.indices) {
+        if (remap[index] == UINT32_MAX) {
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+
+    const bool quantized = mesh.quantizedVertices.size() == mesh.vertices.size();
+    std::vector<MeshVertex> vertices(next);
+    std::vector<QuantizedVertex> packed(quantized ? next : 0);
+    for (size_t v = 0; v < remap.size(); ++v) {
+        if (remap[v] == UINT32_MAX) {
+            continue;
+        }
+        vertices[remap[v]] = mesh.vertices[v];
+        if (quantized) {
+            packed[remap[v]] = mesh.quantizedVertices[v];
+        }
+    }
+    mesh.vertices.swap(vertices);
+    mesh.quantizedVertices.swap(packed);
+    for (uint32_t& index : mesh.meshletVertices) {
+        index = remap[index];
+    }
+    return next;
+}
+
+float MeshOptimizer::ComputeACMR(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return 0.0f;
+    }
+    CacheSimulator cache(vertexCount, cacheSize);
+    size_t misses = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        misses += cache.triangle(indices + t * 3);
+    }
+    return static_cast<float>(misses) / triangleCount;
+}
+
+void MeshOptimizer::Quantize(MeshData& mesh) {
+    float scale[3];
+    for (int a = 0; a < 3; ++a) {
+        const float extent = mesh.boundsMax[a] - mesh.boundsMin[a];
+        scale[a] = extent > 0.0f ? 65535.0f / extent : 0.0f;
+    }
+
+    mesh.quantizedVertices.resize(mesh.vertices.size());
+    for (size_t v = 0; v < mesh.vertices.size(); ++v) {
+        const MeshVertex& vertex = mesh.vertices[v];
+        QuantizedVertex& packed = mesh.quantizedVertices[v];
+        for (int a = 0; a < 3; ++a) {
+            const float q = (vertex.position[a] - mesh.boundsMin[a]) * scale[a];
+            packed.position[a] = static_cast<uint16_t>(std::lround(std::clamp(q, 0.0f, 65535.0f)));
+        }
+        packed.position[3] = 0;
+
+        // Octahedral mapping: project onto |x|+|y|+|z| = 1, fold the lower half outward
+        const float* n = vertex.normal;
+        const float l1 = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+        float x = l1 > 0.0f ? n[0] / l1 : 0.0f;
+        float y = l1 > 0.0f ? n[1] / l1 : 0.0f;
+        if (l1 > 0.0f && n[2] < 0.0f) {
+            const float foldedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+            y = (1.0f - std::fabs(x)) * SignNotZero(y);
+            x = foldedX;
+        }
+        packed.normal[0] = ToSnorm16(x);
+        packed.normal[1] = ToSnorm16(y);
+
+        packed.texCoord[0] = FloatToHalf(vertex.texCoord[0]);
+        packed.texCoord[1] = FloatToHalf(vertex.texCoord[1]);
+    }
+}
+
+void MeshOptimizer::Dequantize(const QuantizedVertex* packed, size_t count, const float boundsMin[3],
+                               const float boundsMax[3], MeshVertex* outVertices) {
+    float scale[3];
+    for (int a = 0; a < 3; ++a) {
+        scale[a] = (boundsMax[a] - boundsMin[a]) / 65535.0f;
+    }
+
+    for (size_t v = 0; v < count; ++v) {
+        const QuantizedVertex& source = packed[v];
+        MeshVertex& vertex = outVertices[v];
+        for (int a = 0; a < 3; ++a) {
+            vertex.position[a] = boundsMin[a] + source.position[a] * scale[a];
+        }
+
+        float x = std::max(source.normal[0] / 32767.0f, -1.0f);
+        float y = std::max(source.normal[1] / 32767.0f, -1.0f);
+        const float z = 1.0f - std::fabs(x) - std::fabs(y);
+        if (z < 0.0f) {
+            const float unfoldedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+            y = (1.0f - std::fabs(x)) * SignNotZero(y);
+            x = unfoldedX;
+        }
+        const float length = std::sqrt(x * x + y * y + z * z);
+        vertex.normal[0] = x / length;
+        vertex.normal[1] = y / length;
+        vertex.normal[2] = z / length;
+
+        vertex.texCoord[0] = HalfToFloat(source.texCoord[0]);
+        vertex.texCoord[1] = HalfToFloat(source.texCoord[1]);
+    }
+}
+
+} // namespace Graphics
+} // namespace OGDE
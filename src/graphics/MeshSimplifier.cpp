@@ -0,0 +1,556 @@
+/**
+ * Mesh Simplifier Implementation
+ */
+
+#include "ogde/graphics/MeshSimplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// Position, normal and texture coordinate
+constexpr int kAttributes = 8;
+constexpr int kMatrixTerms = kAttributes * (kAttributes + 1) / 2;
+
+// Generalized quadric: error(v) = v'Av + 2b'v + c, A symmetric and stored as its upper triangle
+struct Quadric {
+    double a[kMatrixTerms];
+    double b[kAttributes];
+    double c;
+};
+
+// Plane quadric over positions only, for the geometric error; weight is the summed area
+struct PlaneQuadric {
+    double a[6];
+    double b[3];
+    double c;
+    double weight;
+};
+
+struct Collapse {
+    double cost;
+    uint32_t from;
+    uint32_t to;
+};
+
+void Accumulate(Quadric& target, const Quadric& source) {
+    for (int i = 0; i < kMatrixTerms; ++i) {
+        target.a[i] += source.a[i];
+    }
+    for (int i = 0; i < kAttributes; ++i) {
+        target.b[i] += source.b[i];
+    }
+    target.c += source.c;
+}
+
+void Accumulate(PlaneQuadric& target, const PlaneQuadric& source) {
+    for (int i = 0; i < 6; ++i) {
+        target.a[i] += source.a[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        target.b[i] += source.b[i];
+    }
+    target.c += source.c;
+    target.weight += source.weight;
+}
+
+double Evaluate(const Quadric& q, const double* v) {
+    double result = q.c;
+    int term = 0;
+    for (int i = 0; i < kAttributes; ++i) {
+        result += q.a[term++] * v[i] * v[i] + 2.0 * q.b[i] * v[i];
+        for (int j = i + 1; j < kAttributes; ++j) {
+            result += 2.0 * q.a[term++] * v[i] * v[j];
+        }
+    }
+    return result;
+}
+
+double Evaluate(const PlaneQuadric& q, const double* p) {
+    return q.a[0] * p[0] * p[0] + q.a[3] * p[1] * p[1] + q.a[5] * p[2] * p[2] +
+           2.0 * (q.a[1] * p[0] * p[1] + q.a[2] * p[0] * p[2] + q.a[4] * p[1] * p[2]) +
+           2.0 * (q.b[0] * p[0] + q.b[1] * p[1] + q.b[2] * p[2]) + q.c;
+}
+
+double Dot(const double* a, const double* b, int count) {
+    double result = 0.0;
+    for (int i = 0; i < count; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+// Quadric of the plane through three attribute points (Garland & Heckbert 1998), scaled by weight
+bool BuildQuadric(const double* p, const double* q, const double* r, double weight, Quadric& out) {
+    double e1[kAttributes];
+    double e2[kAttributes];
+    for (int i = 0; i < kAttributes; ++i) {
+        e1[i] = q[i] - p[i];
+        e2[i] = r[i] - p[i];
+    }
+    const double length1 = std::sqrt(Dot(e1, e1, kAttributes));
+    if (length1 <= 1e-12) {
+        return false;
+    }
+    for (double& value : e1) {
+        value /= length1;
+    }
+    const double projection = Dot(e1, e2, kAttributes);
+    for (int i = 0; i < kAttributes; ++i) {
+        e2[i] -= projection * e1[i];
+    }
+    const double length2 = std::sqrt(Dot(e2, e2, kAttributes));
+    if (length2 <= 1e-12) {
+        return false;
+    }
+    for (double& value : e2) {
+        value /= length2;
+    }
+
+    const double pe1 = Dot(p, e1, kAttributes);
+    const double pe2 = Dot(p, e2, kAttributes);
+    int term = 0;
+    for (int i = 0; i < kAttributes; ++i) {
+        for (int j = i; j < kAttributes; ++j) {
+            out.a[term++] = weight * ((i == j ? 1.0 : 0.0) - e1[i] * e1[j] - e2[i] * e2[j]);
+        }
+        out.b[i] = weight * (pe1 * e1[i] + pe2 * e2[i] - p[i]);
+    }
+    out.c = weight * (Dot(p, p, kAttributes) - pe1 * pe1 - pe2 * pe2);
+    return true;
+}
+
+// Undirected edge key with the direction in the lowest bit; position ids stay below 2^31
+inline uint64_t EdgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32) | (static_cast<uint64_t>(b) << 1)
+                 : (static_cast<uint64_t>(b) << 32) | (static_cast<uint64_t>(a) << 1) | 1u;
+}
+
+inline uint64_t VertexPairKey(uint32_t from, uint32_t to) {
+    return (static_cast<uint64_t>(from) << 32) | to;
+}
+
+// Number of triangle sides on the undirected edge a-b
+size_t CountEdge(const std::vector<uint64_t>& edges, uint32_t a, uint32_t b) {
+    const uint64_t key = EdgeKey(a, b) & ~uint64_t(1);
+    return static_cast<size_t>(std::lower_bound(edges.begin(), edges.end(), key + 2) -
+                               std::lower_bound(edges.begin(), edges.end(), key));
+}
+
+void Cross(const float* a, const float* b, const float* c, double* out) {
+    const double e1[3] = { double(b[0]) - a[0], double(b[1]) - a[1], double(b[2]) - a[2] };
+    const double e2[3] = { double(c[0]) - a[0], double(c[1]) - a[1], double(c[2]) - a[2] };
+    out[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    out[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    out[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+// Simplify towards decreasing triangle targets in one run, copying the triangle list out as each is reached
+void SimplifyLevels(const MeshData& mesh, const uint32_t* indices, size_t indexCount, const SimplifySettings& settings,
+                    const size_t* targets, size_t levelCount, std::vector<uint32_t>* outLevels, float* outErrors) {
+    std::vector<uint32_t> outIndices(indices, indices + indexCount - indexCount % 3);
+    const size_t vertexCount = mesh.vertices.size();
+    size_t level = 0;
+    if (vertexCount == 0) {
+        for (; level < levelCount; ++level) {
+            outLevels[level] = outIndices;
+            outErrors[level] = 0.0f;
+        }
+        return;
+    }
+
+    // Work in coordinates normalized to the mesh size, so attribute weights and errors are scale-free
+    float boundsMin[3], boundsMax[3];
+    for (int a = 0; a < 3; ++a) {
+        boundsMin[a] = boundsMax[a] = mesh.vertices[0].position[a];
+    }
+    for (const MeshVertex& vertex : mesh.vertices) {
+        for (int a = 0; a < 3; ++a) {
+            boundsMin[a] = std::min(boundsMin[a], vertex.position[a]);
+            boundsMax[a] = std::max(boundsMax[a], vertex.position[a]);
+        }
+    }
+    const double diagonal = std::sqrt(double(boundsMax[0] - boundsMin[0]) * (boundsMax[0] - boundsMin[0]) +
+                                      double(boundsMax[1] - boundsMin[1]) * (boundsMax[1] - boundsMin[1]) +
+                                      double(boundsMax[2] - boundsMin[2]) * (boundsMax[2] - boundsMin[2]));
+    const double scale = diagonal > 0.0 ? 1.0 / diagonal : 1.0;
+
+    std::vector<double> attributes(vertexCount * kAttributes);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        const MeshVertex& vertex = mesh.vertices[v];
+        double* attribute = &attributes[v * kAttributes];
+        for (int a = 0; a < 3; ++a) {
+            attribute[a] = (double(vertex.position[a]) - boundsMin[a]) * scale;
+            attribute[3 + a] = double(vertex.normal[a]) * settings.normalWeight;
+        }
+        attribute[6] = double(vertex.texCoord[0]) * settings.texCoordWeight;
+        attribute[7] = double(vertex.texCoord[1]) * settings.texCoordWeight;
+    }
+
+    // Vertices sharing a position get one position id; several referenced vertices on one id form a seam
+    std::vector<uint32_t> order(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        order[v] = v;
+    }
+    auto positionLess = [&](uint32_t a, uint32_t b) {
+        return std::memcmp(mesh.vertices[a].position, mesh.vertices[b].position, sizeof(float) * 3) < 0;
+    };
+    std::sort(order.begin(), order.end(), positionLess);
+    std::vector<uint32_t> positionId(vertexCount);
+    uint32_t positionCount = 0;
+    for (size_t i = 0; i < vertexCount; ++i) {
+        if (i > 0 && positionLess(order[i - 1], order[i])) {
+            ++positionCount;
+        }
+        positionId[order[i]] = positionCount;
+    }
+    ++positionCount;
+
+    std::vector<uint8_t> referenced(vertexCount, 0);
+    for (uint32_t index : outIndices) {
+        referenced[index] = 1;
+    }
+    std::vector<uint32_t> wedges(positionCount, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        wedges[positionId[v]] += referenced[v];
+    }
+
+    // Per-vertex quadrics from the source triangles
+    std::vector<Quadric> quadrics(vertexCount);
+    std::vector<PlaneQuadric> planes(vertexCount);
+    std::memset(quadrics.data(), 0, quadrics.size() * sizeof(Quadric));
+    std::memset(planes.data(), 0, planes.size() * sizeof(PlaneQuadric));
+    for (size_t t = 0; t < outIndices.size(); t += 3) {
+        const double* p[3];
+        for (int i = 0; i < 3; ++i) {
+            p[i] = &attributes[static_cast<size_t>(outIndices[t + i]) * kAttributes];
+        }
+        const double e1[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+        const double e2[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+        double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+        const double length = std::sqrt(Dot(n, n, 3));
+        if (length <= 0.0) {
+            continue;
+        }
+        const double area = 0.5 * length;
+        for (double& value : n) {
+            value /= length;
+        }
+        const double d = -Dot(n, p[0], 3);
+        PlaneQuadric plane;
+        plane.a[0] = n[0] * n[0] * area;
+        plane.a[1] = n[0] * n[1] * area;
+        plane.a[2] = n[0] * n[2] * area;
+        plane.a[3] = n[1] * n[1] * area;
+        plane.a[4] = n[1] * n[2] * area;
+        plane.a[5] = n[2] * n[2] * area;
+        for (int a = 0; a < 3; ++a) {
+            plane.b[a] = d * n[a] * area;
+        }
+        plane.c = d * d * area;
+        plane.weight = area;
+
+        Quadric quadric;
+        const bool valid = BuildQuadric(p[0], p[1], p[2], area, quadric);
+        for (int i = 0; i < 3; ++i) {
+            Accumulate(planes[outIndices[t + i]], plane);
+            if (valid) {
+                Accumulate(quadrics[outIndices[t + i]], quadric);
+            }
+        }
+    }
+
+    const double maxError = settings.maxError;
+    double resultError = 0.0;
+    std::vector<uint64_t> edges;
+    std::vector<uint8_t> border(vertexCount), locked(vertexCount), used(vertexCount);
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1), adjacency, remap(vertexCount);
+    std::vector<Collapse> collapses, best(vertexCount);
+    // Collapses that failed the error or flip test; the vertex tries its next cheapest edge in later passes
+    std::vector<uint64_t> rejected;
+
+    auto emitReached = [&](bool all) {
+        for (; level < levelCount && (all || outIndices.size() / 3 <= targets[level]); ++level) {
+            outLevels[level] = outIndices;
+            outErrors[level] = static_cast<float>(resultError * diagonal);
+        }
+    };
+
+    for (int pass = 0; pass < 100; ++pass) {
+        emitReached(false);
+        if (level == levelCount) {
+            break;
+        }
+        const size_t triangleCount = outIndices.size() / 3;
+        const size_t target = targets[level];
+
+        // Classify vertices from the current topology
+        edges.clear();
+        for (size_t t = 0; t < outIndices.size(); t += 3) {
+            for (int i = 0; i < 3; ++i) {
+                edges.push_back(EdgeKey(positionId[outIndices[t + i]], positionId[outIndices[t + (i + 1) % 3]]));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        std::fill(border.begin(), border.end(), 0);
+        std::fill(locked.begin(), locked.end(), 0);
+        std::vector<uint8_t> positionBorder(positionCount, 0), positionComplex(positionCount, 0);
+        for (size_t e = 0; e < edges.size();) {
+            // A manifold interior edge is used once in each direction
+            size_t end = e + 1;
+            while (end < edges.size() && (edges[end] >> 1) == (edges[e] >> 1)) {
+                ++end;
+            }
+            const uint32_t a = static_cast<uint32_t>(edges[e] >> 32);
+            const uint32_t b = static_cast<uint32_t>(edges[e] >> 1) & 0x7fffffffu;
+            if (end - e == 1) {
+                positionBorder[a] = positionBorder[b] = 1;
+            } else if (end - e > 2 || edges[e] == edges[e + 1]) {
+                positionComplex[a] = positionComplex[b] = 1;
+            }
+            e = end;
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            const uint32_t id = positionId[v];
+            border[v] = positionBorder[id];
+            locked[v] = wedges[id] > 1 || positionComplex[id] || (border[v] && settings.lockBorders);
+        }
+
+        // Vertex -> triangle adjacency
+        std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+        for (uint32_t index : outIndices) {
+            ++adjacencyOffsets[index + 1];
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+        }
+        adjacency.resize(outIndices.size());
+        {
+            std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t i = 0; i < outIndices.size(); ++i) {
+                adjacency[fill[outIndices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+
+        // Cheapest allowed collapse of every vertex, cheapest first
+        std::fill(best.begin(), best.end(), Collapse{ std::numeric_limits<double>::infinity(), 0, 0 });
+        for (size_t t = 0; t < outIndices.size(); t += 3) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 1; j < 3; ++j) {
+                    const uint32_t from = outIndices[t + i];
+                    const uint32_t to = outIndices[t + (i + j) % 3];
+                    if (locked[from] || positionId[from] == positionId[to]) {
+                        continue;
+                    }
+                    // Boundary vertices may only slide along the boundary
+                    if (border[from] && CountEdge(edges, positionId[from], positionId[to]) != 1) {
+                        continue;
+                    }
+                    if (!rejected.empty() &&
+                        std::binary_search(rejected.begin(), rejected.end(), VertexPairKey(from, to))) {
+                        continue;
+                    }
+                    const double cost = Evaluate(quadrics[from], &attributes[static_cast<size_t>(to) * kAttributes]);
+                    if (cost < best[from].cost || (cost == best[from].cost && to < best[from].to)) {
+                        best[from] = { cost, from, to };
+                    }
+                }
+            }
+        }
+        collapses.clear();
+        for (const Collapse& collapse : best) {
+            if (collapse.cost != std::numeric_limits<double>::infinity()) {
+                collapses.push_back(collapse);
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.cost != b.cost ? a.cost < b.cost : a.from < b.from;
+        });
+
+        // Take the cheapest independent collapses; the cost cut keeps the order close to a global greedy one
+        const size_t budget = triangleCount - target;
+        const size_t considered = std::min(collapses.size(), std::max(collapses.size() / 3, budget));
+        std::fill(used.begin(), used.end(), 0);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            remap[v] = static_cast<uint32_t>(v);
+        }
+        size_t removed = 0;
+        size_t accepted = 0;
+        std::vector<uint64_t> rejectedNow;
+        for (size_t c = 0; c < considered && removed < budget; ++c) {
+            const uint32_t from = collapses[c].from;
+            const uint32_t to = collapses[c].to;
+            if (used[from] || used[to]) {
+                continue;
+            }
+            const PlaneQuadric& plane = planes[from];
+            const double error = std::sqrt(std::max(0.0, Evaluate(plane, &attributes[static_cast<size_t>(to) * kAttributes]) /
+                                                             std::max(plane.weight, 1e-30)));
+            if (error > maxError) {
+                rejectedNow.push_back(VertexPairKey(from, to));
+                continue;
+            }
+
+            // Reject collapses that flip or degenerate a remaining triangle
+            bool flips = false;
+            size_t collapsing = 0;
+            for (uint32_t a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1] && !flips; ++a) {
+                const uint32_t* triangle = &outIndices[static_cast<size_t>(adjacency[a]) * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+                    ++collapsing;
+                    continue;
+                }
+                const float* before[3];
+                const float* after[3];
+                for (int i = 0; i < 3; ++i) {
+                    before[i] = mesh.vertices[triangle[i]].position;
+                    after[i] = triangle[i] == from ? mesh.vertices[to].position : before[i];
+                }
+                double n0[3], n1[3];
+                Cross(before[0], before[1], before[2], n0);
+                Cross(after[0], after[1], after[2], n1);
+                flips = Dot(n0, n1, 3) <= 0.0;
+            }
+            if (flips) {
+                rejectedNow.push_back(VertexPairKey(from, to));
+                continue;
+            }
+
+            remap[from] = to;
+            for (uint32_t a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a) {
+                const uint32_t* triangle = &outIndices[static_cast<size_t>(adjacency[a]) * 3];
+                used[triangle[0]] = used[triangle[1]] = used[triangle[2]] = 1;
+            }
+            Accumulate(quadrics[to], quadrics[from]);
+            Accumulate(planes[to], planes[from]);
+            resultError = std::max(resultError, error);
+            removed += collapsing;
+            ++accepted;
+        }
+        if (accepted == 0 && rejectedNow.empty()) {
+            break;
+        }
+        std::sort(rejectedNow.begin(), rejectedNow.end());
+        const size_t previousRejected = rejected.size();
+        rejected.insert(rejected.end(), rejectedNow.begin(), rejectedNow.end());
+        std::inplace_merge(rejected.begin(), rejected.begin() + previousRejected, rejected.end());
+
+        size_t write = 0;
+        for (size_t t = 0; t < outIndices.size(); t += 3) {
+            const uint32_t a = remap[outIndices[t]];
+            const uint32_t b = remap[outIndices[t + 1]];
+            const uint32_t c = remap[outIndices[t + 2]];
+            if (positionId[a] == positionId[b] || positionId[b] == positionId[c] || positionId[a] == positionId[c]) {
+                continue;
+            }
+            outIndices[write++] = a;
+            outIndices[write++] = b;
+            outIndices[write++] = c;
+        }
+        outIndices.resize(write);
+    }
+
+    emitReached(true);
+}
+
+} // namespace
+
+float MeshSimplifier::Simplify(const MeshData& mesh, const uint32_t* indices, size_t indexCount,
+                               const SimplifySettings& settings, std::vector<uint32_t>& outIndices) {
+    const size_t target = static_cast<size_t>(std::max(0.0f, settings.targetRatio) * (indexCount / 3));
+    float error = 0.0f;
+    SimplifyLevels(mesh, indices, indexCount, settings, &target, 1, &outIndices, &error);
+    return error;
+}
+
+uint32_t MeshSimplifier::GenerateLods(MeshData& mesh, const LodSettings& settings) {
+    // Start from level 0 only
+    std::vector<SubMesh> base;
+    std::vector<uint32_t> indices;
+    for (const SubMesh& subMesh : mesh.subMeshes) {
+        if (subMesh.lod != 0) {
+            continue;
+        }
+        SubMesh copy = subMesh;
+        copy.indexOffset = static_cast<uint32_t>(indices.size());
+        indices.insert(indices.end(), mesh.indices.begin() + subMesh.indexOffset,
+                       mesh.indices.begin() + subMesh.indexOffset + subMesh.indexCount);
+        base.push_back(copy);
+    }
+    if (mesh.subMeshes.empty()) {
+        indices = mesh.indices;
+        SubMesh whole;
+        whole.indexCount = static_cast<uint32_t>(indices.size());
+        base.push_back(whole);
+    }
+    mesh.indices.swap(indices);
+    mesh.subMeshes = base;
+    mesh.lodErrors.clear();
+    mesh.meshlets.clear();
+    mesh.meshletVertices.clear();
+    mesh.meshletTriangles.clear();
+    for (SubMesh& subMesh : mesh.subMeshes) {
+        subMesh.meshletOffset = subMesh.meshletCount = 0;
+    }
+
+    // One run per sub-mesh produces every level, each simplified from the original triangles
+    const size_t levelCount = settings.maxLevels > 1 ? settings.maxLevels - 1 : 0;
+    std::vector<std::vector<std::vector<uint32_t>>> simplified(base.size(), std::vector<std::vector<uint32_t>>(levelCount));
+    std::vector<float> subMeshErrors(base.size() * levelCount, 0.0f);
+    for (size_t s = 0; s < base.size() && levelCount > 0; ++s) {
+        std::vector<size_t> targets(levelCount);
+        for (size_t level = 0; level < levelCount; ++level) {
+            const float ratio = std::pow(settings.reduction, static_cast<float>(level + 1));
+            targets[level] = static_cast<size_t>(std::max(0.0f, ratio) * (base[s].indexCount / 3));
+        }
+        SimplifyLevels(mesh, mesh.indices.data() + base[s].indexOffset, base[s].indexCount, settings.simplify,
+                       targets.data(), levelCount, simplified[s].data(), &subMeshErrors[s * levelCount]);
+    }
+
+    std::vector<float> errors(1, 0.0f);
+    size_t previousTriangles = mesh.GetTriangleCount();
+    for (uint32_t level = 1; level < settings.maxLevels; ++level) {
+        std::vector<SubMesh> levelSubMeshes;
+        std::vector<uint32_t> levelIndices;
+        float error = errors.back();
+        for (size_t s = 0; s < base.size(); ++s) {
+            const std::vector<uint32_t>& result = simplified[s][level - 1];
+            error = std::max(error, subMeshErrors[s * levelCount + level - 1]);
+            if (result.empty()) {
+                continue;
+            }
+            SubMesh entry = base[s];
+            entry.indexOffset = static_cast<uint32_t>(levelIndices.size());
+            entry.indexCount = static_cast<uint32_t>(result.size());
+            entry.lod = level;
+            levelIndices.insert(levelIndices.end(), result.begin(), result.end());
+            levelSubMeshes.push_back(entry);
+        }
+
+        const size_t triangles = levelIndices.size() / 3;
+        if (triangles == 0 || triangles > previousTriangles * settings.minReduction) {
+            break;
+        }
+        const uint32_t offset = static_cast<uint32_t>(mesh.indices.size());
+        for (SubMesh& entry : levelSubMeshes) {
+            entry.indexOffset += offset;
+            mesh.subMeshes.push_back(entry);
+        }
+        mesh.indices.insert(mesh.indices.end(), levelIndices.begin(), levelIndices.end());
+        errors.push_back(error);
+        previousTriangles = triangles;
+    }
+
+    if (errors.size() > 1) {
+        mesh.lodErrors = errors;
+    }
+    return static_cast<uint32_t>(errors.size());
+}
+
+} // namespace Graphics
+} // namespace OGDE
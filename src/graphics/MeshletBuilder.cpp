@@ -0,0 +1,290 @@
+/**
+ * Meshlet Builder Implementation
+ */
+
+#include "ogde/graphics/MeshletBuilder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+constexpr uint16_t kNoLocal = 0xFFFF;
+
+// Below this spread (cosine between the axis and the widest normal) a cone rarely culls anything
+constexpr float kMinConeSpread = 0.1f;
+
+struct IndexRange {
+    uint32_t offset;
+    uint32_t count;
+};
+
+// Unit normal of a triangle from its winding (as ObjLoader generates normals); zero if degenerate
+void TriangleNormal(const float* p0, const float* p1, const float* p2, float* out) {
+    const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    out[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    out[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    out[2] = e1[0] * e2[1] - e1[1] * e2[0];
+    const float length = std::sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2]);
+    const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+    out[0] *= scale;
+    out[1] *= scale;
+    out[2] *= scale;
+}
+
+float DistanceSquared(const float* a, const float* b) {
+    const float d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+    return d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+}
+
+} // namespace
+
+size_t MeshletBuilder::Build(MeshData& mesh, const MeshletSettings& settings) {
+    mesh.meshlets.clear();
+    mesh.meshletVertices.clear();
+    mesh.meshletTriangles.clear();
+    const uint32_t maxVertices = std::clamp(settings.maxVertices, 3u, 256u);
+    const uint32_t maxTriangles = std::max(settings.maxTriangles, 1u);
+    const size_t vertexCount = mesh.vertices.size();
+    const size_t triangleCount = mesh.indices.size() / 3;
+    if (vertexCount == 0 || triangleCount == 0) {
+        for (SubMesh& subMesh : mesh.subMeshes) {
+            subMesh.meshletOffset = subMesh.meshletCount = 0;
+        }
+        return 0;
+    }
+
+    // Vertex -> triangle adjacency over the whole index buffer; triangles outside
+    // the sub-mesh being built stay marked as emitted, so meshlets never cross ranges
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        ++adjacencyOffsets[mesh.indices[i] + 1];
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; ++i) {
+            adjacency[fill[mesh.indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+    std::vector<float> normals(triangleCount * 3);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        TriangleNormal(mesh.vertices[mesh.indices[t * 3]].position, mesh.vertices[mesh.indices[t * 3 + 1]].position,
+                       mesh.vertices[mesh.indices[t * 3 + 2]].position, &normals[t * 3]);
+    }
+    std::vector<uint8_t> emitted(triangleCount, 1);
+    std::vector<uint16_t> local(vertexCount, kNoLocal);
+
+    std::vector<IndexRange> ranges;
+    for (const SubMesh& subMesh : mesh.subMeshes) {
+        ranges.push_back({ subMesh.indexOffset, subMesh.indexCount });
+    }
+    if (ranges.empty()) {
+        ranges.push_back({ 0, static_cast<uint32_t>(triangleCount * 3) });
+    }
+
+    for (size_t r = 0; r < ranges.size(); ++r) {
+        const uint32_t firstTriangle = ranges[r].offset / 3;
+        const uint32_t endTriangle = firstTriangle + ranges[r].count / 3;
+        const uint32_t firstMeshlet = static_cast<uint32_t>(mesh.meshlets.size());
+        std::fill(emitted.begin() + firstTriangle, emitted.begin() + endTriangle, 0);
+
+        uint32_t seed = firstTriangle;
+        while (true) {
+            while (seed < endTriangle && emitted[seed]) {
+                ++seed;
+            }
+            if (seed == endTriangle) {
+                break;
+            }
+
+            Meshlet meshlet = {};
+            meshlet.vertexOffset = static_cast<uint32_t>(mesh.meshletVertices.size());
+            meshlet.triangleOffset = static_cast<uint32_t>(mesh.meshletTriangles.size() / 3);
+            float normalSum[3] = { 0.0f, 0.0f, 0.0f };
+            auto addTriangle = [&](uint32_t t) {
+                for (int i = 0; i < 3; ++i) {
+                    const uint32_t v = mesh.indices[static_cast<size_t>(t) * 3 + i];
+                    if (local[v] == kNoLocal) {
+                        local[v] = static_cast<uint16_t>(meshlet.vertexCount++);
+                        mesh.meshletVertices.push_back(v);
+                    }
+                    mesh.meshletTriangles.push_back(static_cast<uint8_t>(local[v]));
+                }
+                for (int k = 0; k < 3; ++k) {
+                    normalSum[k] += normals[static_cast<size_t>(t) * 3 + k];
+                }
+                emitted[t] = 1;
+                ++meshlet.triangleCount;
+            };
+            auto newVertices = [&](uint32_t t) {
+                const uint32_t* triangle = &mesh.indices[static_cast<size_t>(t) * 3];
+                return uint32_t(local[triangle[0]] == kNoLocal) + uint32_t(local[triangle[1]] == kNoLocal) +
+                       uint32_t(local[triangle[2]] == kNoLocal);
+            };
+
+            addTriangle(seed);
+            uint32_t last = seed;
+            while (meshlet.triangleCount < maxTriangles) {
+                const float length = std::sqrt(normalSum[0] * normalSum[0] + normalSum[1] * normalSum[1] +
+                                               normalSum[2] * normalSum[2]);
+                const float axis[3] = { length > 0.0f ? normalSum[0] / length : 0.0f,
+                                        length > 0.0f ? normalSum[1] / length : 0.0f,
+                                        length > 0.0f ? normalSum[2] / length : 0.0f };
+                uint32_t best = UINT32_MAX;
+                float bestScore = 0.0f;
+                auto consider = [&](uint32_t v) {
+                    for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+                        const uint32_t t = adjacency[a];
+                        if (emitted[t]) {
+                            continue;
+                        }
+                        const uint32_t extra = newVertices(t);
+                        if (meshlet.vertexCount + extra > maxVertices) {
+                            continue;
+                        }
+                        const float* n = &normals[static_cast<size_t>(t) * 3];
+                        const float score = static_cast<float>(extra) +
+                                            settings.coneWeight * (1.0f - (n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2]));
+                        if (best == UINT32_MAX || score < bestScore || (score == bestScore && t < best)) {
+                            best = t;
+                            bestScore = score;
+                        }
+                    }
+                };
+
+                // Neighbors of the last triangle keep the meshlet compact; the whole rim is the fallback
+                for (int i = 0; i < 3; ++i) {
+                    consider(mesh.indices[static_cast<size_t>(last) * 3 + i]);
+                }
+                if (best == UINT32_MAX) {
+                    for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+                        consider(mesh.meshletVertices[meshlet.vertexOffset + i]);
+                    }
+                }
+                // Disconnected pieces continue in index order, which is spatially coherent after vertex cache optimization
+                if (best == UINT32_MAX) {
+                    while (seed < endTriangle && emitted[seed]) {
+                        ++seed;
+                    }
+                    if (seed < endTriangle && meshlet.vertexCount + newVertices(seed) <= maxVertices) {
+                        best = seed;
+                    }
+                }
+                if (best == UINT32_MAX) {
+                    break;
+                }
+                addTriangle(best);
+                last = best;
+            }
+
+            for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+                local[mesh.meshletVertices[meshlet.vertexOffset + i]] = kNoLocal;
+            }
+            ComputeBounds(mesh, meshlet);
+            mesh.meshlets.push_back(meshlet);
+        }
+
+        std::fill(emitted.begin() + firstTriangle, emitted.begin() + endTriangle, 1);
+        if (r < mesh.subMeshes.size()) {
+            mesh.subMeshes[r].meshletOffset = firstMeshlet;
+            mesh.subMeshes[r].meshletCount = static_cast<uint32_t>(mesh.meshlets.size()) - firstMeshlet;
+        }
+    }
+    return mesh.meshlets.size();
+}
+
+void MeshletBuilder::ComputeBounds(const MeshData& mesh, Meshlet& meshlet) {
+    const uint32_t* vertices = mesh.meshletVertices.data() + meshlet.vertexOffset;
+    const uint8_t* triangles = mesh.meshletTriangles.data() + static_cast<size_t>(meshlet.triangleOffset) * 3;
+    auto position = [&](uint32_t i) { return mesh.vertices[vertices[i]].position; };
+
+    // Ritter's sphere: the two far-apart points span the initial sphere, then grow it over every point
+    float center[3] = { 0.0f, 0.0f, 0.0f };
+    float radius = 0.0f;
+    if (meshlet.vertexCount > 0) {
+        uint32_t a = 0, b = 0;
+        for (uint32_t i = 1; i < meshlet.vertexCount; ++i) {
+            if (DistanceSquared(position(i), position(0)) > DistanceSquared(position(a), position(0))) {
+                a = i;
+            }
+        }
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+            if (DistanceSquared(position(i), position(a)) > DistanceSquared(position(b), position(a))) {
+                b = i;
+            }
+        }
+        for (int k = 0; k < 3; ++k) {
+            center[k] = 0.5f * (position(a)[k] + position(b)[k]);
+        }
+        radius = 0.5f * std::sqrt(DistanceSquared(position(a), position(b)));
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+            const float distance = std::sqrt(DistanceSquared(position(i), center));
+            if (distance > radius) {
+                const float grown = 0.5f * (radius + distance);
+                const float shift = (grown - radius) / distance;
+                for (int k = 0; k < 3; ++k) {
+                    center[k] += (position(i)[k] - center[k]) * shift;
+                }
+                radius = grown;
+            }
+        }
+    }
+    std::copy(center, center + 3, meshlet.center);
+    meshlet.radius = radius;
+
+    // Normal cone: average facing, widest deviation from it, and an apex behind every triangle plane
+    float axis[3] = { 0.0f, 0.0f, 0.0f };
+    std::vector<float> normals(static_cast<size_t>(meshlet.triangleCount) * 3);
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+        TriangleNormal(position(triangles[t * 3]), position(triangles[t * 3 + 1]), position(triangles[t * 3 + 2]),
+                       &normals[static_cast<size_t>(t) * 3]);
+        for (int k = 0; k < 3; ++k) {
+            axis[k] += normals[static_cast<size_t>(t) * 3 + k];
+        }
+    }
+    const float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    float minDot = length > 0.0f ? 1.0f : -1.0f;
+    for (int k = 0; k < 3 && length > 0.0f; ++k) {
+        axis[k] /= length;
+    }
+    for (uint32_t t = 0; t < meshlet.triangleCount && minDot > kMinConeSpread; ++t) {
+        const float* n = &normals[static_cast<size_t>(t) * 3];
+        if (n[0] == 0.0f && n[1] == 0.0f && n[2] == 0.0f) {
+            continue;
+        }
+        minDot = std::min(minDot, n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2]);
+    }
+    std::copy(axis, axis + 3, meshlet.coneAxis);
+    std::copy(center, center + 3, meshlet.coneApex);
+    if (minDot <= kMinConeSpread) {
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+
+    // Move the apex back along the axis until it lies behind every triangle's plane
+    float maxT = 0.0f;
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+        const float* n = &normals[static_cast<size_t>(t) * 3];
+        const float* p = position(triangles[t * 3]);
+        const float towardAxis = n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2];
+        if (towardAxis <= 0.0f) {
+            continue;
+        }
+        const float offset = (center[0] - p[0]) * n[0] + (center[1] - p[1]) * n[1] + (center[2] - p[2]) * n[2];
+        maxT = std::max(maxT, offset / towardAxis);
+    }
+    for (int k = 0; k < 3; ++k) {
+        meshlet.coneApex[k] = center[k] - axis[k] * maxT;
+    }
+    meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,213 @@
+/**
+ * @file MeshletCuller.cpp
+ * @brief Per-cluster frustum and backface culling implementation
+ */
+
+#include "ogde/graphics/MeshletCuller.h"
+#include "ogde/graphics/Camera.h"
+#include "ogde/core/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+// Meshlets tested per job in cull()
+constexpr uint32_t kCullGrainSize = 256;
+
+inline void normalize(float* v) {
+    const float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length > 0.0f) {
+        v[0] /= length;
+        v[1] /= length;
+        v[2] /= length;
+    }
+}
+
+} // namespace
+
+MeshletCuller::MeshletCuller()
+    : m_world()
+    , m_orthographic(false)
+    , m_backfaceCulling(true)
+    , m_jobSystem(nullptr) {
+}
+
+void MeshletCuller::setCamera(const Camera& camera) {
+    const Frustum& frustum = camera.getFrustum();
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+        m_world.planes[i] = frustum.getPlane(static_cast<Frustum::PlaneIndex>(i));
+    }
+    camera.getPosition(m_world.position[0], m_world.position[1], m_world.position[2]);
+    camera.getForward(m_world.direction[0], m_world.direction[1], m_world.direction[2]);
+    m_orthographic = camera.getProjectionType() == ProjectionType::Orthographic;
+    m_stats = MeshletCullStats();
+}
+
+void MeshletCuller::makeObjectView(const float* m, View& outView) const {
+    // Planes follow the transpose: a world plane p becomes M * p in object space
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+        const Plane& world = m_world.planes[i];
+        Plane& plane = outView.planes[i];
+        plane.nx = m[0] * world.nx + m[1] * world.ny + m[2] * world.nz + m[3] * world.d;
+        plane.ny = m[4] * world.nx + m[5] * world.ny + m[6] * world.nz + m[7] * world.d;
+        plane.nz = m[8] * world.nx + m[9] * world.ny + m[10] * world.nz + m[11] * world.d;
+        plane.d = m[12] * world.nx + m[13] * world.ny + m[14] * world.nz + m[15] * world.d;
+        const float length = std::sqrt(plane.nx * plane.nx + plane.ny * plane.ny + plane.nz * plane.nz);
+        if (length > 0.0f) {
+            plane.nx /= length;
+            plane.ny /= length;
+            plane.nz /= length;
+            plane.d /= length;
+        }
+    }
+
+    // Camera position and direction go through the inverse of the upper 3x3 (row vectors: world = object * B + t)
+    const float b00 = m[0], b01 = m[1], b02 = m[2];
+    const float b10 = m[4], b11 = m[5], b12 = m[6];
+    const float b20 = m[8], b21 = m[9], b22 = m[10];
+    const float c00 = b11 * b22 - b12 * b21, c01 = b02 * b21 - b01 * b22, c02 = b01 * b12 - b02 * b11;
+    const float c10 = b12 * b20 - b10 * b22, c11 = b00 * b22 - b02 * b20, c12 = b02 * b10 - b00 * b12;
+    const float c20 = b10 * b21 - b11 * b20, c21 = b01 * b20 - b00 * b21, c22 = b00 * b11 - b01 * b10;
+    const float determinant = b00 * c00 + b01 * c10 + b02 * c20;
+    const float inverse = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+    const float p[3] = { m_world.position[0] - m[12], m_world.position[1] - m[13], m_world.position[2] - m[14] };
+    const float* d = m_world.direction;
+    outView.position[0] = (p[0] * c00 + p[1] * c10 + p[2] * c20) * inverse;
+    outView.position[1] = (p[0] * c01 + p[1] * c11 + p[2] * c21) * inverse;
+    outView.position[2] = (p[0] * c02 + p[1] * c12 + p[2] * c22) * inverse;
+    outView.direction[0] = (d[0] * c00 + d[1] * c10 + d[2] * c20) * inverse;
+    outView.direction[1] = (d[0] * c01 + d[1] * c11 + d[2] * c21) * inverse;
+    outView.direction[2] = (d[0] * c02 + d[1] * c12 + d[2] * c22) * inverse;
+    normalize(outView.direction);
+}
+
+MeshletCuller::Result MeshletCuller::test(const View& view, const OGDE::Graphics::Meshlet& meshlet) const {
+    const float* c = meshlet.center;
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+        if (view.planes[i].distance(c[0], c[1], c[2]) < -meshlet.radius) {
+            return OutsideFrustum;
+        }
+    }
+    if (!m_backfaceCulling || meshlet.coneCutoff >= 1.0f) {
+        return Visible;
+    }
+
+    // Backfacing when the view ray to the apex lies inside the cone's negative half
+    float ray[3];
+    if (m_orthographic) {
+        ray[0] = view.direction[0];
+        ray[1] = view.direction[1];
+        ray[2] = view.direction[2];
+    } else {
+        ray[0] = meshlet.coneApex[0] - view.position[0];
+        ray[1] = meshlet.coneApex[1] - view.position[1];
+        ray[2] = meshlet.coneApex[2] - view.position[2];
+        normalize(ray);
+    }
+    const float* axis = meshlet.coneAxis;
+    return ray[0] * axis[0] + ray[1] * axis[1] + ray[2] * axis[2] >= meshlet.coneCutoff ? Backfacing : Visible;
+}
+
+bool MeshletCuller::isVisible(const OGDE::Graphics::Meshlet& meshlet) const {
+    return test(m_world, meshlet) == Visible;
+}
+
+uint32_t MeshletCuller::cull(const OGDE::Graphics::MeshData& mesh, const OGDE::Graphics::SubMesh& subMesh,
+                             uint32_t* outIndices, const float* worldMatrix) {
+    View objectView;
+    if (worldMatrix) {
+        makeObjectView(worldMatrix, objectView);
+    }
+    const View& view = worldMatrix ? objectView : m_world;
+    const OGDE::Graphics::Meshlet* meshlets = mesh.meshlets.data() + subMesh.meshletOffset;
+    const uint32_t meshletCount = subMesh.meshletCount;
+
+    struct RangeResult {
+        uint32_t indexCount;
+        uint32_t frustumCulled;
+        uint32_t backfaceCulled;
+    };
+
+    // Test a range of meshlets, flagging the visible ones
+    auto testRange = [&](uint32_t begin, uint32_t end, uint8_t* visible) {
+        RangeResult result = { 0, 0, 0 };
+        for (uint32_t i = begin; i < end; ++i) {
+            const Result visibility = test(view, meshlets[i]);
+            visible[i] = visibility == Visible;
+            if (visibility == Visible) {
+                result.indexCount += meshlets[i].triangleCount * 3;
+            } else {
+                ++(visibility == OutsideFrustum ? result.frustumCulled : result.backfaceCulled);
+            }
+        }
+        return result;
+    };
+
+    // Expand the flagged meshlets of a range into out
+    auto expandRange = [&](uint32_t begin, uint32_t end, const uint8_t* visible, uint32_t* out) {
+        for (uint32_t i = begin; i < end; ++i) {
+            if (!visible[i]) {
+                continue;
+            }
+            const OGDE::Graphics::Meshlet& meshlet = meshlets[i];
+            const uint32_t* vertices = mesh.meshletVertices.data() + meshlet.vertexOffset;
+            const uint8_t* triangles = mesh.meshletTriangles.data() + static_cast<size_t>(meshlet.triangleOffset) * 3;
+            for (uint32_t k = 0; k < meshlet.triangleCount * 3; ++k) {
+                *out++ = vertices[triangles[k]];
+            }
+        }
+    };
+
+    m_visible.resize(meshletCount);
+    RangeResult total = { 0, 0, 0 };
+    if (!m_jobSystem || meshletCount <= kCullGrainSize) {
+        total = testRange(0, meshletCount, m_visible.data());
+        expandRange(0, meshletCount, m_visible.data(), outIndices);
+    } else {
+        // Test in parallel, turn the per-range counts into output offsets, then expand in parallel
+        const uint32_t rangeCount = (meshletCount + kCullGrainSize - 1) / kCullGrainSize;
+        std::vector<RangeResult> results(rangeCount);
+        m_jobSystem->parallelFor(rangeCount, 1, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t range = begin; range < end; ++range) {
+                const uint32_t first = range * kCullGrainSize;
+                results[range] = testRange(first, std::min(first + kCullGrainSize, meshletCount), m_visible.data());
+            }
+        });
+        std::vector<uint32_t> rangeOffsets(rangeCount);
+        for (uint32_t range = 0; range < rangeCount; ++range) {
+            rangeOffsets[range] = total.indexCount;
+            total.indexCount += results[range].indexCount;
+            total.frustumCulled += results[range].frustumCulled;
+            total.backfaceCulled += results[range].backfaceCulled;
+        }
+        m_jobSystem->parallelFor(rangeCount, 1, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t range = begin; range < end; ++range) {
+                const uint32_t first = range * kCullGrainSize;
+                expandRange(first, std::min(first + kCullGrainSize, meshletCount), m_visible.data(),
+                            outIndices + rangeOffsets[range]);
+            }
+        });
+    }
+
+    m_stats.testedMeshlets += meshletCount;
+    m_stats.frustumCulled += total.frustumCulled;
+    m_stats.backfaceCulled += total.backfaceCulled;
+    m_stats.visibleTriangles += total.indexCount / 3;
+    return total.indexCount;
+}
+
+void MeshletCuller::cull(const OGDE::Graphics::MeshData& mesh, const OGDE::Graphics::SubMesh& subMesh,
+                         std::vector<uint32_t>& outIndices, const float* worldMatrix) {
+    uint32_t capacity = 0;
+    for (uint32_t i = 0; i < subMesh.meshletCount; ++i) {
+        capacity += mesh.meshlets[subMesh.meshletOffset + i].triangleCount * 3;
+    }
+    outIndices.resize(capacity);
+    outIndices.resize(cull(mesh, subMesh, outIndices.data(), worldMatrix));
+}
+
+} // namespace graphics
+} // namespace ogde
@@ -0,0 +1,471 @@
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/Logger.h"
+#include "ogde/platform/CpuFeatures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace OGDE {
+namespace Graphics {
+
+using ogde::platform::CpuFeatures;
+
+namespace {
+
+constexpr int kMaxTaps = 12;
+constexpr int kPad = 6;             // Clamped border pixels on each side of a decoded row
+constexpr int kMinRowsPerJob = 16;
+
+/**
+ * Separable 2:1 kernel. Output pixel x reads source pixels
+ * 2x + firstOffset .. 2x + firstOffset + tapCount - 1.
+ */
+struct FilterKernel {
+    int tapCount = 0;
+    int firstOffset = 0;
+    float weights[kMaxTaps] = {};
+};
+
+double BesselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+FilterKernel MakeKernel(const MipSettings& settings) {
+    FilterKernel kernel;
+    if (settings.filter == MipFilter::Box) {
+        kernel.tapCount = 2;
+        kernel.firstOffset = 0;
+        kernel.weights[0] = 0.5f;
+        kernel.weights[1] = 0.5f;
+        return kernel;
+    }
+
+    // Kaiser-windowed sinc, 3 destination pixels of support on each side
+    const double pi = 3.14159265358979323846;
+    const double support = 3.0;
+    const double alpha = settings.kaiserAlpha;
+    kernel.tapCount = kMaxTaps;
+    kernel.firstOffset = -5;
+    double total = 0.0;
+    double weights[kMaxTaps];
+    for (int k = 0; k < kMaxTaps; ++k) {
+        // Distance between source and destination pixel centers, in destination pixels
+        double t = (k + kernel.firstOffset + 0.5 - 1.0) * 0.5;
+        double sinc = std::sin(pi * t) / (pi * t);
+        double window = t / support;
+        window = BesselI0(alpha * std::sqrt(std::max(0.0, 1.0 - window * window))) / BesselI0(alpha);
+        weights[k] = sinc * window;
+        total += weights[k];
+    }
+    for (int k = 0; k < kMaxTaps; ++k) {
+        kernel.weights[k] = static_cast<float>(weights[k] / total);
+    }
+    return kernel;
+}
+
+struct TransferTables {
+    float srgbToLinear[256];
+    float unormToFloat[256];
+    uint8_t linearToSrgb[65536];   // Indexed by linear value * 65535
+};
+
+const TransferTables& GetTransferTables() {
+    static const TransferTables tables = []() {
+        TransferTables t;
+        for (int i = 0; i < 256; ++i) {
+            double c = i / 255.0;
+            t.srgbToLinear[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+            t.unormToFloat[i] = static_cast<float>(c);
+        }
+        for (int i = 0; i < 65536; ++i) {
+            double l = i / 65535.0;
+            double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+            t.linearToSrgb[i] = static_cast<uint8_t>(std::min(255.0, c * 255.0 + 0.5));
+        }
+        return t;
+    }();
+    return tables;
+}
+
+inline int NextLevelSize(int size) {
+    return std::max(1, size / 2);
+}
+
+// ---------------------------------------------------------------------------
+// Float path: decode rows to linear float, filter horizontally, cache, combine vertically
+// ---------------------------------------------------------------------------
+
+struct DownsampleJob {
+    const uint8_t* src;
+    int srcWidth;
+    int srcHeight;
+    int channels;
+    uint8_t* dst;
+    int dstWidth;
+    int dstHeight;
+    FilterKernel kernel;
+    bool srgbChannel[4];
+};
+
+void HorizontalScalar(const float* in, float* out, int dstWidth, int channels, const FilterKernel& kernel) {
+    for (int x = 0; x < dstWidth; ++x) {
+        const float* first = in + (2 * x + kernel.firstOffset + kPad) * channels;
+        for (int c = 0; c < channels; ++c) {
+            float sum = 0.0f;
+            for (int k = 0; k < kernel.tapCount; ++k) {
+                sum += kernel.weights[k] * first[k * channels + c];
+            }
+            out[x * channels + c] = sum;
+        }
+    }
+}
+
+#ifdef OGDE_ARCH_X86
+// One SSE register holds one RGBA pixel
+void HorizontalRgbaSse2(const float* in, float* out, int dstWidth, const FilterKernel& kernel) {
+    __m128 weights[kMaxTaps];
+    for (int k = 0; k < kernel.tapCount; ++k) {
+        weights[k] = _mm_set1_ps(kernel.weights[k]);
+    }
+    for (int x = 0; x < dstWidth; ++x) {
+        const float* first = in + (2 * x + kernel.firstOffset + kPad) * 4;
+        __m128 sum = _mm_mul_ps(weights[0], _mm_loadu_ps(first));
+        for (int k = 1; k < kernel.tapCount; ++k) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(weights[k], _mm_loadu_ps(first + k * 4)));
+        }
+        _mm_storeu_ps(out + x * 4, sum);
+    }
+}
+
+OGDE_TARGET_AVX2
+void VerticalAvx2(const float* const* rows, const float* weights, int tapCount, float* out, int count) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 sum = _mm256_mul_ps(_mm256_set1_ps(weights[0]), _mm256_loadu_ps(rows[0] + i));
+        for (int k = 1; k < tapCount; ++k) {
+            sum = _mm256_fmadd_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(rows[k] + i), sum);
+        }
+        _mm256_storeu_ps(out + i, sum);
+    }
+    for (; i < count; ++i) {
+        float sum = 0.0f;
+        for (int k = 0; k < tapCount; ++k) {
+            sum += weights[k] * rows[k][i];
+        }
+        out[i] = sum;
+    }
+}
+
+void VerticalSse2(const float* const* rows, const float* weights, int tapCount, float* out, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 sum = _mm_mul_ps(_mm_set1_ps(weights[0]), _mm_loadu_ps(rows[0] + i));
+        for (int k = 1; k < tapCount; ++k) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(rows[k] + i)));
+        }
+        _mm_storeu_ps(out + i, sum);
+    }
+    for (; i < count; ++i) {
+        float sum = 0.0f;
+        for (int k = 0; k < tapCount; ++k) {
+            sum += weights[k] * rows[k][i];
+        }
+        out[i] = sum;
+    }
+}
+
+#else
+void VerticalScalar(const float* const* rows, const float* weights, int tapCount, float* out, int count) {
+    for (int i = 0; i < count; ++i) {
+        float sum = 0.0f;
+        for (int k = 0; k < tapCount; ++k) {
+            sum += weights[k] * rows[k][i];
+        }
+        out[i] = sum;
+    }
+}
+#endif
+
+/**
+ * Horizontally filtered source rows for one range of output rows. Consecutive
+ * output rows share most of their source rows, so each row is decoded once.
+ */
+class RowCache {
+public:
+    explicit RowCache(const DownsampleJob& job)
+        : job_(job)
+        , capacity_(job.kernel.tapCount + 2)
+        , rowFloats_(job.dstWidth * job.channels)
+        , decoded_((job.srcWidth + 2 * kPad) * job.channels)
+        , rows_(static_cast<size_t>(capacity_) * rowFloats_)
+        , rowIds_(capacity_, -1)
+    {
+        const TransferTables& tables = GetTransferTables();
+        for (int c = 0; c < job.channels; ++c) {
+            decodeTables_[c] = job.srgbChannel[c] ? tables.srgbToLinear : tables.unormToFloat;
+        }
+    }
+
+    const float* Get(int srcRow) {
+        int slot = srcRow % capacity_;
+        float* row = rows_.data() + static_cast<size_t>(slot) * rowFloats_;
+        if (rowIds_[slot] != srcRow) {
+            Decode(srcRow);
+#ifdef OGDE_ARCH_X86
+            if (job_.channels == 4) {
+                HorizontalRgbaSse2(decoded_.data(), row, job_.dstWidth, job_.kernel);
+            } else
+#endif
+            {
+                HorizontalScalar(decoded_.data(), row, job_.dstWidth, job_.channels, job_.kernel);
+            }
+            rowIds_[slot] = srcRow;
+        }
+        return row;
+    }
+
+private:
+    void Decode(int srcRow) {
+        const int channels = job_.channels;
+        const uint8_t* src = job_.src + static_cast<size_t>(srcRow) * job_.srcWidth * channels;
+        float* out = decoded_.data() + kPad * channels;
+        if (channels == 4) {
+            const float* t0 = decodeTables_[0];
+            const float* t3 = decodeTables_[3];
+            for (int x = 0; x < job_.srcWidth; ++x) {
+                out[x * 4 + 0] = t0[src[x * 4 + 0]];
+                out[x * 4 + 1] = t0[src[x * 4 + 1]];
+                out[x * 4 + 2] = t0[src[x * 4 + 2]];
+                out[x * 4 + 3] = t3[src[x * 4 + 3]];
+            }
+        } else {
+            for (int x = 0; x < job_.srcWidth; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    out[x * channels + c] = decodeTables_[c][src[x * channels + c]];
+                }
+            }
+        }
+
+        // Clamp-to-edge borders so the horizontal taps never need bounds checks
+        float* left = decoded_.data();
+        float* right = out + job_.srcWidth * channels;
+        const float* lastPixel = right - channels;
+        for (int p = 0; p < kPad; ++p) {
+            std::memcpy(left + p * channels, out, channels * sizeof(float));
+            std::memcpy(right + p * channels, lastPixel, channels * sizeof(float));
+        }
+    }
+
+    const DownsampleJob& job_;
+    int capacity_;
+    int rowFloats_;
+    std::vector<float> decoded_;
+    std::vector<float> rows_;
+    std::vector<int> rowIds_;
+    const float* decodeTables_[4] = {};
+};
+
+void EncodeRow(const float* in, uint8_t* out, int width, int channels, const bool* srgbChannel) {
+    const uint8_t* toSrgb = GetTransferTables().linearToSrgb;
+    for (int x = 0; x < width; ++x) {
+        for (int c = 0; c < channels; ++c) {
+            float v = std::min(1.0f, std::max(0.0f, in[x * channels + c]));
+            out[x * channels + c] = srgbChannel[c]
+                ? toSrgb[static_cast<int>(v * 65535.0f + 0.5f)]
+                : static_cast<uint8_t>(v * 255.0f + 0.5f);
+        }
+    }
+}
+
+void DownsampleRowsFloat(const DownsampleJob& job, int rowBegin, int rowEnd) {
+    RowCache cache(job);
+    std::vector<float> filtered(static_cast<size_t>(job.dstWidth) * job.channels);
+    const float* rows[kMaxTaps];
+    const int count = job.dstWidth * job.channels;
+
+#ifdef OGDE_ARCH_X86
+    const bool useAvx2 = CpuFeatures::hasAVX2();
+#endif
+
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        for (int k = 0; k < job.kernel.tapCount; ++k) {
+            int srcRow = std::min(job.srcHeight - 1, std::max(0, 2 * y + job.kernel.firstOffset + k));
+            rows[k] = cache.Get(srcRow);
+        }
+
+#ifdef OGDE_ARCH_X86
+        if (useAvx2) {
+            VerticalAvx2(rows, job.kernel.weights, job.kernel.tapCount, filtered.data(), count);
+        } else {
+            VerticalSse2(rows, job.kernel.weights, job.kernel.tapCount, filtered.data(), count);
+        }
+#else
+        VerticalScalar(rows, job.kernel.weights, job.kernel.tapCount, filtered.data(), count);
+#endif
+
+        EncodeRow(filtered.data(), job.dst + static_cast<size_t>(y) * job.dstWidth * job.channels,
+                  job.dstWidth, job.channels, job.srgbChannel);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Integer path: 2x2 box average of linear 8-bit data
+// ---------------------------------------------------------------------------
+
+void BoxRowsInteger(const DownsampleJob& job, int rowBegin, int rowEnd) {
+    const int channels = job.channels;
+    const size_t srcPitch = static_cast<size_t>(job.srcWidth) * channels;
+    const int lastColumn = job.srcWidth - 1;
+
+    for (int y = rowBegin; y < rowEnd; ++y) {
+        const uint8_t* row0 = job.src + static_cast<size_t>(2 * y) * srcPitch;
+        const uint8_t* row1 = job.src + static_cast<size_t>(std::min(2 * y + 1, job.srcHeight - 1)) * srcPitch;
+        uint8_t* out = job.dst + static_cast<size_t>(y) * job.dstWidth * channels;
+        int x = 0;
+
+#ifdef OGDE_ARCH_X86
+        if (channels == 4 && job.srcWidth >= 2) {
+            // Two output pixels from four source pixels of each row
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i rounding = _mm_set1_epi16(2);
+            for (; x + 2 <= job.dstWidth; x += 2) {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+                __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+                __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+                low = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+                high = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+                __m128i sum = _mm_unpacklo_epi64(low, high);
+                sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(sum, sum));
+            }
+        }
+#endif
+
+        for (; x < job.dstWidth; ++x) {
+            int x0 = 2 * x;
+            int x1 = std::min(2 * x + 1, lastColumn);
+            for (int c = 0; c < channels; ++c) {
+                int sum = row0[x0 * channels + c] + row0[x1 * channels + c] +
+                          row1[x0 * channels + c] + row1[x1 * channels + c];
+                out[x * channels + c] = static_cast<uint8_t>((sum + 2) >> 2);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int MipGenerator::CalculateLevelCount(int width, int height) {
+    int size = std::max(width, height);
+    int levels = 1;
+    while (size > 1) {
+        size /= 2;
+        levels++;
+    }
+    return levels;
+}
+
+bool MipGenerator::Downsample(const uint8_t* src, int srcWidth, int srcHeight, int channels,
+                              uint8_t* dst, const MipSettings& settings) {
+    if (!src || !dst || srcWidth <= 0 || srcHeight <= 0 || channels < 1 || channels > 4) {
+        ogde::core::Logger::error("Invalid mip generation parameters");
+        return false;
+    }
+
+    DownsampleJob job;
+    job.src = src;
+    job.srcWidth = srcWidth;
+    job.srcHeight = srcHeight;
+    job.channels = channels;
+    job.dst = dst;
+    job.dstWidth = NextLevelSize(srcWidth);
+    job.dstHeight = NextLevelSize(srcHeight);
+    job.kernel = MakeKernel(settings);
+
+    // Alpha is coverage, not color, and is always filtered linearly
+    int alphaChannel = (channels == 2 || channels == 4) ? channels - 1 : -1;
+    bool anySrgb = false;
+    for (int c = 0; c < 4; ++c) {
+        job.srgbChannel[c] = settings.srgb && c < channels && c != alphaChannel;
+        anySrgb = anySrgb || job.srgbChannel[c];
+    }
+
+    const bool integerBox = settings.filter == MipFilter::Box && !anySrgb;
+    auto run = [&job, integerBox](uint32_t begin, uint32_t end) {
+        if (integerBox) {
+            BoxRowsInteger(job, static_cast<int>(begin), static_cast<int>(end));
+        } else {
+            DownsampleRowsFloat(job, static_cast<int>(begin), static_cast<int>(end));
+        }
+    };
+
+    uint32_t rowCount = static_cast<uint32_t>(job.dstHeight);
+    if (settings.jobSystem) {
+        uint32_t grain = std::max<uint32_t>(kMinRowsPerJob, rowCount / (settings.jobSystem->getThreadCount() * 4));
+        settings.jobSystem->parallelFor(rowCount, grain, run);
+    } else {
+        run(0, rowCount);
+    }
+    return true;
+}
+
+bool MipGenerator::GenerateChain(const uint8_t* base, int width, int height, int channels,
+                                 const MipSettings& settings,
+                                 std::vector<uint8_t>& outPixels, std::vector<MipLevel>& outLevels) {
+    if (!base || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+        ogde::core::Logger::error("Invalid mip generation parameters");
+        return false;
+    }
+
+    int levelCount = CalculateLevelCount(width, height);
+    if (settings.maxLevels > 0) {
+        levelCount = std::min(levelCount, settings.maxLevels);
+    }
+
+    outLevels.clear();
+    size_t totalSize = 0;
+    int levelWidth = width;
+    int levelHeight = height;
+    for (int level = 0; level < levelCount; ++level) {
+        MipLevel info;
+        info.width = levelWidth;
+        info.height = levelHeight;
+        info.offset = totalSize;
+        info.size = static_cast<size_t>(levelWidth) * levelHeight * channels;
+        outLevels.push_back(info);
+        totalSize += info.size;
+        levelWidth = NextLevelSize(levelWidth);
+        levelHeight = NextLevelSize(levelHeight);
+    }
+
+    outPixels.resize(totalSize);
+    std::memcpy(outPixels.data(), base, outLevels[0].size);
+
+    for (int level = 1; level < levelCount; ++level) {
+        const MipLevel& source = outLevels[level - 1];
+        if (!Downsample(outPixels.data() + source.offset, source.width, source.height, channels,
+                        outPixels.data() + outLevels[level].offset, settings)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,595 @@
+/**
+ * OBJ Loader Implementation
+ */
+
+#include "ogde/graphics/ObjLoader.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/Logger.h"
+#include "ogde/core/MappedFile.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// Corner references are stored as uint32. Absolute references are 0-based
+// indices; relative ones (negative in the file) are chunk-local until the
+// chunk's base offset is known, and carry kRelativeFlag.
+constexpr uint32_t kRelativeFlag = 0x80000000u;
+constexpr int32_t kRelativeBias = 0x40000000;
+constexpr uint32_t kMissing = 0x7FFFFFFFu;     // No vt or vn given
+constexpr uint32_t kInvalid = 0x7FFFFFFEu;     // Index 0 or out of range
+
+constexpr float kPow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+constexpr double kPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+struct MaterialSwitch {
+    size_t corner;          // Size of the chunk's corner array when usemtl appeared
+    std::string name;
+};
+
+// Everything parsed from one chunk of lines
+struct ObjChunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    std::vector<float> positions;
+    std::vector<float> texCoords;
+    std::vector<float> normals;
+    std::vector<uint32_t> corners;      // (v, vt, vn) per triangle corner
+    std::vector<MaterialSwitch> materials;
+    uint32_t faces = 0;
+    uint32_t positionBase = 0;          // Elements in all previous chunks
+    uint32_t texCoordBase = 0;
+    uint32_t normalBase = 0;
+};
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* SkipSpaces(const char* p, const char* end) {
+    while (p < end && IsSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+inline const char* SkipLine(const char* p, const char* end) {
+    if (p >= end) {
+        return end;
+    }
+    const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return newline ? static_cast<const char*>(newline) + 1 : end;
+}
+
+// Parses up to count floats; missing ones stay 0
+const char* ParseFloats(const char* p, const char* end, float* values, int count) {
+    for (int i = 0; i < count; ++i) {
+        values[i] = 0.0f;
+    }
+    for (int i = 0; i < count; ++i) {
+        p = SkipSpaces(p, end);
+        const char* next = ObjLoader::ParseFloat(p, end, values[i]);
+        if (next == p) {
+            break;
+        }
+        p = next;
+    }
+    return p;
+}
+
+// Parses an OBJ index and encodes it as described above
+const char* ParseIndex(const char* p, const char* end, size_t localCount, uint32_t& outIndex) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    const char* digits = p;
+    uint64_t value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = std::min<uint64_t>(value * 10 + static_cast<uint64_t>(*p - '0'), kInvalid);
+        ++p;
+    }
+    if (p == digits || value == 0 || value >= kInvalid) {
+        outIndex = kInvalid;
+    } else if (!negative) {
+        outIndex = static_cast<uint32_t>(value - 1);
+    } else {
+        const int64_t local = static_cast<int64_t>(localCount) - static_cast<int64_t>(value);
+        outIndex = local < -kRelativeBias || local >= kRelativeBias
+            ? kInvalid
+            : kRelativeFlag | static_cast<uint32_t>(local + kRelativeBias);
+    }
+    return p;
+}
+
+void ParseFace(const char* p, const char* end, ObjChunk& chunk) {
+    uint32_t polygon[3 * 64];
+    uint32_t cornerCount = 0;
+    const size_t positionCount = chunk.positions.size() / 3;
+    const size_t texCoordCount = chunk.texCoords.size() / 2;
+    const size_t normalCount = chunk.normals.size() / 3;
+
+    while (true) {
+        p = SkipSpaces(p, end);
+        if (p >= end || *p == '\n' || *p == '#') {
+            break;
+        }
+        uint32_t v = kInvalid, vt = kMissing, vn = kMissing;
+        const char* next = ParseIndex(p, end, positionCount, v);
+        if (next == p) {
+            break;
+        }
+        p = next;
+        if (p < end && *p == '/') {
+            ++p;
+            if (p < end && *p != '/' && !IsSpace(*p) && *p != '\n') {
+                p = ParseIndex(p, end, texCoordCount, vt);
+            }
+            if (p < end && *p == '/') {
+                p = ParseIndex(p + 1, end, normalCount, vn);
+            }
+        }
+        if (cornerCount < 64) {
+            polygon[cornerCount * 3 + 0] = v;
+            polygon[cornerCount * 3 + 1] = vt;
+            polygon[cornerCount * 3 + 2] = vn;
+            ++cornerCount;
+        }
+        // Anything else glued to the reference (e.g. a stray character) ends the face
+        if (p < end && !IsSpace(*p) && *p != '\n') {
+            break;
+        }
+    }
+
+    if (cornerCount < 3) {
+        return;
+    }
+    ++chunk.faces;
+    for (uint32_t i = 1; i + 1 < cornerCount; ++i) {
+        chunk.corners.insert(chunk.corners.end(), polygon, polygon + 3);
+        chunk.corners.insert(chunk.corners.end(), polygon + i * 3, polygon + i * 3 + 6);
+    }
+}
+
+void ParseChunk(ObjChunk& chunk) {
+    const char* p = chunk.begin;
+    const char* end = chunk.end;
+    while (p < end) {
+        p = SkipSpaces(p, end);
+        if (p >= end) {
+            break;
+        }
+        const char c = *p;
+        if (c == 'v' && p + 1 < end) {
+            float values[3];
+            if (IsSpace(p[1])) {
+                p = ParseFloats(p + 2, end, values, 3);
+                chunk.positions.insert(chunk.positions.end(), values, values + 3);
+            } else if (p[1] == 't' && p + 2 < end && IsSpace(p[2])) {
+                p = ParseFloats(p + 3, end, values, 2);
+                chunk.texCoords.insert(chunk.texCoords.end(), values, values + 2);
+            } else if (p[1] == 'n' && p + 2 < end && IsSpace(p[2])) {
+                p = ParseFloats(p + 3, end, values, 3);
+                chunk.normals.insert(chunk.normals.end(), values, values + 3);
+            }
+        } else if (c == 'f' && p + 1 < end && IsSpace(p[1])) {
+            ParseFace(p + 2, end, chunk);
+        } else if (c == 'u' && static_cast<size_t>(end - p) > 7 && std::memcmp(p, "usemtl", 6) == 0 &&
+                   IsSpace(p[6])) {
+            const char* name = SkipSpaces(p + 7, end);
+            const char* nameEnd = SkipLine(name, end);
+            while (nameEnd > name && (IsSpace(nameEnd[-1]) || nameEnd[-1] == '\n')) {
+                --nameEnd;
+            }
+            chunk.materials.push_back({ chunk.corners.size(), std::string(name, nameEnd) });
+        }
+        p = SkipLine(p, end);
+    }
+}
+
+inline uint32_t Resolve(uint32_t index, uint32_t base, uint32_t count) {
+    if (index == kMissing) {
+        return kMissing;
+    }
+    if (index & kRelativeFlag) {
+        const int64_t local = static_cast<int64_t>(index & ~kRelativeFlag) - kRelativeBias;
+        const int64_t absolute = static_cast<int64_t>(base) + local;
+        return absolute >= 0 && absolute < count ? static_cast<uint32_t>(absolute) : kInvalid;
+    }
+    return index < count ? index : kInvalid;
+}
+
+inline uint32_t HashCorner(const uint32_t* corner) {
+    uint32_t h = corner[0] * 0x9E3779B1u ^ corner[1] * 0x85EBCA77u ^ corner[2] * 0xC2B2AE3Du;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    return h;
+}
+
+// Open-addressing map from (v, vt, vn) to vertex id; keys live in the vertex key array
+class CornerTable {
+public:
+    explicit CornerTable(size_t expected) {
+        size_t capacity = 1024;
+        while (capacity < expected * 2) {
+            capacity <<= 1;
+        }
+        m_slots.assign(capacity, UINT32_MAX);
+    }
+
+    uint32_t findOrInsert(const uint32_t* corner, std::vector<uint32_t>& keys) {
+        if ((keys.size() / 3 + 1) * 2 > m_slots.size()) {
+            grow(keys);
+        }
+        const size_t mask = m_slots.size() - 1;
+        size_t slot = HashCorner(corner) & mask;
+        while (true) {
+            const uint32_t id = m_slots[slot];
+            if (id == UINT32_MAX) {
+                const uint32_t newId = static_cast<uint32_t>(keys.size() / 3);
+                m_slots[slot] = newId;
+                keys.insert(keys.end(), corner, corner + 3);
+                return newId;
+            }
+            const uint32_t* key = keys.data() + static_cast<size_t>(id) * 3;
+            if (key[0] == corner[0] && key[1] == corner[1] && key[2] == corner[2]) {
+                return id;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+private:
+    void grow(const std::vector<uint32_t>& keys) {
+        m_slots.assign(m_slots.size() * 2, UINT32_MAX);
+        const size_t mask = m_slots.size() - 1;
+        const uint32_t count = static_cast<uint32_t>(keys.size() / 3);
+        for (uint32_t id = 0; id < count; ++id) {
+            size_t slot = HashCorner(keys.data() + static_cast<size_t>(id) * 3) & mask;
+            while (m_slots[slot] != UINT32_MAX) {
+                slot = (slot + 1) & mask;
+            }
+            m_slots[slot] = id;
+        }
+    }
+
+    std::vector<uint32_t> m_slots;
+};
+
+void ForEach(ogde::core::JobSystem* jobSystem, uint32_t count, uint32_t grain,
+             const std::function<void(uint32_t)>& fn) {
+    if (jobSystem && count > 1) {
+        jobSystem->parallelFor(count, grain, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                fn(i);
+            }
+        });
+    } else {
+        for (uint32_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+    }
+}
+
+} // namespace
+
+bool ObjLoader::Load(const std::string& filepath, MeshData& outMesh, const ObjLoadSettings& settings,
+                     ObjLoadStats* outStats) {
+    Core::MappedFile file;
+    if (!file.Open(filepath)) {
+        ogde::core::Logger::error("Failed to open OBJ file: " + filepath);
+        return false;
+    }
+    if (!Parse(reinterpret_cast<const char*>(file.GetData()), file.GetSize(), outMesh, settings, outStats)) {
+        ogde::core::Logger::error("OBJ file contains no triangles: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+bool ObjLoader::Parse(const char* data, size_t size, MeshData& outMesh, const ObjLoadSettings& settings,
+                      ObjLoadStats* outStats) {
+    ObjLoadStats stats;
+    MeshData mesh;
+    if (!data) {
+        size = 0;
+    }
+
+    // Split into chunks that end after a newline
+    const size_t chunkSize = std::max<size_t>(settings.chunkSize, 64);
+    const size_t chunkCount = std::max<size_t>(1, (size + chunkSize - 1) / chunkSize);
+    std::vector<ObjChunk> chunks;
+    chunks.reserve(chunkCount);
+    const char* cursor = data;
+    const char* end = data + size;
+    for (size_t i = 1; i <= chunkCount && cursor < end; ++i) {
+        const char* chunkEnd = i == chunkCount ? end : SkipLine(std::max(cursor, data + i * size / chunkCount), end);
+        ObjChunk chunk;
+        chunk.begin = cursor;
+        chunk.end = chunkEnd;
+        chunks.push_back(std::move(chunk));
+        cursor = chunkEnd;
+    }
+    const uint32_t count = static_cast<uint32_t>(chunks.size());
+    stats.chunks = count;
+
+    ForEach(settings.jobSystem, count, 1, [&](uint32_t i) { ParseChunk(chunks[i]); });
+
+    // Concatenate the attribute arrays; relative references need each chunk's base
+    std::vector<float> positions, texCoords, normals;
+    size_t cornerTotal = 0;
+    for (ObjChunk& chunk : chunks) {
+        chunk.positionBase = static_cast<uint32_t>(positions.size() / 3);
+        chunk.texCoordBase = static_cast<uint32_t>(texCoords.size() / 2);
+        chunk.normalBase = static_cast<uint32_t>(normals.size() / 3);
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        texCoords.insert(texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+        std::vector<float>().swap(chunk.positions);
+        std::vector<float>().swap(chunk.texCoords);
+        std::vector<float>().swap(chunk.normals);
+        stats.faces += chunk.faces;
+        cornerTotal += chunk.corners.size() / 3;
+    }
+    const uint32_t positionCount = static_cast<uint32_t>(positions.size() / 3);
+    const uint32_t texCoordCount = static_cast<uint32_t>(texCoords.size() / 2);
+    const uint32_t normalCount = static_cast<uint32_t>(normals.size() / 3);
+    stats.positions = positionCount;
+    stats.texCoords = texCoordCount;
+    stats.normals = normalCount;
+    stats.corners = static_cast<uint32_t>(cornerTotal);
+
+    ForEach(settings.jobSystem, count, 1, [&](uint32_t i) {
+        ObjChunk& chunk = chunks[i];
+        for (size_t c = 0; c < chunk.corners.size(); c += 3) {
+            uint32_t* corner = chunk.corners.data() + c;
+            corner[0] = Resolve(corner[0], chunk.positionBase, positionCount);
+            corner[1] = Resolve(corner[1], chunk.texCoordBase, texCoordCount);
+            corner[2] = Resolve(corner[2], chunk.normalBase, normalCount);
+        }
+    });
+
+    // Deduplicate corners in file order, grouping triangles by material
+    std::vector<uint32_t> keys;
+    keys.reserve(static_cast<size_t>(positionCount) * 3);
+    CornerTable table(positionCount);
+    std::vector<std::string> materialNames(1);
+    std::vector<std::vector<uint32_t>> materialIndices(1);
+    size_t material = 0;
+    bool allNormals = true;
+    bool allTexCoords = true;
+    for (const ObjChunk& chunk : chunks) {
+        size_t nextSwitch = 0;
+        for (size_t c = 0; c < chunk.corners.size(); c += 9) {
+            while (nextSwitch < chunk.materials.size() && chunk.materials[nextSwitch].corner <= c) {
+                const std::string& name = chunk.materials[nextSwitch++].name;
+                material = std::find(materialNames.begin(), materialNames.end(), name) - materialNames.begin();
+                if (material == materialNames.size()) {
+                    materialNames.push_back(name);
+                    materialIndices.emplace_back();
+                }
+            }
+            const uint32_t* triangle = chunk.corners.data() + c;
+            if (triangle[0] == kInvalid || triangle[1] == kInvalid || triangle[2] == kInvalid ||
+                triangle[3] == kInvalid || triangle[4] == kInvalid || triangle[5] == kInvalid ||
+                triangle[6] == kInvalid || triangle[7] == kInvalid || triangle[8] == kInvalid) {
+                ++stats.skippedTriangles;
+                continue;
+            }
+            std::vector<uint32_t>& indices = materialIndices[material];
+            for (int i = 0; i < 3; ++i) {
+                allTexCoords = allTexCoords && triangle[i * 3 + 1] != kMissing;
+                allNormals = allNormals && triangle[i * 3 + 2] != kMissing;
+                indices.push_back(table.findOrInsert(triangle + i * 3, keys));
+            }
+        }
+        // Trailing usemtl lines still select the material of the next chunk
+        while (nextSwitch < chunk.materials.size()) {
+            const std::string& name = chunk.materials[nextSwitch++].name;
+            material = std::find(materialNames.begin(), materialNames.end(), name) - materialNames.begin();
+            if (material == materialNames.size()) {
+                materialNames.push_back(name);
+                materialIndices.emplace_back();
+            }
+        }
+    }
+    chunks.clear();
+
+    for (size_t m = 0; m < materialIndices.size(); ++m) {
+        if (materialIndices[m].empty()) {
+            continue;
+        }
+        SubMesh subMesh;
+        subMesh.indexOffset = static_cast<uint32_t>(mesh.indices.size());
+        subMesh.indexCount = static_cast<uint32_t>(materialIndices[m].size());
+        subMesh.material = materialNames[m];
+        mesh.subMeshes.push_back(subMesh);
+        if (mesh.indices.empty()) {
+            mesh.indices.swap(materialIndices[m]);
+        } else {
+            mesh.indices.insert(mesh.indices.end(), materialIndices[m].begin(), materialIndices[m].end());
+        }
+        std::vector<uint32_t>().swap(materialIndices[m]);
+    }
+
+    // Build the interleaved vertices
+    const uint32_t vertexCount = static_cast<uint32_t>(keys.size() / 3);
+    mesh.vertices.resize(vertexCount);
+    ForEach(settings.jobSystem, (vertexCount + 4095) / 4096, 1, [&](uint32_t block) {
+        const uint32_t last = std::min(vertexCount, (block + 1) * 4096);
+        for (uint32_t v = block * 4096; v < last; ++v) {
+            const uint32_t* key = keys.data() + static_cast<size_t>(v) * 3;
+            MeshVertex& vertex = mesh.vertices[v];
+            std::memcpy(vertex.position, positions.data() + static_cast<size_t>(key[0]) * 3, sizeof(vertex.position));
+            if (key[2] != kMissing) {
+                std::memcpy(vertex.normal, normals.data() + static_cast<size_t>(key[2]) * 3, sizeof(vertex.normal));
+            } else {
+                vertex.normal[0] = vertex.normal[1] = vertex.normal[2] = 0.0f;
+            }
+            if (key[1] != kMissing) {
+                std::memcpy(vertex.texCoord, texCoords.data() + static_cast<size_t>(key[1]) * 2,
+                            sizeof(vertex.texCoord));
+            } else {
+                vertex.texCoord[0] = vertex.texCoord[1] = 0.0f;
+            }
+        }
+    });
+
+    mesh.hasTexCoords = allTexCoords && !mesh.indices.empty();
+    mesh.hasNormals = allNormals && !mesh.indices.empty();
+    if (!mesh.hasNormals && settings.generateNormals && !mesh.indices.empty()) {
+        // Area-weighted normals accumulated per position, so texture seams stay smooth
+        std::vector<float> accumulated(positions.size(), 0.0f);
+        for (size_t t = 0; t < mesh.indices.size(); t += 3) {
+            const uint32_t* corner[3];
+            for (int i = 0; i < 3; ++i) {
+                corner[i] = keys.data() + static_cast<size_t>(mesh.indices[t + i]) * 3;
+            }
+            const float* p0 = positions.data() + static_cast<size_t>(corner[0][0]) * 3;
+            const float* p1 = positions.data() + static_cast<size_t>(corner[1][0]) * 3;
+            const float* p2 = positions.data() + static_cast<size_t>(corner[2][0]) * 3;
+            const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                                 e1[0] * e2[1] - e1[1] * e2[0] };
+            for (int i = 0; i < 3; ++i) {
+                float* target = accumulated.data() + static_cast<size_t>(corner[i][0]) * 3;
+                target[0] += n[0];
+                target[1] += n[1];
+                target[2] += n[2];
+            }
+        }
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const uint32_t* key = keys.data() + static_cast<size_t>(v) * 3;
+            MeshVertex& vertex = mesh.vertices[v];
+            if (key[2] != kMissing) {
+                continue;
+            }
+            const float* n = accumulated.data() + static_cast<size_t>(key[0]) * 3;
+            const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (length > 0.0f) {
+                vertex.normal[0] = n[0] / length;
+                vertex.normal[1] = n[1] / length;
+                vertex.normal[2] = n[2] / length;
+            }
+        }
+        mesh.hasNormals = true;
+    }
+    mesh.ComputeBounds();
+
+    if (outStats) {
+        *outStats = stats;
+    }
+    if (mesh.indices.empty()) {
+        return false;
+    }
+    outMesh = std::move(mesh);
+    return true;
+}
+
+const char* ObjLoader::ParseFloat(const char* begin, const char* end, float& outValue) {
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;         // Significant digits in mantissa
+    int exponent = 0;
+    bool exact = true;      // No digits were dropped
+    bool any = false;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+        any = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            digits += mantissa != 0;
+        } else {
+            ++exponent;
+            exact = exact && *p == '0';
+        }
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        for (; p < end && *p >= '0' && *p <= '9'; ++p) {
+            any = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                digits += mantissa != 0;
+                --exponent;
+            } else {
+                exact = exact && *p == '0';
+            }
+        }
+    }
+
+    if (any && p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negativeExponent = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            negativeExponent = *q == '-';
+            ++q;
+        }
+        if (q < end && *q >= '0' && *q <= '9') {
+            int value = 0;
+            for (; q < end && *q >= '0' && *q <= '9'; ++q) {
+                value = std::min(value * 10 + (*q - '0'), 100000);
+            }
+            exponent += negativeExponent ? -value : value;
+            p = q;
+        }
+    }
+
+    if (any && exact) {
+        // Both operands exact, so one IEEE operation rounds correctly
+        if (mantissa <= (1u << 24) && exponent >= -10 && exponent <= 10) {
+            const float value = static_cast<float>(mantissa);
+            const float result = exponent < 0 ? value / kPow10f[-exponent] : value * kPow10f[exponent];
+            outValue = negative ? -result : result;
+            return p;
+        }
+        if (mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+            const double value = static_cast<double>(mantissa);
+            const double result = exponent < 0 ? value / kPow10[-exponent] : value * kPow10[exponent];
+            // Rounding the double again is exact unless it sits on a float midpoint
+            uint64_t bits;
+            std::memcpy(&bits, &result, sizeof(bits));
+            if ((bits & 0x1FFFFFFFu) != 0x10000000u &&
+                (result == 0.0 || (result >= FLT_MIN && result <= FLT_MAX))) {
+                outValue = static_cast<float>(negative ? -result : result);
+                return p;
+            }
+        }
+    }
+
+    // Slow path on a null-terminated copy of the token
+    const char* tokenEnd = begin;
+    while (tokenEnd < end && !IsSpace(*tokenEnd) && *tokenEnd != '\n' && *tokenEnd != '/') {
+        ++tokenEnd;
+    }
+    char buffer[128];
+    const size_t length = std::min<size_t>(static_cast<size_t>(tokenEnd - begin), sizeof(buffer) - 1);
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char* parsedEnd = nullptr;
+    const float value = std::strtof(buffer, &parsedEnd);
+    if (parsedEnd == buffer) {
+        return begin;
+    }
+    outValue = value;
+    return begin + (parsedEnd - buffer);
+}
+
+} // namespace Graphics
+} // namespace OGDE
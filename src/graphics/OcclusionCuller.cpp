@@ -0,0 +1,433 @@
+/**
+ * @file OcclusionCuller.cpp
+ * @brief CPU software occlusion culling implementation
+ */
+
+#include "ogde/graphics/OcclusionCuller.h"
+#include "ogde/graphics/Camera.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/platform/CpuFeatures.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+// Rows rasterized by one job; triangles are binned to the bands they touch
+constexpr uint32_t kBandHeight = 16;
+
+// Objects tested per job in testAabbs()
+constexpr uint32_t kTestGrainSize = 512;
+
+inline void transformPoint(const float* m, float x, float y, float z, float* out) {
+    out[0] = x * m[0] + y * m[4] + z * m[8] + m[12];
+    out[1] = x * m[1] + y * m[5] + z * m[9] + m[13];
+    out[2] = x * m[2] + y * m[6] + z * m[10] + m[14];
+    out[3] = x * m[3] + y * m[7] + z * m[11] + m[15];
+}
+
+} // namespace
+
+OcclusionCuller::OcclusionCuller(uint32_t width, uint32_t height)
+    : m_width((std::max(width, 8u) + 7) & ~7u)
+    , m_height((std::max(height, 8u) + 7) & ~7u)
+    , m_jobSystem(nullptr)
+{
+    std::memset(m_viewProjection, 0, sizeof(m_viewProjection));
+
+    // Allocate the full pyramid down to 1x1
+    uint32_t levelWidth = m_width;
+    uint32_t levelHeight = m_height;
+    for (;;) {
+        Level level;
+        level.width = levelWidth;
+        level.height = levelHeight;
+        level.depth.assign(static_cast<size_t>(levelWidth) * levelHeight, 1.0f);
+        m_levels.push_back(std::move(level));
+        if (levelWidth == 1 && levelHeight == 1) {
+            break;
+        }
+        levelWidth = (levelWidth + 1) / 2;
+        levelHeight = (levelHeight + 1) / 2;
+    }
+
+    m_bandBins.resize((m_height + kBandHeight - 1) / kBandHeight);
+}
+
+OcclusionCuller::~OcclusionCuller() {
+}
+
+void OcclusionCuller::beginFrame(const Camera& camera) {
+    std::memcpy(m_viewProjection, camera.getViewProjectionMatrix(), sizeof(m_viewProjection));
+    m_triangles.clear();
+    m_stats = OcclusionStats();
+}
+
+void OcclusionCuller::addOccluder(const float* positions, uint32_t vertexCount,
+                                  const uint32_t* indices, uint32_t indexCount,
+                                  const float* worldMatrix) {
+    if (!positions || !indices || vertexCount == 0) {
+        return;
+    }
+
+    // Combine object and camera transforms so each vertex is transformed once
+    float transform[16];
+    if (worldMatrix) {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                transform[i * 4 + j] = 0.0f;
+                for (int k = 0; k < 4; ++k) {
+                    transform[i * 4 + j] += worldMatrix[i * 4 + k] * m_viewProjection[k * 4 + j];
+                }
+            }
+        }
+    } else {
+        std::memcpy(transform, m_viewProjection, sizeof(transform));
+    }
+
+    std::vector<float> clip(static_cast<size_t>(vertexCount) * 4);
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        transformPoint(transform, positions[v * 3 + 0], positions[v * 3 + 1], positions[v * 3 + 2],
+                       &clip[static_cast<size_t>(v) * 4]);
+    }
+
+    const float width = static_cast<float>(m_width);
+    const float height = static_cast<float>(m_height);
+
+    for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+        m_stats.occluderTriangles++;
+
+        ScreenTriangle tri;
+        bool rejected = false;
+        for (int corner = 0; corner < 3 && !rejected; ++corner) {
+            uint32_t index = indices[i + corner];
+            if (index >= vertexCount) {
+                rejected = true;
+                break;
+            }
+            const float* c = &clip[static_cast<size_t>(index) * 4];
+            // In front of the near plane (or behind the eye): skip rather than clip
+            if (c[2] < 0.0f || c[3] <= 1e-6f) {
+                rejected = true;
+                break;
+            }
+            float invW = 1.0f / c[3];
+            tri.x[corner] = (c[0] * invW * 0.5f + 0.5f) * width;
+            tri.y[corner] = (0.5f - c[1] * invW * 0.5f) * height;
+            tri.z[corner] = c[2] * invW;
+        }
+        if (rejected) {
+            continue;
+        }
+
+        float minX = std::min({ tri.x[0], tri.x[1], tri.x[2] });
+        float maxX = std::max({ tri.x[0], tri.x[1], tri.x[2] });
+        float minY = std::min({ tri.y[0], tri.y[1], tri.y[2] });
+        float maxY = std::max({ tri.y[0], tri.y[1], tri.y[2] });
+        float minZ = std::min({ tri.z[0], tri.z[1], tri.z[2] });
+        if (maxX < 0.0f || minX > width || maxY < 0.0f || minY > height || minZ > 1.0f) {
+            continue;
+        }
+
+        m_triangles.push_back(tri);
+        m_stats.rasterizedTriangles++;
+    }
+}
+
+void OcclusionCuller::addOccluderBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) {
+    const float positions[24] = {
+        minX, minY, minZ,  maxX, minY, minZ,  maxX, maxY, minZ,  minX, maxY, minZ,
+        minX, minY, maxZ,  maxX, minY, maxZ,  maxX, maxY, maxZ,  minX, maxY, maxZ
+    };
+    static const uint32_t indices[36] = {
+        0, 2, 1,  0, 3, 2,   // -Z
+        4, 5, 6,  4, 6, 7,   // +Z
+        0, 4, 7,  0, 7, 3,   // -X
+        1, 2, 6,  1, 6, 5,   // +X
+        0, 1, 5,  0, 5, 4,   // -Y
+        3, 7, 6,  3, 6, 2    // +Y
+    };
+    addOccluder(positions, 8, indices, 36);
+}
+
+void OcclusionCuller::rasterize() {
+    std::fill(m_levels[0].depth.begin(), m_levels[0].depth.end(), 1.0f);
+
+    // Bin triangles into the row bands they overlap
+    for (std::vector<uint32_t>& bin : m_bandBins) {
+        bin.clear();
+    }
+    const uint32_t bandCount = static_cast<uint32_t>(m_bandBins.size());
+    for (uint32_t t = 0; t < m_triangles.size(); ++t) {
+        const ScreenTriangle& tri = m_triangles[t];
+        float minY = std::min({ tri.y[0], tri.y[1], tri.y[2] });
+        float maxY = std::max({ tri.y[0], tri.y[1], tri.y[2] });
+        int firstRow = std::max(0, static_cast<int>(std::floor(minY)));
+        int lastRow = std::min(static_cast<int>(m_height) - 1, static_cast<int>(std::ceil(maxY)));
+        if (lastRow < firstRow) {
+            continue;
+        }
+        uint32_t firstBand = static_cast<uint32_t>(firstRow) / kBandHeight;
+        uint32_t lastBand = std::min(static_cast<uint32_t>(lastRow) / kBandHeight, bandCount - 1);
+        for (uint32_t band = firstBand; band <= lastBand; ++band) {
+            m_bandBins[band].push_back(t);
+        }
+    }
+
+    // Bands own disjoint rows, so they can be rasterized concurrently without locking
+    if (m_jobSystem) {
+        m_jobSystem->parallelFor(bandCount, 1, [this](uint32_t begin, uint32_t end) {
+            for (uint32_t band = begin; band < end; ++band) {
+                rasterizeBand(band);
+            }
+        });
+    } else {
+        for (uint32_t band = 0; band < bandCount; ++band) {
+            rasterizeBand(band);
+        }
+    }
+
+    buildPyramid();
+}
+
+void OcclusionCuller::rasterizeBand(uint32_t band) {
+    uint32_t rowBegin = band * kBandHeight;
+    uint32_t rowEnd = std::min(rowBegin + kBandHeight, m_height);
+    for (uint32_t t : m_bandBins[band]) {
+        rasterizeTriangle(m_triangles[t], rowBegin, rowEnd);
+    }
+}
+
+void OcclusionCuller::rasterizeTriangle(const ScreenTriangle& input, uint32_t rowBegin, uint32_t rowEnd) {
+    float x0 = input.x[0], y0 = input.y[0], z0 = input.z[0];
+    float x1 = input.x[1], y1 = input.y[1], z1 = input.z[1];
+    float x2 = input.x[2], y2 = input.y[2], z2 = input.z[2];
+
+    // Occluders are treated as double-sided: normalize to positive area
+    float area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+    if (area < 0.0f) {
+        std::swap(x1, x2);
+        std::swap(y1, y2);
+        std::swap(z1, z2);
+        area = -area;
+    }
+    if (area < 1e-8f) {
+        return;
+    }
+
+    // Edge functions E(p) = A * px + B * py + C, non-negative inside
+    float a0 = y1 - y2, b0 = x2 - x1, c0 = -a0 * x1 - b0 * y1;
+    float a1 = y2 - y0, b1 = x0 - x2, c1 = -a1 * x2 - b1 * y2;
+    float a2 = y0 - y1, b2 = x1 - x0, c2 = -a2 * x0 - b2 * y0;
+
+    // Depth plane from barycentric interpolation
+    float invArea = 1.0f / area;
+    float za = (a0 * z0 + a1 * z1 + a2 * z2) * invArea;
+    float zb = (b0 * z0 + b1 * z1 + b2 * z2) * invArea;
+    float zc = (c0 * z0 + c1 * z1 + c2 * z2) * invArea;
+
+    int minX = std::max(0, static_cast<int>(std::floor(std::min({ x0, x1, x2 }))));
+    int maxX = std::min(static_cast<int>(m_width) - 1, static_cast<int>(std::ceil(std::max({ x0, x1, x2 }))));
+    int minY = std::max(static_cast<int>(rowBegin), static_cast<int>(std::floor(std::min({ y0, y1, y2 }))));
+    int maxY = std::min(static_cast<int>(rowEnd) - 1, static_cast<int>(std::ceil(std::max({ y0, y1, y2 }))));
+    if (minX > maxX || minY > maxY) {
+        return;
+    }
+    minX &= ~3;  // Start on a 4-pixel boundary; the buffer width is a multiple of 8
+
+    float* depth = m_levels[0].depth.data();
+
+#ifdef OGDE_ARCH_X86
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 stepE0 = _mm_set1_ps(a0 * 4.0f);
+    const __m128 stepE1 = _mm_set1_ps(a1 * 4.0f);
+    const __m128 stepE2 = _mm_set1_ps(a2 * 4.0f);
+    const __m128 stepZ = _mm_set1_ps(za * 4.0f);
+
+    for (int y = minY; y <= maxY; ++y) {
+        float py = static_cast<float>(y) + 0.5f;
+        __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(minX)), laneOffsets);
+        __m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a0), px), _mm_set1_ps(b0 * py + c0));
+        __m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a1), px), _mm_set1_ps(b1 * py + c1));
+        __m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a2), px), _mm_set1_ps(b2 * py + c2));
+        __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(za), px), _mm_set1_ps(zb * py + zc));
+
+        float* row = depth + static_cast<size_t>(y) * m_width;
+        for (int x = minX; x <= maxX; x += 4) {
+            __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)),
+                                       _mm_cmpge_ps(e2, zero));
+            if (_mm_movemask_ps(inside) != 0) {
+                __m128 current = _mm_loadu_ps(row + x);
+                __m128 nearest = _mm_min_ps(current, z);
+                _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+            }
+            e0 = _mm_add_ps(e0, stepE0);
+            e1 = _mm_add_ps(e1, stepE1);
+            e2 = _mm_add_ps(e2, stepE2);
+            z = _mm_add_ps(z, stepZ);
+        }
+    }
+#else
+    for (int y = minY; y <= maxY; ++y) {
+        float py = static_cast<float>(y) + 0.5f;
+        float* row = depth + static_cast<size_t>(y) * m_width;
+        for (int x = minX; x <= maxX; ++x) {
+            float px = static_cast<float>(x) + 0.5f;
+            if (a0 * px + b0 * py + c0 >= 0.0f && a1 * px + b1 * py + c1 >= 0.0f &&
+                a2 * px + b2 * py + c2 >= 0.0f) {
+                row[x] = std::min(row[x], za * px + zb * py + zc);
+            }
+        }
+    }
+#endif
+}
+
+void OcclusionCuller::buildPyramid() {
+    // Each texel keeps the farthest occluder depth of the 2x2 block below it, so a
+    // box nearer than that value may be visible somewhere in the block
+    for (size_t l = 1; l < m_levels.size(); ++l) {
+        const Level& source = m_levels[l - 1];
+        Level& target = m_levels[l];
+        for (uint32_t y = 0; y < target.height; ++y) {
+            uint32_t sy0 = std::min(y * 2, source.height - 1);
+            uint32_t sy1 = std::min(y * 2 + 1, source.height - 1);
+            const float* row0 = source.depth.data() + static_cast<size_t>(sy0) * source.width;
+            const float* row1 = source.depth.data() + static_cast<size_t>(sy1) * source.width;
+            float* out = target.depth.data() + static_cast<size_t>(y) * target.width;
+            for (uint32_t x = 0; x < target.width; ++x) {
+                uint32_t sx0 = std::min(x * 2, source.width - 1);
+                uint32_t sx1 = std::min(x * 2 + 1, source.width - 1);
+                out[x] = std::max(std::max(row0[sx0], row0[sx1]), std::max(row1[sx0], row1[sx1]));
+            }
+        }
+    }
+}
+
+bool OcclusionCuller::isVisible(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) const {
+    const float width = static_cast<float>(m_width);
+    const float height = static_cast<float>(m_height);
+
+    float screenMinX = 1e30f, screenMaxX = -1e30f;
+    float screenMinY = 1e30f, screenMaxY = -1e30f;
+    float nearestDepth = 1e30f;
+
+    for (int corner = 0; corner < 8; ++corner) {
+        float clip[4];
+        transformPoint(m_viewProjection,
+                       (corner & 1) ? maxX : minX,
+                       (corner & 2) ? maxY : minY,
+                       (corner & 4) ? maxZ : minZ, clip);
+        // Crossing the near plane: the box surrounds or touches the eye
+        if (clip[2] < 0.0f || clip[3] <= 1e-6f) {
+            return true;
+        }
+        float invW = 1.0f / clip[3];
+        float sx = (clip[0] * invW * 0.5f + 0.5f) * width;
+        float sy = (0.5f - clip[1] * invW * 0.5f) * height;
+        screenMinX = std::min(screenMinX, sx);
+        screenMaxX = std::max(screenMaxX, sx);
+        screenMinY = std::min(screenMinY, sy);
+        screenMaxY = std::max(screenMaxY, sy);
+        nearestDepth = std::min(nearestDepth, clip[2] * invW);
+    }
+
+    // Off-screen boxes are left to frustum culling
+    if (screenMaxX < 0.0f || screenMinX >= width || screenMaxY < 0.0f || screenMinY >= height) {
+        return true;
+    }
+
+    uint32_t x0 = static_cast<uint32_t>(std::max(0.0f, std::floor(screenMinX)));
+    uint32_t x1 = static_cast<uint32_t>(std::min(width - 1.0f, std::floor(screenMaxX)));
+    uint32_t y0 = static_cast<uint32_t>(std::max(0.0f, std::floor(screenMinY)));
+    uint32_t y1 = static_cast<uint32_t>(std::min(height - 1.0f, std::floor(screenMaxY)));
+
+    // Pick the level where the rectangle spans at most a few texels
+    uint32_t extent = std::max(x1 - x0, y1 - y0);
+    uint32_t level = 0;
+    while ((extent >> level) > 1 && level + 1 < m_levels.size()) {
+        level++;
+    }
+
+    const Level& pyramid = m_levels[level];
+    uint32_t lx0 = std::min(x0 >> level, pyramid.width - 1);
+    uint32_t lx1 = std::min(x1 >> level, pyramid.width - 1);
+    uint32_t ly0 = std::min(y0 >> level, pyramid.height - 1);
+    uint32_t ly1 = std::min(y1 >> level, pyramid.height - 1);
+    for (uint32_t y = ly0; y <= ly1; ++y) {
+        const float* row = pyramid.depth.data() + static_cast<size_t>(y) * pyramid.width;
+        for (uint32_t x = lx0; x <= lx1; ++x) {
+            if (nearestDepth <= row[x]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint32_t OcclusionCuller::testAabbs(const AabbBatch& boxes, const uint32_t* candidates, uint32_t candidateCount,
+                                    uint32_t* outVisible) {
+    if (!candidates || !outVisible || candidateCount == 0) {
+        return 0;
+    }
+
+    auto testRange = [&](uint32_t begin, uint32_t end, uint32_t* out) {
+        uint32_t written = 0;
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t index = candidates[i];
+            float cx = boxes.centerX()[index], cy = boxes.centerY()[index], cz = boxes.centerZ()[index];
+            float ex = boxes.extentX()[index], ey = boxes.extentY()[index], ez = boxes.extentZ()[index];
+            if (isVisible(cx - ex, cy - ey, cz - ez, cx + ex, cy + ey, cz + ez)) {
+                out[written++] = index;
+            }
+        }
+        return written;
+    };
+
+    uint32_t visibleCount = 0;
+    if (!m_jobSystem || candidateCount <= kTestGrainSize) {
+        visibleCount = testRange(0, candidateCount, outVisible);
+    } else {
+        // Each range compacts into its own slot, then slots are joined in input order
+        uint32_t rangeCount = (candidateCount + kTestGrainSize - 1) / kTestGrainSize;
+        std::vector<uint32_t> scratch(candidateCount);
+        std::vector<uint32_t> rangeVisible(rangeCount);
+        m_jobSystem->parallelFor(rangeCount, 1, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t range = begin; range < end; ++range) {
+                uint32_t first = range * kTestGrainSize;
+                uint32_t last = std::min(first + kTestGrainSize, candidateCount);
+                rangeVisible[range] = testRange(first, last, scratch.data() + first);
+            }
+        });
+        for (uint32_t range = 0; range < rangeCount; ++range) {
+            std::memcpy(outVisible + visibleCount, scratch.data() + range * kTestGrainSize,
+                        rangeVisible[range] * sizeof(uint32_t));
+            visibleCount += rangeVisible[range];
+        }
+    }
+
+    m_stats.testedObjects += candidateCount;
+    m_stats.occludedObjects += candidateCount - visibleCount;
+    return visibleCount;
+}
+
+const float* OcclusionCuller::getDepthLevel(uint32_t level, uint32_t& outWidth, uint32_t& outHeight) const {
+    if (level >= m_levels.size()) {
+        outWidth = 0;
+        outHeight = 0;
+        return nullptr;
+    }
+    outWidth = m_levels[level].width;
+    outHeight = m_levels[level].height;
+    return m_levels[level].depth.data();
+}
+
+} // namespace graphics
+} // namespace ogde
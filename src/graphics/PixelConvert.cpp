@@ -0,0 +1,517 @@
+/**
+ * Pixel Conversion Implementation
+ */
+
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/platform/CpuFeatures.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace OGDE {
+namespace Graphics {
+
+using ogde::platform::CpuFeatures;
+
+namespace {
+
+constexpr float kInv255 = 1.0f / 255.0f;
+
+struct ConversionTables {
+    // [0, 256): sRGB byte -> linear float, [256, 512): unorm byte -> float (alpha)
+    float decode[512];
+    // [0, 65536): linear * 65535 -> sRGB byte, [65536, 131072): the same index -> unorm byte (alpha)
+    uint8_t encode[131072];
+};
+
+const ConversionTables& GetTables() {
+    static const ConversionTables tables = []() {
+        ConversionTables t;
+        for (int i = 0; i < 256; ++i) {
+            double c = i / 255.0;
+            t.decode[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+            t.decode[256 + i] = static_cast<float>(i) * kInv255;
+        }
+        for (int i = 0; i < 65536; ++i) {
+            double l = i / 65535.0;
+            double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+            t.encode[i] = static_cast<uint8_t>(std::min(255.0, c * 255.0 + 0.5));
+            t.encode[65536 + i] = static_cast<uint8_t>(std::min(255.0, l * 255.0 + 0.5));
+        }
+        return t;
+    }();
+    return tables;
+}
+
+inline bool IsAlphaChannel(int channel, int channels) {
+    return (channels == 4 && channel == 3) || (channels == 2 && channel == 1);
+}
+
+inline int EncodeIndex(float value) {
+    value = std::min(1.0f, std::max(0.0f, value));
+    return static_cast<int>(std::nearbyint(value * 65535.0f));
+}
+
+// ---------------------------------------------------------------------------
+// Scalar kernels (also handle the tails of SIMD runs)
+// ---------------------------------------------------------------------------
+
+void RgbToRgbaScalar(const uint8_t* src, uint8_t* dst, size_t begin, size_t end, uint8_t alpha) {
+    for (size_t i = begin; i < end; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = alpha;
+    }
+}
+
+// Last pixel first, so each write lands beyond every byte still to be read
+void RgbToRgbaBackwardScalar(uint8_t* buffer, size_t begin, size_t end, uint8_t alpha) {
+    for (size_t i = end; i-- > begin;) {
+        uint8_t r = buffer[i * 3 + 0];
+        uint8_t g = buffer[i * 3 + 1];
+        uint8_t b = buffer[i * 3 + 2];
+        buffer[i * 4 + 0] = r;
+        buffer[i * 4 + 1] = g;
+        buffer[i * 4 + 2] = b;
+        buffer[i * 4 + 3] = alpha;
+    }
+}
+
+void SwizzleScalar(const uint8_t* src, uint8_t* dst, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        uint8_t r = src[i * 4 + 0];
+        uint8_t b = src[i * 4 + 2];
+        dst[i * 4 + 0] = b;
+        dst[i * 4 + 1] = src[i * 4 + 1];
+        dst[i * 4 + 2] = r;
+        dst[i * 4 + 3] = src[i * 4 + 3];
+    }
+}
+
+inline uint8_t MultiplyUnorm(uint32_t a, uint32_t b) {
+    // Exact round(a * b / 255)
+    uint32_t p = a * b + 128;
+    return static_cast<uint8_t>((p + (p >> 8)) >> 8);
+}
+
+void PremultiplyScalar(const uint8_t* src, uint8_t* dst, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        uint8_t alpha = src[i * 4 + 3];
+        dst[i * 4 + 0] = MultiplyUnorm(src[i * 4 + 0], alpha);
+        dst[i * 4 + 1] = MultiplyUnorm(src[i * 4 + 1], alpha);
+        dst[i * 4 + 2] = MultiplyUnorm(src[i * 4 + 2], alpha);
+        dst[i * 4 + 3] = alpha;
+    }
+}
+
+void UnormToFloatScalar(const uint8_t* src, float* dst, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        dst[i] = static_cast<float>(src[i]) * kInv255;
+    }
+}
+
+void FloatToUnormScalar(const float* src, uint8_t* dst, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float value = std::min(1.0f, std::max(0.0f, src[i]));
+        dst[i] = static_cast<uint8_t>(std::nearbyint(value * 255.0f));
+    }
+}
+
+void SrgbToLinearScalar(const uint8_t* src, float* dst, size_t begin, size_t end, int channels) {
+    const float* decode = GetTables().decode;
+    for (size_t i = begin; i < end; ++i) {
+        int channel = static_cast<int>(i % channels);
+        dst[i] = decode[src[i] + (IsAlphaChannel(channel, channels) ? 256 : 0)];
+    }
+}
+
+void LinearToSrgbScalar(const float* src, uint8_t* dst, size_t begin, size_t end, int channels) {
+    const uint8_t* encode = GetTables().encode;
+    for (size_t i = begin; i < end; ++i) {
+        int channel = static_cast<int>(i % channels);
+        dst[i] = encode[EncodeIndex(src[i]) + (IsAlphaChannel(channel, channels) ? 65536 : 0)];
+    }
+}
+
+#ifdef OGDE_ARCH_X86
+
+// ---------------------------------------------------------------------------
+// SSE2 / SSSE3 kernels
+// ---------------------------------------------------------------------------
+
+// Spreads 12 RGB bytes over 4 RGBA pixels; alpha slots are zeroed and OR-ed in later
+OGDE_TARGET_SSSE3
+inline __m128i RgbExpandMask() {
+    return _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+}
+
+// 16 pixels: all loads happen before any store, so dst may overlap src at a higher address
+OGDE_TARGET_SSSE3
+inline void RgbToRgbaBlockSsse3(const uint8_t* src, uint8_t* dst, __m128i mask, __m128i alpha) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+    __m128i p0 = _mm_shuffle_epi8(a, mask);
+    __m128i p1 = _mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), mask);
+    __m128i p2 = _mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), mask);
+    __m128i p3 = _mm_shuffle_epi8(_mm_srli_si128(c, 4), mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_or_si128(p0, alpha));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16), _mm_or_si128(p1, alpha));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 32), _mm_or_si128(p2, alpha));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 48), _mm_or_si128(p3, alpha));
+}
+
+OGDE_TARGET_SSSE3
+size_t RgbToRgbaSsse3(const uint8_t* src, uint8_t* dst, size_t count, uint8_t alpha) {
+    const __m128i mask = RgbExpandMask();
+    const __m128i alphaBits = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        RgbToRgbaBlockSsse3(src + i * 3, dst + i * 4, mask, alphaBits);
+    }
+    return i;
+}
+
+OGDE_TARGET_SSSE3
+void RgbToRgbaInPlaceSsse3(uint8_t* buffer, size_t blockCount, uint8_t alpha) {
+    const __m128i mask = RgbExpandMask();
+    const __m128i alphaBits = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+    for (size_t block = blockCount; block-- > 0;) {
+        RgbToRgbaBlockSsse3(buffer + block * 48, buffer + block * 64, mask, alphaBits);
+    }
+}
+
+OGDE_TARGET_SSSE3
+size_t SwizzleSsse3(const uint8_t* src, uint8_t* dst, size_t count) {
+    const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_shuffle_epi8(pixels, mask));
+    }
+    return i;
+}
+
+// Exact round(c * a / 255) on 16-bit lanes: ((p + (p >> 8)) >> 8) with p = c * a + 128
+inline __m128i MultiplyUnormSse2(__m128i color, __m128i alpha) {
+    __m128i p = _mm_add_epi16(_mm_mullo_epi16(color, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+// Per 16-bit lane multiplier: the pixel's alpha for color, 255 for alpha itself
+inline __m128i AlphaMultiplierSse2(__m128i pixels16) {
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels16, 0xFF), 0xFF);
+    const __m128i alphaLanes = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+    return _mm_or_si128(_mm_andnot_si128(alphaLanes, alpha), _mm_and_si128(alphaLanes, _mm_set1_epi16(255)));
+}
+
+size_t PremultiplySse2(const uint8_t* src, uint8_t* dst, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+        __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+        lo = MultiplyUnormSse2(lo, AlphaMultiplierSse2(lo));
+        hi = MultiplyUnormSse2(hi, AlphaMultiplierSse2(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+size_t UnormToFloatSse2(const uint8_t* src, float* dst, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(kInv255);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+    return i;
+}
+
+size_t FloatToUnormSse2(const float* src, uint8_t* dst, size_t count) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i v[4];
+        for (int k = 0; k < 4; ++k) {
+            __m128 value = _mm_min_ps(one, _mm_max_ps(_mm_loadu_ps(src + i + k * 4), zero));
+            // Round to nearest even, like std::nearbyint in the default rounding mode
+            v[k] = _mm_cvtps_epi32(_mm_mul_ps(value, scale));
+        }
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+    return i;
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels
+// ---------------------------------------------------------------------------
+
+// 16 pixels as two 256-bit halves; lane 1 of each load starts 8 bytes in, so its mask is offset by 4
+OGDE_TARGET_AVX2
+inline void RgbToRgbaBlockAvx2(const uint8_t* src, uint8_t* dst, __m256i mask, __m256i alpha) {
+    __m256i a = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8)), 1);
+    __m256i b = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 24))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32)), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_or_si256(_mm256_shuffle_epi8(a, mask), alpha));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), _mm256_or_si256(_mm256_shuffle_epi8(b, mask), alpha));
+}
+
+OGDE_TARGET_AVX2
+inline __m256i RgbExpandMaskAvx2() {
+    return _mm256_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128,
+                            4, 5, 6, -128, 7, 8, 9, -128, 10, 11, 12, -128, 13, 14, 15, -128);
+}
+
+OGDE_TARGET_AVX2
+size_t RgbToRgbaAvx2(const uint8_t* src, uint8_t* dst, size_t count, uint8_t alpha) {
+    const __m256i mask = RgbExpandMaskAvx2();
+    const __m256i alphaBits = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        RgbToRgbaBlockAvx2(src + i * 3, dst + i * 4, mask, alphaBits);
+    }
+    return i;
+}
+
+OGDE_TARGET_AVX2
+void RgbToRgbaInPlaceAvx2(uint8_t* buffer, size_t blockCount, uint8_t alpha) {
+    const __m256i mask = RgbExpandMaskAvx2();
+    const __m256i alphaBits = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+    for (size_t block = blockCount; block-- > 0;) {
+        RgbToRgbaBlockAvx2(buffer + block * 48, buffer + block * 64, mask, alphaBits);
+    }
+}
+
+OGDE_TARGET_AVX2
+size_t SwizzleAvx2(const uint8_t* src, uint8_t* dst, size_t count) {
+    const __m256i mask = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                          2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_shuffle_epi8(pixels, mask));
+    }
+    return i;
+}
+
+OGDE_TARGET_AVX2
+size_t PremultiplyAvx2(const uint8_t* src, uint8_t* dst, size_t count) {
+    // Broadcast each pixel's alpha byte to its color lanes, 255 to its alpha lane
+    const __m256i alphaShuffle = _mm256_setr_epi8(6, -128, 6, -128, 6, -128, -128, -128,
+                                                  14, -128, 14, -128, 14, -128, -128, -128,
+                                                  6, -128, 6, -128, 6, -128, -128, -128,
+                                                  14, -128, 14, -128, 14, -128, -128, -128);
+    const __m256i alphaLane = _mm256_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255);
+    const __m256i round = _mm256_set1_epi16(128);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+        __m256i lo = _mm256_unpacklo_epi8(pixels, _mm256_setzero_si256());
+        __m256i hi = _mm256_unpackhi_epi8(pixels, _mm256_setzero_si256());
+        __m256i alphaLo = _mm256_or_si256(_mm256_shuffle_epi8(lo, alphaShuffle), alphaLane);
+        __m256i alphaHi = _mm256_or_si256(_mm256_shuffle_epi8(hi, alphaShuffle), alphaLane);
+        __m256i pLo = _mm256_add_epi16(_mm256_mullo_epi16(lo, alphaLo), round);
+        __m256i pHi = _mm256_add_epi16(_mm256_mullo_epi16(hi, alphaHi), round);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(pLo, _mm256_srli_epi16(pLo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(pHi, _mm256_srli_epi16(pHi, 8)), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+OGDE_TARGET_AVX2
+size_t UnormToFloatAvx2(const uint8_t* src, float* dst, size_t count) {
+    const __m256 scale = _mm256_set1_ps(kInv255);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256i lo = _mm256_cvtepu8_epi32(bytes);
+        __m256i hi = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        _mm256_storeu_ps(dst + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    return i;
+}
+
+OGDE_TARGET_AVX2
+size_t FloatToUnormAvx2(const float* src, uint8_t* dst, size_t count) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(one, _mm256_max_ps(_mm256_loadu_ps(src + i), zero)), scale));
+        __m256i b = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(one, _mm256_max_ps(_mm256_loadu_ps(src + i + 8), zero)), scale));
+        // Packs interleave 128-bit lanes; undo with a cross-lane permute
+        __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+        __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
+    }
+    return i;
+}
+
+// Table offsets of 8 consecutive values: alpha lanes read the second half of the table
+OGDE_TARGET_AVX2
+inline __m256i AlphaOffsets(int channels, int alphaOffset) {
+    if (channels == 4) {
+        return _mm256_setr_epi32(0, 0, 0, alphaOffset, 0, 0, 0, alphaOffset);
+    }
+    if (channels == 2) {
+        return _mm256_setr_epi32(0, alphaOffset, 0, alphaOffset, 0, alphaOffset, 0, alphaOffset);
+    }
+    return _mm256_setzero_si256();
+}
+
+// Only called with runs of whole 8-value groups, so the channel pattern always starts at 0
+OGDE_TARGET_AVX2
+size_t SrgbToLinearAvx2(const uint8_t* src, float* dst, size_t count, int channels) {
+    const float* decode = GetTables().decode;
+    const __m256i offsets = AlphaOffsets(channels, 256);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i index = _mm256_add_epi32(
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i))), offsets);
+        _mm256_storeu_ps(dst + i, _mm256_i32gather_ps(decode, index, 4));
+    }
+    return i;
+}
+
+OGDE_TARGET_AVX2
+size_t LinearToSrgbAvx2(const float* src, uint8_t* dst, size_t count, int channels) {
+    const uint8_t* encode = GetTables().encode;
+    const __m256i offsets = AlphaOffsets(channels, 65536);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(65535.0f);
+    alignas(32) int32_t index[8];
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        // maxps returns its second operand when either is NaN, so NaN clamps to 0 like the scalar path
+        __m256 value = _mm256_min_ps(one, _mm256_max_ps(_mm256_loadu_ps(src + i), zero));
+        __m256i lookup = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(value, scale)), offsets);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(index), lookup);
+        for (int k = 0; k < 8; ++k) {
+            dst[i + k] = encode[index[k]];
+        }
+    }
+    return i;
+}
+
+#endif // OGDE_ARCH_X86
+
+// Channel layouts whose pattern repeats every 8 values
+inline bool HasVectorPattern(int channels) {
+    return channels == 1 || channels == 2 || channels == 4;
+}
+
+} // namespace
+
+void PixelConverter::RgbToRgba(const uint8_t* src, uint8_t* dst, size_t pixelCount, uint8_t alpha) {
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    if (CpuFeatures::hasAVX2()) {
+        done = RgbToRgbaAvx2(src, dst, pixelCount, alpha);
+    } else if (CpuFeatures::hasSSSE3()) {
+        done = RgbToRgbaSsse3(src, dst, pixelCount, alpha);
+    }
+#endif
+    RgbToRgbaScalar(src, dst, done, pixelCount, alpha);
+}
+
+void PixelConverter::RgbToRgbaInPlace(uint8_t* buffer, size_t pixelCount, uint8_t alpha) {
+    // The tail goes first: it sits above every block in both layouts
+    size_t blocks = 0;
+#ifdef OGDE_ARCH_X86
+    if (CpuFeatures::hasSSSE3()) {
+        blocks = pixelCount / 16;
+    }
+#endif
+    RgbToRgbaBackwardScalar(buffer, blocks * 16, pixelCount, alpha);
+#ifdef OGDE_ARCH_X86
+    if (blocks > 0 && CpuFeatures::hasAVX2()) {
+        RgbToRgbaInPlaceAvx2(buffer, blocks, alpha);
+    } else if (blocks > 0) {
+        RgbToRgbaInPlaceSsse3(buffer, blocks, alpha);
+    }
+#endif
+}
+
+void PixelConverter::SwizzleRgbaBgra(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    if (CpuFeatures::hasAVX2()) {
+        done = SwizzleAvx2(src, dst, pixelCount);
+    } else if (CpuFeatures::hasSSSE3()) {
+        done = SwizzleSsse3(src, dst, pixelCount);
+    }
+#endif
+    SwizzleScalar(src, dst, done, pixelCount);
+}
+
+void PixelConverter::PremultiplyAlpha(const uint8_t* src, uint8_t* dst, size_t pixelCount) {
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    done = CpuFeatures::hasAVX2() ? PremultiplyAvx2(src, dst, pixelCount) : PremultiplySse2(src, dst, pixelCount);
+#endif
+    PremultiplyScalar(src, dst, done, pixelCount);
+}
+
+void PixelConverter::UnormToFloat(const uint8_t* src, float* dst, size_t valueCount) {
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    done = CpuFeatures::hasAVX2() ? UnormToFloatAvx2(src, dst, valueCount) : UnormToFloatSse2(src, dst, valueCount);
+#endif
+    UnormToFloatScalar(src, dst, done, valueCount);
+}
+
+void PixelConverter::FloatToUnorm(const float* src, uint8_t* dst, size_t valueCount) {
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    done = CpuFeatures::hasAVX2() ? FloatToUnormAvx2(src, dst, valueCount) : FloatToUnormSse2(src, dst, valueCount);
+#endif
+    FloatToUnormScalar(src, dst, done, valueCount);
+}
+
+void PixelConverter::SrgbToLinear(const uint8_t* src, float* dst, size_t pixelCount, int channels) {
+    const size_t valueCount = pixelCount * channels;
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    if (HasVectorPattern(channels) && CpuFeatures::hasAVX2()) {
+        done = SrgbToLinearAvx2(src, dst, valueCount, channels);
+    }
+#endif
+    SrgbToLinearScalar(src, dst, done, valueCount, channels);
+}
+
+void PixelConverter::LinearToSrgb(const float* src, uint8_t* dst, size_t pixelCount, int channels) {
+    const size_t valueCount = pixelCount * channels;
+    size_t done = 0;
+#ifdef OGDE_ARCH_X86
+    if (HasVectorPattern(channels) && CpuFeatures::hasAVX2()) {
+        done = LinearToSrgbAvx2(src, dst, valueCount, channels);
+    }
+#endif
+    LinearToSrgbScalar(src, dst, done, valueCount, channels);
+}
+
+} // namespace Graphics
+} // namespace OGDE
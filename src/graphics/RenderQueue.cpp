@@ -0,0 +1,222 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief Sort-key based draw queue implementation
+ */
+
+#include "ogde/graphics/RenderQueue.h"
+#include <algorithm>
+#include <cstring>
+
+namespace ogde {
+namespace graphics {
+
+namespace RenderKey {
+
+namespace {
+
+constexpr uint32_t kDepthMax = (1u << kDepthBits) - 1;
+
+uint64_t field(uint32_t value, uint32_t bits, uint32_t shift) {
+    return static_cast<uint64_t>(value & ((1u << bits) - 1)) << shift;
+}
+
+} // namespace
+
+uint32_t quantizeDepth(float depth) {
+    // Negated comparisons also send NaN to 0
+    if (!(depth > 0.0f)) {
+        return 0;
+    }
+    if (depth >= 1.0f) {
+        return kDepthMax;
+    }
+    return static_cast<uint32_t>(depth * static_cast<float>(kDepthMax));
+}
+
+uint64_t opaque(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, float depth) {
+    return field(pass, kPassBits, 60) |
+           field(layer, kLayerBits, 52) |
+           field(shader, kShaderBits, 40) |
+           field(material, kMaterialBits, 24) |
+           field(quantizeDepth(depth), kDepthBits, 0);
+}
+
+uint64_t translucent(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, float depth) {
+    return field(pass, kPassBits, 60) |
+           field(layer, kLayerBits, 52) |
+           field(kDepthMax - quantizeDepth(depth), kDepthBits, 28) |
+           field(shader, kShaderBits, 16) |
+           field(material, kMaterialBits, 0);
+}
+
+uint64_t instanced(uint32_t pass, uint32_t layer, uint32_t shader, uint32_t material, uint32_t geometry) {
+    return field(pass, kPassBits, 60) |
+           field(layer, kLayerBits, 52) |
+           field(shader, kShaderBits, 40) |
+           field(material, kMaterialBits, 24) |
+           field(geometry, kDepthBits, 0);
+}
+
+} // namespace RenderKey
+
+namespace {
+
+// 11-bit digits sort 64-bit keys in six passes with an L1-sized histogram each
+constexpr int kRadixBits = 11;
+constexpr int kRadixPasses = (64 + kRadixBits - 1) / kRadixBits;
+constexpr uint32_t kRadixBuckets = 1u << kRadixBits;
+constexpr uint64_t kRadixMask = kRadixBuckets - 1;
+
+} // namespace
+
+RenderQueue::RenderQueue() = default;
+
+RenderQueue::~RenderQueue() = default;
+
+void RenderQueue::clear() {
+    m_items.clear();
+    m_order.clear();
+}
+
+void RenderQueue::reserve(size_t count) {
+    m_items.reserve(count);
+    m_order.reserve(count);
+    m_scratch.reserve(count);
+}
+
+void RenderQueue::add(const DrawItem& item) {
+    m_order.push_back({ item.key, static_cast<uint32_t>(m_items.size()), 0 });
+    m_items.push_back(item);
+}
+
+void RenderQueue::sort() {
+    radixSort(m_order, m_scratch);
+}
+
+RenderQueueStats RenderQueue::submit(RenderQueueSink& sink) const {
+    return submit(sink, 0, m_order.size());
+}
+
+RenderQueueStats RenderQueue::submit(RenderQueueSink& sink, size_t first, size_t count) const {
+    RenderQueueStats stats;
+    const size_t end = first + std::min(count, m_order.size() - std::min(first, m_order.size()));
+
+    const DrawItem* previous = nullptr;
+    for (size_t i = first; i < end; ++i) {
+        const DrawItem& item = m_items[m_order[i].index];
+        bindState(sink, previous, item, stats);
+        sink.draw(item);
+        ++stats.draws;
+        stats.instances += item.instanceCount;
+        previous = &item;
+    }
+    return stats;
+}
+
+RenderQueueStats RenderQueue::submitInstanced(RenderQueueSink& sink, std::vector<uint32_t>& instanceIds) const {
+    RenderQueueStats stats;
+    instanceIds.clear();
+    instanceIds.reserve(m_order.size());
+
+    const DrawItem* previous = nullptr;
+    size_t i = 0;
+    while (i < m_order.size()) {
+        const DrawItem& item = m_items[m_order[i].index];
+        DrawItem batch = item;
+        batch.startInstance = static_cast<uint32_t>(instanceIds.size());
+        instanceIds.push_back(item.userData);
+
+        // Extend the run while the next draw differs only in its userData
+        size_t next = i + 1;
+        for (; next < m_order.size(); ++next) {
+            const DrawItem& other = m_items[m_order[next].index];
+            if (other.pass != item.pass || other.shader != item.shader || other.material != item.material ||
+                other.geometry != item.geometry || other.vertexCount != item.vertexCount ||
+                other.startVertex != item.startVertex || other.indexCount != item.indexCount ||
+                other.startIndex != item.startIndex) {
+                break;
+            }
+            instanceIds.push_back(other.userData);
+        }
+        batch.instanceCount = static_cast<uint32_t>(next - i);
+
+        bindState(sink, previous, item, stats);
+        sink.draw(batch);
+        ++stats.draws;
+        stats.instances += batch.instanceCount;
+        previous = &item;
+        i = next;
+    }
+    return stats;
+}
+
+void RenderQueue::bindState(RenderQueueSink& sink, const DrawItem* previous, const DrawItem& item,
+                            RenderQueueStats& stats) {
+    const bool newPass = !previous || item.pass != previous->pass;
+    if (newPass) {
+        sink.bindPass(item.pass);
+        ++stats.passChanges;
+    }
+    if (newPass || item.shader != previous->shader) {
+        sink.bindShader(item.shader);
+        ++stats.shaderChanges;
+    }
+    if (newPass || item.material != previous->material) {
+        sink.bindMaterial(item.material);
+        ++stats.materialChanges;
+    }
+    if (newPass || item.geometry != previous->geometry) {
+        sink.bindGeometry(item.geometry);
+        ++stats.geometryChanges;
+    }
+}
+
+void RenderQueue::radixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+    const size_t count = entries.size();
+    if (count < 2) {
+        return;
+    }
+    scratch.resize(count);
+
+    // One read pass builds the histograms for every digit
+    uint32_t histograms[kRadixPasses][kRadixBuckets];
+    std::memset(histograms, 0, sizeof(histograms));
+    for (const SortEntry& entry : entries) {
+        uint64_t key = entry.key;
+        for (int digit = 0; digit < kRadixPasses; ++digit) {
+            ++histograms[digit][key & kRadixMask];
+            key >>= kRadixBits;
+        }
+    }
+
+    SortEntry* source = entries.data();
+    SortEntry* destination = scratch.data();
+    for (int digit = 0; digit < kRadixPasses; ++digit) {
+        uint32_t* histogram = histograms[digit];
+        const uint32_t shift = digit * kRadixBits;
+
+        // Every key shares this digit: the pass would be an identity copy
+        if (histogram[(source[0].key >> shift) & kRadixMask] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < kRadixBuckets; ++bucket) {
+            const uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const SortEntry& entry = source[i];
+            destination[histogram[(entry.key >> shift) & kRadixMask]++] = entry;
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != entries.data()) {
+        entries.swap(scratch);
+    }
+}
+
+} // namespace graphics
+} // namespace ogde
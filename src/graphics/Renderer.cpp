@@ -3,10 +3,14 @@
  */
 
 #include "ogde/graphics/Renderer.h"
+#include "ogde/graphics/CommandBuffer.h"
 #include "ogde/core/Logger.h"
 
 #ifdef _WIN32
 #include "ogde/graphics/RendererD3D11.h"
+#else
+#include "ogde/graphics/RendererSoftware.h"
+#include "ogde/core/JobSystem.h"
 #endif
 
 namespace ogde {
@@ -15,6 +19,9 @@ namespace graphics {
 Renderer::Renderer() {
 #ifdef _WIN32
     m_rendererD3D11 = std::make_unique<RendererD3D11>();
+#else
+    m_rendererSoftware = std::make_unique<RendererSoftware>();
+    m_rendererSoftware->setJobSystem(&core::JobSystem::shared());
 #endif
 }
 
@@ -28,6 +35,13 @@ bool Renderer::initialize(void* windowHandle, uint32_t width, uint32_t height, b
         HWND hwnd = static_cast<HWND>(windowHandle);
         return m_rendererD3D11->initialize(hwnd, width, height, vsync);
     }
+#else
+    // Headless: there is no window or swap chain to present to
+    (void)windowHandle;
+    (void)vsync;
+    if (m_rendererSoftware) {
+        return m_rendererSoftware->initialize(width, height);
+    }
 #endif
     
     core::Logger::warning("Renderer::initialize not implemented for this platform");
@@ -39,6 +53,10 @@ void Renderer::shutdown() {
     if (m_rendererD3D11) {
         m_rendererD3D11->shutdown();
     }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->shutdown();
+    }
 #endif
 }
 
@@ -47,6 +65,10 @@ void Renderer::beginFrame() {
     if (m_rendererD3D11) {
         m_rendererD3D11->beginFrame();
     }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->beginFrame();
+    }
 #endif
 }
 
@@ -55,6 +77,10 @@ void Renderer::endFrame() {
     if (m_rendererD3D11) {
         m_rendererD3D11->endFrame();
     }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->endFrame();
+    }
 #endif
 }
 
@@ -63,6 +89,10 @@ void Renderer::clear(float r, float g, float b, float a) {
     if (m_rendererD3D11) {
         m_rendererD3D11->clear(r, g, b, a);
     }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->clear(r, g, b, a);
+    }
 #endif
 }
 
@@ -71,6 +101,22 @@ void Renderer::resize(uint32_t width, uint32_t height) {
     if (m_rendererD3D11) {
         m_rendererD3D11->resize(width, height);
     }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->resize(width, height);
+    }
+#endif
+}
+
+void Renderer::execute(const CommandBuffer& commands) {
+#ifdef _WIN32
+    if (m_rendererD3D11) {
+        m_rendererD3D11->execute(commands);
+    }
+#else
+    if (m_rendererSoftware) {
+        m_rendererSoftware->execute(commands);
+    }
 #endif
 }
 
@@ -79,6 +125,10 @@ bool Renderer::isInitialized() const {
     if (m_rendererD3D11) {
         return m_rendererD3D11->isInitialized();
     }
+#else
+    if (m_rendererSoftware) {
+        return m_rendererSoftware->isInitialized();
+    }
 #endif
     return false;
 }
@@ -87,6 +137,10 @@ bool Renderer::isInitialized() const {
 RendererD3D11* Renderer::getD3D11Renderer() const {
     return m_rendererD3D11.get();
 }
+#else
+RendererSoftware* Renderer::getSoftwareRenderer() const {
+    return m_rendererSoftware.get();
+}
 #endif
 
 } // namespace graphics
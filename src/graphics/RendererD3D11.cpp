@@ -8,6 +8,7 @@
 #include "ogde/core/Logger.h"
 #include <d3d11.h>
 #include <dxgi.h>
+#include <cstring>
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -15,12 +16,28 @@
 namespace ogde {
 namespace graphics {
 
+namespace {
+
+constexpr uint64_t kDynamicGeometryCapacity = 4 * 1024 * 1024;
+constexpr uint64_t kDynamicConstantsCapacity = 1024 * 1024;
+constexpr uint32_t kConstantBufferAlignment = 256;  // 16 constants, the granularity of *SetConstantBuffers1
+
+// DXGI lets the CPU queue up to three frames ahead of the GPU, plus the one being recorded
+constexpr uint32_t kUploadFramesInFlight = 4;
+
+} // namespace
+
 RendererD3D11::RendererD3D11()
     : m_initialized(false)
     , m_vsyncEnabled(true)
     , m_width(0)
     , m_height(0)
+    , m_dynamicConstantsSupported(false)
+    , m_nextFence(1)
 {
+    m_dynamicGeometry.bindFlags = D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_INDEX_BUFFER;
+    m_dynamicConstants.bindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    m_dynamicConstants.alignment = kConstantBufferAlignment;
 }
 
 RendererD3D11::~RendererD3D11() {
@@ -177,6 +194,23 @@ bool RendererD3D11::initialize(HWND hwnd, uint32_t width, uint32_t height, bool
     m_deviceContext->RSSetState(m_rasterizerState.Get());
     core::Logger::info("Rasterizer state configured (backface culling disabled)");
 
+    // Upload buffers for per-frame data
+    if (!createDynamicBuffer(m_dynamicGeometry, kDynamicGeometryCapacity)) {
+        return false;
+    }
+
+    // Sub-allocating constants needs offset binds (11.1) and NO_OVERWRITE maps on constant buffers
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+    m_deviceContext.As(&m_deviceContext1);
+    if (m_deviceContext1 &&
+        SUCCEEDED(m_device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))) &&
+        options.ConstantBufferOffsetting && options.MapNoOverwriteOnDynamicConstantBuffer) {
+        m_dynamicConstantsSupported = createDynamicBuffer(m_dynamicConstants, kDynamicConstantsCapacity);
+    }
+    if (!m_dynamicConstantsSupported) {
+        core::Logger::warning("Dynamic constant uploads unavailable: driver lacks constant buffer offsetting");
+    }
+
     m_initialized = true;
     core::Logger::info("DirectX 11 renderer initialized successfully!");
     return true;
@@ -194,6 +228,16 @@ void RendererD3D11::shutdown() {
     m_depthStencilView.Reset();
     m_depthStencilBuffer.Reset();
     m_rasterizerState.Reset();
+    m_vertexBuffers.clear();
+    m_vertexStrides.clear();
+    m_indexBuffers.clear();
+    m_indexFormats.clear();
+    m_dynamicGeometry.buffer.Reset();
+    m_dynamicConstants.buffer.Reset();
+    m_dynamicConstantsSupported = false;
+    m_pendingFences.clear();
+    m_freeQueries.clear();
+    m_deviceContext1.Reset();
     
     if (m_deviceContext) {
         m_deviceContext->ClearState();
@@ -213,6 +257,8 @@ void RendererD3D11::beginFrame() {
         return;
     }
 
+    retireCompletedFrames();
+
     // Clear will be called separately
 }
 
@@ -227,6 +273,47 @@ void RendererD3D11::endFrame() {
     if (FAILED(hr)) {
         core::Logger::error("Failed to present swap chain");
     }
+
+    // Fence the frame's uploads with an event query
+    Microsoft::WRL::ComPtr<ID3D11Query> query;
+    if (!m_freeQueries.empty()) {
+        query = m_freeQueries.back();
+        m_freeQueries.pop_back();
+    } else {
+        D3D11_QUERY_DESC queryDesc = { D3D11_QUERY_EVENT, 0 };
+        if (FAILED(m_device->CreateQuery(&queryDesc, query.GetAddressOf()))) {
+            core::Logger::error("Failed to create frame fence query");
+        }
+    }
+
+    const uint64_t fence = m_nextFence++;
+    for (DynamicBuffer* dynamic : { &m_dynamicGeometry, &m_dynamicConstants }) {
+        if (!dynamic->buffer) {
+            continue;
+        }
+        dynamic->ring.endFrame(fence);
+
+        // Grow at the frame boundary if the buffer had to be renamed this frame
+        const UploadRingStats& stats = dynamic->ring.getStats();
+        if (stats.overflows != dynamic->overflowsSeen) {
+            dynamic->overflowsSeen = stats.overflows;
+            const uint64_t capacity = dynamic->ring.getRecommendedCapacity(kUploadFramesInFlight);
+            if (capacity > dynamic->ring.getCapacity()) {
+                createDynamicBuffer(*dynamic, capacity);
+            }
+        }
+    }
+
+    if (query) {
+        m_deviceContext->End(query.Get());
+        m_pendingFences.push_back({ fence, query });
+    } else {
+        // Without a fence nothing can be retired safely; start over on fresh buffers
+        for (DynamicBuffer* dynamic : { &m_dynamicGeometry, &m_dynamicConstants }) {
+            dynamic->ring.reset(dynamic->ring.getCapacity());
+            dynamic->discardNext = true;
+        }
+    }
 }
 
 void RendererD3D11::clear(float r, float g, float b, float a) {
@@ -396,6 +483,28 @@ bool RendererD3D11::createVertexBuffer(const void* vertices, uint32_t vertexSize
     return true;
 }
 
+bool RendererD3D11::createIndexBuffer(const uint32_t* indices, uint32_t indexCount, ID3D11Buffer** outBuffer) {
+    if (!m_initialized || !m_device || !indices || indexCount == 0 || !outBuffer) {
+        core::Logger::error("Cannot create index buffer: invalid parameters");
+        return false;
+    }
+
+    D3D11_BUFFER_DESC bufferDesc = {};
+    bufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    bufferDesc.ByteWidth = indexCount * sizeof(uint32_t);
+    bufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+
+    D3D11_SUBRESOURCE_DATA initData = {};
+    initData.pSysMem = indices;
+
+    HRESULT hr = m_device->CreateBuffer(&bufferDesc, &initData, outBuffer);
+    if (FAILED(hr)) {
+        core::Logger::error("Failed to create index buffer");
+        return false;
+    }
+    return true;
+}
+
 void RendererD3D11::setVertexBuffer(ID3D11Buffer* buffer, uint32_t vertexSize, uint32_t offset) {
     if (!m_initialized || !m_deviceContext || !buffer) {
         return;
@@ -406,6 +515,214 @@ void RendererD3D11::setVertexBuffer(ID3D11Buffer* buffer, uint32_t vertexSize, u
     m_deviceContext->IASetVertexBuffers(0, 1, &buffer, &stride, &offsetValue);
 }
 
+bool RendererD3D11::createDynamicBuffer(DynamicBuffer& dynamic, uint64_t capacity) {
+    D3D11_BUFFER_DESC bufferDesc = {};
+    bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    bufferDesc.ByteWidth = static_cast<UINT>(capacity);
+    bufferDesc.BindFlags = dynamic.bindFlags;
+    bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    Microsoft::WRL::ComPtr<ID3D11Buffer> buffer;
+    HRESULT hr = m_device->CreateBuffer(&bufferDesc, nullptr, buffer.GetAddressOf());
+    if (FAILED(hr)) {
+        core::Logger::error("Failed to create dynamic buffer of " + std::to_string(capacity) + " bytes");
+        return false;
+    }
+
+    // The old buffer stays alive until the GPU has finished with it
+    dynamic.buffer = buffer;
+    dynamic.ring.reset(capacity);
+    dynamic.discardNext = true;
+    return true;
+}
+
+void RendererD3D11::retireCompletedFrames() {
+    uint64_t completed = 0;
+    while (!m_pendingFences.empty()) {
+        FrameFence& fence = m_pendingFences.front();
+        BOOL done = FALSE;
+        if (m_deviceContext->GetData(fence.query.Get(), &done, sizeof(done), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+            !done) {
+            break;
+        }
+        completed = fence.value;
+        m_freeQueries.push_back(fence.query);
+        m_pendingFences.pop_front();
+    }
+    if (completed != 0) {
+        m_dynamicGeometry.ring.retire(completed);
+        m_dynamicConstants.ring.retire(completed);
+    }
+}
+
+bool RendererD3D11::uploadDynamic(DynamicBufferKind kind, const void* data, uint32_t size,
+                                  DynamicBufferSlice& outSlice) {
+    DynamicBuffer& dynamic = kind == DynamicBufferKind::Constants ? m_dynamicConstants : m_dynamicGeometry;
+    if (!m_initialized || !data || size == 0 || !dynamic.buffer) {
+        core::Logger::error("Cannot upload dynamic data: invalid parameters");
+        return false;
+    }
+
+    // Constant buffer binds cover whole 256-byte blocks
+    const uint64_t allocationSize = kind == DynamicBufferKind::Constants
+        ? (static_cast<uint64_t>(size) + kConstantBufferAlignment - 1) & ~uint64_t(kConstantBufferAlignment - 1)
+        : size;
+
+    UploadAllocation allocation = dynamic.ring.allocate(allocationSize, dynamic.alignment);
+    if (!allocation.valid) {
+        retireCompletedFrames();
+        allocation = dynamic.ring.allocate(allocationSize, dynamic.alignment);
+    }
+    if (!allocation.valid) {
+        if (allocationSize > dynamic.ring.getCapacity()) {
+            // Larger than the whole buffer: grow right away
+            if (!createDynamicBuffer(dynamic, dynamic.ring.getRecommendedCapacity(kUploadFramesInFlight))) {
+                return false;
+            }
+        } else {
+            // Rename: a discard hands out fresh memory while the GPU keeps reading the old contents
+            dynamic.ring.reset(dynamic.ring.getCapacity());
+            dynamic.discardNext = true;
+        }
+        allocation = dynamic.ring.allocate(allocationSize, dynamic.alignment);
+        if (!allocation.valid) {
+            core::Logger::error("Failed to allocate " + std::to_string(size) + " bytes of dynamic buffer space");
+            return false;
+        }
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped = {};
+    const D3D11_MAP mapType = dynamic.discardNext ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    HRESULT hr = m_deviceContext->Map(dynamic.buffer.Get(), 0, mapType, 0, &mapped);
+    if (FAILED(hr)) {
+        core::Logger::error("Failed to map dynamic buffer");
+        return false;
+    }
+    dynamic.discardNext = false;
+    std::memcpy(static_cast<uint8_t*>(mapped.pData) + allocation.offset, data, size);
+    m_deviceContext->Unmap(dynamic.buffer.Get(), 0);
+
+    outSlice.buffer = dynamic.buffer.Get();
+    outSlice.offset = static_cast<uint32_t>(allocation.offset);
+    outSlice.size = static_cast<uint32_t>(allocation.size);
+    return true;
+}
+
+void RendererD3D11::setDynamicVertexBuffer(const DynamicBufferSlice& slice, uint32_t vertexSize) {
+    setVertexBuffer(slice.buffer, vertexSize, slice.offset);
+}
+
+void RendererD3D11::setDynamicIndexBuffer(const DynamicBufferSlice& slice, DXGI_FORMAT format) {
+    if (!m_initialized || !m_deviceContext || !slice.buffer) {
+        return;
+    }
+
+    m_deviceContext->IASetIndexBuffer(slice.buffer, format, slice.offset);
+}
+
+void RendererD3D11::setDynamicConstantBuffer(uint32_t slot, const DynamicBufferSlice& slice) {
+    if (!m_initialized || !m_deviceContext1 || !slice.buffer) {
+        return;
+    }
+
+    // Offsets and sizes are in 16-byte constants
+    UINT firstConstant = slice.offset / 16;
+    UINT numConstants = slice.size / 16;
+    m_deviceContext1->VSSetConstantBuffers1(slot, 1, &slice.buffer, &firstConstant, &numConstants);
+    m_deviceContext1->PSSetConstantBuffers1(slot, 1, &slice.buffer, &firstConstant, &numConstants);
+}
+
+const UploadRingStats& RendererD3D11::getDynamicBufferStats(DynamicBufferKind kind) const {
+    return kind == DynamicBufferKind::Constants ? m_dynamicConstants.ring.getStats()
+                                                : m_dynamicGeometry.ring.getStats();
+}
+
+void RendererD3D11::setInstanceBuffer(ID3D11Buffer* buffer, uint32_t instanceSize, uint32_t offset) {
+    if (!m_initialized || !m_deviceContext || !buffer) {
+        return;
+    }
+
+    UINT stride = instanceSize;
+    UINT offsetValue = offset;
+    m_deviceContext->IASetVertexBuffers(1, 1, &buffer, &stride, &offsetValue);
+}
+
+uint32_t RendererD3D11::registerVertexBuffer(ID3D11Buffer* buffer, uint32_t vertexSize, ID3D11Buffer* indexBuffer,
+                                             DXGI_FORMAT indexFormat) {
+    m_vertexBuffers.emplace_back(buffer);
+    m_vertexStrides.push_back(vertexSize);
+    m_indexBuffers.emplace_back(indexBuffer);
+    m_indexFormats.push_back(indexFormat);
+    return static_cast<uint32_t>(m_vertexBuffers.size() - 1);
+}
+
+namespace {
+
+// Replays recorded commands onto the D3D11 immediate context
+class D3D11CommandSink : public CommandSink {
+public:
+    D3D11CommandSink(RendererD3D11& renderer, ID3D11DeviceContext* context,
+                     const std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>>& buffers,
+                     const std::vector<uint32_t>& strides,
+                     const std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>>& indexBuffers,
+                     const std::vector<DXGI_FORMAT>& indexFormats)
+        : m_renderer(renderer), m_context(context), m_buffers(buffers), m_strides(strides),
+          m_indexBuffers(indexBuffers), m_indexFormats(indexFormats) {}
+
+    void bindPass(uint32_t) override {}
+    void bindShader(uint32_t) override {}
+    void bindMaterial(uint32_t) override {}
+
+    void bindGeometry(uint32_t geometry) override {
+        if (geometry < m_buffers.size()) {
+            m_renderer.setVertexBuffer(m_buffers[geometry].Get(), m_strides[geometry]);
+            if (m_indexBuffers[geometry]) {
+                m_context->IASetIndexBuffer(m_indexBuffers[geometry].Get(), m_indexFormats[geometry], 0);
+            }
+        }
+    }
+
+    void draw(const DrawItem& item) override {
+        const bool instanced = item.instanceCount != 1 || item.startInstance != 0;
+        if (item.indexCount > 0) {
+            m_renderer.drawIndexedInstanced(item.indexCount, item.instanceCount, item.startIndex,
+                                            static_cast<int32_t>(item.startVertex), item.startInstance);
+        } else if (instanced) {
+            m_renderer.drawInstanced(item.vertexCount, item.instanceCount, item.startVertex, item.startInstance);
+        } else {
+            m_renderer.draw(item.vertexCount, item.startVertex);
+        }
+    }
+
+    void updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) override {
+        if (buffer >= m_buffers.size() || size == 0) {
+            return;
+        }
+        D3D11_BOX box = { offset, 0, 0, offset + size, 1, 1 };
+        m_context->UpdateSubresource(m_buffers[buffer].Get(), 0, &box, data, 0, 0);
+    }
+
+private:
+    RendererD3D11& m_renderer;
+    ID3D11DeviceContext* m_context;
+    const std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>>& m_buffers;
+    const std::vector<uint32_t>& m_strides;
+    const std::vector<Microsoft::WRL::ComPtr<ID3D11Buffer>>& m_indexBuffers;
+    const std::vector<DXGI_FORMAT>& m_indexFormats;
+};
+
+} // namespace
+
+void RendererD3D11::execute(const CommandBuffer& commands) {
+    if (!m_initialized || !m_deviceContext) {
+        return;
+    }
+
+    D3D11CommandSink sink(*this, m_deviceContext.Get(), m_vertexBuffers, m_vertexStrides, m_indexBuffers,
+                          m_indexFormats);
+    commands.replay(sink);
+}
+
 void RendererD3D11::draw(uint32_t vertexCount, uint32_t startVertex) {
     if (!m_initialized || !m_deviceContext) {
         return;
@@ -418,6 +735,35 @@ void RendererD3D11::draw(uint32_t vertexCount, uint32_t startVertex) {
     m_deviceContext->Draw(vertexCount, startVertex);
 }
 
+void RendererD3D11::drawIndexed(uint32_t indexCount, uint32_t startIndex, int32_t baseVertex) {
+    if (!m_initialized || !m_deviceContext) {
+        return;
+    }
+
+    m_deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_deviceContext->DrawIndexed(indexCount, startIndex, baseVertex);
+}
+
+void RendererD3D11::drawInstanced(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex,
+                                  uint32_t startInstance) {
+    if (!m_initialized || !m_deviceContext) {
+        return;
+    }
+
+    m_deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_deviceContext->DrawInstanced(vertexCount, instanceCount, startVertex, startInstance);
+}
+
+void RendererD3D11::drawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex,
+                                         int32_t baseVertex, uint32_t startInstance) {
+    if (!m_initialized || !m_deviceContext) {
+        return;
+    }
+
+    m_deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_deviceContext->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+}
+
 } // namespace graphics
 } // namespace ogde
 
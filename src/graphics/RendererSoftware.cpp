@@ -0,0 +1,907 @@
+/**
+ * @file RendererSoftware.cpp
+ * @brief Headless software rasterizer implementation
+ */
+
+#include "ogde/graphics/RendererSoftware.h"
+#include "ogde/graphics/MaterialTable.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/Logger.h"
+#include "ogde/platform/CpuFeatures.h"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef OGDE_ARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+// Pixels per tile side; tiles are the unit of parallel work
+constexpr int32_t kTileSize = 64;
+constexpr int32_t kTileShift = 6;
+
+// Fixed-point vertex positions: 1/16 pixel
+constexpr int32_t kSubpixelBits = 4;
+constexpr int32_t kSubpixelScale = 1 << kSubpixelBits;
+constexpr int32_t kHalfPixel = kSubpixelScale / 2;
+
+// Triangles are only clipped where they leave [-2w, 2w] in x and y. With
+// buffers up to 8192 pixels that bounds edge values inside one tile to
+// int32, so the per-pixel edge tests never overflow.
+constexpr uint32_t kMaxDimension = 8192;
+constexpr float kGuardBand = 2.0f;
+
+// Sutherland-Hodgman output of a triangle against the five clip planes
+constexpr int kMaxClipVertices = 3 + 5;
+
+inline void transformPoint(const float* m, float x, float y, float z, float* out) {
+    out[0] = x * m[0] + y * m[4] + z * m[8] + m[12];
+    out[1] = x * m[1] + y * m[5] + z * m[9] + m[13];
+    out[2] = x * m[2] + y * m[6] + z * m[10] + m[14];
+    out[3] = x * m[3] + y * m[7] + z * m[11] + m[15];
+}
+
+inline void transformDirection(const float* m, const float* v, float* out) {
+    out[0] = v[0] * m[0] + v[1] * m[4] + v[2] * m[8];
+    out[1] = v[0] * m[1] + v[1] * m[5] + v[2] * m[9];
+    out[2] = v[0] * m[2] + v[1] * m[6] + v[2] * m[10];
+}
+
+void setIdentity(float* m) {
+    std::memset(m, 0, 16 * sizeof(float));
+    m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+inline bool normalize(float* v) {
+    const float lengthSq = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+    if (!(lengthSq > 0.0f)) {
+        return false;
+    }
+    const float invLength = 1.0f / std::sqrt(lengthSq);
+    v[0] *= invLength;
+    v[1] *= invLength;
+    v[2] *= invLength;
+    return true;
+}
+
+inline uint32_t packColor(float r, float g, float b, float a) {
+    auto channel = [](float value) {
+        return static_cast<uint32_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+    };
+    return channel(r) | (channel(g) << 8) | (channel(b) << 16) | (channel(a) << 24);
+}
+
+// Signed distance of a clip-space position to each clipping plane (inside >= 0)
+inline float clipDistance(const float* p, int plane) {
+    switch (plane) {
+    case 0: return p[2];                        // Near: z >= 0
+    case 1: return kGuardBand * p[3] - p[0];
+    case 2: return kGuardBand * p[3] + p[0];
+    case 3: return kGuardBand * p[3] - p[1];
+    default: return kGuardBand * p[3] + p[1];
+    }
+}
+
+// Bit per plane a position is outside of: near, guard band, then the
+// view volume itself (x, y in [-w, w], z <= w) for trivial rejection
+inline uint32_t outcode(const float* p) {
+    uint32_t code = 0;
+    for (int plane = 0; plane < 5; ++plane) {
+        code |= (clipDistance(p, plane) < 0.0f ? 1u : 0u) << plane;
+    }
+    code |= (p[0] > p[3] ? 1u : 0u) << 5;
+    code |= (p[0] < -p[3] ? 1u : 0u) << 6;
+    code |= (p[1] > p[3] ? 1u : 0u) << 7;
+    code |= (p[1] < -p[3] ? 1u : 0u) << 8;
+    code |= (p[2] > p[3] ? 1u : 0u) << 9;
+    return code;
+}
+
+constexpr uint32_t kClipPlaneMask = 0x1F;
+
+// Masks the lanes of a 4-pixel group that lie in [minX, maxX]
+inline int laneMask(int32_t x, int32_t minX, int32_t maxX) {
+    int mask = 0xF;
+    if (x < minX) {
+        mask &= 0xF << (minX - x);
+    }
+    if (x + 3 > maxX) {
+        mask &= 0xF >> (x + 3 - maxX);
+    }
+    return mask & 0xF;
+}
+
+} // namespace
+
+RendererSoftware::RendererSoftware()
+    : m_initialized(false)
+    , m_width(0)
+    , m_height(0)
+    , m_stride(0)
+    , m_tilesX(0)
+    , m_tilesY(0)
+    , m_currentBuffer(0)
+    , m_instanceCount(0)
+    , m_materialTable(nullptr)
+    , m_material(UINT32_MAX)
+    , m_jobSystem(nullptr)
+    , m_frameIndex(0)
+{
+    setIdentity(m_viewProjection);
+    setIdentity(m_world);
+    setLightDirection(-0.4f, -1.0f, 0.6f);
+    setColor(1.0f, 1.0f, 1.0f, 1.0f);
+    m_ambient[0] = m_ambient[1] = m_ambient[2] = 0.2f;
+}
+
+RendererSoftware::~RendererSoftware() {
+    shutdown();
+}
+
+bool RendererSoftware::initialize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || width > kMaxDimension || height > kMaxDimension) {
+        core::Logger::error("Invalid software renderer size");
+        return false;
+    }
+
+    m_width = width;
+    m_height = height;
+    m_stride = (width + 3) & ~3u;   // Four-pixel groups never cross into the next row
+    m_tilesX = (width + kTileSize - 1) / kTileSize;
+    m_tilesY = (height + kTileSize - 1) / kTileSize;
+    m_color.assign(static_cast<size_t>(m_stride) * height, 0);
+    m_depth.assign(static_cast<size_t>(m_stride) * height, 1.0f);
+    m_tileBins.assign(static_cast<size_t>(m_tilesX) * m_tilesY, std::vector<uint32_t>());
+    m_tilePixels.assign(m_tileBins.size(), 0);
+    m_triangles.clear();
+    m_initialized = true;
+
+    core::Logger::info("Software renderer initialized (" + std::to_string(width) + "x" +
+                       std::to_string(height) + ")");
+    return true;
+}
+
+void RendererSoftware::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+    m_color.clear();
+    m_depth.clear();
+    m_tileBins.clear();
+    m_tilePixels.clear();
+    m_triangles.clear();
+    m_vertexBuffers.clear();
+    m_instanceData.clear();
+    m_instanceCount = 0;
+    m_initialized = false;
+}
+
+void RendererSoftware::beginFrame() {
+    m_stats = SoftwareRenderStats();
+}
+
+void RendererSoftware::endFrame() {
+    flush();
+    if (!m_dumpPrefix.empty()) {
+        char suffix[16];
+        std::snprintf(suffix, sizeof(suffix), "_%06u.tga", m_frameIndex);
+        saveImage(m_dumpPrefix + suffix);
+    }
+    ++m_frameIndex;
+}
+
+void RendererSoftware::clear(float r, float g, float b, float a) {
+    // Everything queued so far would be overwritten
+    m_triangles.clear();
+    std::fill(m_color.begin(), m_color.end(), packColor(r, g, b, a));
+    std::fill(m_depth.begin(), m_depth.end(), 1.0f);
+}
+
+void RendererSoftware::resize(uint32_t width, uint32_t height) {
+    if (m_initialized && (width != m_width || height != m_height)) {
+        initialize(width, height);
+    }
+}
+
+uint32_t RendererSoftware::createVertexBuffer(const void* vertices, uint32_t vertexCount,
+                                              const SoftwareVertexFormat& format) {
+    VertexBuffer buffer;
+    buffer.vertexCount = vertexCount;
+    buffer.format = format;
+    buffer.data.resize(static_cast<size_t>(vertexCount) * format.stride);
+    if (vertices && !buffer.data.empty()) {
+        std::memcpy(buffer.data.data(), vertices, buffer.data.size());
+    }
+    m_vertexBuffers.push_back(std::move(buffer));
+    return static_cast<uint32_t>(m_vertexBuffers.size() - 1);
+}
+
+void RendererSoftware::setVertexBuffer(uint32_t geometry) {
+    m_currentBuffer = geometry;
+}
+
+void RendererSoftware::setViewProjection(const float* matrix) {
+    std::memcpy(m_viewProjection, matrix, sizeof(m_viewProjection));
+}
+
+void RendererSoftware::setWorldMatrix(const float* matrix) {
+    if (matrix) {
+        std::memcpy(m_world, matrix, sizeof(m_world));
+    } else {
+        setIdentity(m_world);
+    }
+}
+
+void RendererSoftware::setLightDirection(float x, float y, float z) {
+    m_lightDirection[0] = x;
+    m_lightDirection[1] = y;
+    m_lightDirection[2] = z;
+    if (!normalize(m_lightDirection)) {
+        m_lightDirection[0] = 0.0f;
+        m_lightDirection[1] = -1.0f;
+        m_lightDirection[2] = 0.0f;
+    }
+}
+
+void RendererSoftware::setColor(float r, float g, float b, float a) {
+    m_color4[0] = r;
+    m_color4[1] = g;
+    m_color4[2] = b;
+    m_color4[3] = a;
+    m_material = UINT32_MAX;
+}
+
+void RendererSoftware::draw(uint32_t vertexCount, uint32_t startVertex) {
+    if (!m_initialized || vertexCount < 3) {
+        return;
+    }
+    if (m_currentBuffer >= m_vertexBuffers.size()) {
+        core::Logger::error("Software draw without a valid vertex buffer");
+        return;
+    }
+    const VertexBuffer& buffer = m_vertexBuffers[m_currentBuffer];
+    if (startVertex > buffer.vertexCount || vertexCount > buffer.vertexCount - startVertex) {
+        core::Logger::error("Software draw exceeds its vertex buffer");
+        return;
+    }
+    drawTriangles(buffer, nullptr, vertexCount, startVertex, m_world, nullptr);
+}
+
+void RendererSoftware::drawIndexed(uint32_t indexCount, uint32_t startIndex, uint32_t baseVertex) {
+    DrawItem item;
+    item.indexCount = indexCount;
+    item.startIndex = startIndex;
+    item.startVertex = baseVertex;
+    draw(item);
+}
+
+bool RendererSoftware::setIndexBuffer(uint32_t geometry, const uint32_t* indices, uint32_t indexCount) {
+    if (geometry >= m_vertexBuffers.size() || (!indices && indexCount > 0)) {
+        core::Logger::error("Software index buffer needs a valid geometry id");
+        return false;
+    }
+    m_vertexBuffers[geometry].indices.assign(indices, indices + indexCount);
+    return true;
+}
+
+void RendererSoftware::setInstanceStream(const void* data, uint32_t instanceCount,
+                                         const SoftwareInstanceFormat& format) {
+    m_instanceFormat = format;
+    m_instanceCount = data ? instanceCount : 0;
+    m_instanceData.resize(static_cast<size_t>(m_instanceCount) * format.stride);
+    if (!m_instanceData.empty()) {
+        std::memcpy(m_instanceData.data(), data, m_instanceData.size());
+    }
+}
+
+void RendererSoftware::drawTriangles(const VertexBuffer& buffer, const uint32_t* indices, uint32_t count,
+                                     uint32_t vertexBase, const float* worldMatrix, const float* colorScale) {
+    // Surface color: the bound material, else the flat color
+    float baseColor[4];
+    float ambient[3];
+    std::memcpy(baseColor, m_color4, sizeof(baseColor));
+    std::memcpy(ambient, m_ambient, sizeof(ambient));
+    if (m_materialTable && m_material < m_materialTable->GetCount()) {
+        const OGDE::Graphics::MaterialParams& params = m_materialTable->GetData()[m_material];
+        std::memcpy(baseColor, params.diffuseColor, sizeof(baseColor));
+        baseColor[3] *= params.opacity;
+        std::memcpy(ambient, params.ambientColor, sizeof(ambient));
+    }
+    if (colorScale) {
+        for (int c = 0; c < 4; ++c) {
+            baseColor[c] *= colorScale[c];
+        }
+    }
+
+    const SoftwareVertexFormat& format = buffer.format;
+    const uint32_t triangleCount = count / 3;
+    m_stats.trianglesSubmitted += triangleCount;
+
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        float world[3][3];
+        const uint8_t* source[3];
+        for (int i = 0; i < 3; ++i) {
+            const uint32_t index = vertexBase + (indices ? indices[t * 3 + i] : t * 3 + i);
+            source[i] = buffer.data.data() + static_cast<size_t>(index) * format.stride;
+            float position[3];
+            std::memcpy(position, source[i], sizeof(position));
+            float transformed[4];
+            transformPoint(worldMatrix, position[0], position[1], position[2], transformed);
+            std::memcpy(world[i], transformed, sizeof(world[i]));
+        }
+
+        // Without normals, light the face from both sides (nothing is back-face culled)
+        float faceLight = 0.0f;
+        if (format.normalOffset < 0) {
+            const float e1[3] = { world[1][0] - world[0][0], world[1][1] - world[0][1], world[1][2] - world[0][2] };
+            const float e2[3] = { world[2][0] - world[0][0], world[2][1] - world[0][1], world[2][2] - world[0][2] };
+            float normal[3] = { e1[1] * e2[2] - e1[2] * e2[1],
+                                e1[2] * e2[0] - e1[0] * e2[2],
+                                e1[0] * e2[1] - e1[1] * e2[0] };
+            if (normalize(normal)) {
+                faceLight = std::fabs(normal[0] * m_lightDirection[0] +
+                                      normal[1] * m_lightDirection[1] +
+                                      normal[2] * m_lightDirection[2]);
+            }
+        }
+
+        ClipVertex vertices[3];
+        for (int i = 0; i < 3; ++i) {
+            ClipVertex& vertex = vertices[i];
+            transformPoint(m_viewProjection, world[i][0], world[i][1], world[i][2], vertex.position);
+
+            float light = faceLight;
+            if (format.normalOffset >= 0) {
+                float normal[3];
+                float worldNormal[3];
+                std::memcpy(normal, source[i] + format.normalOffset, sizeof(normal));
+                transformDirection(worldMatrix, normal, worldNormal);
+                light = normalize(worldNormal)
+                    ? std::max(0.0f, -(worldNormal[0] * m_lightDirection[0] +
+                                       worldNormal[1] * m_lightDirection[1] +
+                                       worldNormal[2] * m_lightDirection[2]))
+                    : 0.0f;
+            }
+
+            float vertexColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            if (format.colorOffset >= 0) {
+                std::memcpy(vertexColor, source[i] + format.colorOffset, sizeof(vertexColor));
+            }
+            for (int c = 0; c < 3; ++c) {
+                vertex.color[c] = baseColor[c] * vertexColor[c] * (ambient[c] + light);
+            }
+            vertex.color[3] = baseColor[3] * vertexColor[3];
+        }
+        queueTriangle(vertices);
+    }
+}
+
+void RendererSoftware::execute(const CommandBuffer& commands) {
+    commands.replay(*this);
+}
+
+void RendererSoftware::bindPass(uint32_t pass) {
+    (void)pass;
+}
+
+void RendererSoftware::bindShader(uint32_t shader) {
+    (void)shader;
+}
+
+void RendererSoftware::bindMaterial(uint32_t material) {
+    m_material = material;
+}
+
+void RendererSoftware::bindGeometry(uint32_t geometry) {
+    setVertexBuffer(geometry);
+}
+
+void RendererSoftware::draw(const DrawItem& item) {
+    if (item.indexCount == 0 && item.instanceCount == 1 && item.startInstance == 0) {
+        draw(item.vertexCount, item.startVertex);
+        return;
+    }
+    if (!m_initialized || item.instanceCount == 0) {
+        return;
+    }
+    if (m_currentBuffer >= m_vertexBuffers.size()) {
+        core::Logger::error("Software draw without a valid vertex buffer");
+        return;
+    }
+    const VertexBuffer& buffer = m_vertexBuffers[m_currentBuffer];
+
+    const uint32_t* indices = nullptr;
+    uint32_t count = item.vertexCount;
+    if (item.indexCount > 0) {
+        if (item.startIndex > buffer.indices.size() || item.indexCount > buffer.indices.size() - item.startIndex) {
+            core::Logger::error("Software draw exceeds its index buffer");
+            return;
+        }
+        indices = buffer.indices.data() + item.startIndex;
+        count = item.indexCount;
+        const uint32_t maxIndex = *std::max_element(indices, indices + count);
+        if (item.startVertex >= buffer.vertexCount || maxIndex >= buffer.vertexCount - item.startVertex) {
+            core::Logger::error("Software draw indexes past its vertex buffer");
+            return;
+        }
+    } else if (item.startVertex > buffer.vertexCount || count > buffer.vertexCount - item.startVertex) {
+        core::Logger::error("Software draw exceeds its vertex buffer");
+        return;
+    }
+
+    // Instances without a stream all use the world matrix
+    const bool hasStream = m_instanceCount > 0;
+    if (hasStream && (item.startInstance > m_instanceCount ||
+                      item.instanceCount > m_instanceCount - item.startInstance)) {
+        core::Logger::error("Software draw exceeds its instance stream");
+        return;
+    }
+    for (uint32_t i = 0; i < item.instanceCount; ++i) {
+        const float* world = m_world;
+        const float* colorScale = nullptr;
+        float instanceWorld[16];
+        float instanceColor[4];
+        if (hasStream) {
+            const uint8_t* instance =
+                m_instanceData.data() + static_cast<size_t>(item.startInstance + i) * m_instanceFormat.stride;
+            if (m_instanceFormat.transformOffset >= 0) {
+                std::memcpy(instanceWorld, instance + m_instanceFormat.transformOffset, sizeof(instanceWorld));
+                world = instanceWorld;
+            }
+            if (m_instanceFormat.colorOffset >= 0) {
+                std::memcpy(instanceColor, instance + m_instanceFormat.colorOffset, sizeof(instanceColor));
+                colorScale = instanceColor;
+            }
+        }
+        drawTriangles(buffer, indices, count, item.startVertex, world, colorScale);
+    }
+}
+
+void RendererSoftware::updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) {
+    if (buffer >= m_vertexBuffers.size()) {
+        core::Logger::error("Software buffer update targets an unknown buffer");
+        return;
+    }
+    std::vector<uint8_t>& bytes = m_vertexBuffers[buffer].data;
+    if (offset > bytes.size() || size > bytes.size() - offset) {
+        core::Logger::error("Software buffer update out of range");
+        return;
+    }
+    // Queued triangles hold transformed copies, so no flush is needed
+    if (size > 0) {
+        std::memcpy(bytes.data() + offset, data, size);
+    }
+}
+
+void RendererSoftware::queueTriangle(const ClipVertex* vertices) {
+    const uint32_t codes[3] = { outcode(vertices[0].position),
+                                outcode(vertices[1].position),
+                                outcode(vertices[2].position) };
+    if (codes[0] & codes[1] & codes[2]) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+    if (((codes[0] | codes[1] | codes[2]) & kClipPlaneMask) == 0) {
+        setupTriangle(vertices[0], vertices[1], vertices[2]);
+        return;
+    }
+
+    // Clip the polygon plane by plane, then fan it back into triangles
+    ClipVertex buffers[2][kMaxClipVertices];
+    ClipVertex* input = buffers[0];
+    ClipVertex* output = buffers[1];
+    int count = 3;
+    std::memcpy(input, vertices, 3 * sizeof(ClipVertex));
+
+    for (int plane = 0; plane < 5 && count >= 3; ++plane) {
+        int outCount = 0;
+        for (int i = 0; i < count; ++i) {
+            const ClipVertex& a = input[i];
+            const ClipVertex& b = input[(i + 1) % count];
+            const float da = clipDistance(a.position, plane);
+            const float db = clipDistance(b.position, plane);
+            if (da >= 0.0f) {
+                output[outCount++] = a;
+            }
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                const float t = da / (da - db);
+                ClipVertex& v = output[outCount++];
+                for (int c = 0; c < 4; ++c) {
+                    v.position[c] = a.position[c] + (b.position[c] - a.position[c]) * t;
+                    v.color[c] = a.color[c] + (b.color[c] - a.color[c]) * t;
+                }
+            }
+        }
+        std::swap(input, output);
+        count = outCount;
+    }
+
+    if (count < 3) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+    for (int i = 1; i + 1 < count; ++i) {
+        setupTriangle(input[0], input[i], input[i + 1]);
+    }
+}
+
+void RendererSoftware::setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2) {
+    const ClipVertex* v[3] = { &v0, &v1, &v2 };
+
+    int32_t x[3];
+    int32_t y[3];
+    float invW[3];
+    for (int i = 0; i < 3; ++i) {
+        invW[i] = 1.0f / v[i]->position[3];
+        const float sx = (v[i]->position[0] * invW[i] * 0.5f + 0.5f) * static_cast<float>(m_width);
+        const float sy = (0.5f - v[i]->position[1] * invW[i] * 0.5f) * static_cast<float>(m_height);
+        x[i] = static_cast<int32_t>(std::lround(sx * kSubpixelScale));
+        y[i] = static_cast<int32_t>(std::lround(sy * kSubpixelScale));
+    }
+
+    int64_t area = static_cast<int64_t>(x[1] - x[0]) * (y[2] - y[0]) -
+                   static_cast<int64_t>(y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+    // Both windings are drawn; make the area positive so inside is E >= 0
+    if (area < 0) {
+        std::swap(v[1], v[2]);
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        std::swap(invW[1], invW[2]);
+    }
+
+    // Pixels whose centers fall inside the fixed-point bounding box
+    const int32_t minXs = std::min({ x[0], x[1], x[2] });
+    const int32_t maxXs = std::max({ x[0], x[1], x[2] });
+    const int32_t minYs = std::min({ y[0], y[1], y[2] });
+    const int32_t maxYs = std::max({ y[0], y[1], y[2] });
+
+    Triangle tri;
+    tri.minX = std::max((minXs - kHalfPixel + kSubpixelScale - 1) >> kSubpixelBits, 0);
+    tri.minY = std::max((minYs - kHalfPixel + kSubpixelScale - 1) >> kSubpixelBits, 0);
+    tri.maxX = std::min((maxXs - kHalfPixel) >> kSubpixelBits, static_cast<int32_t>(m_width) - 1);
+    tri.maxY = std::min((maxYs - kHalfPixel) >> kSubpixelBits, static_cast<int32_t>(m_height) - 1);
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+
+    // Edge i is opposite vertex i. Pixels on an edge belong to the triangle
+    // only if it is a top or left edge; the -1 bias excludes the others.
+    for (int i = 0; i < 3; ++i) {
+        const int j = (i + 1) % 3;
+        const int k = (i + 2) % 3;
+        tri.edgeA[i] = y[j] - y[k];
+        tri.edgeB[i] = x[k] - x[j];
+        tri.edgeC[i] = static_cast<int64_t>(x[j]) * y[k] - static_cast<int64_t>(x[k]) * y[j];
+        const bool topLeft = tri.edgeA[i] > 0 || (tri.edgeA[i] == 0 && tri.edgeB[i] > 0);
+        if (!topLeft) {
+            tri.edgeC[i] -= 1;
+        }
+    }
+
+    // Screen-space planes of z and of the perspective-divided attributes
+    tri.originX = static_cast<float>(x[0]) / kSubpixelScale;
+    tri.originY = static_cast<float>(y[0]) / kSubpixelScale;
+    const float dx1 = static_cast<float>(x[1] - x[0]) / kSubpixelScale;
+    const float dy1 = static_cast<float>(y[1] - y[0]) / kSubpixelScale;
+    const float dx2 = static_cast<float>(x[2] - x[0]) / kSubpixelScale;
+    const float dy2 = static_cast<float>(y[2] - y[0]) / kSubpixelScale;
+    const float invArea = 1.0f / (dx1 * dy2 - dx2 * dy1);
+
+    float values[6][3];
+    for (int i = 0; i < 3; ++i) {
+        values[0][i] = v[i]->position[2] * invW[i];
+        values[1][i] = invW[i];
+        for (int c = 0; c < 4; ++c) {
+            values[2 + c][i] = v[i]->color[c] * invW[i];
+        }
+    }
+    for (int p = 0; p < 6; ++p) {
+        const float d1 = values[p][1] - values[p][0];
+        const float d2 = values[p][2] - values[p][0];
+        tri.planes[p][0] = values[p][0];
+        tri.planes[p][1] = (d1 * dy2 - d2 * dy1) * invArea;
+        tri.planes[p][2] = (d2 * dx1 - d1 * dx2) * invArea;
+    }
+
+    m_triangles.push_back(tri);
+    ++m_stats.trianglesRasterized;
+}
+
+void RendererSoftware::flush() {
+    if (m_triangles.empty()) {
+        return;
+    }
+
+    // Bin in submission order so every tile draws its triangles in that order
+    for (std::vector<uint32_t>& bin : m_tileBins) {
+        bin.clear();
+    }
+    for (uint32_t t = 0; t < m_triangles.size(); ++t) {
+        const Triangle& tri = m_triangles[t];
+        for (int32_t ty = tri.minY >> kTileShift; ty <= (tri.maxY >> kTileShift); ++ty) {
+            for (int32_t tx = tri.minX >> kTileShift; tx <= (tri.maxX >> kTileShift); ++tx) {
+                m_tileBins[ty * m_tilesX + tx].push_back(t);
+                ++m_stats.tileBinEntries;
+            }
+        }
+    }
+
+    const uint32_t tileCount = m_tilesX * m_tilesY;
+    auto rasterizeTiles = [this](uint32_t begin, uint32_t end) {
+        for (uint32_t tile = begin; tile < end; ++tile) {
+            rasterizeTile(tile);
+        }
+    };
+    if (m_jobSystem && tileCount > 1) {
+        m_jobSystem->parallelFor(tileCount, 1, rasterizeTiles);
+    } else {
+        rasterizeTiles(0, tileCount);
+    }
+
+    for (uint64_t& pixels : m_tilePixels) {
+        m_stats.pixelsWritten += pixels;
+        pixels = 0;
+    }
+    m_triangles.clear();
+}
+
+void RendererSoftware::rasterizeTile(uint32_t tile) {
+    const std::vector<uint32_t>& bin = m_tileBins[tile];
+    if (bin.empty()) {
+        return;
+    }
+    const int32_t tileMinX = static_cast<int32_t>(tile % m_tilesX) * kTileSize;
+    const int32_t tileMinY = static_cast<int32_t>(tile / m_tilesX) * kTileSize;
+    const int32_t tileMaxX = std::min(tileMinX + kTileSize, static_cast<int32_t>(m_width)) - 1;
+    const int32_t tileMaxY = std::min(tileMinY + kTileSize, static_cast<int32_t>(m_height)) - 1;
+
+    uint64_t pixels = 0;
+    for (uint32_t index : bin) {
+        const Triangle& tri = m_triangles[index];
+        pixels += rasterizeTriangle(tri,
+                                    std::max(tileMinX, tri.minX), std::max(tileMinY, tri.minY),
+                                    std::min(tileMaxX, tri.maxX), std::min(tileMaxY, tri.maxY));
+    }
+    m_tilePixels[tile] = pixels;
+}
+
+uint64_t RendererSoftware::rasterizeTriangle(const Triangle& tri, int32_t rectMinX, int32_t rectMinY,
+                                             int32_t rectMaxX, int32_t rectMaxY) {
+    // Four-pixel groups start on a multiple of 4, which stays inside the tile
+    const int32_t startX = rectMinX & ~3;
+
+    // Edges positive over the whole rectangle are dropped from the per-pixel
+    // test; an edge negative over all of it rejects the triangle. What
+    // remains crosses the rectangle, so its values fit in int32.
+    int32_t edgeRow[3];
+    int32_t edgeStepX[3];
+    int32_t edgeStepY[3];
+    for (int i = 0; i < 3; ++i) {
+        const int64_t a = tri.edgeA[i];
+        const int64_t b = tri.edgeB[i];
+        const int64_t px0 = static_cast<int64_t>(startX) * kSubpixelScale + kHalfPixel;
+        const int64_t py0 = static_cast<int64_t>(rectMinY) * kSubpixelScale + kHalfPixel;
+        const int64_t px1 = static_cast<int64_t>(rectMaxX) * kSubpixelScale + kHalfPixel;
+        const int64_t py1 = static_cast<int64_t>(rectMaxY) * kSubpixelScale + kHalfPixel;
+        const int64_t e00 = a * px0 + b * py0 + tri.edgeC[i];
+        const int64_t e10 = a * px1 + b * py0 + tri.edgeC[i];
+        const int64_t e01 = a * px0 + b * py1 + tri.edgeC[i];
+        const int64_t e11 = a * px1 + b * py1 + tri.edgeC[i];
+        if (std::max({ e00, e10, e01, e11 }) < 0) {
+            return 0;
+        }
+        if (std::min({ e00, e10, e01, e11 }) >= 0) {
+            edgeRow[i] = 0;
+            edgeStepX[i] = 0;
+            edgeStepY[i] = 0;
+        } else {
+            edgeRow[i] = static_cast<int32_t>(e00);
+            edgeStepX[i] = tri.edgeA[i] * kSubpixelScale;
+            edgeStepY[i] = tri.edgeB[i] * kSubpixelScale;
+        }
+    }
+
+    uint64_t pixels = 0;
+    const float startDx = static_cast<float>(startX) + 0.5f - tri.originX;
+
+#ifdef OGDE_ARCH_X86
+    const __m128 laneOffset = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128i laneBits = _mm_setr_epi32(1, 2, 4, 8);
+    __m128i stepX4[3];
+    __m128i laneStep[3];
+    for (int i = 0; i < 3; ++i) {
+        stepX4[i] = _mm_set1_epi32(edgeStepX[i] * 4);
+        laneStep[i] = _mm_setr_epi32(0, edgeStepX[i], 2 * edgeStepX[i], 3 * edgeStepX[i]);
+    }
+    __m128 planeStepX4[6];
+    __m128 planeLane[6];
+    for (int p = 0; p < 6; ++p) {
+        planeStepX4[p] = _mm_set1_ps(tri.planes[p][1] * 4.0f);
+        planeLane[p] = _mm_mul_ps(laneOffset, _mm_set1_ps(tri.planes[p][1]));
+    }
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 roundHalf = _mm_set1_ps(0.5f);
+
+    for (int32_t y = rectMinY; y <= rectMaxY; ++y) {
+        __m128i e0 = _mm_add_epi32(_mm_set1_epi32(edgeRow[0]), laneStep[0]);
+        __m128i e1 = _mm_add_epi32(_mm_set1_epi32(edgeRow[1]), laneStep[1]);
+        __m128i e2 = _mm_add_epi32(_mm_set1_epi32(edgeRow[2]), laneStep[2]);
+
+        const float dy = static_cast<float>(y) + 0.5f - tri.originY;
+        __m128 plane[6];
+        for (int p = 0; p < 6; ++p) {
+            const float rowValue = tri.planes[p][0] + tri.planes[p][1] * startDx + tri.planes[p][2] * dy;
+            plane[p] = _mm_add_ps(_mm_set1_ps(rowValue), planeLane[p]);
+        }
+
+        const size_t row = static_cast<size_t>(y) * m_stride;
+        for (int32_t x = startX; x <= rectMaxX; x += 4) {
+            const __m128i outside = _mm_or_si128(e0, _mm_or_si128(e1, e2));
+            int mask = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & laneMask(x, rectMinX, rectMaxX);
+            if (mask) {
+                float* depth = &m_depth[row + x];
+                const __m128 z = plane[0];
+                const __m128 stored = _mm_loadu_ps(depth);
+                mask &= _mm_movemask_ps(_mm_cmplt_ps(z, stored));
+                if (mask) {
+                    const __m128 write = _mm_castsi128_ps(_mm_cmpeq_epi32(
+                        _mm_and_si128(_mm_set1_epi32(mask), laneBits), laneBits));
+                    _mm_storeu_ps(depth, _mm_or_ps(_mm_and_ps(write, z), _mm_andnot_ps(write, stored)));
+
+                    const __m128 w = _mm_div_ps(one, plane[1]);
+                    __m128i packed = _mm_setzero_si128();
+                    for (int c = 0; c < 4; ++c) {
+                        __m128 value = _mm_min_ps(_mm_max_ps(_mm_mul_ps(plane[2 + c], w), zero), one);
+                        value = _mm_add_ps(_mm_mul_ps(value, scale), roundHalf);
+                        packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_cvttps_epi32(value), 8 * c));
+                    }
+                    __m128i* color = reinterpret_cast<__m128i*>(&m_color[row + x]);
+                    const __m128i old = _mm_loadu_si128(color);
+                    const __m128i writeBits = _mm_castps_si128(write);
+                    _mm_storeu_si128(color, _mm_or_si128(_mm_and_si128(writeBits, packed),
+                                                         _mm_andnot_si128(writeBits, old)));
+                    pixels += std::popcount(static_cast<unsigned>(mask));
+                }
+            }
+
+            e0 = _mm_add_epi32(e0, stepX4[0]);
+            e1 = _mm_add_epi32(e1, stepX4[1]);
+            e2 = _mm_add_epi32(e2, stepX4[2]);
+            for (int p = 0; p < 6; ++p) {
+                plane[p] = _mm_add_ps(plane[p], planeStepX4[p]);
+            }
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            edgeRow[i] += edgeStepY[i];
+        }
+    }
+#else
+    for (int32_t y = rectMinY; y <= rectMaxY; ++y) {
+        const float dy = static_cast<float>(y) + 0.5f - tri.originY;
+        const size_t row = static_cast<size_t>(y) * m_stride;
+        int32_t e[3] = { edgeRow[0], edgeRow[1], edgeRow[2] };
+        for (int32_t x = startX; x <= rectMaxX; ++x) {
+            if (x >= rectMinX && (e[0] | e[1] | e[2]) >= 0) {
+                const float dx = startDx + static_cast<float>(x - startX);
+                float value[6];
+                for (int p = 0; p < 6; ++p) {
+                    value[p] = tri.planes[p][0] + tri.planes[p][1] * dx + tri.planes[p][2] * dy;
+                }
+                float& depth = m_depth[row + x];
+                if (value[0] < depth) {
+                    depth = value[0];
+                    const float w = 1.0f / value[1];
+                    m_color[row + x] = packColor(value[2] * w, value[3] * w, value[4] * w, value[5] * w);
+                    ++pixels;
+                }
+            }
+            for (int i = 0; i < 3; ++i) {
+                e[i] += edgeStepX[i];
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            edgeRow[i] += edgeStepY[i];
+        }
+    }
+#endif
+
+    return pixels;
+}
+
+const uint32_t* RendererSoftware::getColorBuffer() {
+    flush();
+    return m_color.data();
+}
+
+const float* RendererSoftware::getDepthBuffer() {
+    flush();
+    return m_depth.data();
+}
+
+bool RendererSoftware::saveImage(const std::string& path) {
+    if (!m_initialized) {
+        core::Logger::error("Cannot save image: software renderer not initialized");
+        return false;
+    }
+    flush();
+
+    std::string extension;
+    const size_t dot = path.find_last_of('.');
+    if (dot != std::string::npos) {
+        extension = path.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    }
+    const bool tga = extension == "tga";
+    if (!tga && extension != "ppm") {
+        core::Logger::error("Unsupported image format: " + path);
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        core::Logger::error("Failed to open image for writing: " + path);
+        return false;
+    }
+
+    std::vector<uint8_t> row(static_cast<size_t>(m_width) * (tga ? 4 : 3));
+    if (tga) {
+        // Uncompressed true-color, 8 alpha bits, top-left origin
+        uint8_t header[18] = {};
+        header[2] = 2;
+        header[12] = static_cast<uint8_t>(m_width & 0xFF);
+        header[13] = static_cast<uint8_t>(m_width >> 8);
+        header[14] = static_cast<uint8_t>(m_height & 0xFF);
+        header[15] = static_cast<uint8_t>(m_height >> 8);
+        header[16] = 32;
+        header[17] = 0x28;
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    } else {
+        file << "P6\n" << m_width << " " << m_height << "\n255\n";
+    }
+
+    for (uint32_t y = 0; y < m_height; ++y) {
+        const uint32_t* pixels = &m_color[static_cast<size_t>(y) * m_stride];
+        uint8_t* out = row.data();
+        for (uint32_t x = 0; x < m_width; ++x) {
+            const uint32_t pixel = pixels[x];
+            if (tga) {
+                *out++ = static_cast<uint8_t>(pixel >> 16);   // BGRA
+                *out++ = static_cast<uint8_t>(pixel >> 8);
+                *out++ = static_cast<uint8_t>(pixel);
+                *out++ = static_cast<uint8_t>(pixel >> 24);
+            } else {
+                *out++ = static_cast<uint8_t>(pixel);
+                *out++ = static_cast<uint8_t>(pixel >> 8);
+                *out++ = static_cast<uint8_t>(pixel >> 16);
+            }
+        }
+        file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+
+    if (!file) {
+        core::Logger::error("Failed to write image: " + path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace graphics
+} // namespace ogde
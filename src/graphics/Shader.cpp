@@ -24,7 +24,8 @@ bool Shader::createFromSource(
     const std::string& vertexShaderSource,
     const std::string& pixelShaderSource,
     const D3D11_INPUT_ELEMENT_DESC* inputLayoutDesc,
-    UINT numElements)
+    UINT numElements,
+    ShaderCache* cache)
 {
     if (!device) {
         core::Logger::error("Shader::createFromSource: device is null");
@@ -32,16 +33,16 @@ bool Shader::createFromSource(
     }
 
     // Compile vertex shader
-    Microsoft::WRL::ComPtr<ID3DBlob> vsBlob;
-    if (!compileShader(vertexShaderSource, "VSMain", "vs_5_0", vsBlob.GetAddressOf())) {
+    std::vector<uint8_t> vsBytecode;
+    if (!compileShader(vertexShaderSource, "VSMain", "vs_5_0", cache, vsBytecode)) {
         core::Logger::error("Failed to compile vertex shader");
         return false;
     }
 
     // Create vertex shader
     HRESULT hr = device->CreateVertexShader(
-        vsBlob->GetBufferPointer(),
-        vsBlob->GetBufferSize(),
+        vsBytecode.data(),
+        vsBytecode.size(),
         nullptr,
         m_vertexShader.GetAddressOf()
     );
@@ -55,8 +56,8 @@ bool Shader::createFromSource(
         hr = device->CreateInputLayout(
             inputLayoutDesc,
             numElements,
-            vsBlob->GetBufferPointer(),
-            vsBlob->GetBufferSize(),
+            vsBytecode.data(),
+            vsBytecode.size(),
             m_inputLayout.GetAddressOf()
         );
         if (FAILED(hr)) {
@@ -66,16 +67,16 @@ bool Shader::createFromSource(
     }
 
     // Compile pixel shader
-    Microsoft::WRL::ComPtr<ID3DBlob> psBlob;
-    if (!compileShader(pixelShaderSource, "PSMain", "ps_5_0", psBlob.GetAddressOf())) {
+    std::vector<uint8_t> psBytecode;
+    if (!compileShader(pixelShaderSource, "PSMain", "ps_5_0", cache, psBytecode)) {
         core::Logger::error("Failed to compile pixel shader");
         return false;
     }
 
     // Create pixel shader
     hr = device->CreatePixelShader(
-        psBlob->GetBufferPointer(),
-        psBlob->GetBufferSize(),
+        psBytecode.data(),
+        psBytecode.size(),
         nullptr,
         m_pixelShader.GetAddressOf()
     );
@@ -104,37 +105,63 @@ bool Shader::compileShader(
     const std::string& source,
     const char* entryPoint,
     const char* target,
-    ID3DBlob** blob)
+    ShaderCache* cache,
+    std::vector<uint8_t>& bytecode)
 {
-    Microsoft::WRL::ComPtr<ID3DBlob> errorBlob;
-    
-    UINT flags = D3DCOMPILE_ENABLE_STRICTNESS;
+    ShaderCompileRequest request;
+    request.source = source;
+    request.entryPoint = entryPoint;
+    request.target = target;
+    request.flags = D3DCOMPILE_ENABLE_STRICTNESS;
+    request.compiler = "d3dcompiler_" + std::to_string(D3D_COMPILER_VERSION);
 #ifdef _DEBUG
-    flags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+    request.flags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
 #endif
 
+    std::string errors;
+    bool compiled = cache
+        ? cache->getOrCompile(request, &Shader::compileBytecode, bytecode, &errors)
+        : compileBytecode(request, bytecode, errors);
+    if (!compiled) {
+        core::Logger::error("Shader compilation error: " + errors);
+    }
+    return compiled;
+}
+
+bool Shader::compileBytecode(const ShaderCompileRequest& request, std::vector<uint8_t>& bytecode,
+                             std::string& errors)
+{
+    // D3DCompile takes a null-terminated macro array
+    std::vector<D3D_SHADER_MACRO> macros;
+    macros.reserve(request.defines.size() + 1);
+    for (const ShaderDefine& define : request.defines) {
+        macros.push_back({ define.name.c_str(), define.value.c_str() });
+    }
+    macros.push_back({ nullptr, nullptr });
+
+    Microsoft::WRL::ComPtr<ID3DBlob> blob;
+    Microsoft::WRL::ComPtr<ID3DBlob> errorBlob;
     HRESULT hr = D3DCompile(
-        source.c_str(),
-        source.size(),
-        nullptr,
+        request.source.c_str(),
+        request.source.size(),
+        request.name.empty() ? nullptr : request.name.c_str(),
+        macros.data(),
         nullptr,
-        nullptr,
-        entryPoint,
-        target,
-        flags,
+        request.entryPoint.c_str(),
+        request.target.c_str(),
+        request.flags,
         0,
-        blob,
+        blob.GetAddressOf(),
         errorBlob.GetAddressOf()
     );
 
     if (FAILED(hr)) {
-        if (errorBlob) {
-            std::string errorMsg = static_cast<const char*>(errorBlob->GetBufferPointer());
-            core::Logger::error("Shader compilation error: " + errorMsg);
-        }
+        errors = errorBlob ? static_cast<const char*>(errorBlob->GetBufferPointer()) : "D3DCompile failed";
         return false;
     }
 
+    const uint8_t* data = static_cast<const uint8_t*>(blob->GetBufferPointer());
+    bytecode.assign(data, data + blob->GetBufferSize());
     return true;
 }
 
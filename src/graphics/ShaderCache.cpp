@@ -0,0 +1,277 @@
+/**
+ * @file ShaderCache.cpp
+ * @brief Shader bytecode cache implementation
+ */
+
+#include "ogde/graphics/ShaderCache.h"
+#include "ogde/core/Hash.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace ogde {
+namespace graphics {
+
+namespace {
+
+// Bump when the key derivation or the file layout changes
+constexpr uint32_t kCacheVersion = 2;
+constexpr char kCacheMagic[4] = { 'O', 'G', 'S', 'C' };
+
+struct CacheFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint64_t payloadSize;
+    uint64_t payloadHash;
+};
+
+static_assert(sizeof(CacheFileHeader) == 32, "Cache file header is 32 bytes");
+
+// Length-prefixed, so no two field sequences serialize to the same bytes
+void appendField(std::vector<uint8_t>& out, const std::string& value) {
+    const uint64_t length = value.size();
+    const uint8_t* lengthBytes = reinterpret_cast<const uint8_t*>(&length);
+    out.insert(out.end(), lengthBytes, lengthBytes + sizeof(length));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+} // namespace
+
+ShaderCache::ShaderCache(const std::string& directory)
+    : m_directory(directory)
+{
+}
+
+ShaderCache::~ShaderCache() = default;
+
+uint64_t ShaderCache::computeKey(const ShaderCompileRequest& request) {
+    std::vector<const ShaderDefine*> defines;
+    defines.reserve(request.defines.size());
+    for (const ShaderDefine& define : request.defines) {
+        defines.push_back(&define);
+    }
+    std::sort(defines.begin(), defines.end(), [](const ShaderDefine* a, const ShaderDefine* b) {
+        return a->name != b->name ? a->name < b->name : a->value < b->value;
+    });
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(request.source.size() + 64);
+    const uint32_t header[2] = { kCacheVersion, request.flags };
+    const uint8_t* headerBytes = reinterpret_cast<const uint8_t*>(header);
+    bytes.insert(bytes.end(), headerBytes, headerBytes + sizeof(header));
+    appendField(bytes, request.source);
+    appendField(bytes, request.entryPoint);
+    appendField(bytes, request.target);
+    appendField(bytes, request.compiler);
+    for (const ShaderDefine* define : defines) {
+        appendField(bytes, define->name);
+        appendField(bytes, define->value);
+    }
+    return OGDE::Core::Hash64(bytes.data(), bytes.size());
+}
+
+bool ShaderCache::load(uint64_t key, std::vector<uint8_t>& bytecode) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            bytecode = it->second;
+            ++m_stats.memoryHits;
+            return true;
+        }
+    }
+
+    if (loadFile(key, bytecode)) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.emplace(key, bytecode);
+        ++m_stats.diskHits;
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_stats.misses;
+    return false;
+}
+
+bool ShaderCache::store(uint64_t key, const uint8_t* bytecode, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[key].assign(bytecode, bytecode + size);
+    }
+    if (m_directory.empty()) {
+        return true;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+
+    CacheFileHeader header;
+    std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.version = kCacheVersion;
+    header.key = key;
+    header.payloadSize = size;
+    header.payloadHash = OGDE::Core::Hash64(bytecode, size);
+
+    // Write a temporary file and rename it, so readers never see a partial entry
+    static std::atomic<uint32_t> s_tempCounter{ 0 };
+    const std::string path = getFilePath(key);
+    const std::string tempPath = path + ".tmp" + std::to_string(s_tempCounter.fetch_add(1));
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(bytecode), static_cast<std::streamsize>(size));
+        if (!file) {
+            file.close();
+            std::filesystem::remove(tempPath, error);
+            core::Logger::warning("Failed to write shader cache file: " + path);
+            return false;
+        }
+    }
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        core::Logger::warning("Failed to write shader cache file: " + path);
+        return false;
+    }
+    return true;
+}
+
+bool ShaderCache::getOrCompile(const ShaderCompileRequest& request, const ShaderCompileFunction& compiler,
+                               std::vector<uint8_t>& bytecode, std::string* errors) {
+    const uint64_t key = computeKey(request);
+    if (load(key, bytecode)) {
+        return true;
+    }
+
+    std::string compileErrors;
+    bytecode.clear();
+    if (!compiler || !compiler(request, bytecode, compileErrors)) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.compileFailures;
+        }
+        if (!compiler) {
+            compileErrors = "No shader compiler available";
+        }
+        if (errors) {
+            *errors = compileErrors;
+        }
+        return false;
+    }
+
+    store(key, bytecode.data(), bytecode.size());
+    return true;
+}
+
+void ShaderCache::clearMemory() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+std::string ShaderCache::getFilePath(uint64_t key) const {
+    if (m_directory.empty()) {
+        return std::string();
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.ogsc", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(m_directory) / name).string();
+}
+
+ShaderCacheStats ShaderCache::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+bool ShaderCache::loadFile(uint64_t key, std::vector<uint8_t>& bytecode) {
+    if (m_directory.empty()) {
+        return false;
+    }
+    const std::string path = getFilePath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    CacheFileHeader header;
+    bool valid = fileSize >= static_cast<std::streamoff>(sizeof(header));
+    if (valid) {
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        valid = file && std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) == 0 &&
+                header.version == kCacheVersion && header.key == key &&
+                header.payloadSize == static_cast<uint64_t>(fileSize) - sizeof(header);
+    }
+    if (valid) {
+        bytecode.resize(static_cast<size_t>(header.payloadSize));
+        file.read(reinterpret_cast<char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+        valid = file && OGDE::Core::Hash64(bytecode.data(), bytecode.size()) == header.payloadHash;
+    }
+
+    if (!valid) {
+        bytecode.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.rejectedFiles;
+        core::Logger::warning("Ignoring damaged shader cache file: " + path);
+    }
+    return valid;
+}
+
+std::vector<std::vector<ShaderDefine>> enumerateShaderPermutations(const std::vector<ShaderOption>& options) {
+    std::vector<std::vector<ShaderDefine>> permutations(1);
+    for (const ShaderOption& option : options) {
+        if (option.values.empty()) {
+            continue;
+        }
+        std::vector<std::vector<ShaderDefine>> next;
+        next.reserve(permutations.size() * option.values.size());
+        for (const std::vector<ShaderDefine>& defines : permutations) {
+            for (const std::string& value : option.values) {
+                next.push_back(defines);
+                if (!value.empty()) {
+                    next.back().push_back({ option.name, value });
+                }
+            }
+        }
+        permutations.swap(next);
+    }
+    return permutations;
+}
+
+std::vector<ShaderPermutation> compileShaderPermutations(ShaderCache& cache, const ShaderCompileRequest& base,
+                                                         const std::vector<ShaderOption>& options,
+                                                         const ShaderCompileFunction& compiler,
+                                                         core::JobSystem* jobSystem) {
+    const std::vector<std::vector<ShaderDefine>> permutations = enumerateShaderPermutations(options);
+    std::vector<ShaderPermutation> results(permutations.size());
+    for (size_t i = 0; i < permutations.size(); ++i) {
+        results[i].defines = base.defines;
+        results[i].defines.insert(results[i].defines.end(), permutations[i].begin(), permutations[i].end());
+    }
+
+    auto compileRange = [&](uint32_t begin, uint32_t end) {
+        ShaderCompileRequest request = base;
+        for (uint32_t i = begin; i < end; ++i) {
+            ShaderPermutation& result = results[i];
+            request.defines = result.defines;
+            result.key = ShaderCache::computeKey(request);
+            result.compiled = cache.getOrCompile(request, compiler, result.bytecode, &result.errors);
+        }
+    };
+    const uint32_t count = static_cast<uint32_t>(results.size());
+    if (jobSystem && count > 1) {
+        jobSystem->parallelFor(count, 1, compileRange);
+    } else {
+        compileRange(0, count);
+    }
+    return results;
+}
+
+} // namespace graphics
+} // namespace ogde
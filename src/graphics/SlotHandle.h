@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace OGDE {
+namespace Graphics {
+
+// Handle packing shared by TextureLoader, TextureStreamer and MaterialTable:
+// slot index + 1 in the low 24 bits (so 0 stays invalid) and an 8-bit slot
+// generation above it, so a handle kept after its slot is freed and reused
+// no longer resolves.
+
+constexpr uint32_t kSlotHandleIndexBits = 24;
+
+// Slot count limit: past it, index + 1 would spill into the generation byte
+constexpr uint32_t kMaxHandleSlots = (1u << kSlotHandleIndexBits) - 1;
+
+inline uint32_t MakeSlotHandle(uint32_t index, uint32_t generation) {
+    return ((generation & 0xFF) << kSlotHandleIndexBits) | (index + 1);
+}
+
+// Slot index of a handle; UINT32_MAX for the invalid handle 0
+inline uint32_t SlotHandleIndex(uint32_t handle) {
+    return (handle & kMaxHandleSlots) - 1;
+}
+
+// Whether a handle was issued for the slot's current generation
+inline bool SlotHandleMatches(uint32_t handle, uint32_t generation) {
+    return (generation & 0xFF) == (handle >> kSlotHandleIndexBits);
+}
+
+} // namespace Graphics
+} // namespace OGDE
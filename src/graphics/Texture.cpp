@@ -1,4 +1,7 @@
 #include "ogde/graphics/Texture.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/graphics/ImageDecoder.h"
 #include "ogde/core/Logger.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -17,17 +20,24 @@ Texture::Texture(Texture&& other) noexcept
     : width_(other.width_)
     , height_(other.height_)
     , channels_(other.channels_)
+    , pixels_(std::move(other.pixels_))
+    , decoded_(std::move(other.decoded_))
     , data_(other.data_)
+    , mappedFile_(std::move(other.mappedFile_))
+    , mipLevels_(std::move(other.mipLevels_))
+    , compressed_(other.compressed_)
+    , blockFormat_(other.blockFormat_)
     , filepath_(std::move(other.filepath_))
 #ifdef _WIN32
     , texture_(std::move(other.texture_))
     , shaderResourceView_(std::move(other.shaderResourceView_))
 #endif
 {
-    other.data_ = nullptr;
     other.width_ = 0;
     other.height_ = 0;
     other.channels_ = 0;
+    other.data_ = nullptr;
+    other.compressed_ = false;
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept {
@@ -37,7 +47,13 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         width_ = other.width_;
         height_ = other.height_;
         channels_ = other.channels_;
+        pixels_ = std::move(other.pixels_);
+        decoded_ = std::move(other.decoded_);
         data_ = other.data_;
+        mappedFile_ = std::move(other.mappedFile_);
+        mipLevels_ = std::move(other.mipLevels_);
+        compressed_ = other.compressed_;
+        blockFormat_ = other.blockFormat_;
         filepath_ = std::move(other.filepath_);
         
 #ifdef _WIN32
@@ -45,10 +61,11 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         shaderResourceView_ = std::move(other.shaderResourceView_);
 #endif
         
-        other.data_ = nullptr;
         other.width_ = 0;
         other.height_ = 0;
         other.channels_ = 0;
+        other.data_ = nullptr;
+        other.compressed_ = false;
     }
     return *this;
 }
@@ -56,23 +73,19 @@ Texture& Texture::operator=(Texture&& other) noexcept {
 bool Texture::LoadFromFile(const std::string& filepath) {
     FreeImageData();
     
-    // Use stb_image to load the texture
-    int width, height, channels;
-    data_ = stbi_load(filepath.c_str(), &width, &height, &channels, 0);
+    if (TextureContainer::IsContainerPath(filepath)) {
+        return LoadContainer(filepath);
+    }
     
-    if (!data_) {
+    Core::MappedFile file;
+    if (!file.Open(filepath) || !LoadFromEncodedMemory(file.GetData(), file.GetSize(), filepath)) {
         ogde::core::Logger::error("Failed to load texture: " + filepath);
         return false;
     }
     
-    width_ = width;
-    height_ = height;
-    channels_ = channels;
-    filepath_ = filepath;
-    
     ogde::core::Logger::info("Loaded texture: " + filepath + 
-                             " (" + std::to_string(width) + "x" + std::to_string(height) + 
-                             ", " + std::to_string(channels) + " channels)");
+                             " (" + std::to_string(width_) + "x" + std::to_string(height_) + 
+                             ", " + std::to_string(channels_) + " channels)");
     
     return true;
 }
@@ -85,21 +98,195 @@ bool Texture::LoadFromMemory(const uint8_t* data, int width, int height, int cha
     
     FreeImageData();
     
-    size_t dataSize = width * height * channels;
-    data_ = new uint8_t[dataSize];
-    memcpy(data_, data, dataSize);
+    SetBaseLevel(data, width, height, channels);
+    filepath_ = "(memory)";
+    
+    return true;
+}
+
+bool Texture::LoadFromEncodedMemory(const uint8_t* data, size_t size, const std::string& name) {
+    FreeImageData();
+    
+    if (!data || size == 0 || size > static_cast<size_t>(INT32_MAX)) {
+        ogde::core::Logger::error("Invalid encoded image: " + name);
+        return false;
+    }
+    
+    // PNG and QOI decode straight into the texture's own buffer
+    ImageInfo info;
+    if (ImageDecoder::ReadInfo(data, size, info)) {
+        MipLevel base;
+        base.width = info.width;
+        base.height = info.height;
+        base.size = static_cast<size_t>(info.width) * info.height * info.channels;
+        // Every byte is written by the decoder, so skip the zero fill a vector would do
+        std::unique_ptr<uint8_t[]> pixels = std::make_unique_for_overwrite<uint8_t[]>(base.size);
+        if (ImageDecoder::Decode(data, size, pixels.get())) {
+            decoded_ = std::move(pixels);
+            data_ = decoded_.get();
+            mipLevels_.assign(1, base);
+            width_ = info.width;
+            height_ = info.height;
+            channels_ = info.channels;
+            filepath_ = name;
+            return true;
+        }
+    }
+    
+    // Everything else (and anything the in-tree decoders reject) goes through stb_image
+    int width, height, channels;
+    stbi_uc* pixels = stbi_load_from_memory(data, static_cast<int>(size), &width, &height, &channels, 0);
+    
+    if (!pixels) {
+        ogde::core::Logger::error("Failed to decode texture: " + name);
+        return false;
+    }
+    
+    SetBaseLevel(pixels, width, height, channels);
+    stbi_image_free(pixels);
+    filepath_ = name;
+    
+    return true;
+}
+
+size_t Texture::GetMemorySize() const {
+    size_t size = 0;
+    for (const MipLevel& level : mipLevels_) {
+        size += level.size;
+    }
+    return size;
+}
+
+bool Texture::LoadContainer(const std::string& filepath) {
+    Core::MappedFile file;
+    if (!file.Open(filepath)) {
+        return false;
+    }
+    
+    OgtexInfo info;
+    if (!TextureContainer::Parse(file.GetData(), file.GetSize(), info)) {
+        ogde::core::Logger::error("Failed to load texture container: " + filepath);
+        return false;
+    }
+    
+    // Point straight at the mapped payload; nothing is decoded or copied
+    width_ = info.width;
+    height_ = info.height;
+    channels_ = info.channels;
+    compressed_ = info.compressed;
+    blockFormat_ = info.blockFormat;
+    mipLevels_ = std::move(info.levels);
+    data_ = info.payload;
+    mappedFile_ = std::move(file);
+    filepath_ = filepath;
+    
+    ogde::core::Logger::info("Mapped texture: " + filepath + 
+                             " (" + std::to_string(width_) + "x" + std::to_string(height_) + 
+                             ", " + std::to_string(mipLevels_.size()) + " levels)");
+    
+    return true;
+}
+
+bool Texture::GenerateMipmaps(const MipSettings& settings) {
+    if (!IsLoaded()) {
+        ogde::core::Logger::error("Cannot generate mipmaps for an empty texture");
+        return false;
+    }
+    if (compressed_) {
+        ogde::core::Logger::error("Cannot generate mipmaps for a compressed texture: " + filepath_);
+        return false;
+    }
+    
+    std::vector<uint8_t> pixels;
+    std::vector<MipLevel> levels;
+    if (!MipGenerator::GenerateChain(GetData(), width_, height_, channels_, settings, pixels, levels)) {
+        ogde::core::Logger::error("Failed to generate mipmaps: " + filepath_);
+        return false;
+    }
+    
+    SetOwnedPixels(std::move(pixels), std::move(levels));
+    return true;
+}
+
+bool Texture::Compress(const CompressionSettings& settings) {
+    if (!IsLoaded() || compressed_) {
+        ogde::core::Logger::error("Texture has no uncompressed data to compress: " + filepath_);
+        return false;
+    }
+    if (width_ % 4 != 0 || height_ % 4 != 0) {
+        ogde::core::Logger::error("Block-compressed textures must be a multiple of 4 pixels: " + filepath_);
+        return false;
+    }
+    
+    std::vector<MipLevel> levels = mipLevels_;
+    size_t totalSize = 0;
+    for (MipLevel& level : levels) {
+        level.offset = totalSize;
+        level.size = BlockCompressor::GetCompressedSize(settings.format, level.width, level.height);
+        totalSize += level.size;
+    }
+    
+    std::vector<uint8_t> blocks(totalSize);
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const MipLevel& source = mipLevels_[i];
+        if (!BlockCompressor::Encode(data_ + source.offset, source.width, source.height, channels_,
+                                     settings, blocks.data() + levels[i].offset)) {
+            ogde::core::Logger::error("Failed to compress texture: " + filepath_);
+            return false;
+        }
+    }
     
+    SetOwnedPixels(std::move(blocks), std::move(levels));
+    compressed_ = true;
+    blockFormat_ = settings.format;
+    return true;
+}
+
+bool Texture::PremultiplyAlpha() {
+    if (!IsLoaded() || compressed_ || channels_ != 4) {
+        ogde::core::Logger::error("Alpha premultiplication needs uncompressed RGBA data: " + filepath_);
+        return false;
+    }
+    
+    const MipLevel& last = mipLevels_.back();
+    const size_t pixelCount = (last.offset + last.size) / 4;
+    if (IsMapped()) {
+        std::vector<uint8_t> pixels(pixelCount * 4);
+        PixelConverter::PremultiplyAlpha(data_, pixels.data(), pixelCount);
+        std::vector<MipLevel> levels = mipLevels_;
+        SetOwnedPixels(std::move(pixels), std::move(levels));
+    } else {
+        uint8_t* owned = decoded_ ? decoded_.get() : pixels_.data();
+        PixelConverter::PremultiplyAlpha(owned, owned, pixelCount);
+    }
+    return true;
+}
+
+void Texture::SetBaseLevel(const uint8_t* data, int width, int height, int channels) {
+    MipLevel base;
+    base.width = width;
+    base.height = height;
+    base.offset = 0;
+    base.size = static_cast<size_t>(width) * height * channels;
+    
+    SetOwnedPixels(std::vector<uint8_t>(data, data + base.size), std::vector<MipLevel>(1, base));
+    compressed_ = false;
     width_ = width;
     height_ = height;
     channels_ = channels;
-    filepath_ = "(memory)";
-    
-    return true;
+}
+
+void Texture::SetOwnedPixels(std::vector<uint8_t> pixels, std::vector<MipLevel> levels) {
+    pixels_ = std::move(pixels);
+    decoded_.reset();
+    mipLevels_ = std::move(levels);
+    data_ = pixels_.data();
+    mappedFile_.Close();
 }
 
 #ifdef _WIN32
 bool Texture::InitializeD3D11(ID3D11Device* device) {
-    if (!device || !data_) {
+    if (!device || !IsLoaded()) {
         ogde::core::Logger::error("Invalid device or texture data");
         return false;
     }
@@ -108,51 +295,59 @@ bool Texture::InitializeD3D11(ID3D11Device* device) {
     texture_.Reset();
     shaderResourceView_.Reset();
     
-    // Determine DXGI format based on channels
+    // Determine DXGI format based on block format or channels
     DXGI_FORMAT format;
-    switch (channels_) {
-        case 1:
-            format = DXGI_FORMAT_R8_UNORM;
-            break;
-        case 2:
-            format = DXGI_FORMAT_R8G8_UNORM;
-            break;
-        case 3:
-            // RGB needs to be converted to RGBA
-            format = DXGI_FORMAT_R8G8B8A8_UNORM;
-            break;
-        case 4:
-            format = DXGI_FORMAT_R8G8B8A8_UNORM;
-            break;
-        default:
-            ogde::core::Logger::error("Unsupported texture channel count: " + std::to_string(channels_));
-            return false;
+    if (compressed_) {
+        switch (blockFormat_) {
+            case BlockFormat::BC1: format = DXGI_FORMAT_BC1_UNORM; break;
+            case BlockFormat::BC3: format = DXGI_FORMAT_BC3_UNORM; break;
+            case BlockFormat::BC4: format = DXGI_FORMAT_BC4_UNORM; break;
+            case BlockFormat::BC5: format = DXGI_FORMAT_BC5_UNORM; break;
+            case BlockFormat::BC7: format = DXGI_FORMAT_BC7_UNORM; break;
+            default:
+                ogde::core::Logger::error("Unsupported block format");
+                return false;
+        }
+    } else {
+        switch (channels_) {
+            case 1:
+                format = DXGI_FORMAT_R8_UNORM;
+                break;
+            case 2:
+                format = DXGI_FORMAT_R8G8_UNORM;
+                break;
+            case 3:
+                // RGB needs to be converted to RGBA
+                format = DXGI_FORMAT_R8G8B8A8_UNORM;
+                break;
+            case 4:
+                format = DXGI_FORMAT_R8G8B8A8_UNORM;
+                break;
+            default:
+                ogde::core::Logger::error("Unsupported texture channel count: " + std::to_string(channels_));
+                return false;
+        }
     }
     
     // Prepare texture data (convert RGB to RGBA if needed)
+    const int mipCount = GetMipLevelCount();
+    const int uploadChannels = (channels_ == 3) ? 4 : channels_;
     std::vector<uint8_t> textureData;
-    const uint8_t* dataToUse = data_;
     
-    if (channels_ == 3) {
+    if (channels_ == 3 && !compressed_) {
         // Convert RGB to RGBA
-        size_t pixelCount = width_ * height_;
+        const MipLevel& last = mipLevels_.back();
+        size_t pixelCount = (last.offset + last.size) / 3;
         textureData.resize(pixelCount * 4);
-        
-        for (size_t i = 0; i < pixelCount; ++i) {
-            textureData[i * 4 + 0] = data_[i * 3 + 0]; // R
-            textureData[i * 4 + 1] = data_[i * 3 + 1]; // G
-            textureData[i * 4 + 2] = data_[i * 3 + 2]; // B
-            textureData[i * 4 + 3] = 255;               // A
-        }
-        
-        dataToUse = textureData.data();
+        PixelConverter::RgbToRgba(data_, textureData.data(), pixelCount);
     }
+    const uint8_t* dataToUse = textureData.empty() ? data_ : textureData.data();
     
     // Create texture description
     D3D11_TEXTURE2D_DESC texDesc = {};
     texDesc.Width = width_;
     texDesc.Height = height_;
-    texDesc.MipLevels = 1;
+    texDesc.MipLevels = mipCount;
     texDesc.ArraySize = 1;
     texDesc.Format = format;
     texDesc.SampleDesc.Count = 1;
@@ -162,14 +357,23 @@ bool Texture::InitializeD3D11(ID3D11Device* device) {
     texDesc.CPUAccessFlags = 0;
     texDesc.MiscFlags = 0;
     
-    // Create subresource data
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = dataToUse;
-    initData.SysMemPitch = width_ * (channels_ == 3 ? 4 : channels_);
-    initData.SysMemSlicePitch = 0;
+    // Create subresource data, one entry per mip level
+    std::vector<D3D11_SUBRESOURCE_DATA> initData(mipCount);
+    for (int level = 0; level < mipCount; ++level) {
+        const MipLevel& mip = mipLevels_[level];
+        if (compressed_) {
+            // Rows of 4x4 blocks
+            initData[level].pSysMem = data_ + mip.offset;
+            initData[level].SysMemPitch = static_cast<UINT>(((mip.width + 3) / 4) * BlockCompressor::GetBlockSize(blockFormat_));
+        } else {
+            initData[level].pSysMem = dataToUse + mip.offset / channels_ * uploadChannels;
+            initData[level].SysMemPitch = mip.width * uploadChannels;
+        }
+        initData[level].SysMemSlicePitch = 0;
+    }
     
     // Create the texture
-    HRESULT hr = device->CreateTexture2D(&texDesc, &initData, texture_.GetAddressOf());
+    HRESULT hr = device->CreateTexture2D(&texDesc, initData.data(), texture_.GetAddressOf());
     if (FAILED(hr)) {
         ogde::core::Logger::error("Failed to create D3D11 texture");
         return false;
@@ -180,7 +384,7 @@ bool Texture::InitializeD3D11(ID3D11Device* device) {
     srvDesc.Format = format;
     srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
     srvDesc.Texture2D.MostDetailedMip = 0;
-    srvDesc.Texture2D.MipLevels = 1;
+    srvDesc.Texture2D.MipLevels = mipCount;
     
     // Create the shader resource view
     hr = device->CreateShaderResourceView(texture_.Get(), &srvDesc, shaderResourceView_.GetAddressOf());
@@ -210,10 +414,13 @@ void Texture::Release() {
 }
 
 void Texture::FreeImageData() {
-    if (data_) {
-        stbi_image_free(data_);
-        data_ = nullptr;
-    }
+    pixels_.clear();
+    pixels_.shrink_to_fit();
+    decoded_.reset();
+    data_ = nullptr;
+    mappedFile_.Close();
+    mipLevels_.clear();
+    compressed_ = false;
 }
 
 } // namespace Graphics
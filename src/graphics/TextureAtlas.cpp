@@ -0,0 +1,319 @@
+/**
+ * Texture Atlas Implementation
+ */
+
+#include "ogde/graphics/TextureAtlas.h"
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+bool Contains(const AtlasRect& outer, const AtlasRect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+int RoundUp(int value, int multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+int NextPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+} // namespace
+
+AtlasPacker::AtlasPacker(int width, int height)
+    : width_(width)
+    , height_(height) {
+    freeRects_.push_back({ 0, 0, width, height });
+}
+
+bool AtlasPacker::Insert(int width, int height, AtlasRect& outRect) {
+    int bestShort = 0;
+    int bestLong = 0;
+    const AtlasRect* best = nullptr;
+    for (const AtlasRect& free : freeRects_) {
+        if (free.width < width || free.height < height) {
+            continue;
+        }
+        int leftoverX = free.width - width;
+        int leftoverY = free.height - height;
+        int shortSide = std::min(leftoverX, leftoverY);
+        int longSide = std::max(leftoverX, leftoverY);
+        if (!best || shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+            best = &free;
+            bestShort = shortSide;
+            bestLong = longSide;
+        }
+    }
+    if (!best) {
+        return false;
+    }
+
+    outRect = { best->x, best->y, width, height };
+    SplitFreeRects(outRect);
+    PruneFreeRects();
+    usedArea_ += static_cast<int64_t>(width) * height;
+    return true;
+}
+
+float AtlasPacker::GetOccupancy() const {
+    return static_cast<float>(static_cast<double>(usedArea_) / (static_cast<double>(width_) * height_));
+}
+
+void AtlasPacker::SplitFreeRects(const AtlasRect& used) {
+    std::vector<AtlasRect> result;
+    result.reserve(freeRects_.size() + 4);
+    for (const AtlasRect& free : freeRects_) {
+        bool overlaps = used.x < free.x + free.width && used.x + used.width > free.x &&
+                        used.y < free.y + free.height && used.y + used.height > free.y;
+        if (!overlaps) {
+            result.push_back(free);
+            continue;
+        }
+
+        // Up to four maximal rectangles around the used area
+        if (used.x > free.x) {
+            result.push_back({ free.x, free.y, used.x - free.x, free.height });
+        }
+        if (used.x + used.width < free.x + free.width) {
+            int x = used.x + used.width;
+            result.push_back({ x, free.y, free.x + free.width - x, free.height });
+        }
+        if (used.y > free.y) {
+            result.push_back({ free.x, free.y, free.width, used.y - free.y });
+        }
+        if (used.y + used.height < free.y + free.height) {
+            int y = used.y + used.height;
+            result.push_back({ free.x, y, free.width, free.y + free.height - y });
+        }
+    }
+    freeRects_ = std::move(result);
+}
+
+void AtlasPacker::PruneFreeRects() {
+    for (size_t i = 0; i < freeRects_.size(); ++i) {
+        for (size_t j = i + 1; j < freeRects_.size(); ++j) {
+            if (Contains(freeRects_[j], freeRects_[i])) {
+                freeRects_.erase(freeRects_.begin() + i);
+                --i;
+                break;
+            }
+            if (Contains(freeRects_[i], freeRects_[j])) {
+                freeRects_.erase(freeRects_.begin() + j);
+                --j;
+            }
+        }
+    }
+}
+
+bool TextureAtlas::Build(const std::vector<const Texture*>& images, const AtlasSettings& settings) {
+    pages_.clear();
+    regions_.clear();
+
+    if (images.empty()) {
+        ogde::core::Logger::error("Cannot build an atlas without images");
+        return false;
+    }
+    for (const Texture* image : images) {
+        if (!image || !image->IsLoaded() || image->IsCompressed()) {
+            ogde::core::Logger::error("Atlas images must be loaded and uncompressed");
+            return false;
+        }
+    }
+
+    bool built = settings.layout == AtlasLayout::Array ? BuildArray(images, settings) : BuildAtlas(images, settings);
+    if (!built) {
+        pages_.clear();
+        regions_.clear();
+    }
+    return built;
+}
+
+void TextureAtlas::RemapUV(int image, float u, float v, float& outU, float& outV) const {
+    const AtlasRegion& region = regions_[image];
+    outU = region.u0 + u * (region.u1 - region.u0);
+    outV = region.v0 + v * (region.v1 - region.v0);
+}
+
+bool TextureAtlas::BuildAtlas(const std::vector<const Texture*>& images, const AtlasSettings& settings) {
+    const int padding = std::max(0, settings.padding);
+
+    // Keep a border texel at every generated level, and align cells to the
+    // coarsest level so its texels never straddle two images
+    int mipLevels = 1;
+    if (settings.generateMipmaps) {
+        while ((1 << mipLevels) <= padding) {
+            ++mipLevels;
+        }
+        if (settings.mipSettings.maxLevels > 0) {
+            mipLevels = std::min(mipLevels, settings.mipSettings.maxLevels);
+        }
+    }
+    const int alignment = 1 << (mipLevels - 1);
+    const int maxSize = settings.maxSize / alignment * alignment;
+
+    const size_t count = images.size();
+    std::vector<int> cellWidth(count), cellHeight(count);
+    int64_t totalArea = 0;
+    int widest = 0;
+    int tallest = 0;
+    for (size_t i = 0; i < count; ++i) {
+        cellWidth[i] = RoundUp(images[i]->GetWidth() + 2 * padding, alignment);
+        cellHeight[i] = RoundUp(images[i]->GetHeight() + 2 * padding, alignment);
+        if (cellWidth[i] > maxSize || cellHeight[i] > maxSize) {
+            ogde::core::Logger::error("Atlas image does not fit in a " + std::to_string(maxSize) + " page");
+            return false;
+        }
+        totalArea += static_cast<int64_t>(cellWidth[i]) * cellHeight[i];
+        widest = std::max(widest, cellWidth[i]);
+        tallest = std::max(tallest, cellHeight[i]);
+    }
+
+    // Largest first packs tighter
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        int sideA = std::max(cellWidth[a], cellHeight[a]);
+        int sideB = std::max(cellWidth[b], cellHeight[b]);
+        return sideA != sideB ? sideA > sideB : cellWidth[a] * cellHeight[a] > cellWidth[b] * cellHeight[b];
+    });
+
+    // Grow a single power-of-two page until everything fits
+    std::vector<AtlasPacker> packers;
+    std::vector<AtlasRect> cells(count);
+    std::vector<int> cellPage(count, 0);
+    int side = NextPowerOfTwo(static_cast<int>(std::ceil(std::sqrt(static_cast<double>(totalArea)))));
+    int pageWidth = std::min(maxSize, std::max(side, NextPowerOfTwo(widest)));
+    int pageHeight = std::min(maxSize, std::max(side / 2, NextPowerOfTwo(tallest)));
+    bool packed = false;
+    while (!packed) {
+        AtlasPacker packer(pageWidth, pageHeight);
+        packed = true;
+        for (size_t i : order) {
+            if (!packer.Insert(cellWidth[i], cellHeight[i], cells[i])) {
+                packed = false;
+                break;
+            }
+        }
+        if (packed) {
+            packers.push_back(packer);
+        } else if (pageWidth >= maxSize && pageHeight >= maxSize) {
+            break;
+        } else if (pageHeight < pageWidth || pageWidth >= maxSize) {
+            pageHeight = std::min(maxSize, pageHeight * 2);
+        } else {
+            pageWidth = std::min(maxSize, pageWidth * 2);
+        }
+    }
+
+    // Still too much for one page: fill full-size pages in order
+    if (!packed) {
+        for (size_t i : order) {
+            bool placed = false;
+            for (size_t page = 0; page < packers.size() && !placed; ++page) {
+                placed = packers[page].Insert(cellWidth[i], cellHeight[i], cells[i]);
+                cellPage[i] = static_cast<int>(page);
+            }
+            if (!placed) {
+                packers.emplace_back(maxSize, maxSize);
+                packers.back().Insert(cellWidth[i], cellHeight[i], cells[i]);
+                cellPage[i] = static_cast<int>(packers.size() - 1);
+            }
+        }
+    }
+
+    // Copy every image into its cell; the border and alignment slack repeat the edge pixels
+    std::vector<std::vector<uint8_t>> pixels(packers.size());
+    for (size_t page = 0; page < packers.size(); ++page) {
+        pixels[page].assign(static_cast<size_t>(packers[page].GetWidth()) * packers[page].GetHeight() * 4, 0);
+    }
+
+    regions_.resize(count);
+    std::vector<uint8_t> rgba;
+    for (size_t i = 0; i < count; ++i) {
+        const Texture& image = *images[i];
+        const int width = image.GetWidth();
+        const int height = image.GetHeight();
+        rgba.resize(static_cast<size_t>(width) * height * 4);
+        BlockCompressor::ExpandToRgba(image.GetData(), width, height, image.GetChannels(), rgba.data());
+
+        const AtlasRect& cell = cells[i];
+        const AtlasPacker& packer = packers[cellPage[i]];
+        uint8_t* page = pixels[cellPage[i]].data();
+        for (int y = 0; y < cell.height; ++y) {
+            int sourceY = std::min(std::max(y - padding, 0), height - 1);
+            uint8_t* row = page + (static_cast<size_t>(cell.y + y) * packer.GetWidth() + cell.x) * 4;
+            const uint8_t* sourceRow = rgba.data() + static_cast<size_t>(sourceY) * width * 4;
+            for (int x = 0; x < cell.width; ++x) {
+                int sourceX = std::min(std::max(x - padding, 0), width - 1);
+                std::copy(sourceRow + sourceX * 4, sourceRow + sourceX * 4 + 4, row + x * 4);
+            }
+        }
+
+        AtlasRegion& region = regions_[i];
+        region.page = cellPage[i];
+        region.rect = { cell.x + padding, cell.y + padding, width, height };
+        const float invWidth = 1.0f / static_cast<float>(packer.GetWidth());
+        const float invHeight = 1.0f / static_cast<float>(packer.GetHeight());
+        region.u0 = region.rect.x * invWidth;
+        region.v0 = region.rect.y * invHeight;
+        region.u1 = (region.rect.x + width) * invWidth;
+        region.v1 = (region.rect.y + height) * invHeight;
+    }
+
+    // Wider filters would read past the border into neighbouring cells
+    MipSettings mipSettings = settings.mipSettings;
+    mipSettings.maxLevels = mipLevels;
+    mipSettings.filter = MipFilter::Box;
+    pages_.resize(packers.size());
+    for (size_t page = 0; page < packers.size(); ++page) {
+        pages_[page].LoadFromMemory(pixels[page].data(), packers[page].GetWidth(), packers[page].GetHeight(), 4);
+        if (settings.generateMipmaps && mipLevels > 1 && !pages_[page].GenerateMipmaps(mipSettings)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TextureAtlas::BuildArray(const std::vector<const Texture*>& images, const AtlasSettings& settings) {
+    const int width = images[0]->GetWidth();
+    const int height = images[0]->GetHeight();
+    for (const Texture* image : images) {
+        if (image->GetWidth() != width || image->GetHeight() != height) {
+            ogde::core::Logger::error("Texture array layers must all have the same size");
+            return false;
+        }
+    }
+
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+    pages_.resize(images.size());
+    regions_.resize(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        BlockCompressor::ExpandToRgba(images[i]->GetData(), width, height, images[i]->GetChannels(), rgba.data());
+        pages_[i].LoadFromMemory(rgba.data(), width, height, 4);
+        if (settings.generateMipmaps && !pages_[i].GenerateMipmaps(settings.mipSettings)) {
+            return false;
+        }
+
+        AtlasRegion& region = regions_[i];
+        region.page = static_cast<int>(i);
+        region.rect = { 0, 0, width, height };
+    }
+    return true;
+}
+
+} // namespace Graphics
+} // namespace OGDE
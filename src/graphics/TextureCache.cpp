@@ -0,0 +1,206 @@
+/**
+ * Texture Cache Implementation
+ */
+
+#include "ogde/graphics/TextureCache.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/core/FileSystem.h"
+#include "ogde/core/Hash.h"
+#include "ogde/core/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// A matching hash is not proof: compare against a file the entry was loaded from
+bool SameContent(const std::string& cachedPath, const Core::MappedFile& file) {
+    Core::MappedFile cached;
+    return cached.Open(cachedPath) && cached.GetSize() == file.GetSize() &&
+           std::memcmp(cached.GetData(), file.GetData(), file.GetSize()) == 0;
+}
+
+} // namespace
+
+TextureCache::TextureCache(const TextureCacheSettings& settings)
+    : settings_(settings) {
+}
+
+TextureCache::~TextureCache() = default;
+
+std::shared_ptr<Texture> TextureCache::Load(const std::string& filepath) {
+    const std::string key = MakeKey(filepath);
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto byPath = byPath_.find(key);
+    if (byPath != byPath_.end()) {
+        ++pathHits_;
+        return Touch(byPath->second);
+    }
+
+    // Hash the mapped file; an identical file under another name shares its texture
+    Core::MappedFile file;
+    if (!file.Open(filepath)) {
+        return nullptr;
+    }
+    const uint64_t hash = Core::Hash64(file.GetData(), file.GetSize());
+    auto range = byContent_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->fileSize == file.GetSize() && SameContent(it->second->paths.front(), file)) {
+            ++contentHits_;
+            it->second->paths.push_back(key);
+            byPath_.emplace(key, it->second);
+            return Touch(it->second);
+        }
+    }
+
+    auto texture = std::make_shared<Texture>();
+    bool loaded = TextureContainer::IsContainerPath(filepath)
+        ? texture->LoadFromFile(filepath)
+        : texture->LoadFromEncodedMemory(file.GetData(), file.GetSize(), filepath);
+    if (!loaded) {
+        return nullptr;
+    }
+    if (settings_.generateMipmaps && texture->GetMipLevelCount() == 1 && !texture->IsCompressed()) {
+        texture->GenerateMipmaps(settings_.mipSettings);
+    }
+    ++misses_;
+
+    Entry entry;
+    entry.texture = texture;
+    entry.paths.push_back(key);
+    entry.contentHash = hash;
+    entry.fileSize = file.GetSize();
+    entry.bytes = texture->GetMemorySize();
+    entry.lastUsed = ++clock_;
+    entries_.push_front(std::move(entry));
+    byPath_.emplace(key, entries_.begin());
+    byContent_.emplace(hash, entries_.begin());
+    totalBytes_ += entries_.front().bytes;
+
+    EvictLocked(settings_.budgetBytes);
+    return texture;
+}
+
+std::shared_ptr<Texture> TextureCache::Find(const std::string& filepath) {
+    const std::string key = MakeKey(filepath);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto byPath = byPath_.find(key);
+    return byPath != byPath_.end() ? Touch(byPath->second) : nullptr;
+}
+
+void TextureCache::Remove(const std::string& filepath) {
+    const std::string key = MakeKey(filepath);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto byPath = byPath_.find(key);
+    if (byPath == byPath_.end()) {
+        return;
+    }
+
+    EntryList::iterator entry = byPath->second;
+    byPath_.erase(byPath);
+    entry->paths.erase(std::find(entry->paths.begin(), entry->paths.end(), key));
+    if (entry->paths.empty()) {
+        // Outside owners keep their texture alive; the cache just stops handing it out
+        EraseLocked(entry);
+    }
+}
+
+size_t TextureCache::Trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return EvictLocked(settings_.budgetBytes);
+}
+
+size_t TextureCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return EvictLocked(0);
+}
+
+void TextureCache::SetBudget(size_t budgetBytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    settings_.budgetBytes = budgetBytes;
+    EvictLocked(budgetBytes);
+}
+
+TextureCacheStats TextureCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TextureCacheStats stats;
+    stats.textureCount = static_cast<uint32_t>(entries_.size());
+    stats.budgetBytes = settings_.budgetBytes;
+    stats.totalBytes = totalBytes_;
+    for (const Entry& entry : entries_) {
+        if (entry.texture.use_count() > 1) {
+            ++stats.referencedCount;
+            stats.referencedBytes += entry.bytes;
+        }
+    }
+    stats.pathHits = pathHits_;
+    stats.contentHits = contentHits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    return stats;
+}
+
+std::vector<TextureCacheEntryInfo> TextureCache::GetEntries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TextureCacheEntryInfo> result;
+    result.reserve(entries_.size());
+    for (const Entry& entry : entries_) {
+        TextureCacheEntryInfo info;
+        info.paths = entry.paths;
+        info.contentHash = entry.contentHash;
+        info.bytes = entry.bytes;
+        info.references = entry.texture.use_count() - 1;
+        info.lastUsed = entry.lastUsed;
+        result.push_back(std::move(info));
+    }
+    return result;
+}
+
+std::string TextureCache::MakeKey(const std::string& filepath) {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(filepath, error);
+    return Core::FileSystem::NormalizePath(error ? filepath : absolute.string());
+}
+
+std::shared_ptr<Texture> TextureCache::Touch(EntryList::iterator entry) {
+    entry->lastUsed = ++clock_;
+    entries_.splice(entries_.begin(), entries_, entry);
+    return entry->texture;
+}
+
+size_t TextureCache::EvictLocked(size_t budgetBytes) {
+    size_t evicted = 0;
+    auto it = entries_.end();
+    while (totalBytes_ > budgetBytes && it != entries_.begin()) {
+        --it;
+        if (it->texture.use_count() > 1) {
+            continue;
+        }
+        for (const std::string& path : it->paths) {
+            byPath_.erase(path);
+        }
+        EraseLocked(it++);
+        ++evicted;
+        ++evictions_;
+    }
+    return evicted;
+}
+
+void TextureCache::EraseLocked(EntryList::iterator entry) {
+    auto range = byContent_.equal_range(entry->contentHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entry) {
+            byContent_.erase(it);
+            break;
+        }
+    }
+    totalBytes_ -= entry->bytes;
+    entries_.erase(entry);
+}
+
+} // namespace Graphics
+} // namespace OGDE
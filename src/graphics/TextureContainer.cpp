@@ -0,0 +1,160 @@
+/**
+ * Texture Container Implementation
+ */
+
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/graphics/Texture.h"
+#include "ogde/core/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+// Largest dimension accepted from a file; guards the size arithmetic below
+constexpr uint32_t kMaxDimension = 65536;
+
+size_t LevelTableEnd(uint32_t mipCount) {
+    return sizeof(OgtexHeader) + static_cast<size_t>(mipCount) * sizeof(OgtexLevel);
+}
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+size_t ExpectedLevelSize(const OgtexInfo& info, int width, int height) {
+    if (info.compressed) {
+        return BlockCompressor::GetCompressedSize(info.blockFormat, width, height);
+    }
+    return static_cast<size_t>(width) * height * info.channels;
+}
+
+} // namespace
+
+bool TextureContainer::Write(const std::string& filepath, const Texture& texture) {
+    if (!texture.IsLoaded()) {
+        ogde::core::Logger::error("Cannot write an empty texture: " + filepath);
+        return false;
+    }
+
+    const int mipCount = texture.GetMipLevelCount();
+    OgtexHeader header;
+    header.width = static_cast<uint32_t>(texture.GetWidth());
+    header.height = static_cast<uint32_t>(texture.GetHeight());
+    header.channels = static_cast<uint32_t>(texture.GetChannels());
+    header.format = texture.IsCompressed() ? static_cast<uint32_t>(texture.GetBlockFormat()) + 1 : 0;
+    header.mipCount = static_cast<uint32_t>(mipCount);
+    header.payloadOffset = AlignUp(LevelTableEnd(header.mipCount), kOgtexPayloadAlignment);
+
+    std::vector<OgtexLevel> table(mipCount);
+    for (int level = 0; level < mipCount; ++level) {
+        const MipLevel& mip = texture.GetMipLevel(level);
+        table[level].width = static_cast<uint32_t>(mip.width);
+        table[level].height = static_cast<uint32_t>(mip.height);
+        table[level].offset = mip.offset;
+        table[level].size = mip.size;
+        header.payloadSize = std::max<uint64_t>(header.payloadSize, mip.offset + mip.size);
+    }
+
+    std::ofstream file(filepath, std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        ogde::core::Logger::error("Failed to open file for writing: " + filepath);
+        return false;
+    }
+
+    const char padding[kOgtexPayloadAlignment] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(OgtexLevel)));
+    file.write(padding, static_cast<std::streamsize>(header.payloadOffset - LevelTableEnd(header.mipCount)));
+    file.write(reinterpret_cast<const char*>(texture.GetData()), static_cast<std::streamsize>(header.payloadSize));
+
+    if (!file.good()) {
+        ogde::core::Logger::error("Failed to write texture container: " + filepath);
+        return false;
+    }
+    return true;
+}
+
+bool TextureContainer::Parse(const uint8_t* data, size_t size, OgtexInfo& outInfo) {
+    OgtexHeader header;
+    if (!data || size < sizeof(header)) {
+        ogde::core::Logger::error("Texture container is truncated");
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != kOgtexMagic) {
+        ogde::core::Logger::error("Not a texture container (bad magic)");
+        return false;
+    }
+    if (header.version != kOgtexVersion) {
+        ogde::core::Logger::error("Unsupported texture container version: " + std::to_string(header.version));
+        return false;
+    }
+    if (header.width == 0 || header.height == 0 || header.width > kMaxDimension || header.height > kMaxDimension ||
+        header.channels < 1 || header.channels > 4 || header.format > static_cast<uint32_t>(BlockFormat::BC7) + 1 ||
+        header.mipCount == 0 ||
+        header.mipCount > static_cast<uint32_t>(MipGenerator::CalculateLevelCount(header.width, header.height))) {
+        ogde::core::Logger::error("Texture container header is invalid");
+        return false;
+    }
+    if (header.payloadOffset < LevelTableEnd(header.mipCount) || header.payloadOffset > size ||
+        header.payloadSize > size - header.payloadOffset) {
+        ogde::core::Logger::error("Texture container is truncated");
+        return false;
+    }
+
+    OgtexInfo info;
+    info.width = static_cast<int>(header.width);
+    info.height = static_cast<int>(header.height);
+    info.channels = static_cast<int>(header.channels);
+    info.compressed = header.format != 0;
+    info.blockFormat = info.compressed ? static_cast<BlockFormat>(header.format - 1) : BlockFormat::BC7;
+    info.payload = data + header.payloadOffset;
+    info.levels.resize(header.mipCount);
+
+    // Levels must be packed in order with no gaps; loaders size the pixel buffer from the last level
+    int width = info.width;
+    int height = info.height;
+    uint64_t expectedOffset = 0;
+    for (uint32_t level = 0; level < header.mipCount; ++level) {
+        OgtexLevel entry;
+        std::memcpy(&entry, data + sizeof(header) + level * sizeof(OgtexLevel), sizeof(entry));
+
+        if (entry.width != static_cast<uint32_t>(width) || entry.height != static_cast<uint32_t>(height) ||
+            entry.size != ExpectedLevelSize(info, width, height) || entry.offset != expectedOffset ||
+            entry.offset > header.payloadSize || entry.size > header.payloadSize - entry.offset) {
+            ogde::core::Logger::error("Texture container level " + std::to_string(level) + " is invalid");
+            return false;
+        }
+
+        MipLevel& mip = info.levels[level];
+        mip.width = width;
+        mip.height = height;
+        mip.offset = static_cast<size_t>(entry.offset);
+        mip.size = static_cast<size_t>(entry.size);
+        expectedOffset += entry.size;
+
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+
+    outInfo = std::move(info);
+    return true;
+}
+
+bool TextureContainer::IsContainerPath(const std::string& filepath) {
+    const std::string extension = ".ogtex";
+    if (filepath.size() < extension.size()) {
+        return false;
+    }
+    return std::equal(extension.begin(), extension.end(), filepath.end() - extension.size(),
+                      [](char a, char b) { return a == std::tolower(static_cast<unsigned char>(b)); });
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,286 @@
+/**
+ * Texture Loader Implementation
+ */
+
+#include "ogde/graphics/TextureLoader.h"
+#include "ogde/graphics/Camera.h"
+#include "SlotHandle.h"
+#include <algorithm>
+#include <cmath>
+
+namespace OGDE {
+namespace Graphics {
+
+namespace {
+
+size_t TextureBytes(const Texture& texture) {
+    if (!texture.IsLoaded()) {
+        return 0;
+    }
+    const MipLevel& last = texture.GetMipLevel(texture.GetMipLevelCount() - 1);
+    return last.offset + last.size;
+}
+
+} // namespace
+
+TextureLoader::TextureLoader(uint32_t threadCount) {
+    const uint8_t checker[] = {
+        96, 96, 96, 255,   160, 160, 160, 255,
+        160, 160, 160, 255,   96, 96, 96, 255
+    };
+    placeholder_.LoadFromMemory(checker, 2, 2, 4);
+
+    threadCount = std::max(1u, threadCount);
+    workers_.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back(&TextureLoader::WorkerLoop, this);
+    }
+}
+
+TextureLoader::~TextureLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+TextureHandle TextureLoader::Load(const std::string& filepath, float priority, const TextureLoadOptions& options) {
+    TextureHandle handle;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint32_t index;
+        if (!freeSlots_.empty()) {
+            index = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            if (slots_.size() >= kMaxHandleSlots) {
+                return kInvalidTextureHandle;
+            }
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot& slot = slots_[index];
+        slot.filepath = filepath;
+        slot.options = options;
+        slot.state = TextureLoadState::Queued;
+        slot.priority = priority;
+        slot.inUse = true;
+        ++slot.version;
+        queue_.push({ priority, index, slot.version });
+        ++pending_;
+        handle = MakeSlotHandle(index, slot.generation);
+    }
+    wake_.notify_one();
+    return handle;
+}
+
+void TextureLoader::SetPriority(TextureHandle handle, float priority) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot* slot = FindSlot(handle);
+    if (!slot || slot->priority == priority) {
+        return;
+    }
+
+    slot->priority = priority;
+    if (slot->state == TextureLoadState::Queued) {
+        // The old entry stays in the heap and is skipped once its version is stale
+        ++slot->version;
+        queue_.push({ priority, SlotHandleIndex(handle), slot->version });
+    }
+}
+
+void TextureLoader::Unload(TextureHandle handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot* slot = FindSlot(handle);
+    if (!slot) {
+        return;
+    }
+
+    const uint32_t index = SlotHandleIndex(handle);
+    if (slot->state == TextureLoadState::Queued) {
+        --pending_;
+        if (pending_ == 0) {
+            idle_.notify_all();
+        }
+    } else if (slot->state == TextureLoadState::Decoded) {
+        completed_.erase(std::find(completed_.begin(), completed_.end(), index));
+    }
+    // A decoding slot is recycled right away; the decode thread sees the new
+    // generation when it finishes and drops its result
+
+    slot->decoded.Release();
+    slot->resident.Release();
+    slot->filepath.clear();
+    slot->state = TextureLoadState::Failed;
+    slot->inUse = false;
+    ++slot->version;
+    ++slot->generation;
+    freeSlots_.push_back(index);
+}
+
+size_t TextureLoader::ProcessUploads(size_t byteBudget, const UploadCallback& upload) {
+    std::vector<uint32_t> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::stable_sort(completed_.begin(), completed_.end(), [this](uint32_t a, uint32_t b) {
+            return slots_[a].priority > slots_[b].priority;
+        });
+
+        size_t bytes = 0;
+        size_t count = 0;
+        for (; count < completed_.size(); ++count) {
+            Slot& slot = slots_[completed_[count]];
+            size_t size = TextureBytes(slot.decoded);
+            if (count > 0 && bytes + size > byteBudget) {
+                break;
+            }
+            bytes += size;
+            slot.resident = std::move(slot.decoded);
+            slot.state = TextureLoadState::Resident;
+        }
+        ready.assign(completed_.begin(), completed_.begin() + count);
+        completed_.erase(completed_.begin(), completed_.begin() + count);
+
+        lastUploadBytes_ = bytes;
+        lastUploadCount_ = static_cast<uint32_t>(count);
+    }
+
+    // Resident textures belong to the main thread, so the callback runs unlocked
+    if (upload) {
+        for (uint32_t index : ready) {
+            Slot& slot = slots_[index];
+            upload(MakeSlotHandle(index, slot.generation), slot.resident);
+        }
+    }
+    return lastUploadBytes_;
+}
+
+void TextureLoader::WaitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return pending_ == 0; });
+}
+
+TextureLoadState TextureLoader::GetState(TextureHandle handle) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Slot* slot = FindSlot(handle);
+    return slot ? slot->state : TextureLoadState::Failed;
+}
+
+const Texture& TextureLoader::GetTexture(TextureHandle handle) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Slot* slot = FindSlot(handle);
+    if (slot && slot->state == TextureLoadState::Resident) {
+        return slot->resident;
+    }
+    return placeholder_;
+}
+
+TextureLoaderStats TextureLoader::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TextureLoaderStats stats;
+    for (const Slot& slot : slots_) {
+        if (!slot.inUse) {
+            continue;
+        }
+        switch (slot.state) {
+            case TextureLoadState::Queued: ++stats.queued; break;
+            case TextureLoadState::Decoding: ++stats.decoding; break;
+            case TextureLoadState::Decoded: ++stats.decoded; break;
+            case TextureLoadState::Resident:
+                ++stats.resident;
+                stats.residentBytes += TextureBytes(slot.resident);
+                break;
+            case TextureLoadState::Failed: ++stats.failed; break;
+        }
+    }
+    stats.lastUploadBytes = lastUploadBytes_;
+    stats.lastUploadCount = lastUploadCount_;
+    return stats;
+}
+
+float TextureLoader::ComputeScreenPriority(const ogde::graphics::Camera& camera, float viewportHeight,
+                                           float x, float y, float z, float radius) {
+    if (camera.getProjectionType() == ogde::graphics::ProjectionType::Orthographic) {
+        return 2.0f * radius / camera.getOrthoHeight() * viewportHeight;
+    }
+
+    float cx, cy, cz;
+    camera.getPosition(cx, cy, cz);
+    const float dx = x - cx;
+    const float dy = y - cy;
+    const float dz = z - cz;
+    const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (distance <= radius) {
+        return viewportHeight;
+    }
+
+    const float halfFovTan = std::tan(camera.getFieldOfView() * 0.5f * 3.14159265f / 180.0f);
+    return std::min(viewportHeight, radius / (distance * halfFovTan) * viewportHeight);
+}
+
+void TextureLoader::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this]() { return shutdown_ || !queue_.empty(); });
+        if (shutdown_) {
+            return;
+        }
+
+        QueueEntry entry = queue_.top();
+        queue_.pop();
+        Slot& slot = slots_[entry.index];
+        if (entry.version != slot.version || slot.state != TextureLoadState::Queued) {
+            continue;
+        }
+
+        slot.state = TextureLoadState::Decoding;
+        const uint32_t generation = slot.generation;
+        const std::string filepath = slot.filepath;
+        const TextureLoadOptions options = slot.options;
+        lock.unlock();
+
+        Texture texture;
+        bool loaded = texture.LoadFromFile(filepath);
+        if (loaded && options.generateMipmaps && texture.GetMipLevelCount() == 1 && !texture.IsCompressed()) {
+            loaded = texture.GenerateMipmaps(options.mipSettings);
+        }
+
+        lock.lock();
+        if (slot.generation == generation) {
+            if (loaded) {
+                slot.decoded = std::move(texture);
+                slot.state = TextureLoadState::Decoded;
+                completed_.push_back(entry.index);
+            } else {
+                slot.state = TextureLoadState::Failed;
+            }
+        }
+        if (--pending_ == 0) {
+            idle_.notify_all();
+        }
+    }
+}
+
+TextureLoader::Slot* TextureLoader::FindSlot(TextureHandle handle) {
+    return const_cast<Slot*>(static_cast<const TextureLoader*>(this)->FindSlot(handle));
+}
+
+const TextureLoader::Slot* TextureLoader::FindSlot(TextureHandle handle) const {
+    const uint32_t index = SlotHandleIndex(handle);
+    if (handle == kInvalidTextureHandle || index >= slots_.size()) {
+        return nullptr;
+    }
+    const Slot& slot = slots_[index];
+    if (!slot.inUse || !SlotHandleMatches(handle, slot.generation)) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+} // namespace Graphics
+} // namespace OGDE
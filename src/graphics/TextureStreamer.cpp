@@ -0,0 +1,271 @@
+/**
+ * Texture Streamer Implementation
+ */
+
+#include "ogde/graphics/TextureStreamer.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/core/Logger.h"
+#include "SlotHandle.h"
+#include <algorithm>
+#include <cmath>
+
+namespace OGDE {
+namespace Graphics {
+
+TextureStreamer::TextureStreamer(const StreamingSettings& settings)
+    : settings_(settings) {
+}
+
+TextureStreamer::~TextureStreamer() = default;
+
+StreamedTextureHandle TextureStreamer::Register(const std::string& filepath) {
+    if (!TextureContainer::IsContainerPath(filepath)) {
+        ogde::core::Logger::error("Texture streaming requires an .ogtex container: " + filepath);
+        return kInvalidStreamedTexture;
+    }
+    if (freeEntries_.empty() && entries_.size() >= kMaxHandleSlots) {
+        return kInvalidStreamedTexture;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    if (!entry->source.LoadFromFile(filepath)) {
+        return kInvalidStreamedTexture;
+    }
+
+    // The tail starts at the first level that fits in tailSize x tailSize
+    const int mipCount = entry->source.GetMipLevelCount();
+    entry->tailMip = mipCount - 1;
+    for (int level = 0; level < mipCount; ++level) {
+        const MipLevel& mip = entry->source.GetMipLevel(level);
+        if (mip.width <= settings_.tailSize && mip.height <= settings_.tailSize) {
+            entry->tailMip = level;
+            break;
+        }
+    }
+
+    // Smallest levels first
+    entry->levels.resize(mipCount);
+    entry->residentMip = mipCount;
+    for (int level = mipCount - 1; level >= entry->tailMip; --level) {
+        LoadLevel(*entry, level);
+    }
+    entry->desiredMip = entry->tailMip;
+    entry->loads = 0;
+
+    uint32_t index;
+    if (!freeEntries_.empty()) {
+        index = freeEntries_.back();
+        freeEntries_.pop_back();
+        entries_[index] = std::move(entry);
+    } else {
+        index = static_cast<uint32_t>(entries_.size());
+        entries_.push_back(std::move(entry));
+        generations_.push_back(0);
+    }
+    return MakeSlotHandle(index, generations_[index]);
+}
+
+void TextureStreamer::Unregister(StreamedTextureHandle handle) {
+    Entry* entry = FindEntry(handle);
+    if (!entry) {
+        return;
+    }
+
+    for (int level = entry->residentMip; level < entry->source.GetMipLevelCount(); ++level) {
+        residentBytes_ -= entry->levels[level].size();
+    }
+    // Bumping the generation invalidates every copy of the handle before the slot is reused
+    const uint32_t index = SlotHandleIndex(handle);
+    entries_[index].reset();
+    ++generations_[index];
+    freeEntries_.push_back(index);
+}
+
+void TextureStreamer::ReportUsage(StreamedTextureHandle handle, int desiredMip) {
+    Entry* entry = FindEntry(handle);
+    if (!entry) {
+        return;
+    }
+
+    desiredMip = std::max(0, std::min(desiredMip, entry->source.GetMipLevelCount() - 1));
+    // Several uses in one frame keep the most detailed request
+    if (entry->lastUsedFrame == frame_) {
+        entry->desiredMip = std::min(entry->desiredMip, desiredMip);
+    } else {
+        entry->desiredMip = desiredMip;
+        entry->lastUsedFrame = frame_;
+    }
+}
+
+void TextureStreamer::Update() {
+    loadsLastUpdate_ = 0;
+    evictionsLastUpdate_ = 0;
+    bytesLoadedLastUpdate_ = 0;
+
+    // The budget may have shrunk since the last frame
+    MakeRoom(0, nullptr);
+
+    std::vector<bool> blocked(entries_.size(), false);
+    while (true) {
+        // Largest deficit first among textures used this frame
+        Entry* next = nullptr;
+        size_t nextIndex = 0;
+        int bestDeficit = 0;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            Entry* entry = entries_[i].get();
+            if (!entry || blocked[i] || entry->lastUsedFrame != frame_) {
+                continue;
+            }
+            int deficit = entry->residentMip - entry->desiredMip;
+            if (deficit > bestDeficit) {
+                bestDeficit = deficit;
+                next = entry;
+                nextIndex = i;
+            }
+        }
+        if (!next) {
+            break;
+        }
+
+        const size_t size = next->source.GetMipLevel(next->residentMip - 1).size;
+        if (loadsLastUpdate_ > 0 && bytesLoadedLastUpdate_ + size > settings_.maxLoadBytesPerUpdate) {
+            break;
+        }
+        if (!MakeRoom(size, next)) {
+            blocked[nextIndex] = true;
+            continue;
+        }
+
+        LoadLevel(*next, next->residentMip - 1);
+        ++loadsLastUpdate_;
+        bytesLoadedLastUpdate_ += size;
+    }
+
+    pendingLastUpdate_ = 0;
+    for (const auto& entry : entries_) {
+        if (entry && entry->lastUsedFrame == frame_ && entry->residentMip > entry->desiredMip) {
+            ++pendingLastUpdate_;
+        }
+    }
+    ++frame_;
+}
+
+const uint8_t* TextureStreamer::GetLevelData(StreamedTextureHandle handle, int level) const {
+    const Entry* entry = FindEntry(handle);
+    if (!entry || level < entry->residentMip || level >= entry->source.GetMipLevelCount()) {
+        return nullptr;
+    }
+    return entry->levels[level].data();
+}
+
+const Texture& TextureStreamer::GetSource(StreamedTextureHandle handle) const {
+    static const Texture empty;
+    const Entry* entry = FindEntry(handle);
+    return entry ? entry->source : empty;
+}
+
+TextureResidency TextureStreamer::GetResidency(StreamedTextureHandle handle) const {
+    TextureResidency residency;
+    const Entry* entry = FindEntry(handle);
+    if (!entry) {
+        return residency;
+    }
+
+    residency.mipCount = entry->source.GetMipLevelCount();
+    residency.residentMip = entry->residentMip;
+    residency.desiredMip = entry->desiredMip;
+    residency.tailMip = entry->tailMip;
+    for (int level = 0; level < residency.mipCount; ++level) {
+        residency.fullBytes += entry->source.GetMipLevel(level).size;
+        residency.residentBytes += entry->levels[level].size();
+    }
+    residency.lastUsedFrame = entry->lastUsedFrame;
+    residency.loads = entry->loads;
+    residency.evictions = entry->evictions;
+    return residency;
+}
+
+StreamingStats TextureStreamer::GetStats() const {
+    StreamingStats stats;
+    stats.textureCount = static_cast<uint32_t>(entries_.size() - freeEntries_.size());
+    stats.budgetBytes = settings_.budgetBytes;
+    stats.residentBytes = residentBytes_;
+    stats.pendingTextures = pendingLastUpdate_;
+    stats.loadsLastUpdate = loadsLastUpdate_;
+    stats.evictionsLastUpdate = evictionsLastUpdate_;
+    stats.bytesLoadedLastUpdate = bytesLoadedLastUpdate_;
+    return stats;
+}
+
+int TextureStreamer::ComputeDesiredMip(int width, int height, float projectedPixels) {
+    const int lastLevel = MipGenerator::CalculateLevelCount(width, height) - 1;
+    const float texels = static_cast<float>(std::max(width, height));
+    if (projectedPixels <= 0.0f) {
+        return lastLevel;
+    }
+    if (projectedPixels >= texels) {
+        return 0;
+    }
+    const int level = static_cast<int>(std::floor(std::log2(texels / projectedPixels)));
+    return std::min(level, lastLevel);
+}
+
+TextureStreamer::Entry* TextureStreamer::FindEntry(StreamedTextureHandle handle) {
+    return const_cast<Entry*>(static_cast<const TextureStreamer*>(this)->FindEntry(handle));
+}
+
+const TextureStreamer::Entry* TextureStreamer::FindEntry(StreamedTextureHandle handle) const {
+    const uint32_t index = SlotHandleIndex(handle);
+    if (handle == kInvalidStreamedTexture || index >= entries_.size() ||
+        !SlotHandleMatches(handle, generations_[index])) {
+        return nullptr;
+    }
+    return entries_[index].get();
+}
+
+bool TextureStreamer::MakeRoom(size_t bytes, const Entry* requester) {
+    while (residentBytes_ + bytes > settings_.budgetBytes) {
+        // Least recently used first; among equals, the largest level frees the most
+        Entry* victim = nullptr;
+        for (const auto& candidate : entries_) {
+            Entry* entry = candidate.get();
+            if (!entry || entry == requester || entry->residentMip >= entry->tailMip) {
+                continue;
+            }
+            // A texture in use this frame only gives up levels finer than it asked for
+            if (entry->lastUsedFrame == frame_ && entry->residentMip >= entry->desiredMip) {
+                continue;
+            }
+            if (!victim || entry->lastUsedFrame < victim->lastUsedFrame ||
+                (entry->lastUsedFrame == victim->lastUsedFrame &&
+                 entry->levels[entry->residentMip].size() > victim->levels[victim->residentMip].size())) {
+                victim = entry;
+            }
+        }
+        if (!victim) {
+            return false;
+        }
+        EvictLevel(*victim);
+        ++evictionsLastUpdate_;
+    }
+    return true;
+}
+
+void TextureStreamer::LoadLevel(Entry& entry, int level) {
+    const MipLevel& mip = entry.source.GetMipLevel(level);
+    const uint8_t* data = entry.source.GetData(level);
+    entry.levels[level].assign(data, data + mip.size);
+    entry.residentMip = level;
+    residentBytes_ += mip.size;
+    ++entry.loads;
+}
+
+void TextureStreamer::EvictLevel(Entry& entry) {
+    std::vector<uint8_t>().swap(entry.levels[entry.residentMip]);
+    residentBytes_ -= entry.source.GetMipLevel(entry.residentMip).size;
+    ++entry.residentMip;
+    ++entry.evictions;
+}
+
+} // namespace Graphics
+} // namespace OGDE
@@ -0,0 +1,110 @@
+/**
+ * @file UploadRing.cpp
+ * @brief Fenced ring sub-allocator implementation
+ */
+
+#include "ogde/graphics/UploadRing.h"
+#include <algorithm>
+
+namespace ogde {
+namespace graphics {
+
+UploadRing::UploadRing(uint64_t capacity)
+    : m_capacity(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_frameStart(0)
+    , m_frameDemand(0)
+{
+    reset(capacity);
+}
+
+UploadRing::~UploadRing() = default;
+
+void UploadRing::reset(uint64_t capacity) {
+    m_capacity = capacity;
+    m_head = 0;
+    m_tail = 0;
+    m_frameStart = 0;
+    m_frames.clear();
+    m_stats.frameBytes = 0;
+}
+
+UploadAllocation UploadRing::allocate(uint64_t size, uint64_t alignment) {
+    UploadAllocation allocation;
+    if (size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return allocation;
+    }
+    m_frameDemand += size;
+    if (size > m_capacity) {
+        ++m_stats.overflows;
+        return allocation;
+    }
+
+    // Nothing in use: restart at offset 0 instead of wrapping around
+    if (m_head == m_tail) {
+        m_head = m_tail = m_frameStart = 0;
+    }
+
+    const uint64_t offset = m_head % m_capacity;
+    uint64_t start = (offset + alignment - 1) & ~(alignment - 1);
+    bool wraps = false;
+    if (start + size > m_capacity) {
+        // Skip the tail end of the buffer and start over at offset 0
+        start = 0;
+        wraps = true;
+    }
+    const uint64_t consumed = (wraps ? m_capacity - offset : start - offset) + size;
+    if (consumed > m_capacity - getUsedBytes()) {
+        ++m_stats.overflows;
+        return allocation;
+    }
+
+    m_head += consumed;
+    m_frameDemand += consumed - size;
+    m_stats.frameBytes += consumed;
+    ++m_stats.allocations;
+    if (wraps) {
+        ++m_stats.wraps;
+    }
+
+    allocation.offset = start;
+    allocation.size = size;
+    allocation.valid = true;
+    return allocation;
+}
+
+void UploadRing::endFrame(uint64_t fence) {
+    // Frames without allocations hold no space and need no fence
+    if (m_head != m_frameStart) {
+        m_frames.push_back({ fence, m_head });
+    }
+    m_frameStart = m_head;
+    m_stats.peakFrameDemand = std::max(m_stats.peakFrameDemand, m_frameDemand);
+    m_stats.frameBytes = 0;
+    m_frameDemand = 0;
+}
+
+void UploadRing::retire(uint64_t completedFence) {
+    while (!m_frames.empty() && m_frames.front().fence <= completedFence) {
+        m_tail = m_frames.front().end;
+        m_frames.pop_front();
+    }
+}
+
+uint64_t UploadRing::getOldestPendingFence() const {
+    return m_frames.empty() ? 0 : m_frames.front().fence;
+}
+
+uint64_t UploadRing::getRecommendedCapacity(uint32_t framesInFlight) const {
+    const uint64_t peak = std::max(m_stats.peakFrameDemand, m_frameDemand);
+    const uint64_t needed = peak * std::max(framesInFlight, 1u);
+    uint64_t capacity = 1;
+    while (capacity < needed) {
+        capacity <<= 1;
+    }
+    return std::max(capacity, m_capacity);
+}
+
+} // namespace graphics
+} // namespace ogde
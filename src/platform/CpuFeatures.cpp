@@ -0,0 +1,103 @@
+/**
+ * CPU Feature Detection Implementation
+ */
+
+#include "ogde/platform/CpuFeatures.h"
+
+#ifdef OGDE_ARCH_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace ogde {
+namespace platform {
+
+namespace {
+
+struct DetectedFeatures {
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool avx2 = false;
+};
+
+#ifdef OGDE_ARCH_X86
+void cpuid(int leaf, int subleaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, leaf, subleaf);
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned int>(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+unsigned long long readXcr0() {
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+DetectedFeatures detect() {
+    DetectedFeatures features;
+#ifdef OGDE_ARCH_X86
+    unsigned int regs[4] = {};
+    cpuid(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    cpuid(1, 0, regs);
+    const unsigned int ecx1 = regs[2];
+    features.ssse3 = (ecx1 & (1u << 9)) != 0;
+    features.sse41 = (ecx1 & (1u << 19)) != 0;
+
+    const bool fma = (ecx1 & (1u << 12)) != 0;
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const bool avx = (ecx1 & (1u << 28)) != 0;
+
+    // AVX state (XMM and YMM registers) must be enabled by the OS
+    bool osSupportsYmm = false;
+    if (osxsave && avx) {
+        osSupportsYmm = (readXcr0() & 0x6) == 0x6;
+    }
+
+    if (maxLeaf >= 7 && osSupportsYmm && fma) {
+        cpuid(7, 0, regs);
+        features.avx2 = (regs[1] & (1u << 5)) != 0;
+    }
+#endif
+    return features;
+}
+
+const DetectedFeatures& features() {
+    static const DetectedFeatures s_features = detect();
+    return s_features;
+}
+
+} // namespace
+
+bool CpuFeatures::hasSSSE3() {
+    return features().ssse3;
+}
+
+bool CpuFeatures::hasSSE41() {
+    return features().sse41;
+}
+
+bool CpuFeatures::hasAVX2() {
+    return features().avx2;
+}
+
+} // namespace platform
+} // namespace ogde
@@ -5,6 +5,10 @@
 
 #include "ogde/core/FileSystem.h"
 #include "ogde/core/Config.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/core/FloatingOrigin.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <cassert>
 #include <cmath>
@@ -227,6 +231,65 @@ void TestConfigKeyOperations() {
     std::cout << "  ✓ Config key operations passed" << std::endl;
 }
 
+void TestJobSystemParallelFor() {
+    std::cout << "Testing job system parallel for..." << std::endl;
+    
+    ogde::core::JobSystem jobs(3);
+    std::vector<uint32_t> hits(10007, 0);
+    
+    // Every index is visited exactly once across repeated loops
+    for (int pass = 0; pass < 20; ++pass) {
+        jobs.parallelFor(static_cast<uint32_t>(hits.size()), 64, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                hits[i]++;
+            }
+        });
+    }
+    assert(std::all_of(hits.begin(), hits.end(), [](uint32_t count) { return count == 20; }) &&
+           "Index visited wrong number of times");
+    
+    // Nested loops run inline instead of deadlocking
+    std::atomic<uint32_t> total(0);
+    jobs.parallelFor(8, 1, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            jobs.parallelFor(100, 0, [&](uint32_t innerBegin, uint32_t innerEnd) {
+                total += innerEnd - innerBegin;
+            });
+        }
+    });
+    assert(total == 800 && "Nested loop lost work");
+    
+    std::cout << "  ✓ Job system parallel for passed" << std::endl;
+}
+
+void TestFloatingOriginRebase() {
+    std::cout << "Testing floating origin rebase..." << std::endl;
+    
+    ogde::core::FloatingOrigin origin(1024.0);
+    ogde::core::Vector3 tracked = origin.toLocal(ogde::core::Vector3d(150000.5, 20.0, -80000.25));
+    origin.addListener([&](const ogde::core::Vector3d&, const ogde::core::Vector3& shift) {
+        ogde::core::FloatingOrigin::applyShift(&tracked, 1, shift);
+    });
+    
+    // Staying close to the origin does not rebase
+    assert(!origin.update(ogde::core::Vector3d(1000.0, 0.0, -1000.0)) && "Unexpected rebase");
+    
+    // Moving far away snaps the origin to the rebase grid near the focus
+    ogde::core::Vector3d focus(150000.0, 20.0, -80000.0);
+    assert(origin.update(focus) && "Expected rebase");
+    assert(origin.getOrigin().x == 149504.0 && origin.getOrigin().z == -79872.0 && "Origin not snapped");
+    assert(origin.getRebaseCount() == 1 && "Rebase count mismatch");
+    
+    // Shifted local data matches a fresh conversion, with sub-millimetre precision
+    [[maybe_unused]] ogde::core::Vector3 fresh = origin.toLocal(ogde::core::Vector3d(150000.5, 20.0, -80000.25));
+    assert(std::abs(tracked.x - fresh.x) < 0.001f && std::abs(tracked.z - fresh.z) < 0.001f && "Shift mismatch");
+    assert(std::abs(fresh.x - 496.5f) < 0.0001f && "Local precision lost");
+    
+    assert(std::abs(origin.toWorld(fresh).z - (-80000.25)) < 1e-6 && "Round trip mismatch");
+    
+    std::cout << "  ✓ Floating origin rebase passed" << std::endl;
+}
+
 int main() {
     std::cout << "=== Core Tests ===" << std::endl;
     
@@ -245,6 +308,12 @@ int main() {
         TestConfigStringParsing();
         TestConfigKeyOperations();
         
+        // Job system tests
+        TestJobSystemParallelFor();
+        
+        // Large world tests
+        TestFloatingOriginRebase();
+        
         std::cout << "\n✓ All core tests passed!" << std::endl;
         return 0;
     } catch (const std::exception& e) {
@@ -4,9 +4,48 @@
  */
 
 #include "ogde/graphics/Camera.h"
+#include "ogde/graphics/Frustum.h"
+#include "ogde/graphics/CameraSet.h"
+#include "ogde/graphics/OcclusionCuller.h"
+#include "ogde/core/JobSystem.h"
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/Texture.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/graphics/TextureLoader.h"
+#include "ogde/graphics/TextureStreamer.h"
+#include "ogde/graphics/TextureAtlas.h"
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/graphics/TextureCache.h"
+#include "ogde/graphics/ImageDecoder.h"
+#include "ogde/graphics/MaterialTable.h"
+#include "ogde/graphics/MaterialInstance.h"
+#include "ogde/graphics/RenderQueue.h"
+#include "ogde/graphics/CommandBuffer.h"
+#include "ogde/graphics/RendererSoftware.h"
+#include "ogde/graphics/Renderer.h"
+#include "ogde/graphics/ShaderCache.h"
+#include "ogde/graphics/UploadRing.h"
+#include "ogde/graphics/ObjLoader.h"
+#include "ogde/graphics/MeshContainer.h"
+#include "ogde/graphics/MeshOptimizer.h"
+#include "ogde/graphics/MeshSimplifier.h"
+#include "ogde/graphics/LodSelector.h"
+#include "ogde/graphics/MeshletBuilder.h"
+#include "ogde/graphics/MeshletCuller.h"
+#include "ogde/core/FileSystem.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <cmath>
 #include <cstring>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
 
 // Simple test framework
 int testsPassed = 0;
@@ -180,6 +219,2625 @@ void testCameraDirectionVectors() {
     }
 }
 
+void testCameraViewProjectionOrder() {
+    TEST("Camera view-projection transforms points (row vectors)") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(90.0f, 1.0f, 1.0f, 100.0f);
+        camera.setPosition(0.0f, 0.0f, -5.0f);
+        camera.update();
+
+        // A point at the world origin is 5 units in front of the camera
+        const float* vp = camera.getViewProjectionMatrix();
+        float clipZ = vp[14];
+        float clipW = vp[15];
+
+        bool wIsDistance = std::abs(clipW - 5.0f) < 0.001f;
+        bool depthInRange = clipZ / clipW > 0.0f && clipZ / clipW < 1.0f;
+
+        EXPECT_TRUE(wIsDistance && depthInRange);
+    }
+}
+
+void testFrustumExtraction() {
+    TEST("Frustum extraction from camera") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(90.0f, 1.0f, 0.1f, 100.0f);
+        camera.setPosition(0.0f, 0.0f, 0.0f);
+        camera.update();
+
+        const ogde::graphics::Frustum& frustum = camera.getFrustum();
+        bool inFront = frustum.containsPoint(0.0f, 0.0f, 10.0f);
+        bool behind = frustum.containsPoint(0.0f, 0.0f, -10.0f);
+        bool beyondFar = frustum.containsPoint(0.0f, 0.0f, 150.0f);
+        bool outsideLeft = frustum.containsPoint(-20.0f, 0.0f, 10.0f);
+        bool sphereStraddlesLeft = frustum.intersectsSphere(-11.0f, 0.0f, 10.0f, 2.0f);
+        bool boxStraddlesNear = frustum.intersectsAabb(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+
+        EXPECT_TRUE(inFront && !behind && !beyondFar && !outsideLeft &&
+                    sphereStraddlesLeft && boxStraddlesNear);
+    }
+}
+
+void testBatchCullingMatchesScalar() {
+    TEST("Batched AABB/sphere culling matches per-object tests") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 16.0f / 9.0f, 0.1f, 200.0f);
+        camera.lookAt(10.0f, 5.0f, -20.0f, 0.0f, 0.0f, 0.0f);
+        camera.update();
+        const ogde::graphics::Frustum& frustum = camera.getFrustum();
+
+        ogde::graphics::AabbBatch boxes;
+        ogde::graphics::SphereBatch spheres;
+        std::vector<uint32_t> expectedBoxes;
+        std::vector<uint32_t> expectedSpheres;
+
+        // Odd count so the last SIMD batch is partially filled
+        std::srand(1234);
+        for (uint32_t i = 0; i < 1003; ++i) {
+            float x = static_cast<float>(std::rand() % 400) - 200.0f;
+            float y = static_cast<float>(std::rand() % 400) - 200.0f;
+            float z = static_cast<float>(std::rand() % 400) - 200.0f;
+            float size = 0.5f + static_cast<float>(std::rand() % 8);
+
+            boxes.add(x - size, y - size, z - size, x + size, y + size, z + size);
+            spheres.add(x, y, z, size);
+            if (frustum.intersectsAabb(x - size, y - size, z - size, x + size, y + size, z + size)) {
+                expectedBoxes.push_back(i);
+            }
+            if (frustum.intersectsSphere(x, y, z, size)) {
+                expectedSpheres.push_back(i);
+            }
+        }
+
+        std::vector<uint32_t> visibleBoxes;
+        std::vector<uint32_t> visibleSpheres;
+        ogde::graphics::cullAabbs(frustum, boxes, visibleBoxes);
+        ogde::graphics::cullSpheres(frustum, spheres, visibleSpheres);
+
+        bool someCulled = visibleBoxes.size() > 0 && visibleBoxes.size() < boxes.size();
+        EXPECT_TRUE(someCulled && visibleBoxes == expectedBoxes && visibleSpheres == expectedSpheres);
+    }
+}
+
+void testCameraSetDirtyUpdates() {
+    TEST("CameraSet updates only dirty views") {
+        ogde::graphics::CameraSet views;
+        uint32_t main = views.addView(ogde::graphics::ViewType::Main);
+        views.addView(ogde::graphics::ViewType::SplitScreen,
+                      ogde::graphics::CameraSet::splitScreenViewport(1, 2));
+        views.addView(ogde::graphics::ViewType::Reflection);
+
+        uint32_t first = views.update();
+        uint32_t second = views.update();
+        views.getCamera(main).setPosition(1.0f, 2.0f, 3.0f);
+        uint32_t third = views.update();
+
+        EXPECT_TRUE(first == 3 && second == 0 && third == 1);
+    }
+}
+
+void testCameraSetSinglePassCulling() {
+    TEST("CameraSet single-pass masks match per-view culling") {
+        ogde::graphics::CameraSet views;
+        uint32_t left = views.addView(ogde::graphics::ViewType::SplitScreen);
+        uint32_t right = views.addView(ogde::graphics::ViewType::SplitScreen);
+        uint32_t disabled = views.addView(ogde::graphics::ViewType::Reflection);
+        views.getCamera(left).lookAt(0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f);
+        views.getCamera(right).lookAt(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+        views.setViewEnabled(disabled, false);
+        views.update();
+
+        ogde::graphics::AabbBatch boxes;
+        std::srand(99);
+        for (int i = 0; i < 517; ++i) {
+            float x = static_cast<float>(std::rand() % 200) - 100.0f;
+            float y = static_cast<float>(std::rand() % 40) - 20.0f;
+            float z = static_cast<float>(std::rand() % 200) - 100.0f;
+            boxes.add(x, y, z, x + 2.5f, y + 2.5f, z + 2.5f);
+        }
+
+        std::vector<uint32_t> masks;
+        views.cull(boxes, masks);
+
+        std::vector<uint32_t> expectedLeft, expectedRight, fromMasks;
+        ogde::graphics::cullAabbs(views.getCamera(left).getFrustum(), boxes, expectedLeft);
+        ogde::graphics::cullAabbs(views.getCamera(right).getFrustum(), boxes, expectedRight);
+
+        bool match = masks.size() == boxes.size();
+        ogde::graphics::CameraSet::collectVisible(masks, left, fromMasks);
+        match = match && fromMasks == expectedLeft;
+        ogde::graphics::CameraSet::collectVisible(masks, right, fromMasks);
+        match = match && fromMasks == expectedRight;
+        ogde::graphics::CameraSet::collectVisible(masks, disabled, fromMasks);
+        match = match && fromMasks.empty() && !expectedLeft.empty() && !expectedRight.empty();
+
+        EXPECT_TRUE(match);
+    }
+}
+
+void testCameraSetShadowCascades() {
+    TEST("CameraSet shadow cascades cover their frustum slices") {
+        float splits[5];
+        ogde::graphics::CameraSet::computeCascadeSplits(0.5f, 200.0f, 4, 0.75f, splits);
+        bool monotonic = splits[0] == 0.5f && splits[4] == 200.0f;
+        for (int i = 0; i < 4; ++i) {
+            monotonic = monotonic && splits[i] < splits[i + 1];
+        }
+
+        ogde::graphics::Camera viewer;
+        viewer.setPerspective(60.0f, 16.0f / 9.0f, 0.5f, 200.0f);
+        viewer.lookAt(10.0f, 20.0f, 30.0f, 50.0f, 0.0f, 80.0f);
+        viewer.update();
+
+        ogde::graphics::CameraSet views;
+        uint32_t firstCascade = views.addShadowCascades(4);
+        views.updateShadowCascades(viewer, 0.3f, -1.0f, 0.2f);
+        views.update();
+
+        // The point on the view axis in the middle of each slice must be inside its cascade
+        float px, py, pz, fx, fy, fz;
+        viewer.getPosition(px, py, pz);
+        viewer.getForward(fx, fy, fz);
+        bool covered = true;
+        float nearSplit = 0.5f;
+        for (uint32_t c = 0; c < 4; ++c) {
+            float mid = (nearSplit + views.getCascadeSplit(c)) * 0.5f;
+            nearSplit = views.getCascadeSplit(c);
+            const ogde::graphics::Frustum& frustum = views.getCamera(firstCascade + c).getFrustum();
+            covered = covered && frustum.containsPoint(px + fx * mid, py + fy * mid, pz + fz * mid);
+        }
+
+        // A second fit with the same inputs must not dirty the cascades
+        views.updateShadowCascades(viewer, 0.3f, -1.0f, 0.2f);
+        bool stable = views.update() == 0;
+
+        // Orthographic viewers: slices span the full ortho extents, not a field of view
+        ogde::graphics::Camera ortho;
+        ortho.setOrthographic(80.0f, 45.0f, 0.5f, 200.0f);
+        ortho.lookAt(10.0f, 20.0f, 30.0f, 50.0f, 0.0f, 80.0f);
+        ortho.update();
+        views.updateShadowCascades(ortho, 0.3f, -1.0f, 0.2f);
+        views.update();
+        float rx, ry, rz, ux, uy, uz;
+        ortho.getPosition(px, py, pz);
+        ortho.getForward(fx, fy, fz);
+        ortho.getRight(rx, ry, rz);
+        ortho.getUp(ux, uy, uz);
+        nearSplit = 0.5f;
+        for (uint32_t c = 0; c < 4; ++c) {
+            float mid = (nearSplit + views.getCascadeSplit(c)) * 0.5f;
+            nearSplit = views.getCascadeSplit(c);
+            const ogde::graphics::Frustum& frustum = views.getCamera(firstCascade + c).getFrustum();
+            for (int corner = 0; corner < 4; ++corner) {
+                float sx = (corner & 1) ? 39.0f : -39.0f;
+                float sy = (corner & 2) ? 22.0f : -22.0f;
+                covered = covered && frustum.containsPoint(px + fx * mid + rx * sx + ux * sy,
+                                                           py + fy * mid + ry * sx + uy * sy,
+                                                           pz + fz * mid + rz * sx + uz * sy);
+            }
+        }
+
+        EXPECT_TRUE(monotonic && covered && stable);
+    }
+}
+
+void testCameraWorldOrigin() {
+    TEST("Camera keeps precision far from the world origin") {
+        // 200 km from zero, a float position can only resolve ~1.5 cm steps
+        const double worldX = 200000.013;
+        const double worldZ = -200000.007;
+
+        ogde::graphics::Camera camera;
+        camera.setWorldPosition(worldX, 10.0, worldZ);
+        camera.setWorldOrigin(199680.0, 0.0, -199680.0);
+        camera.update();
+
+        float x, y, z;
+        camera.getPosition(x, y, z);
+        double wx, wy, wz;
+        camera.getWorldPosition(wx, wy, wz);
+
+        // A point 3 mm to the right of the camera, expressed relative to the origin
+        const float* vp = camera.getViewProjectionMatrix();
+        float px = static_cast<float>(worldX + 0.003 - 199680.0);
+        float py = 10.0f;
+        float pz = static_cast<float>(worldZ + 5.0 + 199680.0);
+        float clipX = px * vp[0] + py * vp[4] + pz * vp[8] + vp[12];
+        float clipW = px * vp[3] + py * vp[7] + pz * vp[11] + vp[15];
+
+        bool keptWorld = wx == worldX && wz == worldZ;
+        bool relative = std::abs(x - 320.013f) < 1e-4f && std::abs(z - (-320.007f)) < 1e-4f;
+        bool resolved = clipX / clipW > 0.0f;
+
+        EXPECT_TRUE(keptWorld && relative && resolved);
+    }
+}
+
+void testOcclusionWallHidesBoxes() {
+    TEST("Occlusion culler hides boxes behind a wall only") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 2.0f, 0.5f, 200.0f);
+        camera.lookAt(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+        camera.update();
+
+        ogde::graphics::OcclusionCuller culler(128, 64);
+        culler.beginFrame(camera);
+        culler.addOccluderBox(-10.0f, -10.0f, 10.0f, 10.0f, 10.0f, 11.0f);
+        culler.rasterize();
+
+        bool behindHidden = !culler.isVisible(-1.0f, -1.0f, 30.0f, 1.0f, 1.0f, 32.0f);
+        bool frontVisible = culler.isVisible(-1.0f, -1.0f, 5.0f, 1.0f, 1.0f, 7.0f);
+        bool besideVisible = culler.isVisible(30.0f, -1.0f, 30.0f, 32.0f, 1.0f, 32.0f);
+        bool aroundEyeVisible = culler.isVisible(-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f);
+
+        EXPECT_TRUE(behindHidden && frontVisible && besideVisible && aroundEyeVisible);
+    }
+}
+
+void testOcclusionPyramidKeepsMaxDepth() {
+    TEST("Occlusion depth pyramid stores the farthest depth of each block") {
+        ogde::graphics::Camera camera;
+        camera.lookAt(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+        camera.update();
+
+        ogde::graphics::OcclusionCuller culler(64, 64);
+        culler.beginFrame(camera);
+        culler.addOccluderBox(-2.0f, -2.0f, 8.0f, 3.0f, 1.0f, 9.0f);
+        culler.rasterize();
+
+        bool conservative = culler.getLevelCount() == 7;
+        for (uint32_t level = 1; level < culler.getLevelCount(); ++level) {
+            uint32_t fineWidth, fineHeight, width, height;
+            const float* fine = culler.getDepthLevel(level - 1, fineWidth, fineHeight);
+            const float* coarse = culler.getDepthLevel(level, width, height);
+            for (uint32_t y = 0; y < fineHeight; ++y) {
+                for (uint32_t x = 0; x < fineWidth; ++x) {
+                    conservative = conservative && fine[y * fineWidth + x] <= coarse[(y / 2) * width + x / 2];
+                }
+            }
+        }
+
+        EXPECT_TRUE(conservative);
+    }
+}
+
+void testOcclusionThreadedMatchesSerial() {
+    TEST("Occlusion culler gives the same result with worker threads") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(70.0f, 16.0f / 9.0f, 0.5f, 300.0f);
+        camera.lookAt(0.0f, 5.0f, -20.0f, 0.0f, 0.0f, 50.0f);
+        camera.update();
+
+        ogde::graphics::AabbBatch boxes;
+        std::vector<uint32_t> candidates;
+        std::srand(7);
+        for (uint32_t i = 0; i < 3000; ++i) {
+            float x = static_cast<float>(std::rand() % 200) - 100.0f;
+            float z = static_cast<float>(std::rand() % 200);
+            boxes.add(x, 0.0f, z, x + 1.0f, 2.0f, z + 1.0f);
+            candidates.push_back(i);
+        }
+
+        ogde::graphics::OcclusionCuller serial;
+        ogde::graphics::OcclusionCuller threaded;
+        ogde::core::JobSystem jobs(3);
+        threaded.setJobSystem(&jobs);
+
+        std::vector<uint32_t> serialVisible(candidates.size());
+        std::vector<uint32_t> threadedVisible(candidates.size());
+        uint32_t counts[2];
+        ogde::graphics::OcclusionCuller* cullers[2] = { &serial, &threaded };
+        std::vector<uint32_t>* outputs[2] = { &serialVisible, &threadedVisible };
+        for (int c = 0; c < 2; ++c) {
+            cullers[c]->beginFrame(camera);
+            for (int b = 0; b < 20; ++b) {
+                float x = static_cast<float>(b * 10 - 100);
+                cullers[c]->addOccluderBox(x, 0.0f, 20.0f, x + 6.0f, 15.0f, 22.0f);
+            }
+            cullers[c]->rasterize();
+            counts[c] = cullers[c]->testAabbs(boxes, candidates.data(),
+                                              static_cast<uint32_t>(candidates.size()), outputs[c]->data());
+        }
+
+        bool match = counts[0] == counts[1] && counts[0] > 0 && counts[0] < candidates.size() &&
+                     std::equal(serialVisible.begin(), serialVisible.begin() + counts[0], threadedVisible.begin()) &&
+                     threaded.getStats().occludedObjects == candidates.size() - counts[1];
+
+        EXPECT_TRUE(match);
+    }
+}
+
+void testMipChainLayout() {
+    TEST("Mip chain sizes follow the D3D convention") {
+        std::vector<uint8_t> base(37 * 10 * 3, 200);
+        std::vector<uint8_t> pixels;
+        std::vector<OGDE::Graphics::MipLevel> levels;
+        OGDE::Graphics::MipSettings settings;
+        bool generated = OGDE::Graphics::MipGenerator::GenerateChain(base.data(), 37, 10, 3, settings, pixels, levels);
+
+        bool layout = generated && levels.size() == 6 &&
+                      OGDE::Graphics::MipGenerator::CalculateLevelCount(37, 10) == 6;
+        const int expected[6][2] = { {37, 10}, {18, 5}, {9, 2}, {4, 1}, {2, 1}, {1, 1} };
+        size_t offset = 0;
+        for (size_t i = 0; layout && i < levels.size(); ++i) {
+            layout = levels[i].width == expected[i][0] && levels[i].height == expected[i][1] &&
+                     levels[i].offset == offset && levels[i].size == size_t(expected[i][0] * expected[i][1] * 3);
+            offset += levels[i].size;
+        }
+        // A constant image stays constant through every level
+        bool constant = layout && pixels.size() == offset &&
+                        std::all_of(pixels.begin(), pixels.end(), [](uint8_t v) { return v == 200; });
+
+        EXPECT_TRUE(constant);
+    }
+}
+
+void testMipBoxFilter() {
+    TEST("Box mip filter averages linearly or in sRGB space") {
+        // Black/white checkerboard, RGBA with alpha alternating 0/255
+        const int size = 16;
+        std::vector<uint8_t> base(size * size * 4);
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                uint8_t v = ((x + y) & 1) ? 255 : 0;
+                for (int c = 0; c < 4; ++c) {
+                    base[(y * size + x) * 4 + c] = v;
+                }
+            }
+        }
+
+        std::vector<uint8_t> linear((size / 2) * (size / 2) * 4);
+        std::vector<uint8_t> srgb(linear.size());
+        OGDE::Graphics::MipSettings settings;
+        settings.srgb = false;
+        OGDE::Graphics::MipGenerator::Downsample(base.data(), size, size, 4, linear.data(), settings);
+        settings.srgb = true;
+        OGDE::Graphics::MipGenerator::Downsample(base.data(), size, size, 4, srgb.data(), settings);
+
+        // Linear 0.5 is 128 in UNORM and 188 in sRGB; alpha is always averaged linearly
+        bool correct = true;
+        for (size_t i = 0; i < linear.size(); i += 4) {
+            correct = correct && linear[i] == 128 && linear[i + 3] == 128;
+            correct = correct && srgb[i] == 188 && srgb[i + 1] == 188 && srgb[i + 3] == 128;
+        }
+
+        EXPECT_TRUE(correct);
+    }
+}
+
+void testMipKaiserFilter() {
+    TEST("Kaiser mip filter preserves flat regions and matches with threads") {
+        const int width = 64;
+        const int height = 48;
+        std::vector<uint8_t> base(width * height * 4);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                uint8_t* p = &base[(y * width + x) * 4];
+                p[0] = static_cast<uint8_t>(x * 4);
+                p[1] = static_cast<uint8_t>(y * 5);
+                p[2] = 90;
+                p[3] = 255;
+            }
+        }
+
+        OGDE::Graphics::Texture serial;
+        OGDE::Graphics::Texture threaded;
+        serial.LoadFromMemory(base.data(), width, height, 4);
+        threaded.LoadFromMemory(base.data(), width, height, 4);
+
+        OGDE::Graphics::MipSettings settings;
+        settings.filter = OGDE::Graphics::MipFilter::Kaiser;
+        serial.GenerateMipmaps(settings);
+        ogde::core::JobSystem jobs(2);
+        settings.jobSystem = &jobs;
+        threaded.GenerateMipmaps(settings);
+
+        bool match = serial.GetMipLevelCount() == 7 && threaded.GetMipLevelCount() == 7;
+        const OGDE::Graphics::MipLevel& last = serial.GetMipLevel(6);
+        match = match && std::equal(serial.GetData(), serial.GetData() + last.offset + last.size, threaded.GetData());
+
+        // Blue and alpha are constant, so they must survive filtering exactly
+        for (int level = 1; match && level < serial.GetMipLevelCount(); ++level) {
+            const uint8_t* data = serial.GetData(level);
+            const OGDE::Graphics::MipLevel& mip = serial.GetMipLevel(level);
+            for (int i = 0; i < mip.width * mip.height; ++i) {
+                match = match && data[i * 4 + 2] == 90 && data[i * 4 + 3] == 255;
+            }
+        }
+
+        EXPECT_TRUE(match);
+    }
+}
+
+// Smooth RGBA test image with an alpha ramp and a few hard edges
+std::vector<uint8_t> makeCompressionTestImage(int width, int height) {
+    std::vector<uint8_t> rgba(width * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            uint8_t* p = &rgba[(y * width + x) * 4];
+            p[0] = static_cast<uint8_t>(x * 255 / (width - 1));
+            p[1] = static_cast<uint8_t>(y * 255 / (height - 1));
+            p[2] = static_cast<uint8_t>(((x / 8 + y / 8) & 1) ? 200 : 40);
+            p[3] = static_cast<uint8_t>(255 - x * 2);
+        }
+    }
+    return rgba;
+}
+
+void testBlockCompressionRoundTrip() {
+    TEST("Block compression round trips every format with good PSNR") {
+        const int width = 64;
+        const int height = 60;  // Not a multiple of 4: edge blocks are padded
+        std::vector<uint8_t> rgba = makeCompressionTestImage(width, height);
+
+        const OGDE::Graphics::BlockFormat formats[] = {
+            OGDE::Graphics::BlockFormat::BC1, OGDE::Graphics::BlockFormat::BC3, OGDE::Graphics::BlockFormat::BC4,
+            OGDE::Graphics::BlockFormat::BC5, OGDE::Graphics::BlockFormat::BC7
+        };
+        const double minimumPsnr[] = { 30.0, 30.0, 40.0, 40.0, 38.0 };
+
+        bool allGood = true;
+        std::vector<uint8_t> decoded(width * height * 4);
+        for (int f = 0; f < 5; ++f) {
+            OGDE::Graphics::CompressionSettings settings;
+            settings.format = formats[f];
+            std::vector<uint8_t> blocks(OGDE::Graphics::BlockCompressor::GetCompressedSize(formats[f], width, height));
+            bool encoded = OGDE::Graphics::BlockCompressor::Encode(rgba.data(), width, height, 4, settings, blocks.data());
+            bool decodedOk = OGDE::Graphics::BlockCompressor::Decode(blocks.data(), width, height, formats[f], decoded.data());
+            double psnr = OGDE::Graphics::BlockCompressor::ComputePsnr(
+                rgba.data(), decoded.data(), width, height, OGDE::Graphics::BlockCompressor::GetChannelCount(formats[f]));
+            if (!encoded || !decodedOk || psnr < minimumPsnr[f]) {
+                std::cout << "(format " << f << " PSNR " << psnr << ") ";
+                allGood = false;
+            }
+        }
+
+        EXPECT_TRUE(allGood);
+    }
+}
+
+void testBlockCompressionQualityAndThreads() {
+    TEST("Higher BC7 quality never loses PSNR and threads match serial output") {
+        const int width = 64;
+        const int height = 64;
+        std::vector<uint8_t> rgba = makeCompressionTestImage(width, height);
+        size_t size = OGDE::Graphics::BlockCompressor::GetCompressedSize(OGDE::Graphics::BlockFormat::BC7, width, height);
+
+        OGDE::Graphics::CompressionSettings settings;
+        double psnr[3];
+        std::vector<uint8_t> blocks(size), decoded(width * height * 4);
+        const OGDE::Graphics::CompressionQuality qualities[] = {
+            OGDE::Graphics::CompressionQuality::Fast, OGDE::Graphics::CompressionQuality::Normal,
+            OGDE::Graphics::CompressionQuality::High
+        };
+        for (int q = 0; q < 3; ++q) {
+            settings.quality = qualities[q];
+            OGDE::Graphics::BlockCompressor::Encode(rgba.data(), width, height, 4, settings, blocks.data());
+            OGDE::Graphics::BlockCompressor::Decode(blocks.data(), width, height, settings.format, decoded.data());
+            psnr[q] = OGDE::Graphics::BlockCompressor::ComputePsnr(rgba.data(), decoded.data(), width, height, 4);
+        }
+
+        ogde::core::JobSystem jobs(3);
+        settings.jobSystem = &jobs;
+        std::vector<uint8_t> threaded(size);
+        OGDE::Graphics::BlockCompressor::Encode(rgba.data(), width, height, 4, settings, threaded.data());
+
+        EXPECT_TRUE(psnr[1] >= psnr[0] && psnr[2] >= psnr[1] && threaded == blocks);
+    }
+}
+
+void testTextureCompress() {
+    TEST("Texture compresses its whole mip chain") {
+        std::vector<uint8_t> rgb(32 * 16 * 3, 77);
+        OGDE::Graphics::Texture texture;
+        texture.LoadFromMemory(rgb.data(), 32, 16, 3);
+        texture.GenerateMipmaps();
+
+        OGDE::Graphics::CompressionSettings settings;
+        settings.format = OGDE::Graphics::BlockFormat::BC1;
+        bool compressed = texture.Compress(settings) && texture.IsCompressed();
+
+        // 32x16, 16x8, 8x4, 4x2, 2x1, 1x1 -> 32 + 8 + 2 + 1 + 1 + 1 blocks of 8 bytes
+        const OGDE::Graphics::MipLevel& last = texture.GetMipLevel(texture.GetMipLevelCount() - 1);
+        bool sizes = texture.GetMipLevelCount() == 6 && last.offset + last.size == 45 * 8 &&
+                     texture.GetMipLevel(1).offset == 32 * 8;
+        bool refusesMips = !texture.GenerateMipmaps();
+
+        EXPECT_TRUE(compressed && sizes && refusesMips);
+    }
+}
+
+std::string tempTexturePath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void testTextureContainerRoundTrip() {
+    TEST("Texture container maps mips and BC blocks back bit-exactly") {
+        const int width = 64;
+        const int height = 32;
+        std::vector<uint8_t> rgba = makeCompressionTestImage(width, height);
+
+        OGDE::Graphics::Texture plain;
+        plain.LoadFromMemory(rgba.data(), width, height, 4);
+        plain.GenerateMipmaps();
+
+        OGDE::Graphics::Texture compressed;
+        compressed.LoadFromMemory(rgba.data(), width, height, 4);
+        compressed.GenerateMipmaps();
+        OGDE::Graphics::CompressionSettings settings;
+        settings.format = OGDE::Graphics::BlockFormat::BC1;
+        compressed.Compress(settings);
+
+        bool match = true;
+        OGDE::Graphics::Texture* sources[] = { &plain, &compressed };
+        for (OGDE::Graphics::Texture* source : sources) {
+            std::string path = tempTexturePath(source == &plain ? "ogde_plain.ogtex" : "ogde_bc1.ogtex");
+            match = match && OGDE::Graphics::TextureContainer::Write(path, *source);
+
+            OGDE::Graphics::Texture loaded;
+            match = match && loaded.LoadFromFile(path) && loaded.IsMapped();
+            match = match && loaded.GetWidth() == width && loaded.GetHeight() == height &&
+                    loaded.GetChannels() == 4 && loaded.IsCompressed() == source->IsCompressed() &&
+                    loaded.GetMipLevelCount() == source->GetMipLevelCount();
+            for (int level = 0; match && level < loaded.GetMipLevelCount(); ++level) {
+                const OGDE::Graphics::MipLevel& mip = loaded.GetMipLevel(level);
+                match = mip.size == source->GetMipLevel(level).size &&
+                        std::equal(loaded.GetData(level), loaded.GetData(level) + mip.size, source->GetData(level));
+            }
+            // Payload is aligned for SIMD access straight out of the mapping
+            match = match && reinterpret_cast<uintptr_t>(loaded.GetData()) % OGDE::Graphics::kOgtexPayloadAlignment == 0;
+
+            // Modifying a mapped texture detaches it from the file
+            if (!loaded.IsCompressed()) {
+                match = match && loaded.GenerateMipmaps() && !loaded.IsMapped();
+            }
+            loaded.Release();
+            std::filesystem::remove(path);
+        }
+
+        EXPECT_TRUE(match);
+    }
+}
+
+void testTextureContainerRejectsCorruptFiles() {
+    TEST("Texture container rejects truncated and corrupt files") {
+        std::vector<uint8_t> rgba = makeCompressionTestImage(16, 16);
+        OGDE::Graphics::Texture texture;
+        texture.LoadFromMemory(rgba.data(), 16, 16, 4);
+        texture.GenerateMipmaps();
+
+        std::string path = tempTexturePath("ogde_corrupt.ogtex");
+        OGDE::Graphics::TextureContainer::Write(path, texture);
+        std::vector<uint8_t> file = *OGDE::Core::FileSystem::ReadBinaryFile(path);
+        std::filesystem::remove(path);
+
+        OGDE::Graphics::OgtexInfo info;
+        bool valid = OGDE::Graphics::TextureContainer::Parse(file.data(), file.size(), info);
+
+        bool truncated = OGDE::Graphics::TextureContainer::Parse(file.data(), file.size() - 1, info);
+
+        std::vector<uint8_t> badMagic = file;
+        badMagic[0] ^= 0xFF;
+        bool magic = OGDE::Graphics::TextureContainer::Parse(badMagic.data(), badMagic.size(), info);
+
+        // Level 1 claims a size that does not match its 8x8 RGBA dimensions
+        std::vector<uint8_t> badLevel = file;
+        badLevel[sizeof(OGDE::Graphics::OgtexHeader) + sizeof(OGDE::Graphics::OgtexLevel) + 16] ^= 0x01;
+        bool level = OGDE::Graphics::TextureContainer::Parse(badLevel.data(), badLevel.size(), info);
+
+        // Level 1 moved 4 bytes later: still inside the payload, but leaves a gap after level 0
+        std::vector<uint8_t> gap = file;
+        gap[sizeof(OGDE::Graphics::OgtexHeader) + sizeof(OGDE::Graphics::OgtexLevel) + 8] += 4;
+        bool gapped = OGDE::Graphics::TextureContainer::Parse(gap.data(), gap.size(), info);
+
+        EXPECT_TRUE(valid && !truncated && !magic && !level && !gapped);
+    }
+}
+
+// Writes a solid-color RGBA .ogtex of the given size, optionally with a full mip chain, and returns its path
+std::string writeSolidTexture(const char* name, int size, uint8_t value, bool withMips = false) {
+    std::vector<uint8_t> rgba(size * size * 4, value);
+    OGDE::Graphics::Texture texture;
+    texture.LoadFromMemory(rgba.data(), size, size, 4);
+    if (withMips) {
+        texture.GenerateMipmaps();
+    }
+    std::string path = tempTexturePath(name);
+    OGDE::Graphics::TextureContainer::Write(path, texture);
+    return path;
+}
+
+void testTextureLoaderPriorityAndBudget() {
+    TEST("Async texture loader publishes by priority under the upload budget") {
+        std::string paths[] = {
+            writeSolidTexture("ogde_async_a.ogtex", 32, 10),
+            writeSolidTexture("ogde_async_b.ogtex", 32, 20),
+            writeSolidTexture("ogde_async_c.ogtex", 32, 30)
+        };
+
+        OGDE::Graphics::TextureLoader loader(2);
+        OGDE::Graphics::TextureHandle low = loader.Load(paths[0], 1.0f);
+        OGDE::Graphics::TextureHandle mid = loader.Load(paths[1], 5.0f);
+        OGDE::Graphics::TextureHandle high = loader.Load(paths[2], 9.0f);
+
+        // Nothing is visible before the frame boundary, even once decoded
+        bool ok = &loader.GetTexture(high) == &loader.GetPlaceholder();
+        loader.WaitIdle();
+        ok = ok && loader.GetState(low) == OGDE::Graphics::TextureLoadState::Decoded;
+        ok = ok && &loader.GetTexture(high) == &loader.GetPlaceholder();
+
+        // A full 32x32 chain is 5460 bytes: the budget admits exactly one texture
+        std::vector<OGDE::Graphics::TextureHandle> uploaded;
+        auto record = [&](OGDE::Graphics::TextureHandle handle, OGDE::Graphics::Texture&) { uploaded.push_back(handle); };
+        ok = ok && loader.ProcessUploads(6000, record) == 5460;
+
+        // Raising the low texture's priority lets it overtake the middle one
+        loader.SetPriority(low, 20.0f);
+        loader.ProcessUploads(6000, record);
+        loader.ProcessUploads(6000, record);
+
+        const OGDE::Graphics::Texture& resident = loader.GetTexture(high);
+        ok = ok && uploaded.size() == 3 && uploaded[0] == high && uploaded[1] == low && uploaded[2] == mid;
+        ok = ok && resident.GetMipLevelCount() == 6 && resident.GetData()[0] == 30;
+        ok = ok && loader.GetStats().resident == 3 && loader.GetStats().residentBytes == 3 * 5460;
+
+        for (const std::string& path : paths) {
+            std::filesystem::remove(path);
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureLoaderFailuresAndUnload() {
+    TEST("Async texture loader keeps the placeholder for failed and unloaded textures") {
+        std::string path = writeSolidTexture("ogde_async_unload.ogtex", 16, 50);
+
+        OGDE::Graphics::TextureLoader loader(1);
+        OGDE::Graphics::TextureHandle missing = loader.Load(tempTexturePath("ogde_missing.ogtex"));
+        OGDE::Graphics::TextureHandle dropped = loader.Load(path);
+        OGDE::Graphics::TextureHandle kept = loader.Load(path);
+        loader.Unload(dropped);
+        loader.WaitIdle();
+        loader.ProcessUploads(1 << 20);
+
+        bool ok = loader.GetState(missing) == OGDE::Graphics::TextureLoadState::Failed;
+        ok = ok && &loader.GetTexture(missing) == &loader.GetPlaceholder();
+        ok = ok && &loader.GetTexture(dropped) == &loader.GetPlaceholder();
+        ok = ok && loader.GetState(kept) == OGDE::Graphics::TextureLoadState::Resident;
+
+        // Recycled slots hand out new handles; the stale one stays invalid
+        OGDE::Graphics::TextureHandle reused = loader.Load(path);
+        ok = ok && reused != dropped && loader.GetState(dropped) == OGDE::Graphics::TextureLoadState::Failed;
+        loader.WaitIdle();
+
+        // Nearer objects get a higher priority
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 1.0f, 0.1f, 1000.0f);
+        float nearPriority = OGDE::Graphics::TextureLoader::ComputeScreenPriority(camera, 1080.0f, 0.0f, 0.0f, 10.0f, 1.0f);
+        float farPriority = OGDE::Graphics::TextureLoader::ComputeScreenPriority(camera, 1080.0f, 0.0f, 0.0f, 100.0f, 1.0f);
+        ok = ok && nearPriority > farPriority && std::abs(nearPriority / farPriority - 10.0f) < 0.01f;
+
+        std::filesystem::remove(path);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureStreamingLru() {
+    TEST("Texture streamer loads requested mips and evicts the least recently used") {
+        // 128x128 RGBA chains: the tail of 16x16 and below is 1364 bytes
+        const size_t tail = 1364;
+        const size_t streamed = 65536 + 16384 + 4096;
+        std::string pathA = writeSolidTexture("ogde_stream_a.ogtex", 128, 70, true);
+        std::string pathB = writeSolidTexture("ogde_stream_b.ogtex", 128, 140, true);
+
+        OGDE::Graphics::StreamingSettings settings;
+        settings.budgetBytes = 2 * tail + streamed;
+        OGDE::Graphics::TextureStreamer streamer(settings);
+        OGDE::Graphics::StreamedTextureHandle a = streamer.Register(pathA);
+        OGDE::Graphics::StreamedTextureHandle b = streamer.Register(pathB);
+
+        // Only the tail is resident after registration
+        bool ok = streamer.GetResidency(a).residentMip == 3 && streamer.GetStats().residentBytes == 2 * tail;
+        ok = ok && streamer.GetLevelData(a, 2) == nullptr && streamer.GetLevelData(a, 3)[0] == 70;
+
+        streamer.ReportUsage(a, 0);
+        streamer.Update();
+        ok = ok && streamer.GetResidency(a).residentMip == 0 && streamer.GetStats().loadsLastUpdate == 3;
+
+        // B now needs the memory A holds; A was not used this frame
+        streamer.ReportUsage(b, 0);
+        streamer.Update();
+        OGDE::Graphics::TextureResidency residencyA = streamer.GetResidency(a);
+        OGDE::Graphics::TextureResidency residencyB = streamer.GetResidency(b);
+        ok = ok && residencyB.residentMip == 0 && residencyA.residentMip == residencyA.tailMip;
+        ok = ok && residencyA.evictions == 3 && residencyB.residentBytes == residencyB.fullBytes;
+        ok = ok && streamer.GetStats().residentBytes <= settings.budgetBytes;
+        ok = ok && streamer.GetLevelData(b, 0)[0] == 140;
+
+        // Shrinking the budget trims B back toward its tail on the next update
+        streamer.SetBudget(2 * tail + 4096);
+        streamer.Update();
+        ok = ok && streamer.GetResidency(b).residentMip == 2 && streamer.GetStats().residentBytes == 2 * tail + 4096;
+
+        // A recycled slot hands out a new handle; the stale one no longer resolves
+        streamer.Unregister(a);
+        OGDE::Graphics::StreamedTextureHandle reused = streamer.Register(pathB);
+        ok = ok && reused != a && streamer.GetResidency(a).mipCount == 0 && streamer.GetLevelData(a, 3) == nullptr;
+        ok = ok && streamer.GetLevelData(reused, 3)[0] == 140;
+
+        std::filesystem::remove(pathA);
+        std::filesystem::remove(pathB);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureStreamingContention() {
+    TEST("Texture streamer defers requests instead of evicting textures in use") {
+        const size_t tail = 1364;
+        std::string pathA = writeSolidTexture("ogde_stream_c.ogtex", 128, 10, true);
+        std::string pathB = writeSolidTexture("ogde_stream_d.ogtex", 128, 20, true);
+
+        OGDE::Graphics::StreamingSettings settings;
+        settings.budgetBytes = 2 * tail + 65536 + 16384 + 4096;
+        OGDE::Graphics::TextureStreamer streamer(settings);
+        OGDE::Graphics::StreamedTextureHandle a = streamer.Register(pathA);
+        OGDE::Graphics::StreamedTextureHandle b = streamer.Register(pathB);
+
+        bool ok = true;
+        for (int frame = 0; frame < 3; ++frame) {
+            streamer.ReportUsage(a, 0);
+            streamer.ReportUsage(b, 0);
+            streamer.Update();
+            ok = ok && streamer.GetStats().residentBytes <= settings.budgetBytes;
+            ok = ok && (frame == 0 || streamer.GetStats().evictionsLastUpdate == 0);
+        }
+        // Both reached level 1 (16 KB each); neither can take level 0 without evicting the other
+        ok = ok && streamer.GetResidency(a).residentMip == 1 && streamer.GetResidency(b).residentMip == 1;
+        ok = ok && streamer.GetStats().pendingTextures == 2;
+
+        ok = ok && OGDE::Graphics::TextureStreamer::ComputeDesiredMip(1024, 1024, 256.0f) == 2;
+        ok = ok && OGDE::Graphics::TextureStreamer::ComputeDesiredMip(1024, 512, 2048.0f) == 0;
+        ok = ok && OGDE::Graphics::TextureStreamer::ComputeDesiredMip(1024, 512, 0.5f) == 10;
+
+        std::filesystem::remove(pathA);
+        std::filesystem::remove(pathB);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testAtlasPackerNoOverlap() {
+    TEST("MaxRects packer places rectangles inside the bin without overlap") {
+        OGDE::Graphics::AtlasPacker packer(256, 256);
+        std::vector<OGDE::Graphics::AtlasRect> placed;
+        uint32_t seed = 7;
+        for (int i = 0; i < 200; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            int width = 4 + static_cast<int>((seed >> 8) % 28);
+            int height = 4 + static_cast<int>((seed >> 16) % 28);
+            OGDE::Graphics::AtlasRect rect;
+            if (packer.Insert(width, height, rect)) {
+                placed.push_back(rect);
+            }
+        }
+
+        bool ok = placed.size() > 50 && packer.GetOccupancy() > 0.8f;
+        for (size_t i = 0; ok && i < placed.size(); ++i) {
+            const OGDE::Graphics::AtlasRect& a = placed[i];
+            ok = a.x >= 0 && a.y >= 0 && a.x + a.width <= 256 && a.y + a.height <= 256;
+            for (size_t j = i + 1; ok && j < placed.size(); ++j) {
+                const OGDE::Graphics::AtlasRect& b = placed[j];
+                ok = a.x >= b.x + b.width || b.x >= a.x + a.width || a.y >= b.y + b.height || b.y >= a.y + a.height;
+            }
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureAtlasPaddingAndMips() {
+    TEST("Texture atlas pads images so mips do not bleed between blocks") {
+        // 16 solid 16x16 block textures plus a 3-channel 24x8 one
+        std::vector<OGDE::Graphics::Texture> blocks(17);
+        std::vector<const OGDE::Graphics::Texture*> images;
+        for (int i = 0; i < 16; ++i) {
+            std::vector<uint8_t> rgba(16 * 16 * 4);
+            for (size_t p = 0; p < rgba.size(); p += 4) {
+                rgba[p + 0] = static_cast<uint8_t>(i * 15);
+                rgba[p + 1] = static_cast<uint8_t>(255 - i * 15);
+                rgba[p + 2] = static_cast<uint8_t>(i * 7);
+                rgba[p + 3] = 255;
+            }
+            blocks[i].LoadFromMemory(rgba.data(), 16, 16, 4);
+            images.push_back(&blocks[i]);
+        }
+        std::vector<uint8_t> rgb(24 * 8 * 3, 99);
+        blocks[16].LoadFromMemory(rgb.data(), 24, 8, 3);
+        images.push_back(&blocks[16]);
+
+        OGDE::Graphics::AtlasSettings settings;
+        settings.padding = 4;
+        settings.mipSettings.srgb = false;
+        settings.mipSettings.filter = OGDE::Graphics::MipFilter::Kaiser;    // Overridden: too wide for the border
+        OGDE::Graphics::TextureAtlas atlas;
+        bool ok = atlas.Build(images, settings) && atlas.GetPageCount() == 1;
+
+        // Padding 4 keeps a border texel down to level 2
+        const OGDE::Graphics::Texture& page = atlas.GetPage(0);
+        ok = ok && page.GetMipLevelCount() == 3 && page.GetChannels() == 4;
+
+        for (int i = 0; ok && i < atlas.GetRegionCount(); ++i) {
+            const OGDE::Graphics::AtlasRegion& region = atlas.GetRegion(i);
+            uint8_t expected = i < 16 ? static_cast<uint8_t>(i * 15) : 99;
+            // Every texel of the image plus its border, at every level, has the image's color
+            for (int level = 0; ok && level < page.GetMipLevelCount(); ++level) {
+                const OGDE::Graphics::MipLevel& mip = page.GetMipLevel(level);
+                int x0 = (region.rect.x - settings.padding) >> level;
+                int y0 = (region.rect.y - settings.padding) >> level;
+                int x1 = (region.rect.x + region.rect.width + settings.padding) >> level;
+                int y1 = (region.rect.y + region.rect.height + settings.padding) >> level;
+                for (int y = y0; ok && y < y1; ++y) {
+                    for (int x = x0; ok && x < x1; ++x) {
+                        ok = page.GetData(level)[(y * mip.width + x) * 4] == expected;
+                    }
+                }
+            }
+        }
+
+        float u, v;
+        atlas.RemapUV(16, 1.0f, 0.5f, u, v);
+        const OGDE::Graphics::AtlasRegion& wide = atlas.GetRegion(16);
+        ok = ok && std::abs(u - (wide.rect.x + 24) / static_cast<float>(page.GetWidth())) < 1e-6f;
+        ok = ok && std::abs(v - (wide.rect.y + 4) / static_cast<float>(page.GetHeight())) < 1e-6f;
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureArrayLayout() {
+    TEST("Texture array layout gives each image a full-UV layer") {
+        std::vector<uint8_t> pixels(16 * 16 * 4, 40);
+        OGDE::Graphics::Texture a, b, odd;
+        a.LoadFromMemory(pixels.data(), 16, 16, 4);
+        b.LoadFromMemory(pixels.data(), 16, 16, 4);
+        odd.LoadFromMemory(pixels.data(), 8, 8, 4);
+
+        OGDE::Graphics::AtlasSettings settings;
+        settings.layout = OGDE::Graphics::AtlasLayout::Array;
+        OGDE::Graphics::TextureAtlas atlas;
+        bool ok = atlas.Build({ &a, &b }, settings) && atlas.GetPageCount() == 2;
+        ok = ok && atlas.GetRegion(1).page == 1 && atlas.GetRegion(1).u1 == 1.0f;
+        ok = ok && atlas.GetPage(1).GetMipLevelCount() == 5;
+        ok = ok && !atlas.Build({ &a, &odd }, settings) && atlas.GetPageCount() == 0;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testPixelConvertMatchesReference() {
+    TEST("Pixel conversion kernels match scalar references, including in place") {
+        // Odd count so every SIMD path also runs its scalar tail
+        const size_t count = 1037;
+        std::vector<uint8_t> rgb(count * 3), rgba(count * 4);
+        uint32_t seed = 99;
+        for (uint8_t& value : rgb) {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<uint8_t>(seed >> 24);
+        }
+        for (uint8_t& value : rgba) {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<uint8_t>(seed >> 24);
+        }
+
+        bool ok = true;
+        std::vector<uint8_t> expanded(count * 4);
+        OGDE::Graphics::PixelConverter::RgbToRgba(rgb.data(), expanded.data(), count, 200);
+        std::vector<uint8_t> inPlace(count * 4);
+        std::copy(rgb.begin(), rgb.end(), inPlace.begin());
+        OGDE::Graphics::PixelConverter::RgbToRgbaInPlace(inPlace.data(), count, 200);
+        for (size_t i = 0; ok && i < count; ++i) {
+            ok = expanded[i * 4] == rgb[i * 3] && expanded[i * 4 + 1] == rgb[i * 3 + 1] &&
+                 expanded[i * 4 + 2] == rgb[i * 3 + 2] && expanded[i * 4 + 3] == 200;
+        }
+        ok = ok && inPlace == expanded;
+
+        std::vector<uint8_t> swizzled = rgba;
+        OGDE::Graphics::PixelConverter::SwizzleRgbaBgra(swizzled.data(), swizzled.data(), count);
+        std::vector<uint8_t> premultiplied(count * 4);
+        OGDE::Graphics::PixelConverter::PremultiplyAlpha(rgba.data(), premultiplied.data(), count);
+        for (size_t i = 0; ok && i < count; ++i) {
+            const uint8_t* p = &rgba[i * 4];
+            ok = swizzled[i * 4] == p[2] && swizzled[i * 4 + 2] == p[0] && swizzled[i * 4 + 1] == p[1] &&
+                 swizzled[i * 4 + 3] == p[3];
+            for (int c = 0; ok && c < 3; ++c) {
+                int expected = static_cast<int>(std::floor(p[c] * p[3] / 255.0 + 0.5));
+                ok = premultiplied[i * 4 + c] == expected;
+            }
+            ok = ok && premultiplied[i * 4 + 3] == p[3];
+        }
+
+        std::vector<float> floats(rgba.size());
+        std::vector<uint8_t> bytes(rgba.size());
+        OGDE::Graphics::PixelConverter::UnormToFloat(rgba.data(), floats.data(), rgba.size());
+        OGDE::Graphics::PixelConverter::FloatToUnorm(floats.data(), bytes.data(), floats.size());
+        ok = ok && bytes == rgba && std::abs(floats[5] - rgba[5] / 255.0f) < 1e-6f;
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testPixelConvertSrgbRoundTrip() {
+    TEST("sRGB decode and encode round trip every value and keep alpha linear") {
+        std::vector<uint8_t> rgba(256 * 4 + 4);  // One extra pixel exercises the tail
+        for (size_t i = 0; i < rgba.size(); ++i) {
+            rgba[i] = static_cast<uint8_t>(i / 4);
+        }
+        const size_t count = rgba.size() / 4;
+
+        std::vector<float> linear(rgba.size());
+        std::vector<uint8_t> encoded(rgba.size());
+        OGDE::Graphics::PixelConverter::SrgbToLinear(rgba.data(), linear.data(), count, 4);
+        OGDE::Graphics::PixelConverter::LinearToSrgb(linear.data(), encoded.data(), count, 4);
+
+        bool ok = encoded == rgba;
+        // sRGB 128 is about 0.2158 linear; alpha 128 stays 128 / 255
+        ok = ok && std::abs(linear[128 * 4] - 0.2158f) < 1e-3f && std::abs(linear[128 * 4 + 3] - 128 / 255.0f) < 1e-6f;
+
+        // Out-of-range input is clamped
+        float extremes[3] = { -1.0f, 2.0f, 0.5f };
+        uint8_t clamped[3];
+        OGDE::Graphics::PixelConverter::LinearToSrgb(extremes, clamped, 3, 1);
+        ok = ok && clamped[0] == 0 && clamped[1] == 255 && clamped[2] == 188;
+
+        // NaN and infinities: the first 16 values go through the SIMD kernels, the last 4
+        // through the scalar tail, and both must agree (NaN -> 0, +Inf -> 255, -Inf -> 0)
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float inf = std::numeric_limits<float>::infinity();
+        std::vector<float> special(20, 0.5f);
+        for (size_t base : { size_t(0), size_t(8), size_t(16) }) {
+            special[base + 0] = nan;
+            special[base + 1] = inf;
+            special[base + 2] = -inf;
+            special[base + 3] = -nan;
+        }
+        std::vector<uint8_t> srgb(special.size());
+        std::vector<uint8_t> unorm(special.size());
+        OGDE::Graphics::PixelConverter::LinearToSrgb(special.data(), srgb.data(), special.size(), 1);
+        OGDE::Graphics::PixelConverter::FloatToUnorm(special.data(), unorm.data(), special.size());
+        for (size_t base : { size_t(0), size_t(8), size_t(16) }) {
+            ok = ok && srgb[base] == 0 && srgb[base + 1] == 255 && srgb[base + 2] == 0 && srgb[base + 3] == 0;
+            ok = ok && unorm[base] == 0 && unorm[base + 1] == 255 && unorm[base + 2] == 0 && unorm[base + 3] == 0;
+        }
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+std::string writeTgaImage(const char* name, int size, uint8_t seed) {
+    // Uncompressed 24-bit TGA, enough for stb_image
+    std::vector<uint8_t> file(18 + static_cast<size_t>(size) * size * 3);
+    file[2] = 2;
+    file[12] = static_cast<uint8_t>(size);
+    file[14] = static_cast<uint8_t>(size);
+    file[16] = 24;
+    for (size_t i = 18; i < file.size(); ++i) {
+        file[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    std::string path = tempTexturePath(name);
+    OGDE::Core::FileSystem::WriteBinaryFile(path, file);
+    return path;
+}
+
+void testTextureCacheDeduplicates() {
+    TEST("Texture cache shares one texture across repeated paths and identical files") {
+        std::string path = writeTgaImage("ogde_cache_a.tga", 16, 1);
+        std::string copy = tempTexturePath("ogde_cache_copy.tga");
+        std::filesystem::copy_file(path, copy, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::path dotted = std::filesystem::path(path).parent_path() / "." / "ogde_cache_a.tga";
+
+        OGDE::Graphics::TextureCache cache;
+        std::shared_ptr<OGDE::Graphics::Texture> first = cache.Load(path);
+        std::shared_ptr<OGDE::Graphics::Texture> again = cache.Load(path);
+        std::shared_ptr<OGDE::Graphics::Texture> viaDot = cache.Load(dotted.string());
+        std::shared_ptr<OGDE::Graphics::Texture> viaCopy = cache.Load(copy);
+
+        bool ok = first && first == again && first == viaDot && first == viaCopy;
+        ok = ok && first->GetWidth() == 16 && first->GetMipLevelCount() == 5;
+
+        OGDE::Graphics::TextureCacheStats stats = cache.GetStats();
+        ok = ok && stats.misses == 1 && stats.pathHits == 2 && stats.contentHits == 1;
+        ok = ok && stats.textureCount == 1 && stats.totalBytes == first->GetMemorySize();
+
+        std::vector<OGDE::Graphics::TextureCacheEntryInfo> entries = cache.GetEntries();
+        ok = ok && entries.size() == 1 && entries[0].paths.size() == 2 && entries[0].references == 4;
+        ok = ok && !cache.Load(tempTexturePath("ogde_cache_missing.tga"));
+
+        // A matching hash alone is not enough: once the cached file changes on disk, a file
+        // with its old contents no longer compares equal and is decoded on its own
+        std::string stale = tempTexturePath("ogde_cache_stale.tga");
+        std::filesystem::copy_file(path, stale, std::filesystem::copy_options::overwrite_existing);
+        writeTgaImage("ogde_cache_a.tga", 16, 2);
+        std::shared_ptr<OGDE::Graphics::Texture> viaStale = cache.Load(stale);
+        ok = ok && viaStale && viaStale != first && cache.GetStats().misses == 2;
+
+        std::filesystem::remove(path);
+        std::filesystem::remove(copy);
+        std::filesystem::remove(stale);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testTextureCacheEvictsUnreferencedLru() {
+    TEST("Texture cache evicts least recently used unreferenced textures over budget") {
+        std::string paths[4];
+        for (int i = 0; i < 4; ++i) {
+            std::string name = "ogde_cache_lru" + std::to_string(i) + ".tga";
+            paths[i] = writeTgaImage(name.c_str(), 16, static_cast<uint8_t>(10 + i));
+        }
+
+        OGDE::Graphics::TextureCacheSettings settings;
+        settings.generateMipmaps = false;
+        settings.budgetBytes = 16 * 16 * 3 * 3;
+        OGDE::Graphics::TextureCache cache(settings);
+
+        cache.Load(paths[0]);
+        std::shared_ptr<OGDE::Graphics::Texture> held = cache.Load(paths[1]);
+        cache.Load(paths[2]);
+        cache.Load(paths[0]);               // 0 is now more recent than 2
+        cache.Load(paths[3]);               // Over budget: 1 is held, so 2 goes
+
+        bool ok = cache.Find(paths[0]) && cache.Find(paths[1]) && !cache.Find(paths[2]) && cache.Find(paths[3]);
+        OGDE::Graphics::TextureCacheStats stats = cache.GetStats();
+        ok = ok && stats.evictions == 1 && stats.textureCount == 3 && stats.referencedCount == 1;
+
+        // Referenced textures survive even a zero budget
+        cache.SetBudget(0);
+        ok = ok && cache.GetStats().textureCount == 1 && cache.Find(paths[1]) == held;
+        held.reset();
+        ok = ok && cache.Clear() == 1 && cache.GetStats().totalBytes == 0;
+
+        for (const std::string& path : paths) {
+            std::filesystem::remove(path);
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+// 32x16 PNGs: RGBA cycling all five row filters (dynamic Huffman), RGB with
+// fixed Huffman codes, and a 2-bit palette with tRNS (stored blocks). Each
+// splits its zlib stream over two IDAT chunks.
+const uint8_t kPngRgbaFilters[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x77, 0x00, 0x7D,
+    0x59, 0x00, 0x00, 0x01, 0x18, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xE5, 0xD4, 0x55, 0x50, 0x94,
+    0x51, 0x00, 0xC5, 0xF1, 0xFD, 0xBE, 0x5D, 0x96, 0x15, 0x11, 0x90, 0x10, 0x14, 0x24, 0x57, 0x40,
+    0x58, 0x72, 0x05, 0x04, 0x04, 0x64, 0x15, 0x94, 0x55, 0xD0, 0x55, 0x51, 0x51, 0x51, 0x6C, 0x4C,
+    0xEC, 0xD6, 0xB5, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x3B, 0x50, 0xF8, 0xEF,
+    0x8C, 0x3E, 0xE8, 0xF8, 0x22, 0xC3, 0xEC, 0x38, 0xC3, 0x79, 0x3C, 0xF7, 0xFE, 0x66, 0xEE, 0xC3,
+    0x99, 0x2B, 0x91, 0x94, 0xEA, 0xB2, 0x5E, 0x56, 0xBA, 0xC7, 0x66, 0x45, 0xD9, 0xDE, 0xDB, 0xCD,
+    0xCB, 0xF7, 0xDF, 0x6D, 0x55, 0x71, 0xF0, 0x7E, 0xDB, 0xCA, 0xC3, 0x0F, 0x3B, 0x54, 0x1B, 0x7D,
+    0xDC, 0xA9, 0xE6, 0xF8, 0xD3, 0xAE, 0x75, 0x26, 0x9F, 0x57, 0xA6, 0x4D, 0xBF, 0xEC, 0xDD, 0x68,
+    0xF6, 0x75, 0x55, 0xFA, 0xFC, 0xDB, 0x81, 0x2D, 0x17, 0xDF, 0x2F, 0xD1, 0x66, 0xF9, 0xE3, 0x92,
+    0x1D, 0x56, 0x3F, 0x87, 0xBE, 0x86, 0xBE, 0x87, 0x7E, 0x86, 0x66, 0x42, 0x25, 0x50, 0x19, 0x54,
+    0x01, 0x35, 0x87, 0x5A, 0x41, 0x6D, 0xA1, 0x0E, 0x50, 0x27, 0xA8, 0x2B, 0x54, 0x09, 0xF5, 0x86,
+    0xAA, 0xA0, 0x81, 0x82, 0x34, 0xA6, 0xFB, 0x26, 0xF9, 0x1F, 0xC9, 0x24, 0xC6, 0xEA, 0x44, 0x29,
+    0x31, 0x21, 0xA6, 0x24, 0x8B, 0x08, 0xC4, 0x98, 0x9D, 0x54, 0xAE, 0xD4, 0xA4, 0x29, 0x88, 0xE1,
+    0xC0, 0x8C, 0x18, 0x0E, 0x45, 0x62, 0xAC, 0x4E, 0xF6, 0xEB, 0x25, 0x86, 0xC2, 0x70, 0x41, 0xFC,
+    0x19, 0x63, 0x75, 0x12, 0xCB, 0x0A, 0x83, 0xF6, 0xD9, 0x54, 0x1A, 0x76, 0xC8, 0xBE, 0xEA, 0xA8,
+    0x63, 0x8E, 0x35, 0xC6, 0x9D, 0x72, 0xA9, 0x3D, 0xE9, 0x9C, 0x47, 0xBD, 0x69, 0x97, 0xBC, 0x1A,
+    0xCE, 0xBA, 0xE6, 0xDB, 0x74, 0xDE, 0xAD, 0x80, 0x16, 0x8B, 0xEE, 0xA9, 0x33, 0x96, 0x3D, 0x0A,
+    0x6B, 0xBF, 0xEA, 0x59, 0x64, 0xE7, 0x75, 0xAF, 0x98, 0xCC, 0xBB, 0x32, 0xFA, 0x6D, 0x9F, 0xCA,
+    0xF5, 0x6C, 0xC3, 0x3A, 0x08, 0x00, 0x00, 0x01, 0x19, 0x49, 0x44, 0x41, 0x54, 0xDB, 0xF5, 0x0D,
+    0x9A, 0x05, 0x95, 0x42, 0x4D, 0xA1, 0xF9, 0xA1, 0x96, 0x50, 0x1B, 0xA8, 0x3D, 0xD4, 0x11, 0xEA,
+    0x02, 0xF5, 0x80, 0x7A, 0x41, 0x7D, 0xA1, 0x01, 0x50, 0x35, 0x34, 0x0C, 0x1A, 0x09, 0x8D, 0x11,
+    0xAC, 0x93, 0x86, 0x1E, 0xCC, 0xDB, 0x23, 0xB4, 0x50, 0x69, 0xD3, 0xFF, 0x71, 0x48, 0xFA, 0x9C,
+    0x8F, 0x50, 0x9F, 0x6B, 0x23, 0x14, 0x73, 0x3E, 0x42, 0xF1, 0xF7, 0x11, 0x3A, 0xD7, 0x9A, 0x78,
+    0xD6, 0xBD, 0xEE, 0xD4, 0x8B, 0x9E, 0x0D, 0x66, 0x5E, 0xF5, 0x69, 0x32, 0xF7, 0xA6, 0x7F, 0xF3,
+    0x85, 0x77, 0x83, 0x5B, 0x2F, 0x7D, 0x18, 0xDA, 0x6E, 0xE5, 0xD3, 0x88, 0x4E, 0x6B, 0x5F, 0x46,
+    0x77, 0xDB, 0xF8, 0x56, 0xD3, 0x6B, 0xEB, 0xC7, 0xF8, 0xBE, 0x3B, 0xBF, 0x6A, 0x07, 0xEE, 0xFD,
+    0xC1, 0x64, 0xC4, 0x2A, 0x23, 0x8F, 0xCA, 0xAB, 0x8F, 0x3D, 0x69, 0x06, 0xB5, 0x80, 0x5A, 0x43,
+    0x0B, 0x41, 0x8B, 0x40, 0x9D, 0xA1, 0xEE, 0x50, 0x4F, 0xA8, 0x0F, 0xD4, 0x1F, 0x1A, 0x0C, 0x0D,
+    0x85, 0x46, 0x40, 0xA3, 0xA1, 0x1A, 0x68, 0x3C, 0x54, 0x0B, 0x4D, 0x12, 0xDC, 0x52, 0xA7, 0x5C,
+    0xC8, 0xDB, 0x23, 0xB4, 0x53, 0xEB, 0x32, 0xFE, 0xF7, 0x9F, 0x30, 0xD7, 0x06, 0xF7, 0xD7, 0x9F,
+    0xD0, 0xAF, 0xD9, 0x82, 0x3B, 0x41, 0xAD, 0x96, 0x3C, 0x08, 0x69, 0xBB, 0xE2, 0x49, 0x78, 0xC7,
+    0x35, 0x2F, 0xA2, 0xBA, 0x6E, 0x78, 0x13, 0xDB, 0x73, 0xCB, 0x87, 0xB8, 0x3E, 0x3B, 0xBE, 0x24,
+    0x0C, 0xD8, 0xF3, 0x3D, 0x71, 0xC8, 0x01, 0x41, 0x37, 0xE2, 0x88, 0x49, 0xF2, 0x98, 0x13, 0xF9,
+    0x52, 0x26, 0x9C, 0x29, 0xC0, 0x64, 0x0A, 0xD6, 0x9F, 0x71, 0xC5, 0xAE, 0xF1, 0x9C, 0x1B, 0x85,
+    0xA1, 0x45, 0xA1, 0x6E, 0xD0, 0x62, 0xD0, 0xE2, 0x50, 0x3F, 0x68, 0x10, 0x34, 0x04, 0x1A, 0x0E,
+    0x8D, 0x82, 0xC6, 0x42, 0xE3, 0xA0, 0x09, 0xD0, 0x44, 0xA8, 0x0E, 0x9A, 0x0C, 0x4D, 0x81, 0xA6,
+    0x66, 0x03, 0xF5, 0x77, 0x3B, 0xC9, 0x64, 0x4F, 0xA0, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+const uint8_t kPngRgbFixed[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x08, 0x02, 0x00, 0x00, 0x00, 0xF8, 0x62, 0xEA,
+    0x0E, 0x00, 0x00, 0x00, 0xD9, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x63, 0x61, 0xB0, 0xA9, 0x60,
+    0xA1, 0x25, 0x60, 0x66, 0x56, 0xB4, 0x67, 0x63, 0x63, 0x63, 0x67, 0x67, 0xE7, 0xE0, 0xE0, 0xE0,
+    0xE4, 0xE4, 0x64, 0x60, 0x60, 0xA0, 0x2E, 0x97, 0x89, 0x99, 0x99, 0x99, 0x95, 0x95, 0x15, 0x28,
+    0xFA, 0xFF, 0xFF, 0x7F, 0x46, 0x46, 0x46, 0xAA, 0x73, 0x19, 0x39, 0x5D, 0x1B, 0xB9, 0xB8, 0xB8,
+    0x80, 0xB6, 0x41, 0x48, 0x38, 0x83, 0x6A, 0x5C, 0x1E, 0x8F, 0x16, 0x89, 0x90, 0x09, 0x52, 0x61,
+    0x93, 0x64, 0x22, 0xA6, 0xC8, 0x45, 0x4D, 0x53, 0x88, 0x99, 0xA1, 0x93, 0xB1, 0x44, 0x2F, 0x6B,
+    0x99, 0x41, 0xCE, 0x0A, 0xA3, 0xBC, 0x55, 0x26, 0x05, 0x6B, 0x1C, 0x6A, 0x76, 0x38, 0xD5, 0xED,
+    0x72, 0x69, 0xD8, 0xE3, 0xD6, 0xB4, 0xCF, 0xA3, 0xE5, 0x40, 0xC8, 0x84, 0x33, 0x61, 0x93, 0xCE,
+    0x45, 0x4C, 0xB9, 0x10, 0x35, 0xED, 0x52, 0xCC, 0x8C, 0x2B, 0x19, 0x4B, 0x1E, 0x64, 0x2D, 0x7B,
+    0x94, 0xB3, 0xE2, 0x49, 0xDE, 0xAA, 0x67, 0x05, 0x6B, 0x5E, 0xD4, 0xEC, 0xF8, 0x52, 0xB7, 0xEB,
+    0x5B, 0xC3, 0x9E, 0x1F, 0x4D, 0xFB, 0x7E, 0xB5, 0x1C, 0xF8, 0x33, 0xE1, 0x0C, 0x07, 0x30, 0x12,
+    0x98, 0x7F, 0xFF, 0xFE, 0x0D, 0x8C, 0x0D, 0x46, 0x30, 0xA0, 0x3A, 0x97, 0x99, 0x5B, 0xD3, 0x9D,
+    0x36, 0x91, 0xDC, 0xC9, 0xC0, 0xD0, 0x40, 0x97, 0x48, 0x06, 0x46, 0x00, 0x6D, 0x23, 0x59, 0x3A,
+    0x7C, 0xB2, 0x7A, 0xF2, 0x7C, 0xCD, 0xD4, 0x85, 0xDA, 0xE9, 0x8B, 0x75, 0x33, 0x97, 0xEA, 0x67,
+    0x2F, 0xB7, 0xFB, 0x44, 0x92, 0xE5, 0x00, 0x00, 0x00, 0xD9, 0x49, 0x44, 0x41, 0x54, 0x2E, 0xDF,
+    0x6C, 0x5B, 0xB9, 0xD5, 0xBE, 0x7A, 0xBB, 0x63, 0xED, 0x4E, 0xE7, 0xFA, 0xDD, 0xFE, 0xDD, 0xC7,
+    0x03, 0x7B, 0x4F, 0x06, 0xF7, 0x9F, 0x0E, 0x9D, 0x78, 0x36, 0x7C, 0xF2, 0xF9, 0xE4, 0xF9, 0xB7,
+    0x53, 0x17, 0xDE, 0x4D, 0x5F, 0x7C, 0x3F, 0x73, 0xE9, 0xC3, 0xEC, 0xE5, 0x8F, 0xCB, 0x37, 0xBF,
+    0xAF, 0xDC, 0xFA, 0xB1, 0x7A, 0xFB, 0xE7, 0xDA, 0x9D, 0x5F, 0xEB, 0x77, 0x7F, 0xEF, 0x3E, 0xCE,
+    0xDC, 0x7B, 0x92, 0xB5, 0xFF, 0x34, 0xFB, 0xC4, 0xB3, 0x9C, 0x93, 0xCF, 0x73, 0xCF, 0xBF, 0x2D,
+    0x4E, 0xFB, 0x48, 0x16, 0x32, 0xF0, 0xA3, 0x5E, 0x24, 0x37, 0x0C, 0x44, 0x4E, 0x06, 0x46, 0x00,
+    0x6D, 0x23, 0x59, 0x2B, 0x6D, 0x91, 0x59, 0xD1, 0x3A, 0x8B, 0x92, 0x0D, 0x56, 0x65, 0x9B, 0x6C,
+    0x2A, 0xB6, 0xD8, 0x55, 0x6D, 0xF3, 0x6A, 0x3B, 0xE4, 0xD3, 0x71, 0xC4, 0xAF, 0xEB, 0x58, 0x40,
+    0xCF, 0x89, 0xA0, 0xBE, 0x53, 0x71, 0xB3, 0xAE, 0x25, 0xCC, 0xB9, 0x91, 0x34, 0xEF, 0x56, 0xCA,
+    0x82, 0x3B, 0x69, 0x8B, 0xEE, 0x15, 0xAD, 0x7B, 0x55, 0xB2, 0xE1, 0x4D, 0xD9, 0xA6, 0x77, 0x15,
+    0x5B, 0x3E, 0x54, 0x6D, 0xFB, 0xD4, 0x76, 0xE8, 0x5F, 0xC7, 0x11, 0x86, 0xAE, 0x63, 0x4C, 0x3D,
+    0x27, 0x58, 0xFA, 0x4E, 0xB1, 0xCD, 0xBA, 0x26, 0x34, 0xE7, 0x86, 0xC8, 0xBC, 0x5B, 0x62, 0x0B,
+    0xEE, 0x48, 0x2C, 0xBA, 0x27, 0xB5, 0xEE, 0x95, 0x1A, 0x55, 0x22, 0xF9, 0x2F, 0x23, 0x23, 0x0B,
+    0x2E, 0x59, 0x00, 0xBD, 0x01, 0x28, 0xAC, 0x1F, 0x3E, 0xFB, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+const uint8_t kPngPalette2Bit[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x02, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x6E, 0x95,
+    0xCA, 0x00, 0x00, 0x00, 0x0C, 0x50, 0x4C, 0x54, 0x45, 0x0A, 0x14, 0x1E, 0xC8, 0x64, 0x32, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x6A, 0x44, 0x9D, 0x00, 0x00, 0x00, 0x03, 0x74, 0x52, 0x4E,
+    0x53, 0xFF, 0x80, 0x00, 0x7F, 0x6D, 0x68, 0x78, 0x00, 0x00, 0x00, 0x4D, 0x49, 0x44, 0x41, 0x54,
+    0x78, 0x01, 0x01, 0x90, 0x00, 0x6F, 0xFF, 0x01, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x03, 0x7B, 0x23, 0x23, 0x23, 0x23, 0x23,
+    0x23, 0x23, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x03, 0x7B, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x3D, 0x9D,
+    0xF1, 0x00, 0x00, 0x00, 0x4E, 0x49, 0x44, 0x41, 0x54, 0x00, 0x00, 0x01, 0x1B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x03, 0x7B, 0x23,
+    0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+    0x51, 0x03, 0x7B, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD5, 0x70, 0x10, 0xC9, 0xB4, 0x11, 0x95, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x49,
+    0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+// 16x10 RGBA QOI using every op
+const uint8_t kQoiMixed[] = {
+    0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0A, 0x04, 0x00, 0xFE, 0x0A,
+    0x14, 0x1E, 0xDF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x09, 0x18, 0x27, 0x36, 0x05, 0x14, 0x23, 0x32, 0x01, 0x10, 0x1F, 0x2E, 0x3D, 0x0C,
+    0x1B, 0x2A, 0x09, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6,
+    0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6, 0x79, 0xA6,
+    0x79, 0x09, 0x27, 0x05, 0x23, 0x01, 0x1F, 0x3D, 0x1B, 0x39, 0x17, 0x35, 0x13, 0x31, 0x0F, 0x2D,
+    0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x32, 0x00, 0x00, 0xFE, 0x64, 0x00, 0x00, 0x35, 0x0B, 0x21,
+    0x35, 0x0B, 0x21, 0x35, 0x0B, 0x21, 0x35, 0x0B, 0x21, 0x35, 0xC0, 0x0B, 0x21, 0x35, 0x0B, 0x21,
+    0x35, 0x0B, 0x21, 0x35, 0x0B, 0x21, 0x35, 0x0B, 0x21, 0x35, 0xFF, 0x00, 0x38, 0x00, 0x80, 0xFF,
+    0x0D, 0x38, 0x08, 0x81, 0xFF, 0x1A, 0x38, 0x10, 0x82, 0xFF, 0x27, 0x38, 0x18, 0x83, 0xFF, 0x34,
+    0x38, 0x20, 0x84, 0xFF, 0x41, 0x38, 0x28, 0x85, 0xFF, 0x4E, 0x38, 0x30, 0x86, 0xFF, 0x5B, 0x38,
+    0x38, 0x87, 0xFF, 0x68, 0x38, 0x40, 0x88, 0xFF, 0x75, 0x38, 0x48, 0x89, 0xFF, 0x82, 0x38, 0x50,
+    0x8A, 0xFF, 0x8F, 0x38, 0x58, 0x8B, 0xFF, 0x9C, 0x38, 0x60, 0x8C, 0xFF, 0xA9, 0x38, 0x68, 0x8D,
+    0xFF, 0xB6, 0x38, 0x70, 0x8E, 0xFF, 0xC3, 0x38, 0x78, 0x8F, 0xFF, 0x00, 0x3F, 0x00, 0x80, 0xFF,
+    0x0D, 0x3F, 0x09, 0x81, 0xFF, 0x1A, 0x3F, 0x12, 0x82, 0xFF, 0x27, 0x3F, 0x1B, 0x83, 0xFF, 0x34,
+    0x3F, 0x24, 0x84, 0xFF, 0x41, 0x3F, 0x2D, 0x85, 0xFF, 0x4E, 0x3F, 0x36, 0x86, 0xFF, 0x5B, 0x3F,
+    0x3F, 0x87, 0xFF, 0x68, 0x3F, 0x48, 0x88, 0xFF, 0x75, 0x3F, 0x51, 0x89, 0xFF, 0x82, 0x3F, 0x5A,
+    0x8A, 0xFF, 0x8F, 0x3F, 0x63, 0x8B, 0xFF, 0x9C, 0x3F, 0x6C, 0x8C, 0xFF, 0xA9, 0x3F, 0x75, 0x8D,
+    0xFF, 0xB6, 0x3F, 0x7E, 0x8E, 0xFF, 0xC3, 0x3F, 0x87, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01,
+};
+
+uint8_t pngTestValue(int x, int y, int c) {
+    return static_cast<uint8_t>(x * 4 + y * 3 + c * 60 + ((x * y) % 5) * 2);
+}
+
+void qoiTestPixel(int i, uint8_t* p) {
+    const int x = i % 16;
+    const int y = i / 16;
+    int r = 10, g = 20, b = 30, a = 255;
+    if (y >= 2 && y < 4) {
+        r = 10 + x; g = 20 + x; b = 30 + x;
+    } else if (y >= 4 && y < 6) {
+        r = 10 + x * 5; g = 20 + x * 6; b = 30 + x * 7;
+    } else if (y >= 6 && y < 8) {
+        r = (x % 3) * 50; g = 0; b = 0;
+    } else if (y >= 8) {
+        r = x * 13; g = y * 7; b = x * y; a = 128 + x;
+    }
+    p[0] = static_cast<uint8_t>(r);
+    p[1] = static_cast<uint8_t>(g);
+    p[2] = static_cast<uint8_t>(b);
+    p[3] = static_cast<uint8_t>(a);
+}
+
+void testPngDecoderFiltersAndLayouts() {
+    TEST("PNG decoder reverses every filter and expands RGB and palettes") {
+        using OGDE::Graphics::ImageDecoder;
+        OGDE::Graphics::ImageInfo info;
+        bool ok = ImageDecoder::ReadInfo(kPngRgbaFilters, sizeof(kPngRgbaFilters), info) &&
+                  info.format == OGDE::Graphics::ImageFormat::Png && info.width == 32 && info.height == 16 &&
+                  info.channels == 4;
+        std::vector<uint8_t> pixels(32 * 16 * 4);
+        ok = ok && ImageDecoder::Decode(kPngRgbaFilters, sizeof(kPngRgbaFilters), pixels.data());
+        for (int i = 0; ok && i < 32 * 16 * 4; ++i) {
+            ok = pixels[i] == pngTestValue(i / 4 % 32, i / 128, i % 4);
+        }
+
+        // RGB file decoded straight into RGBA
+        ok = ok && ImageDecoder::ReadInfo(kPngRgbFixed, sizeof(kPngRgbFixed), info) && info.channels == 3;
+        ok = ok && ImageDecoder::Decode(kPngRgbFixed, sizeof(kPngRgbFixed), pixels.data(), 4);
+        for (int i = 0; ok && i < 32 * 16 * 4; ++i) {
+            ok = pixels[i] == (i % 4 == 3 ? 255 : pngTestValue(i / 4 % 32, i / 128, i % 4));
+        }
+
+        // Palette with transparency becomes RGBA
+        const uint8_t palette[4][4] = { { 10, 20, 30, 255 }, { 200, 100, 50, 128 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 } };
+        ok = ok && ImageDecoder::ReadInfo(kPngPalette2Bit, sizeof(kPngPalette2Bit), info) && info.channels == 4;
+        ok = ok && ImageDecoder::Decode(kPngPalette2Bit, sizeof(kPngPalette2Bit), pixels.data());
+        for (int i = 0; ok && i < 32 * 16; ++i) {
+            ok = std::equal(palette[(i % 32 + i / 32) % 4], palette[(i % 32 + i / 32) % 4] + 4, &pixels[i * 4]);
+        }
+
+        ok = ok && !ImageDecoder::Decode(kPngRgbaFilters, sizeof(kPngRgbaFilters) - 40, pixels.data());
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testQoiDecoder() {
+    TEST("QOI decoder handles every op and loads through Texture") {
+        OGDE::Graphics::ImageInfo info;
+        bool ok = OGDE::Graphics::ImageDecoder::ReadInfo(kQoiMixed, sizeof(kQoiMixed), info) &&
+                  info.format == OGDE::Graphics::ImageFormat::Qoi && info.width == 16 && info.height == 10 &&
+                  info.channels == 4;
+
+        OGDE::Graphics::Texture texture;
+        ok = ok && texture.LoadFromEncodedMemory(kQoiMixed, sizeof(kQoiMixed), "mixed.qoi") &&
+             texture.GetWidth() == 16 && texture.GetChannels() == 4;
+        for (int i = 0; ok && i < 160; ++i) {
+            uint8_t expected[4];
+            qoiTestPixel(i, expected);
+            ok = std::equal(expected, expected + 4, texture.GetData() + i * 4);
+        }
+
+        std::vector<uint8_t> pixels(16 * 10 * 4);
+        ok = ok && !OGDE::Graphics::ImageDecoder::Decode(kQoiMixed, sizeof(kQoiMixed) - 40, pixels.data());
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testMaterialTableDenseHandles() {
+    TEST("Material table keeps parameters dense and rejects stale handles") {
+        using OGDE::Graphics::Material;
+        OGDE::Graphics::MaterialTable table;
+        OGDE::Graphics::MaterialHandle a = table.Create("a");
+        OGDE::Graphics::MaterialHandle b = table.Create("b");
+        OGDE::Graphics::MaterialHandle c = table.Create("c");
+        table.SetDiffuseColor(c, 0.5f, 0.25f, 0.125f);
+        table.SetTexture(c, Material::TextureType::Normal, 42);
+
+        uint32_t begin = 0, end = 0;
+        table.GetDirtyRange(begin, end);
+        bool ok = table.GetCount() == 3 && begin == 0 && end == 3;
+        table.ClearDirty();
+
+        // Destroying a middle material moves the last one into its place
+        table.Destroy(a);
+        table.GetDirtyRange(begin, end);
+        ok = ok && table.GetCount() == 2 && !table.IsValid(a) && table.Get(a) == nullptr;
+        ok = ok && table.GetIndex(c) == 0 && table.GetHandle(0) == c && table.GetIndex(b) == 1;
+        ok = ok && begin == 0 && end == 1 && table.GetName(c) == "c";
+
+        const OGDE::Graphics::MaterialParams& params = table.GetData()[table.GetIndex(c)];
+        ok = ok && params.diffuseColor[1] == 0.25f && params.textures[1] == 42 && params.textureMask == 2u;
+
+        // The reused slot gets a new generation, so the old handle stays dead
+        OGDE::Graphics::MaterialHandle d = table.Create("d");
+        ok = ok && d != a && !table.IsValid(a) && table.IsValid(d) && table.GetIndex(d) == 2;
+        table.SetTexture(c, Material::TextureType::Normal, OGDE::Graphics::kInvalidTextureHandle);
+        ok = ok && table.Get(c)->textureMask == 0 && table.GetDataSize() == 3 * 80;
+
+        Material material;
+        material.SetName("imported");
+        material.SetSpecular(0.1f, 0.2f, 0.3f, 64.0f);
+        material.SetTexture(Material::TextureType::Diffuse, std::make_shared<OGDE::Graphics::Texture>());
+        OGDE::Graphics::MaterialHandle imported = table.Import(material,
+            [](const std::shared_ptr<OGDE::Graphics::Texture>&) { return OGDE::Graphics::TextureHandle(7); });
+        ok = ok && table.Get(imported)->shininess == 64.0f &&
+             table.GetTexture(imported, Material::TextureType::Diffuse) == 7 &&
+             table.GetName(imported) == "imported";
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testMaterialInstanceOverrides() {
+    TEST("Material instances resolve overrides lazily and copy on write") {
+        using OGDE::Graphics::Material;
+        using OGDE::Graphics::MaterialParam;
+        OGDE::Graphics::MaterialTable table;
+        OGDE::Graphics::MaterialHandle base = table.Create("base");
+        table.SetSpecular(base, 0.5f, 0.5f, 0.5f, 16.0f);
+        table.SetTexture(base, Material::TextureType::Diffuse, 3);
+
+        OGDE::Graphics::MaterialInstance tinted(table, base);
+        tinted.SetDiffuseColor(1.0f, 0.0f, 0.0f);
+        tinted.SetTexture(Material::TextureType::Diffuse, OGDE::Graphics::kInvalidTextureHandle);
+        tinted.SetTexture(Material::TextureType::Normal, 9);
+
+        const OGDE::Graphics::MaterialParams* resolved = &tinted.Resolve();
+        bool ok = resolved->diffuseColor[1] == 0.0f && resolved->shininess == 16.0f;
+        ok = ok && resolved->textures[0] == 0 && resolved->textures[1] == 9 && resolved->textureMask == 2u;
+        ok = ok && !tinted.NeedsResolve() && &tinted.Resolve() == resolved;
+
+        // A parent edit invalidates the cache; overridden values still win
+        table.SetSpecular(base, 0.5f, 0.5f, 0.5f, 64.0f);
+        table.SetDiffuseColor(base, 0.0f, 0.0f, 1.0f);
+        ok = ok && tinted.NeedsResolve() && tinted.Resolve().shininess == 64.0f &&
+             tinted.Resolve().diffuseColor[0] == 1.0f;
+
+        // Copies share the resolved block until one of them writes
+        OGDE::Graphics::MaterialInstance copy = tinted;
+        ok = ok && &copy.Resolve() == &tinted.Resolve();
+        copy.SetOpacity(0.5f);
+        ok = ok && &copy.Resolve() != &tinted.Resolve() && copy.Resolve().opacity == 0.5f &&
+             tinted.Resolve().opacity == 1.0f && copy.GetOverrideCount() == 4 && tinted.GetOverrideCount() == 3;
+
+        copy.ClearOverride(MaterialParam::DiffuseColor);
+        ok = ok && !copy.IsOverridden(MaterialParam::DiffuseColor) && copy.Resolve().diffuseColor[2] == 1.0f;
+        copy.ClearOverrides();
+        ok = ok && copy.Resolve().textureMask == 1u && copy.Resolve().textures[0] == 3;
+
+        // Without a live parent the overrides apply to defaults
+        table.Destroy(base);
+        ok = ok && tinted.Resolve().shininess == 32.0f && tinted.Resolve().diffuseColor[0] == 1.0f;
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Records what a RenderQueue submits
+class RecordingSink : public ogde::graphics::RenderQueueSink {
+public:
+    void bindPass(uint32_t) override { ++binds; }
+    void bindShader(uint32_t) override { ++binds; }
+    void bindMaterial(uint32_t) override { ++binds; }
+    void bindGeometry(uint32_t) override { ++binds; }
+    void draw(const ogde::graphics::DrawItem& item) override { drawn.push_back(item.userData); }
+
+    uint32_t binds = 0;
+    std::vector<uint32_t> drawn;
+};
+
+void testRenderQueueRadixSortStable() {
+    TEST("Render queue radix sort orders keys and keeps equal keys in submission order") {
+        std::vector<ogde::graphics::RenderQueue::SortEntry> entries, scratch;
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (uint32_t i = 0; i < 5000; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            // Few distinct keys so many ties, spread over high and low digits
+            uint64_t key = ((state & 7) << 61) | ((state >> 8) & 3);
+            entries.push_back({ key, i, 0 });
+        }
+        std::vector<ogde::graphics::RenderQueue::SortEntry> expected = entries;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](const ogde::graphics::RenderQueue::SortEntry& a, const ogde::graphics::RenderQueue::SortEntry& b) {
+                return a.key < b.key;
+            });
+        ogde::graphics::RenderQueue::radixSort(entries, scratch);
+
+        bool ok = entries.size() == expected.size();
+        for (size_t i = 0; ok && i < entries.size(); ++i) {
+            ok = entries[i].key == expected[i].key && entries[i].index == expected[i].index;
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testRenderQueueSubmitsStateChanges() {
+    TEST("Render queue sorts opaque front to back, translucent back to front, and elides binds") {
+        namespace RenderKey = ogde::graphics::RenderKey;
+        ogde::graphics::RenderQueue queue;
+        auto add = [&](uint32_t pass, bool translucent, uint32_t shader, uint32_t material, float depth, uint32_t id) {
+            ogde::graphics::DrawItem item;
+            item.key = translucent ? RenderKey::translucent(pass, 0, shader, material, depth)
+                                   : RenderKey::opaque(pass, 0, shader, material, depth);
+            item.pass = pass;
+            item.shader = shader;
+            item.material = material;
+            item.geometry = 1;
+            item.userData = id;
+            queue.add(item);
+        };
+        add(1, true, 2, 5, 0.2f, 10);
+        add(0, false, 1, 7, 0.9f, 3);
+        add(1, true, 1, 4, 0.8f, 11);
+        add(0, false, 1, 7, 0.1f, 2);
+        add(0, false, 0, 9, 0.5f, 0);
+        add(0, false, 0, 9, 0.6f, 1);
+        queue.sort();
+
+        RecordingSink sink;
+        ogde::graphics::RenderQueueStats stats = queue.submit(sink);
+        std::vector<uint32_t> expected = { 0, 1, 2, 3, 11, 10 };
+        bool ok = sink.drawn == expected && stats.draws == 6;
+        // Pass 0: shader 0/material 9, then shader 1/material 7; pass 1 rebinds everything, then two changes
+        ok = ok && stats.passChanges == 2 && stats.shaderChanges == 4 && stats.materialChanges == 4 &&
+             stats.geometryChanges == 2 && sink.binds == 12;
+        ok = ok && RenderKey::pass(queue.getSorted(5).key) == 1 && RenderKey::quantizeDepth(2.0f) == 0xFFFFFF;
+
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Flattens a replayed command stream into comparable numbers
+class TraceSink : public ogde::graphics::CommandSink {
+public:
+    void bindPass(uint32_t pass) override { trace.insert(trace.end(), { 1u, pass }); }
+    void bindShader(uint32_t shader) override { trace.insert(trace.end(), { 2u, shader }); }
+    void bindMaterial(uint32_t material) override { trace.insert(trace.end(), { 3u, material }); }
+    void bindGeometry(uint32_t geometry) override { trace.insert(trace.end(), { 4u, geometry }); }
+    void draw(const ogde::graphics::DrawItem& item) override {
+        trace.insert(trace.end(), { 5u, item.pass, item.shader, item.material, item.geometry,
+                                    item.vertexCount, item.startVertex, item.userData });
+    }
+    void updateBuffer(uint32_t buffer, uint32_t offset, const void* data, uint32_t size) override {
+        trace.insert(trace.end(), { 6u, buffer, offset, size });
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        trace.insert(trace.end(), bytes, bytes + size);
+    }
+
+    std::vector<uint32_t> trace;
+};
+
+void testCommandBufferRecordReplay() {
+    TEST("Command buffer replays binds, draws and inline buffer updates in order") {
+        ogde::graphics::CommandBuffer commands;
+        const uint8_t bytes[5] = { 1, 2, 3, 4, 5 };
+        commands.bindPass(2);
+        commands.bindGeometry(7);
+        commands.updateBuffer(7, 16, bytes, sizeof(bytes));
+        commands.draw(36, 12, 99);
+        commands.bindShader(4);
+        commands.draw(3);
+
+        TraceSink sink;
+        commands.replay(sink);
+        std::vector<uint32_t> expected = { 1, 2, 4, 7, 6, 7, 16, 5, 1, 2, 3, 4, 5,
+                                           5, 2, 0, 0, 7, 36, 12, 99, 2, 4, 5, 2, 4, 0, 7, 3, 0, 0 };
+        bool ok = sink.trace == expected && commands.getCommandCount() == 6;
+
+        ogde::graphics::CommandBuffer copy;
+        copy.append(commands);
+        copy.append(commands);
+        TraceSink twice;
+        copy.replay(twice);
+        ok = ok && copy.getCommandCount() == 12 && twice.trace.size() == expected.size() * 2;
+
+        commands.clear();
+        ok = ok && commands.isEmpty() && commands.getSize() == 0;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testCommandRecorderDeterministicMerge() {
+    TEST("Command recorder merges per-thread buffers in key order regardless of timing") {
+        ogde::graphics::RenderQueue queue;
+        for (uint32_t i = 0; i < 2000; ++i) {
+            ogde::graphics::DrawItem item;
+            item.pass = i % 3;
+            item.shader = (i * 7) % 11;
+            item.material = (i * 13) % 17;
+            item.geometry = i % 5;
+            item.vertexCount = 3 + i % 4;
+            item.userData = i;
+            item.key = ogde::graphics::RenderKey::opaque(item.pass, 0, item.shader, item.material,
+                                                         (i % 101) / 101.0f);
+            queue.add(item);
+        }
+        queue.sort();
+
+        // Reference: the same ranges recorded one after another on this thread
+        const uint32_t chunk = 128;
+        const uint32_t chunkCount = (2000 + chunk - 1) / chunk;
+        TraceSink serial;
+        for (uint32_t c = 0; c < chunkCount; ++c) {
+            queue.submit(serial, c * chunk, chunk);
+        }
+
+        ogde::graphics::CommandRecorder recorder;
+        ogde::core::JobSystem jobs(3);
+        bool ok = true;
+        for (int frame = 0; frame < 3 && ok; ++frame) {
+            recorder.reset();
+            // Record chunks in reverse so buffer creation order differs from key order
+            jobs.parallelFor(chunkCount, 1, [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i) {
+                    const uint32_t c = chunkCount - 1 - i;
+                    queue.submit(recorder.begin(c), c * chunk, chunk);
+                }
+            });
+
+            ogde::graphics::CommandBuffer merged;
+            recorder.merge(merged);
+            TraceSink fromMerged, fromRecorder;
+            merged.replay(fromMerged);
+            recorder.replay(fromRecorder);
+            ok = fromMerged.trace == serial.trace && fromRecorder.trace == serial.trace &&
+                 recorder.getBufferCount() == chunkCount && merged.getCommandCount() == recorder.getCommandCount();
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Triangle fan around (cx, cy) covering a regular polygon, one vertex buffer per fan
+std::vector<float> makeSoftwareFan(float cx, float cy, int sides, float radius, float depth, float depthStep) {
+    std::vector<float> vertices;
+    for (int i = 0; i < sides; ++i) {
+        const float a0 = 6.2831853f * i / sides + 0.3f;
+        const float a1 = 6.2831853f * (i + 1) / sides + 0.3f;
+        const float z = depth - depthStep * i;
+        const float triangle[9] = { cx, cy, z,
+                                    radius * std::cos(a0), radius * std::sin(a0), z,
+                                    radius * std::cos(a1), radius * std::sin(a1), z };
+        vertices.insert(vertices.end(), triangle, triangle + 9);
+    }
+    return vertices;
+}
+
+void testSoftwareRasterizerWatertight() {
+    TEST("Software rasterizer covers shared edges exactly once") {
+        ogde::graphics::RendererSoftware renderer;
+        bool ok = renderer.initialize(64, 64);
+
+        // Quad split along a diagonal that passes through pixel centers;
+        // the second triangle is nearer, so a double hit would count twice
+        const float quad[18] = { -0.5f, -0.5f, 0.5f,   0.5f, -0.5f, 0.5f,   0.5f, 0.5f, 0.5f,
+                                 -0.5f, -0.5f, 0.4f,   0.5f, 0.5f, 0.4f,   -0.5f, 0.5f, 0.4f };
+        renderer.setVertexBuffer(renderer.createVertexBuffer(quad, 6));
+        renderer.beginFrame();
+        renderer.clear();
+        renderer.draw(6);
+        renderer.endFrame();
+        ok = ok && renderer.getStats().pixelsWritten == 32 * 32;
+
+        // The same polygon triangulated around two different centers must
+        // produce the same coverage, with every pixel written exactly once
+        auto coverage = [&](float cx, float cy) {
+            const std::vector<float> fan = makeSoftwareFan(cx, cy, 7, 0.8f, 0.9f, 0.1f);
+            renderer.setVertexBuffer(renderer.createVertexBuffer(fan.data(), static_cast<uint32_t>(fan.size() / 3)));
+            renderer.beginFrame();
+            renderer.clear();
+            renderer.draw(static_cast<uint32_t>(fan.size() / 3));
+            const uint32_t* color = renderer.getColorBuffer();
+            std::vector<uint8_t> mask(64 * 64);
+            uint64_t covered = 0;
+            for (uint32_t y = 0; y < 64; ++y) {
+                for (uint32_t x = 0; x < 64; ++x) {
+                    mask[y * 64 + x] = color[y * renderer.getStride() + x] != 0xFF000000u;
+                    covered += mask[y * 64 + x];
+                }
+            }
+            ok = ok && covered == renderer.getStats().pixelsWritten && covered > 1000;
+            return mask;
+        };
+        ok = ok && coverage(0.137f, -0.211f) == coverage(-0.31f, 0.05f);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testSoftwareRasterizerDepthThreadsAndDump() {
+    TEST("Software rasterizer depth tests, matches serial output when threaded, and dumps images") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 160.0f / 96.0f, 0.5f, 50.0f);
+        camera.lookAt(0.0f, 0.0f, -5.0f, 0.0f, 0.0f, 0.0f);
+        camera.update();
+
+        // Random triangles, some crossing the near plane and the screen edges
+        std::vector<float> scene;
+        uint32_t seed = 12345;
+        auto random = [&seed](float range) {
+            seed = seed * 1664525u + 1013904223u;
+            return (static_cast<float>(seed >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+        };
+        for (int i = 0; i < 300; ++i) {
+            const float cx = random(4.0f), cy = random(3.0f), cz = random(5.0f);
+            for (int v = 0; v < 3; ++v) {
+                scene.push_back(cx + random(1.5f));
+                scene.push_back(cy + random(1.5f));
+                scene.push_back(cz + random(1.5f));
+            }
+        }
+
+        auto render = [&](ogde::core::JobSystem* jobs, ogde::graphics::RendererSoftware& renderer) {
+            renderer.initialize(160, 96);
+            renderer.setJobSystem(jobs);
+            renderer.setViewProjection(camera.getViewProjectionMatrix());
+            renderer.setVertexBuffer(renderer.createVertexBuffer(scene.data(), static_cast<uint32_t>(scene.size() / 3)));
+            renderer.beginFrame();
+            renderer.clear(0.1f, 0.2f, 0.3f, 1.0f);
+            renderer.setColor(0.9f, 0.6f, 0.3f);
+            renderer.draw(static_cast<uint32_t>(scene.size() / 3));
+            renderer.endFrame();
+        };
+        ogde::graphics::RendererSoftware serial, threaded;
+        ogde::core::JobSystem jobs(3);
+        render(nullptr, serial);
+        render(&jobs, threaded);
+        const size_t pixels = static_cast<size_t>(serial.getStride()) * serial.getHeight();
+        bool ok = serial.getStats().trianglesRasterized > 200 && serial.getStats().pixelsWritten > 0 &&
+                  std::equal(serial.getColorBuffer(), serial.getColorBuffer() + pixels, threaded.getColorBuffer()) &&
+                  std::equal(serial.getDepthBuffer(), serial.getDepthBuffer() + pixels, threaded.getDepthBuffer());
+
+        // Nearer geometry wins regardless of draw order
+        ogde::graphics::RendererSoftware depth;
+        depth.initialize(16, 16);
+        const float layers[18] = { -1, -1, 0.7f,   3, -1, 0.7f,   -1, 3, 0.7f,
+                                   -1, -1, 0.3f,   3, -1, 0.3f,   -1, 3, 0.3f };
+        depth.setVertexBuffer(depth.createVertexBuffer(layers, 6));
+        depth.clear();
+        depth.setColor(0.0f, 0.0f, 1.0f);
+        depth.draw(3, 3);
+        depth.setColor(1.0f, 0.0f, 0.0f);
+        depth.draw(3, 0);
+        const uint32_t center = depth.getColorBuffer()[8 * depth.getStride() + 8];
+        ok = ok && (center & 0xFF) == 0 && ((center >> 16) & 0xFF) > 0 &&
+             std::fabs(depth.getDepthBuffer()[8 * depth.getStride() + 8] - 0.3f) < 1e-5f;
+
+        // The TGA dump loads back with the same pixels
+        const std::string path = tempTexturePath("ogde_software_render.tga");
+        ok = ok && threaded.saveImage(path);
+        OGDE::Graphics::Texture loaded;
+        ok = ok && loaded.LoadFromFile(path) && loaded.GetWidth() == 160 && loaded.GetHeight() == 96 &&
+             loaded.GetChannels() == 4;
+        for (uint32_t y = 0; ok && y < 96; ++y) {
+            ok = std::memcmp(loaded.GetData() + y * 160 * 4, threaded.getColorBuffer() + y * threaded.getStride(), 160 * 4) == 0;
+        }
+        std::filesystem::remove(path);
+        ok = ok && !threaded.saveImage(tempTexturePath("ogde_software_render.bmp"));
+
+        // Off Windows the Renderer facade drives the software backend
+#ifndef _WIN32
+        ogde::graphics::Renderer facade;
+        ok = ok && facade.initialize(nullptr, 32, 16) && facade.isInitialized();
+        facade.beginFrame();
+        facade.clear(1.0f, 0.0f, 0.0f, 1.0f);
+        facade.endFrame();
+        ok = ok && facade.getSoftwareRenderer()->getColorBuffer()[0] == 0xFF0000FFu;
+#endif
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Stand-in compiler: the "bytecode" spells out the inputs, and calls are counted
+ogde::graphics::ShaderCompileFunction makeCountingCompiler(std::atomic<int>& calls) {
+    return [&calls](const ogde::graphics::ShaderCompileRequest& request, std::vector<uint8_t>& bytecode,
+                    std::string& errors) {
+        ++calls;
+        if (request.source.find("error") != std::string::npos) {
+            errors = "syntax error";
+            return false;
+        }
+        std::string text = request.entryPoint + "|" + request.target;
+        for (const ogde::graphics::ShaderDefine& define : request.defines) {
+            text += "|" + define.name + "=" + define.value;
+        }
+        bytecode.assign(text.begin(), text.end());
+        return true;
+    };
+}
+
+void testShaderCacheKeysAndPersistence() {
+    TEST("Shader cache keys on every input and reuses bytecode from disk") {
+        using ogde::graphics::ShaderCache;
+        using ogde::graphics::ShaderCompileRequest;
+
+        ShaderCompileRequest request;
+        request.source = "float4 VSMain() : SV_Position { return 0; }";
+        request.entryPoint = "VSMain";
+        request.target = "vs_5_0";
+        request.defines = { { "A", "1" }, { "B", "2" } };
+        const uint64_t key = ShaderCache::computeKey(request);
+
+        ShaderCompileRequest reordered = request;
+        std::swap(reordered.defines[0], reordered.defines[1]);
+        reordered.name = "other.hlsl";
+        bool ok = ShaderCache::computeKey(reordered) == key;
+        ShaderCompileRequest changed = request;
+        changed.source += " ";
+        ok = ok && ShaderCache::computeKey(changed) != key;
+        changed = request;
+        changed.entryPoint = "Main";
+        ok = ok && ShaderCache::computeKey(changed) != key;
+        changed = request;
+        changed.target = "vs_4_0";
+        ok = ok && ShaderCache::computeKey(changed) != key;
+        changed = request;
+        changed.compiler = "d3dcompiler_48";
+        ok = ok && ShaderCache::computeKey(changed) != key;
+        changed = request;
+        changed.defines[1].value = "3";
+        ok = ok && ShaderCache::computeKey(changed) != key;
+        changed = request;
+        changed.flags = 1;
+        ok = ok && ShaderCache::computeKey(changed) != key;
+
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ogde_shader_cache_test";
+        std::filesystem::remove_all(directory);
+        std::atomic<int> calls{ 0 };
+        const ogde::graphics::ShaderCompileFunction compiler = makeCountingCompiler(calls);
+        std::vector<uint8_t> first, second, third;
+        {
+            ShaderCache cache(directory.string());
+            ok = ok && cache.getOrCompile(request, compiler, first) && calls == 1;
+            ok = ok && cache.getOrCompile(reordered, compiler, second) && calls == 1 && second == first;
+            ok = ok && cache.getStats().memoryHits == 1 && std::filesystem::exists(cache.getFilePath(key));
+        }
+
+        // A new cache (a later launch) reads the file instead of compiling
+        ShaderCache reopened(directory.string());
+        ok = ok && reopened.getOrCompile(request, compiler, third) && calls == 1 && third == first &&
+             reopened.getStats().diskHits == 1;
+
+        // A damaged file is rejected and rewritten
+        {
+            std::fstream file(reopened.getFilePath(key), std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(40);
+            file.put('X');
+        }
+        reopened.clearMemory();
+        ok = ok && reopened.getOrCompile(request, compiler, third) && calls == 2 && third == first &&
+             reopened.getStats().rejectedFiles == 1;
+        reopened.clearMemory();
+        ok = ok && reopened.load(key, third) && reopened.getStats().diskHits == 2;
+
+        // Failures are reported and not cached
+        ShaderCompileRequest broken = request;
+        broken.source = "error";
+        std::string errors;
+        ok = ok && !reopened.getOrCompile(broken, compiler, third, &errors) && errors == "syntax error" &&
+             !reopened.load(ShaderCache::computeKey(broken), third);
+
+        std::filesystem::remove_all(directory);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testShaderPermutationsCompileInParallel() {
+    TEST("Shader permutations enumerate every option combination and compile in parallel") {
+        std::vector<ogde::graphics::ShaderOption> options = {
+            { "FOG", { "", "1" } },
+            { "LIGHTS", { "1", "2", "4" } },
+            { "UNUSED", {} },
+            { "SKINNED", { "", "1" } }
+        };
+        const std::vector<std::vector<ogde::graphics::ShaderDefine>> permutations =
+            ogde::graphics::enumerateShaderPermutations(options);
+        bool ok = permutations.size() == 12 && permutations[0].size() == 1 &&
+                  permutations[0][0].name == "LIGHTS" && permutations[11].size() == 3;
+
+        ogde::graphics::ShaderCompileRequest base;
+        base.source = "float4 PSMain() : SV_Target { return 1; }";
+        base.entryPoint = "PSMain";
+        base.target = "ps_5_0";
+        base.defines = { { "QUALITY", "high" } };
+
+        std::atomic<int> calls{ 0 };
+        ogde::graphics::ShaderCache serialCache, parallelCache;
+        ogde::core::JobSystem jobs(3);
+        std::vector<ogde::graphics::ShaderPermutation> serial = ogde::graphics::compileShaderPermutations(
+            serialCache, base, options, makeCountingCompiler(calls));
+        std::vector<ogde::graphics::ShaderPermutation> parallel = ogde::graphics::compileShaderPermutations(
+            parallelCache, base, options, makeCountingCompiler(calls), &jobs);
+        ok = ok && calls == 24 && serial.size() == 12 && parallel.size() == 12;
+        for (size_t i = 0; ok && i < serial.size(); ++i) {
+            ok = serial[i].compiled && parallel[i].compiled && serial[i].key == parallel[i].key &&
+                 serial[i].bytecode == parallel[i].bytecode && serial[i].defines.size() == permutations[i].size() + 1;
+            for (size_t j = 0; ok && j < i; ++j) {
+                ok = serial[i].key != serial[j].key;
+            }
+        }
+
+        // A second pass is served from the cache
+        ogde::graphics::compileShaderPermutations(parallelCache, base, options, makeCountingCompiler(calls), &jobs);
+        ok = ok && calls == 24 && parallelCache.getStats().memoryHits == 12;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testUploadRingFencing() {
+    TEST("Upload ring aligns, wraps and keeps fenced frames until retired") {
+        using ogde::graphics::UploadAllocation;
+        using ogde::graphics::UploadRing;
+
+        UploadRing ring(1024);
+        UploadAllocation a = ring.allocate(400);
+        ring.endFrame(1);
+        UploadAllocation b = ring.allocate(400);
+        ring.endFrame(2);
+        bool ok = a.valid && a.offset == 0 && b.valid && b.offset == 400 && ring.getPendingFrameCount() == 2;
+
+        // 300 bytes only fit after wrapping, which needs frame 1's space back
+        UploadAllocation c = ring.allocate(300);
+        ok = ok && !c.valid && ring.getStats().overflows == 1;
+        ring.retire(1);
+        c = ring.allocate(300);
+        ok = ok && c.valid && c.offset == 0 && ring.getStats().wraps == 1 && ring.getPendingFrameCount() == 1;
+
+        // Aligned offsets, and frame 2 (400..800) is never handed out again
+        UploadAllocation d = ring.allocate(8, 64);
+        UploadAllocation e = ring.allocate(200);
+        ok = ok && d.valid && d.offset == 320 && !e.valid && ring.getStats().overflows == 2;
+
+        ring.endFrame(3);
+        ring.endFrame(4);   // Empty frames are not tracked
+        ok = ok && ring.getPendingFrameCount() == 2 && ring.getOldestPendingFence() == 2;
+        ring.retire(4);
+        ok = ok && !ring.hasPendingFrames() && ring.getUsedBytes() == 0;
+
+        // Invalid requests
+        ok = ok && !ring.allocate(2000).valid && ring.getStats().overflows == 3;
+        ok = ok && !ring.allocate(0).valid && !ring.allocate(16, 24).valid && ring.getStats().overflows == 3;
+
+        // Recommended capacity covers the peak demand, overflowed requests included
+        UploadRing small(256);
+        small.allocate(100);
+        small.allocate(100);
+        small.allocate(100);
+        small.endFrame(1);
+        ok = ok && small.getStats().peakFrameDemand == 312 && small.getRecommendedCapacity(2) == 1024 &&
+             small.getRecommendedCapacity(1) == 512 && UploadRing(4096).getRecommendedCapacity(3) == 4096;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testUploadRingSimulatedLatency() {
+    TEST("Upload ring never reuses memory the simulated GPU may still read") {
+        using ogde::graphics::UploadAllocation;
+        using ogde::graphics::UploadRing;
+
+        struct Range { uint64_t fence, offset, size; };
+        const uint64_t capacity = 32 * 1024;
+        const uint64_t gpuLatency = 2;
+        UploadRing ring(capacity);
+        std::vector<Range> live;
+        uint32_t seed = 12345;
+        uint32_t stalls = 0;
+        bool ok = true;
+
+        for (uint64_t frame = 1; ok && frame <= 300; ++frame) {
+            // The GPU finishes frames gpuLatency behind the CPU
+            if (frame > gpuLatency) {
+                ring.retire(frame - gpuLatency);
+                live.erase(std::remove_if(live.begin(), live.end(),
+                                          [&](const Range& r) { return r.fence <= frame - gpuLatency; }),
+                           live.end());
+            }
+
+            const uint32_t count = 1 + (frame % 17);
+            for (uint32_t i = 0; ok && i < count; ++i) {
+                seed = seed * 1664525u + 1013904223u;
+                const uint64_t size = 16 + (seed >> 8) % 2048;
+                const uint64_t alignment = uint64_t(1) << ((seed >> 4) % 9);
+                UploadAllocation allocation = ring.allocate(size, alignment);
+                while (!allocation.valid && ring.hasPendingFrames()) {
+                    // Wait for the oldest frame, as a backend without renaming would
+                    const uint64_t fence = ring.getOldestPendingFence();
+                    ring.retire(fence);
+                    live.erase(std::remove_if(live.begin(), live.end(),
+                                              [&](const Range& r) { return r.fence <= fence; }),
+                               live.end());
+                    ++stalls;
+                    allocation = ring.allocate(size, alignment);
+                }
+                ok = allocation.valid && allocation.offset % alignment == 0 &&
+                     allocation.offset + size <= capacity;
+                for (const Range& r : live) {
+                    ok = ok && (allocation.offset + size <= r.offset || r.offset + r.size <= allocation.offset);
+                }
+                live.push_back({ frame, allocation.offset, size });
+            }
+            ring.endFrame(frame);
+            ok = ok && ring.getUsedBytes() <= capacity;
+        }
+        ok = ok && ring.getStats().wraps > 0 && stalls > 0;
+        EXPECT_TRUE(ok);
+    }
+}
+
+class InstanceTraceSink : public ogde::graphics::CommandSink {
+public:
+    void bindPass(uint32_t) override {}
+    void bindShader(uint32_t) override {}
+    void bindMaterial(uint32_t) override {}
+    void bindGeometry(uint32_t) override {}
+    void draw(const ogde::graphics::DrawItem& item) override { draws.push_back(item); }
+    void updateBuffer(uint32_t, uint32_t, const void*, uint32_t) override {}
+
+    std::vector<ogde::graphics::DrawItem> draws;
+};
+
+void testInstancedBatching() {
+    TEST("Render queue merges identical mesh and material draws into instanced draws") {
+        using ogde::graphics::DrawItem;
+
+        ogde::graphics::RenderQueue queue;
+        for (uint32_t i = 0; i < 600; ++i) {
+            DrawItem item;
+            item.geometry = i % 3;
+            item.material = (i / 3) % 2;
+            item.key = ogde::graphics::RenderKey::instanced(0, 0, 0, item.material, item.geometry);
+            item.vertexCount = 36;
+            item.indexCount = item.geometry == 2 ? 36 : 0;
+            item.userData = i;
+            queue.add(item);
+        }
+        queue.sort();
+
+        RecordingSink plain;
+        bool ok = queue.submit(plain).draws == 600;
+
+        // Batches survive recording and replay through a command buffer
+        ogde::graphics::CommandBuffer commands;
+        std::vector<uint32_t> instanceIds;
+        const ogde::graphics::RenderQueueStats stats = queue.submitInstanced(commands, instanceIds);
+        InstanceTraceSink trace;
+        commands.replay(trace);
+        ok = ok && stats.draws == 6 && stats.instances == 600 && trace.draws.size() == 6 && instanceIds.size() == 600;
+        for (const DrawItem& draw : trace.draws) {
+            ok = ok && draw.instanceCount == 100 && draw.startInstance + draw.instanceCount <= instanceIds.size() &&
+                 draw.indexCount == (draw.geometry == 2 ? 36u : 0u);
+            for (uint32_t i = 0; ok && i < draw.instanceCount; ++i) {
+                const uint32_t id = instanceIds[draw.startInstance + i];
+                ok = id % 3 == draw.geometry && (id / 3) % 2 == draw.material;
+            }
+        }
+        std::vector<uint32_t> sortedIds = instanceIds;
+        std::sort(sortedIds.begin(), sortedIds.end());
+        for (uint32_t i = 0; ok && i < sortedIds.size(); ++i) {
+            ok = sortedIds[i] == i;
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testSoftwareInstancedMatchesSeparateDraws() {
+    TEST("Software instanced indexed draw matches one draw per instance") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 1.0f, 0.5f, 50.0f);
+        camera.lookAt(0.0f, 0.0f, -8.0f, 0.0f, 0.0f, 0.0f);
+        camera.update();
+
+        const float quad[12] = { -0.4f, -0.4f, 0.0f,   0.4f, -0.4f, 0.0f,   0.4f, 0.4f, 0.0f,   -0.4f, 0.4f, 0.0f };
+        const uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+        struct Instance {
+            float world[16];
+            float color[4];
+        };
+        std::vector<Instance> instances(16);
+        for (uint32_t i = 0; i < 16; ++i) {
+            Instance& instance = instances[i];
+            std::memset(instance.world, 0, sizeof(instance.world));
+            instance.world[0] = instance.world[5] = instance.world[10] = instance.world[15] = 1.0f;
+            instance.world[12] = static_cast<float>(i % 4) - 1.5f;
+            instance.world[13] = static_cast<float>(i / 4) - 1.5f;
+            instance.world[14] = 0.1f * static_cast<float>(i);
+            instance.color[0] = (i & 1) ? 1.0f : 0.25f;
+            instance.color[1] = (i & 2) ? 1.0f : 0.25f;
+            instance.color[2] = (i & 4) ? 1.0f : 0.25f;
+            instance.color[3] = 1.0f;
+        }
+
+        auto setup = [&](ogde::graphics::RendererSoftware& renderer) {
+            renderer.initialize(64, 64);
+            renderer.setViewProjection(camera.getViewProjectionMatrix());
+            const uint32_t geometry = renderer.createVertexBuffer(quad, 4);
+            renderer.setIndexBuffer(geometry, indices, 6);
+            renderer.beginFrame();
+            renderer.clear();
+            return geometry;
+        };
+
+        ogde::graphics::RendererSoftware separate, instanced;
+        separate.setVertexBuffer(setup(separate));
+        for (const Instance& instance : instances) {
+            separate.setWorldMatrix(instance.world);
+            separate.setColor(instance.color[0], instance.color[1], instance.color[2], instance.color[3]);
+            separate.drawIndexed(6);
+        }
+        separate.endFrame();
+
+        const uint32_t geometry = setup(instanced);
+        ogde::graphics::SoftwareInstanceFormat format;
+        format.stride = sizeof(Instance);
+        format.transformOffset = 0;
+        format.colorOffset = 16 * sizeof(float);
+        instanced.setInstanceStream(instances.data(), 16, format);
+        ogde::graphics::CommandBuffer commands;
+        commands.bindGeometry(geometry);
+        ogde::graphics::DrawItem item;
+        item.indexCount = 6;
+        item.instanceCount = 16;
+        commands.draw(item);
+        instanced.execute(commands);
+        instanced.endFrame();
+
+        const size_t pixels = static_cast<size_t>(separate.getStride()) * separate.getHeight();
+        bool ok = separate.getStats().trianglesSubmitted == 32 && instanced.getStats().trianglesSubmitted == 32 &&
+                  separate.getStats().pixelsWritten > 0 &&
+                  std::equal(separate.getColorBuffer(), separate.getColorBuffer() + pixels, instanced.getColorBuffer());
+
+        // A draw past the end of the stream is rejected
+        item.startInstance = 10;
+        instanced.draw(item);
+        ok = ok && instanced.getStats().trianglesSubmitted == 32;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testObjFloatParserMatchesStrtof() {
+    TEST("OBJ float parser matches strtof") {
+        std::vector<std::string> tokens = {
+            "0", "-0", "1", "-1.5", "+2.25", ".5", "5.", "3.14159265", "1e10", "1E-7", "-2.5e+3",
+            "0.1", "0.3333333333333333333333", "123456789012345678901234", "1e-40", "3.4028236e38",
+            "1e39", "7.006492321624086e-46", "16777217", "0.000001", "1.17549435e-38", "nan", "inf"
+        };
+        std::mt19937 rng(47);
+        std::uniform_real_distribution<float> mantissa(-1.0f, 1.0f);
+        std::uniform_int_distribution<int> exponent(-30, 30);
+        for (int i = 0; i < 2000; ++i) {
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), i % 2 ? "%.9g" : "%.6f",
+                          std::ldexp(mantissa(rng), i % 2 ? exponent(rng) : exponent(rng) / 4));
+            tokens.push_back(buffer);
+        }
+
+        bool ok = true;
+        for (const std::string& token : tokens) {
+            const std::string line = token + " 7";
+            float value = 0.0f;
+            const char* end = OGDE::Graphics::ObjLoader::ParseFloat(line.data(), line.data() + line.size(), value);
+            const float expected = std::strtof(token.c_str(), nullptr);
+            const bool same = std::isnan(expected) ? std::isnan(value)
+                                                   : std::memcmp(&value, &expected, sizeof(float)) == 0;
+            ok = ok && same && end == line.data() + token.size();
+        }
+
+        // No number leaves the cursor where it was
+        const char* text = "abc";
+        float value = 0.0f;
+        ok = ok && OGDE::Graphics::ObjLoader::ParseFloat(text, text + 3, value) == text;
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testObjLoaderIndexedMesh() {
+    TEST("OBJ loader deduplicates corners and matches across chunkings") {
+        std::string obj =
+            "# two quads sharing an edge\n"
+            "mtllib scene.mtl\n"
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 2 0 0\nv 2 1 0\n"
+            "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+            "vn 0 0 1\n"
+            "usemtl stone\n"
+            "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+            "usemtl wood\n"
+            "f -5/1/-1 -2/2/-1 -1/3/-1 -4/4/-1   # relative indices\n"
+            "usemtl stone\n"
+            "f 1/1/1 3/3/1 4/4/1\n"
+            "f 1/1/1 9/1/1 2/2/1\n";
+
+        OGDE::Graphics::MeshData serial;
+        OGDE::Graphics::ObjLoadStats stats;
+        bool ok = OGDE::Graphics::ObjLoader::Parse(obj.data(), obj.size(), serial,
+                                                   OGDE::Graphics::ObjLoadSettings(), &stats);
+        // 2 + 2 + 1 triangles; the last face references a missing position
+        ok = ok && stats.positions == 6 && stats.faces == 4 && stats.skippedTriangles == 1 &&
+             serial.GetTriangleCount() == 5 && serial.vertices.size() == 8 &&
+             serial.hasNormals && serial.hasTexCoords && serial.subMeshes.size() == 2 &&
+             serial.subMeshes[0].material == "stone" && serial.subMeshes[0].indexCount == 9 &&
+             serial.subMeshes[1].material == "wood" && serial.subMeshes[1].indexOffset == 9 &&
+             serial.boundsMax[0] == 2.0f && serial.boundsMax[1] == 1.0f;
+
+        // Tiny chunks on several threads give the identical mesh
+        ogde::core::JobSystem jobs(3);
+        OGDE::Graphics::ObjLoadSettings settings;
+        settings.jobSystem = &jobs;
+        settings.chunkSize = 64;
+        OGDE::Graphics::MeshData chunked;
+        ok = ok && OGDE::Graphics::ObjLoader::Parse(obj.data(), obj.size(), chunked, settings, &stats);
+        ok = ok && stats.chunks > 3 && chunked.indices == serial.indices &&
+             chunked.vertices.size() == serial.vertices.size() &&
+             std::memcmp(chunked.vertices.data(), serial.vertices.data(),
+                         serial.vertices.size() * sizeof(OGDE::Graphics::MeshVertex)) == 0;
+
+        // Positions only: smooth normals are generated
+        const std::string bare = "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+        OGDE::Graphics::MeshData generated;
+        ok = ok && OGDE::Graphics::ObjLoader::Parse(bare.data(), bare.size(), generated) &&
+             generated.hasNormals && !generated.hasTexCoords && generated.vertices[0].normal[2] == 1.0f;
+
+        ok = ok && !OGDE::Graphics::ObjLoader::Parse("v 0 0 0\n", 8, generated);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testMeshContainerRoundTrip() {
+    TEST("Mesh container round-trips and rejects corrupt files") {
+        const std::string obj = "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0 0\nvt 1 1\n"
+                                "usemtl a\nf 1/1 2/2 3/1\nusemtl b\nf 1/1 3/1 4/2\n";
+        OGDE::Graphics::MeshData mesh;
+        bool ok = OGDE::Graphics::ObjLoader::Parse(obj.data(), obj.size(), mesh);
+        // The longest name that fits the 48-byte field
+        const std::string longName = "materials/terrain/cliff_face_moss_wet_variant_3";
+        ok = ok && longName.size() == 47;
+        mesh.subMeshes[0].material = longName;
+
+        const std::string path = tempTexturePath("ogde_mesh.ogmesh");
+        ok = ok && OGDE::Graphics::MeshContainer::IsContainerPath(path) &&
+             OGDE::Graphics::MeshContainer::Write(path, mesh);
+        OGDE::Graphics::MeshData loaded;
+        ok = ok && OGDE::Graphics::MeshContainer::Read(path, loaded);
+        ok = ok && loaded.indices == mesh.indices && loaded.vertices.size() == mesh.vertices.size() &&
+             std::memcmp(loaded.vertices.data(), mesh.vertices.data(),
+                         mesh.vertices.size() * sizeof(OGDE::Graphics::MeshVertex)) == 0 &&
+             loaded.subMeshes.size() == 2 && loaded.subMeshes[0].material == longName &&
+             loaded.subMeshes[1].material == "b" &&
+             loaded.subMeshes[1].indexOffset == 3 && loaded.hasNormals == mesh.hasNormals &&
+             loaded.hasTexCoords && loaded.boundsMax[1] == 1.0f;
+
+        std::vector<uint8_t> file = *OGDE::Core::FileSystem::ReadBinaryFile(path);
+        std::filesystem::remove(path);
+        ok = ok && !OGDE::Graphics::MeshContainer::Parse(file.data(), file.size() - 1, loaded);
+
+        std::vector<uint8_t> badMagic = file;
+        badMagic[0] ^= 0xFF;
+        ok = ok && !OGDE::Graphics::MeshContainer::Parse(badMagic.data(), badMagic.size(), loaded);
+
+        // An index past the vertex array
+        std::vector<uint8_t> badIndex = file;
+        OGDE::Graphics::OgmeshHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        badIndex[header.indexOffset + 3] = 0x7F;
+        ok = ok && !OGDE::Graphics::MeshContainer::Parse(badIndex.data(), badIndex.size(), loaded);
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Grid of columns x rows quads on the XZ plane, triangles in random order
+OGDE::Graphics::MeshData makeShuffledGrid(int columns, int rows, uint32_t seed) {
+    OGDE::Graphics::MeshData mesh;
+    for (int y = 0; y <= rows; ++y) {
+        for (int x = 0; x <= columns; ++x) {
+            OGDE::Graphics::MeshVertex vertex = {};
+            vertex.position[0] = static_cast<float>(x);
+            vertex.position[1] = 0.1f * std::sin(x * 0.3f + y * 0.2f);
+            vertex.position[2] = static_cast<float>(y);
+            vertex.normal[1] = 1.0f;
+            vertex.texCoord[0] = x / static_cast<float>(columns);
+            vertex.texCoord[1] = y / static_cast<float>(rows);
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            const uint32_t a = y * (columns + 1) + x;
+            triangles.push_back({ a, a + columns + 1, a + 1 });
+            triangles.push_back({ a + 1, a + columns + 1, a + columns + 2 });
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+    for (const auto& triangle : triangles) {
+        mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+    }
+    mesh.hasNormals = mesh.hasTexCoords = true;
+    mesh.ComputeBounds();
+    return mesh;
+}
+
+// Triangles as sorted position triples, rotated to a canonical first corner (winding kept)
+std::vector<std::array<float, 9>> canonicalTriangles(const OGDE::Graphics::MeshData& mesh) {
+    std::vector<std::array<float, 9>> result;
+    for (size_t t = 0; t < mesh.indices.size(); t += 3) {
+        std::array<float, 9> corners[3];
+        for (int r = 0; r < 3; ++r) {
+            for (int i = 0; i < 3; ++i) {
+                const float* p = mesh.vertices[mesh.indices[t + (r + i) % 3]].position;
+                std::copy(p, p + 3, corners[r].begin() + i * 3);
+            }
+        }
+        result.push_back(*std::min_element(corners, corners + 3));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void testMeshOptimizerImprovesCacheEfficiency() {
+    TEST("Mesh optimizer lowers ACMR and keeps every triangle") {
+        OGDE::Graphics::MeshData mesh = makeShuffledGrid(40, 30, 48);
+        // Two sub-meshes (front and back half of the grid) must stay separate
+        std::vector<std::array<uint32_t, 3>> triangles(mesh.indices.size() / 3);
+        std::memcpy(triangles.data(), mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+        std::stable_partition(triangles.begin(), triangles.end(),
+                              [&](const std::array<uint32_t, 3>& t) { return mesh.vertices[t[0]].position[2] < 15.0f; });
+        std::memcpy(mesh.indices.data(), triangles.data(), mesh.indices.size() * sizeof(uint32_t));
+        mesh.subMeshes.push_back({ 0, 1200 * 3, "a" });
+        mesh.subMeshes.push_back({ 1200 * 3, 1200 * 3, "b" });
+        const auto before = canonicalTriangles(mesh);
+        std::vector<std::array<float, 9>> secondHalf;
+        {
+            OGDE::Graphics::MeshData half = mesh;
+            half.indices.erase(half.indices.begin(), half.indices.begin() + 1200 * 3);
+            secondHalf = canonicalTriangles(half);
+        }
+
+        OGDE::Graphics::MeshOptimizeSettings settings;
+        settings.overdraw = false;
+        OGDE::Graphics::MeshData cacheOnly = mesh;
+        OGDE::Graphics::MeshOptimizeReport cacheReport;
+        OGDE::Graphics::MeshOptimizer::Optimize(cacheOnly, settings, &cacheReport);
+
+        OGDE::Graphics::MeshOptimizeReport report;
+        OGDE::Graphics::MeshOptimizer::Optimize(mesh, OGDE::Graphics::MeshOptimizeSettings(), &report);
+
+        bool ok = report.acmrBefore > 2.0f && cacheReport.acmrAfter < 0.8f &&
+                  report.acmrAfter <= cacheReport.acmrAfter * 1.1f && report.clusters > 2 &&
+                  report.verticesAfter == 41 * 31 && canonicalTriangles(mesh) == before;
+        {
+            OGDE::Graphics::MeshData half = mesh;
+            half.indices.erase(half.indices.begin(), half.indices.begin() + 1200 * 3);
+            ok = ok && canonicalTriangles(half) == secondHalf;
+        }
+
+        // Vertex fetch order: each new vertex is the next one in memory
+        uint32_t next = 0;
+        for (uint32_t index : mesh.indices) {
+            ok = ok && index <= next;
+            next = std::max(next, index + 1);
+        }
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testMeshQuantizationRoundTrip() {
+    TEST("Quantized mesh vertices decode within tolerance and round-trip through .ogmesh") {
+        OGDE::Graphics::MeshData mesh = makeShuffledGrid(8, 8, 49);
+        std::mt19937 rng(49);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        for (OGDE::Graphics::MeshVertex& vertex : mesh.vertices) {
+            float n[3] = { unit(rng), unit(rng), unit(rng) };
+            const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int a = 0; a < 3; ++a) {
+                vertex.normal[a] = n[a] / length;
+            }
+            vertex.texCoord[0] = 4.0f * unit(rng);
+        }
+
+        OGDE::Graphics::MeshOptimizeSettings settings;
+        settings.quantize = true;
+        OGDE::Graphics::MeshOptimizeReport report;
+        OGDE::Graphics::MeshOptimizer::Optimize(mesh, settings, &report);
+
+        const std::string path = tempTexturePath("ogde_quantized.ogmesh");
+        const std::string floatPath = tempTexturePath("ogde_float.ogmesh");
+        OGDE::Graphics::MeshData floats = mesh;
+        floats.quantizedVertices.clear();
+        OGDE::Graphics::MeshData loaded;
+        bool ok = report.vertexBytesAfter * 2 == report.vertexBytesBefore &&
+                  OGDE::Graphics::MeshContainer::Write(path, mesh) &&
+                  OGDE::Graphics::MeshContainer::Write(floatPath, floats) &&
+                  OGDE::Graphics::MeshContainer::Read(path, loaded) &&
+                  std::filesystem::file_size(path) + mesh.vertices.size() * sizeof(OGDE::Graphics::QuantizedVertex) <=
+                      std::filesystem::file_size(floatPath) + OGDE::Graphics::kOgmeshPayloadAlignment;
+        std::filesystem::remove(path);
+        std::filesystem::remove(floatPath);
+        ok = ok && loaded.vertices.size() == mesh.vertices.size() && loaded.indices == mesh.indices &&
+             loaded.quantizedVertices.size() == mesh.vertices.size();
+
+        float positionError = 0.0f, normalDot = 1.0f, uvError = 0.0f;
+        for (size_t v = 0; ok && v < mesh.vertices.size(); ++v) {
+            const OGDE::Graphics::MeshVertex& a = mesh.vertices[v];
+            const OGDE::Graphics::MeshVertex& b = loaded.vertices[v];
+            float dot = 0.0f;
+            for (int i = 0; i < 3; ++i) {
+                positionError = std::max(positionError, std::fabs(a.position[i] - b.position[i]));
+                dot += a.normal[i] * b.normal[i];
+            }
+            normalDot = std::min(normalDot, dot);
+            uvError = std::max(uvError, std::fabs(a.texCoord[0] - b.texCoord[0]) / 4.0f);
+        }
+        // 8 units / 65535 steps; snorm16 octahedral is well under 0.01 degrees; halfs keep 11 bits
+        ok = ok && positionError < 1e-4f && normalDot > 0.99999f && uvError < 1.0f / 2048.0f;
+        EXPECT_TRUE(ok);
+    }
+}
+
+// UV sphere with a texture seam at phi = 0 and duplicated pole vertices
+OGDE::Graphics::MeshData makeUvSphere(int rings, int segments) {
+    OGDE::Graphics::MeshData mesh;
+    for (int r = 0; r <= rings; ++r) {
+        for (int s = 0; s <= segments; ++s) {
+            const float theta = 3.14159265f * r / rings;
+            const float phi = 2.0f * 3.14159265f * (s % segments) / segments;
+            OGDE::Graphics::MeshVertex vertex = {};
+            vertex.normal[0] = std::sin(theta) * std::cos(phi);
+            vertex.normal[1] = std::cos(theta);
+            vertex.normal[2] = std::sin(theta) * std::sin(phi);
+            std::copy(vertex.normal, vertex.normal + 3, vertex.position);
+            vertex.texCoord[0] = static_cast<float>(s) / segments;
+            vertex.texCoord[1] = static_cast<float>(r) / rings;
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    for (int r = 0; r < rings; ++r) {
+        for (int s = 0; s < segments; ++s) {
+            const uint32_t a = r * (segments + 1) + s;
+            const uint32_t b = a + segments + 1;
+            if (r > 0) {
+                mesh.indices.insert(mesh.indices.end(), { a, a + 1, b });
+            }
+            if (r + 1 < rings) {
+                mesh.indices.insert(mesh.indices.end(), { a + 1, b + 1, b });
+            }
+        }
+    }
+    mesh.hasNormals = mesh.hasTexCoords = true;
+    mesh.ComputeBounds();
+    return mesh;
+}
+
+void testMeshLodGeneration() {
+    TEST("LOD chain halves triangles with growing error and keeps seams and borders") {
+        OGDE::Graphics::MeshData sphere = makeUvSphere(48, 96);
+        const size_t sourceTriangles = sphere.GetTriangleCount();
+        const uint32_t levels = OGDE::Graphics::MeshSimplifier::GenerateLods(sphere);
+
+        bool ok = levels >= 3 && sphere.GetLodCount() == levels && sphere.lodErrors[0] == 0.0f;
+        std::vector<size_t> triangles(levels, 0);
+        std::vector<std::vector<uint8_t>> used(levels, std::vector<uint8_t>(sphere.vertices.size(), 0));
+        for (const OGDE::Graphics::SubMesh& subMesh : sphere.subMeshes) {
+            ok = ok && subMesh.lod < levels;
+            triangles[subMesh.lod] += subMesh.indexCount / 3;
+            for (uint32_t i = subMesh.indexOffset; ok && i < subMesh.indexOffset + subMesh.indexCount; ++i) {
+                used[subMesh.lod][sphere.indices[i]] = 1;
+            }
+        }
+        ok = ok && triangles[0] == sourceTriangles;
+        for (uint32_t level = 1; ok && level < levels; ++level) {
+            ok = triangles[level] <= triangles[level - 1] * 6 / 10 &&
+                 sphere.lodErrors[level] >= sphere.lodErrors[level - 1] && sphere.lodErrors[level] > 0.0f &&
+                 sphere.lodErrors[level] < 0.02f * std::sqrt(12.0f);
+        }
+        // Seam vertices (both copies at phi = 0) never move
+        for (int r = 1; ok && r < 48; ++r) {
+            ok = used[1][r * 97] && used[1][r * 97 + 96];
+        }
+
+        // Open plane: border vertices stay, the flat interior collapses at no cost
+        OGDE::Graphics::MeshData plane = makeShuffledGrid(24, 24, 50);
+        OGDE::Graphics::SimplifySettings settings;
+        settings.targetRatio = 0.1f;
+        std::vector<uint32_t> simplified;
+        for (OGDE::Graphics::MeshVertex& vertex : plane.vertices) {
+            vertex.position[1] = 0.0f;
+        }
+        const float error = OGDE::Graphics::MeshSimplifier::Simplify(plane, plane.indices.data(),
+                                                                     plane.indices.size(), settings, simplified);
+        std::vector<uint8_t> planeUsed(plane.vertices.size(), 0);
+        for (uint32_t index : simplified) {
+            planeUsed[index] = 1;
+        }
+        ok = ok && simplified.size() / 3 <= plane.GetTriangleCount() / 10 && error < 1e-4f;
+        for (int i = 0; ok && i <= 24; ++i) {
+            ok = planeUsed[i] && planeUsed[24 * 25 + i] && planeUsed[i * 25] && planeUsed[i * 25 + 24];
+        }
+
+        // Levels and their errors survive the container
+        const std::string path = tempTexturePath("ogde_lods.ogmesh");
+        OGDE::Graphics::MeshData loaded;
+        ok = ok && OGDE::Graphics::MeshContainer::Write(path, sphere) &&
+             OGDE::Graphics::MeshContainer::Read(path, loaded) && loaded.lodErrors == sphere.lodErrors &&
+             loaded.subMeshes.size() == sphere.subMeshes.size() && loaded.subMeshes.back().lod == levels - 1;
+        std::filesystem::remove(path);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testLodSelectorUsesProjection() {
+    TEST("LOD selector picks coarser levels with distance and follows the projection") {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        camera.setPosition(0.0f, 0.0f, 0.0f);
+        camera.update();
+        ogde::graphics::LodSelector selector;
+        selector.setCamera(camera, 1080.0f);
+
+        // 1080 / (2 tan 30) = 935 pixels per unit at distance 1
+        const float errors[4] = { 0.0f, 0.01f, 0.04f, 0.16f };
+        const float spheres[5][4] = { {0, 0, 5, 1}, {0, 0, 20, 1}, {0, 60, 0, 1}, {-400, 0, 0, 1}, {0, 0, 0.5f, 1} };
+        uint8_t levels[5];
+        selector.selectBatch(&spheres[0][0], 5, errors, 4, levels);
+        bool ok = levels[0] == 0 && levels[1] == 1 && levels[2] == 2 && levels[3] == 3 && levels[4] == 0 &&
+                  selector.select(errors, 4, 0, 0, 20, 1) == 1;
+
+        // A looser threshold or a smaller object scale allows coarser levels
+        ok = ok && selector.select(errors, 4, 0, 0, 20, 1, 0.25f) == 2;
+        selector.setErrorThreshold(4.0f);
+        ok = ok && selector.select(errors, 4, 0, 0, 20, 1) == 2;
+
+        // Narrow field of view (zoomed in) needs finer levels
+        camera.setPerspective(10.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+        camera.update();
+        selector.setCamera(camera, 1080.0f);
+        ok = ok && selector.select(errors, 4, 0, 0, 60, 1) == 1;
+
+        // Orthographic: 1080 pixels over 10 units, independent of distance
+        camera.setOrthographic(17.8f, 10.0f, 0.1f, 1000.0f);
+        camera.update();
+        selector.setCamera(camera, 1080.0f);
+        selector.setErrorThreshold(1.0f);
+        ok = ok && selector.select(errors, 4, 0, 0, 5, 1) == 0 && selector.select(errors, 4, 0, 0, 500, 1) == 0;
+        selector.setErrorThreshold(5.0f);
+        ok = ok && selector.select(errors, 4, 0, 0, 500, 1) == 2;
+        EXPECT_TRUE(ok);
+    }
+}
+
+// Index triples rotated to start at their smallest index, so winding-preserving reorders compare equal
+std::vector<std::array<uint32_t, 3>> rotatedTriangles(const uint32_t* indices, size_t indexCount) {
+    std::vector<std::array<uint32_t, 3>> result;
+    for (size_t t = 0; t + 2 < indexCount; t += 3) {
+        std::array<uint32_t, 3> triangle = { indices[t], indices[t + 1], indices[t + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        result.push_back(triangle);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+bool triangleFacesPoint(const OGDE::Graphics::MeshData& mesh, const uint32_t* triangle, const float* point) {
+    const float* p0 = mesh.vertices[triangle[0]].position;
+    const float* p1 = mesh.vertices[triangle[1]].position;
+    const float* p2 = mesh.vertices[triangle[2]].position;
+    const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    const float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+    return n[0] * (point[0] - p0[0]) + n[1] * (point[1] - p0[1]) + n[2] * (point[2] - p0[2]) > 0.0f;
+}
+
+void testMeshletBuildCoversMesh() {
+    TEST("Meshlets respect the limits, cover every triangle once and bound their triangles") {
+        OGDE::Graphics::MeshData sphere = makeUvSphere(48, 96);
+        OGDE::Graphics::MeshSimplifier::GenerateLods(sphere);
+        OGDE::Graphics::MeshOptimizer::Optimize(sphere);
+        const size_t meshletCount = OGDE::Graphics::MeshletBuilder::Build(sphere);
+
+        bool ok = meshletCount == sphere.meshlets.size() && sphere.subMeshes.size() >= 3;
+        for (const OGDE::Graphics::SubMesh& subMesh : sphere.subMeshes) {
+            std::vector<uint32_t> expanded;
+            for (uint32_t m = subMesh.meshletOffset; ok && m < subMesh.meshletOffset + subMesh.meshletCount; ++m) {
+                const OGDE::Graphics::Meshlet& meshlet = sphere.meshlets[m];
+                ok = meshlet.vertexCount <= 64 && meshlet.triangleCount <= 124 && meshlet.triangleCount > 0;
+                for (uint32_t k = 0; ok && k < meshlet.triangleCount * 3; ++k) {
+                    const uint32_t vertex = sphere.meshletVertices[meshlet.vertexOffset +
+                                                                   sphere.meshletTriangles[meshlet.triangleOffset * 3 + k]];
+                    const float* p = sphere.vertices[vertex].position;
+                    const float d[3] = { p[0] - meshlet.center[0], p[1] - meshlet.center[1], p[2] - meshlet.center[2] };
+                    ok = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) <= meshlet.radius * 1.0001f + 1e-6f;
+                    expanded.push_back(vertex);
+                }
+            }
+            ok = ok && rotatedTriangles(expanded.data(), expanded.size()) ==
+                           rotatedTriangles(sphere.indices.data() + subMesh.indexOffset, subMesh.indexCount);
+        }
+        // Well-filled clusters: a 64-vertex grid patch holds about 100 triangles
+        ok = ok && sphere.subMeshes[0].meshletCount <= sphere.subMeshes[0].indexCount / 3 / 80;
+
+        // A cluster whose cone says backfacing has no triangle facing the camera
+        std::mt19937 rng(50);
+        std::uniform_real_distribution<float> coordinate(-4.0f, 4.0f);
+        size_t backfacing = 0;
+        for (int sample = 0; ok && sample < 64; ++sample) {
+            const float camera[3] = { coordinate(rng), coordinate(rng), coordinate(rng) };
+            for (const OGDE::Graphics::Meshlet& meshlet : sphere.meshlets) {
+                float ray[3] = { meshlet.coneApex[0] - camera[0], meshlet.coneApex[1] - camera[1],
+                                 meshlet.coneApex[2] - camera[2] };
+                const float length = std::sqrt(ray[0] * ray[0] + ray[1] * ray[1] + ray[2] * ray[2]);
+                if ((ray[0] * meshlet.coneAxis[0] + ray[1] * meshlet.coneAxis[1] + ray[2] * meshlet.coneAxis[2]) <
+                    meshlet.coneCutoff * length) {
+                    continue;
+                }
+                ++backfacing;
+                for (uint32_t t = 0; ok && t < meshlet.triangleCount; ++t) {
+                    uint32_t triangle[3];
+                    for (int i = 0; i < 3; ++i) {
+                        triangle[i] = sphere.meshletVertices[meshlet.vertexOffset +
+                                                             sphere.meshletTriangles[(meshlet.triangleOffset + t) * 3 + i]];
+                    }
+                    ok = !triangleFacesPoint(sphere, triangle, camera);
+                }
+            }
+        }
+        ok = ok && backfacing > 0;
+
+        // Meshlets survive the container and vertex fetch renumbering
+        const std::string path = tempTexturePath("ogde_meshlets.ogmesh");
+        OGDE::Graphics::MeshData loaded;
+        ok = ok && OGDE::Graphics::MeshContainer::Write(path, sphere) &&
+             OGDE::Graphics::MeshContainer::Read(path, loaded) && loaded.meshlets.size() == sphere.meshlets.size() &&
+             std::memcmp(loaded.meshlets.data(), sphere.meshlets.data(),
+                         sphere.meshlets.size() * sizeof(OGDE::Graphics::Meshlet)) == 0 &&
+             loaded.meshletVertices == sphere.meshletVertices && loaded.meshletTriangles == sphere.meshletTriangles &&
+             loaded.subMeshes.back().meshletCount == sphere.subMeshes.back().meshletCount;
+        std::filesystem::remove(path);
+        EXPECT_TRUE(ok);
+    }
+}
+
+void testMeshletCullerFrustumAndBackface() {
+    TEST("Meshlet culler drops clusters outside the view or facing away and keeps every visible triangle") {
+        OGDE::Graphics::MeshData sphere = makeUvSphere(96, 192);
+        OGDE::Graphics::SubMesh whole;
+        whole.indexCount = static_cast<uint32_t>(sphere.indices.size());
+        sphere.subMeshes.push_back(whole);
+        OGDE::Graphics::MeshletBuilder::Build(sphere);
+        const OGDE::Graphics::SubMesh& subMesh = sphere.subMeshes[0];
+
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 1.0f, 0.1f, 100.0f);
+        camera.lookAt(0.0f, 0.0f, -5.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+        camera.update();
+        ogde::graphics::MeshletCuller culler;
+        culler.setCamera(camera);
+        std::vector<uint32_t> visible;
+        culler.cull(sphere, subMesh, visible);
+        const ogde::graphics::MeshletCullStats stats = culler.getStats();
+        // From 5 radii away 40% of the sphere faces the camera
+        const size_t triangleCount = subMesh.indexCount / 3;
+        bool ok = stats.testedMeshlets == subMesh.meshletCount && stats.backfaceCulled > subMesh.meshletCount / 4 &&
+                  stats.frustumCulled == 0 && stats.visibleTriangles * 3 == visible.size() &&
+                  visible.size() / 3 < triangleCount * 3 / 4 && visible.size() / 3 > triangleCount * 2 / 5;
+
+        // Every triangle facing the camera is kept
+        const float eye[3] = { 0.0f, 0.0f, -5.0f };
+        const auto kept = rotatedTriangles(visible.data(), visible.size());
+        for (size_t t = 0; ok && t < sphere.indices.size(); t += 3) {
+            if (triangleFacesPoint(sphere, &sphere.indices[t], eye)) {
+                ok = std::binary_search(kept.begin(), kept.end(), rotatedTriangles(&sphere.indices[t], 3)[0]);
+            }
+        }
+
+        // The same view of a moved and uniformly scaled object keeps the same triangles
+        const float world[16] = { 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 100, 0, 0, 1 };
+        camera.lookAt(100.0f, 0.0f, -10.0f, 100.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+        camera.update();
+        culler.setCamera(camera);
+        std::vector<uint32_t> moved;
+        culler.cull(sphere, subMesh, moved, world);
+        ok = ok && moved == visible;
+
+        // Looking away culls everything by the frustum; parallel culling matches the serial result
+        camera.lookAt(100.0f, 0.0f, -10.0f, 100.0f, 0.0f, -20.0f, 0.0f, 1.0f, 0.0f);
+        camera.update();
+        culler.setCamera(camera);
+        std::vector<uint32_t> none;
+        culler.cull(sphere, subMesh, none, world);
+        ok = ok && none.empty() && culler.getStats().frustumCulled == subMesh.meshletCount;
+
+        ogde::core::JobSystem jobs(3);
+        camera.lookAt(0.0f, 0.0f, -5.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+        camera.update();
+        culler.setCamera(camera);
+        culler.setJobSystem(&jobs);
+        std::vector<uint32_t> parallel;
+        culler.cull(sphere, subMesh, parallel);
+        ok = ok && subMesh.meshletCount > 256 && parallel == visible;
+        EXPECT_TRUE(ok);
+    }
+}
+
 int main() {
     std::cout << "=== Graphics Module Tests ===" << std::endl;
     std::cout << std::endl;
@@ -193,6 +2851,129 @@ int main() {
     testCameraViewMatrix();
     testCameraViewProjectionMatrix();
     testCameraDirectionVectors();
+    testCameraViewProjectionOrder();
+    testCameraWorldOrigin();
+    
+    std::cout << std::endl;
+    std::cout << "--- Frustum Culling Tests ---" << std::endl;
+    testFrustumExtraction();
+    testBatchCullingMatchesScalar();
+    
+    std::cout << std::endl;
+    std::cout << "--- Camera Set Tests ---" << std::endl;
+    testCameraSetDirtyUpdates();
+    testCameraSetSinglePassCulling();
+    testCameraSetShadowCascades();
+    
+    std::cout << std::endl;
+    std::cout << "--- Occlusion Culling Tests ---" << std::endl;
+    testOcclusionWallHidesBoxes();
+    testOcclusionPyramidKeepsMaxDepth();
+    testOcclusionThreadedMatchesSerial();
+    
+    std::cout << std::endl;
+    std::cout << "--- Mipmap Generation Tests ---" << std::endl;
+    testMipChainLayout();
+    testMipBoxFilter();
+    testMipKaiserFilter();
+    
+    std::cout << std::endl;
+    std::cout << "--- Block Compression Tests ---" << std::endl;
+    testBlockCompressionRoundTrip();
+    testBlockCompressionQualityAndThreads();
+    testTextureCompress();
+    
+    std::cout << std::endl;
+    std::cout << "--- Texture Container Tests ---" << std::endl;
+    testTextureContainerRoundTrip();
+    testTextureContainerRejectsCorruptFiles();
+    
+    std::cout << std::endl;
+    std::cout << "--- Async Texture Loading Tests ---" << std::endl;
+    testTextureLoaderPriorityAndBudget();
+    testTextureLoaderFailuresAndUnload();
+    
+    std::cout << std::endl;
+    std::cout << "--- Texture Streaming Tests ---" << std::endl;
+    testTextureStreamingLru();
+    testTextureStreamingContention();
+    
+    std::cout << std::endl;
+    std::cout << "--- Texture Atlas Tests ---" << std::endl;
+    testAtlasPackerNoOverlap();
+    testTextureAtlasPaddingAndMips();
+    testTextureArrayLayout();
+    
+    std::cout << std::endl;
+    std::cout << "--- Pixel Conversion Tests ---" << std::endl;
+    testPixelConvertMatchesReference();
+    testPixelConvertSrgbRoundTrip();
+    
+    std::cout << std::endl;
+    std::cout << "--- Texture Cache Tests ---" << std::endl;
+    testTextureCacheDeduplicates();
+    testTextureCacheEvictsUnreferencedLru();
+    
+    std::cout << std::endl;
+    std::cout << "--- Image Decoder Tests ---" << std::endl;
+    testPngDecoderFiltersAndLayouts();
+    testQoiDecoder();
+    
+    std::cout << std::endl;
+    std::cout << "--- Material Table Tests ---" << std::endl;
+    testMaterialTableDenseHandles();
+    testMaterialInstanceOverrides();
+    
+    std::cout << std::endl;
+    std::cout << "--- Render Queue Tests ---" << std::endl;
+    testRenderQueueRadixSortStable();
+    testRenderQueueSubmitsStateChanges();
+    
+    std::cout << std::endl;
+    std::cout << "--- Command Buffer Tests ---" << std::endl;
+    testCommandBufferRecordReplay();
+    testCommandRecorderDeterministicMerge();
+
+    std::cout << std::endl;
+    std::cout << "--- Software Rasterizer Tests ---" << std::endl;
+    testSoftwareRasterizerWatertight();
+    testSoftwareRasterizerDepthThreadsAndDump();
+
+    std::cout << std::endl;
+    std::cout << "--- Shader Cache Tests ---" << std::endl;
+    testShaderCacheKeysAndPersistence();
+    testShaderPermutationsCompileInParallel();
+
+    std::cout << std::endl;
+    std::cout << "--- Upload Ring Tests ---" << std::endl;
+    testUploadRingFencing();
+    testUploadRingSimulatedLatency();
+
+    std::cout << std::endl;
+    std::cout << "--- Instancing Tests ---" << std::endl;
+    testInstancedBatching();
+    testSoftwareInstancedMatchesSeparateDraws();
+
+    std::cout << std::endl;
+    std::cout << "--- Mesh Loading Tests ---" << std::endl;
+    testObjFloatParserMatchesStrtof();
+    testObjLoaderIndexedMesh();
+    testMeshContainerRoundTrip();
+
+    std::cout << std::endl;
+    std::cout << "--- Mesh Optimization Tests ---" << std::endl;
+    testMeshOptimizerImprovesCacheEfficiency();
+    testMeshQuantizationRoundTrip();
+
+    std::cout << std::endl;
+    std::cout << "--- Mesh LOD Tests ---" << std::endl;
+    testMeshLodGeneration();
+    testLodSelectorUsesProjection();
+
+    std::cout << std::endl;
+    std::cout << "--- Meshlet Tests ---" << std::endl;
+    testMeshletBuildCoversMesh();
+    testMeshletCullerFrustumAndBackface();
     
     std::cout << std::endl;
     std::cout << "=== Test Results ===" << std::endl;
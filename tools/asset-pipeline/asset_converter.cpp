@@ -1,13 +1,645 @@
 /**
  * Asset Converter Tool
- * Placeholder for asset conversion and optimization tool
+ * Offline asset conversion and optimization
+ *
+ * Usage: AssetConverter <command> [arguments]
  */
 
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/MeshContainer.h"
+#include "ogde/graphics/MeshOptimizer.h"
+#include "ogde/graphics/MeshSimplifier.h"
+#include "ogde/graphics/MeshletBuilder.h"
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/graphics/ObjLoader.h"
+#include "ogde/graphics/ShaderCache.h"
+#include "ogde/graphics/Texture.h"
+#include "ogde/graphics/TextureAtlas.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/core/FileSystem.h"
+#include "ogde/core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
-int main(int argc, char* argv[]) {
+#include "../../external/json.hpp"
+
+#ifdef _WIN32
+#include "ogde/graphics/Shader.h"
+#endif
+
+namespace {
+
+void PrintUsage() {
     std::cout << "OpenGameDevEngine Asset Converter" << std::endl;
-    std::cout << "Usage: AssetConverter <input> <output>" << std::endl;
-    std::cout << "This tool is a placeholder for future asset conversion functionality." << std::endl;
+    std::cout << "Usage: AssetConverter <command> [arguments]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Commands:" << std::endl;
+    std::cout << "  mips <image> [--filter box|kaiser] [--linear]" << std::endl;
+    std::cout << "      Generate the mip chain of an image and report each level" << std::endl;
+    std::cout << "  compress <image> [--format bc1|bc3|bc4|bc5|bc7] [--quality fast|normal|high]" << std::endl;
+    std::cout << "      Block-compress an image and report throughput and PSNR" << std::endl;
+    std::cout << "  texture <image> <output.ogtex> [--no-mips] [--premultiply] [mips options] [--format ...] [--quality ...]" << std::endl;
+    std::cout << "      Build mips, optionally block-compress, and write an engine texture container" << std::endl;
+    std::cout << "  atlas <output> <image>... [--padding N] [--max-size N] [--array]" << std::endl;
+    std::cout << "      Pack images into <output>_N.ogtex pages and write the UV table to <output>.json" << std::endl;
+    std::cout << "  shaders <source.hlsl> <cache-dir> --entry NAME --target PROFILE [-D NAME=VALUE]..." << std::endl;
+    std::cout << "          [--option NAME=VALUE,VALUE,...]... [--compiler COMMAND]" << std::endl;
+    std::cout << "          [--compiler-id ID]" << std::endl;
+    std::cout << "      Compile every option combination in parallel into the shader bytecode cache" << std::endl;
+    std::cout << "      (an empty option value leaves the define out; COMMAND is an fxc-compatible compiler," << std::endl;
+    std::cout << "      D3DCompile is used on Windows when none is given; ID names the compiler in the cache key)" << std::endl;
+    std::cout << "  mesh <input.obj> <output.ogmesh> [--no-optimize] [--quantize] [--cache-size N] [--lods N]" << std::endl;
+    std::cout << "          [--meshlets]" << std::endl;
+    std::cout << "      Parse an OBJ file in parallel, optionally append up to N-1 simplified levels of detail," << std::endl;
+    std::cout << "      optimize vertex cache, overdraw and fetch order, optionally quantize vertices and split" << std::endl;
+    std::cout << "      sub-meshes into cullable meshlets, and write an engine mesh container" << std::endl;
+}
+
+// Option parsers shared by texture commands. Each one looks at argv[i] and returns
+// the number of arguments it consumed, 0 if the option is not its own, or -1 on error.
+int ParseMipOption(int argc, char* argv[], int i, OGDE::Graphics::MipSettings& settings) {
+    if (std::strcmp(argv[i], "--linear") == 0) {
+        settings.srgb = false;
+        return 1;
+    }
+    if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+        std::string filter = argv[i + 1];
+        if (filter == "box") {
+            settings.filter = OGDE::Graphics::MipFilter::Box;
+        } else if (filter == "kaiser") {
+            settings.filter = OGDE::Graphics::MipFilter::Kaiser;
+        } else {
+            std::cerr << "Unknown filter: " << filter << std::endl;
+            return -1;
+        }
+        return 2;
+    }
+    return 0;
+}
+
+int ParseCompressionOption(int argc, char* argv[], int i, OGDE::Graphics::CompressionSettings& settings) {
+    std::string option = argv[i];
+    std::string value = (i + 1 < argc) ? argv[i + 1] : "";
+    if (option == "--format" && !value.empty()) {
+        if (value == "bc1") {
+            settings.format = OGDE::Graphics::BlockFormat::BC1;
+        } else if (value == "bc3") {
+            settings.format = OGDE::Graphics::BlockFormat::BC3;
+        } else if (value == "bc4") {
+            settings.format = OGDE::Graphics::BlockFormat::BC4;
+        } else if (value == "bc5") {
+            settings.format = OGDE::Graphics::BlockFormat::BC5;
+        } else if (value == "bc7") {
+            settings.format = OGDE::Graphics::BlockFormat::BC7;
+        } else {
+            std::cerr << "Unknown format: " << value << std::endl;
+            return -1;
+        }
+        return 2;
+    }
+    if (option == "--quality" && !value.empty()) {
+        if (value == "fast") {
+            settings.quality = OGDE::Graphics::CompressionQuality::Fast;
+        } else if (value == "normal") {
+            settings.quality = OGDE::Graphics::CompressionQuality::Normal;
+        } else if (value == "high") {
+            settings.quality = OGDE::Graphics::CompressionQuality::High;
+        } else {
+            std::cerr << "Unknown quality: " << value << std::endl;
+            return -1;
+        }
+        return 2;
+    }
+    return 0;
+}
+
+bool ParseMipSettings(int argc, char* argv[], int first, OGDE::Graphics::MipSettings& settings) {
+    for (int i = first; i < argc;) {
+        int consumed = ParseMipOption(argc, argv, i, settings);
+        if (consumed == 0) {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+        if (consumed <= 0) {
+            return false;
+        }
+        i += consumed;
+    }
+    return true;
+}
+
+int RunMips(int argc, char* argv[]) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    OGDE::Graphics::MipSettings settings;
+    settings.jobSystem = &ogde::core::JobSystem::shared();
+    if (!ParseMipSettings(argc, argv, 3, settings)) {
+        return 1;
+    }
+
+    OGDE::Graphics::Texture texture;
+    if (!texture.LoadFromFile(argv[2])) {
+        return 1;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!texture.GenerateMipmaps(settings)) {
+        return 1;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    size_t totalBytes = 0;
+    for (int level = 0; level < texture.GetMipLevelCount(); ++level) {
+        const OGDE::Graphics::MipLevel& mip = texture.GetMipLevel(level);
+        std::printf("  level %2d: %5d x %-5d %10zu bytes\n", level, mip.width, mip.height, mip.size);
+        totalBytes += mip.size;
+    }
+    std::printf("%d levels, %zu bytes, generated in %.2f ms\n", texture.GetMipLevelCount(), totalBytes,
+                std::chrono::duration<double, std::milli>(end - start).count());
+    return 0;
+}
+
+bool ParseCompressionSettings(int argc, char* argv[], int first, OGDE::Graphics::CompressionSettings& settings) {
+    for (int i = first; i < argc;) {
+        int consumed = ParseCompressionOption(argc, argv, i, settings);
+        if (consumed == 0) {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+        if (consumed <= 0) {
+            return false;
+        }
+        i += consumed;
+    }
+    return true;
+}
+
+int RunCompress(int argc, char* argv[]) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    OGDE::Graphics::CompressionSettings settings;
+    settings.jobSystem = &ogde::core::JobSystem::shared();
+    if (!ParseCompressionSettings(argc, argv, 3, settings)) {
+        return 1;
+    }
+
+    OGDE::Graphics::Texture texture;
+    if (!texture.LoadFromFile(argv[2])) {
+        return 1;
+    }
+    const int width = texture.GetWidth();
+    const int height = texture.GetHeight();
+
+    std::vector<uint8_t> blocks(OGDE::Graphics::BlockCompressor::GetCompressedSize(settings.format, width, height));
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!OGDE::Graphics::BlockCompressor::Encode(texture.GetData(), width, height, texture.GetChannels(),
+                                                 settings, blocks.data())) {
+        return 1;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::vector<uint8_t> source(static_cast<size_t>(width) * height * 4);
+    std::vector<uint8_t> decoded(source.size());
+    OGDE::Graphics::BlockCompressor::ExpandToRgba(texture.GetData(), width, height, texture.GetChannels(), source.data());
+    OGDE::Graphics::BlockCompressor::Decode(blocks.data(), width, height, settings.format, decoded.data());
+    double psnr = OGDE::Graphics::BlockCompressor::ComputePsnr(
+        source.data(), decoded.data(), width, height, OGDE::Graphics::BlockCompressor::GetChannelCount(settings.format));
+
+    std::printf("%dx%d -> %zu bytes in %.2f ms (%.1f MP/s, %u threads), PSNR %.2f dB\n", width, height,
+                blocks.size(), ms, width * static_cast<double>(height) / 1000.0 / ms,
+                settings.jobSystem->getThreadCount(), psnr);
     return 0;
 }
+
+int RunTexture(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage();
+        return 1;
+    }
+
+    bool generateMips = true;
+    bool premultiply = false;
+    bool compress = false;
+    OGDE::Graphics::MipSettings mipSettings;
+    OGDE::Graphics::CompressionSettings compressionSettings;
+    mipSettings.jobSystem = &ogde::core::JobSystem::shared();
+    compressionSettings.jobSystem = &ogde::core::JobSystem::shared();
+    for (int i = 4; i < argc;) {
+        int consumed = 0;
+        if (std::strcmp(argv[i], "--no-mips") == 0) {
+            generateMips = false;
+            consumed = 1;
+        } else if (std::strcmp(argv[i], "--premultiply") == 0) {
+            premultiply = true;
+            consumed = 1;
+        } else {
+            consumed = ParseMipOption(argc, argv, i, mipSettings);
+            if (consumed == 0) {
+                consumed = ParseCompressionOption(argc, argv, i, compressionSettings);
+                compress = compress || consumed > 0;
+            }
+        }
+        if (consumed == 0) {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+        if (consumed <= 0) {
+            return 1;
+        }
+        i += consumed;
+    }
+
+    OGDE::Graphics::Texture texture;
+    if (!texture.LoadFromFile(argv[2])) {
+        return 1;
+    }
+    if (premultiply && !texture.PremultiplyAlpha()) {
+        return 1;
+    }
+    if (generateMips && !texture.GenerateMipmaps(mipSettings)) {
+        return 1;
+    }
+    if (compress && !texture.Compress(compressionSettings)) {
+        return 1;
+    }
+    if (!OGDE::Graphics::TextureContainer::Write(argv[3], texture)) {
+        return 1;
+    }
+
+    const OGDE::Graphics::MipLevel& last = texture.GetMipLevel(texture.GetMipLevelCount() - 1);
+    std::printf("%s: %dx%d, %d levels, %s, %zu payload bytes\n", argv[3], texture.GetWidth(), texture.GetHeight(),
+                texture.GetMipLevelCount(), compress ? "block-compressed" : "uncompressed", last.offset + last.size);
+    return 0;
+}
+
+int RunAtlas(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage();
+        return 1;
+    }
+
+    const std::string output = argv[2];
+    OGDE::Graphics::AtlasSettings settings;
+    settings.mipSettings.jobSystem = &ogde::core::JobSystem::shared();
+    std::vector<std::string> paths;
+    for (int i = 3; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--padding" && i + 1 < argc) {
+            settings.padding = std::atoi(argv[++i]);
+        } else if (option == "--max-size" && i + 1 < argc) {
+            settings.maxSize = std::atoi(argv[++i]);
+        } else if (option == "--array") {
+            settings.layout = OGDE::Graphics::AtlasLayout::Array;
+        } else if (option.compare(0, 2, "--") == 0) {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        } else {
+            paths.push_back(option);
+        }
+    }
+
+    std::vector<OGDE::Graphics::Texture> textures(paths.size());
+    std::vector<const OGDE::Graphics::Texture*> images;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (!textures[i].LoadFromFile(paths[i])) {
+            return 1;
+        }
+        images.push_back(&textures[i]);
+    }
+
+    OGDE::Graphics::TextureAtlas atlas;
+    if (!atlas.Build(images, settings)) {
+        return 1;
+    }
+
+    nlohmann::json table;
+    table["layout"] = settings.layout == OGDE::Graphics::AtlasLayout::Array ? "array" : "atlas";
+    for (int page = 0; page < atlas.GetPageCount(); ++page) {
+        std::string pagePath = output + "_" + std::to_string(page) + ".ogtex";
+        if (!OGDE::Graphics::TextureContainer::Write(pagePath, atlas.GetPage(page))) {
+            return 1;
+        }
+        table["pages"].push_back(OGDE::Core::FileSystem::GetFilename(pagePath));
+    }
+    for (int i = 0; i < atlas.GetRegionCount(); ++i) {
+        const OGDE::Graphics::AtlasRegion& region = atlas.GetRegion(i);
+        table["regions"].push_back({
+            { "name", OGDE::Core::FileSystem::GetFilename(paths[i]) },
+            { "page", region.page },
+            { "uv", { region.u0, region.v0, region.u1, region.v1 } },
+            { "rect", { region.rect.x, region.rect.y, region.rect.width, region.rect.height } }
+        });
+    }
+
+    std::ofstream file(output + ".json");
+    if (!file.is_open()) {
+        std::cerr << "Failed to write " << output << ".json" << std::endl;
+        return 1;
+    }
+    file << table.dump(2) << std::endl;
+
+    const OGDE::Graphics::Texture& first = atlas.GetPage(0);
+    std::printf("%zu images -> %d page(s) of %dx%d, %d levels\n", paths.size(), atlas.GetPageCount(),
+                first.GetWidth(), first.GetHeight(), first.GetMipLevelCount());
+    return 0;
+}
+
+
+// D3DCOMPILE_ENABLE_STRICTNESS: the flags Shader uses in release builds, so
+// the runtime finds the bytecode compiled here under the same key
+constexpr uint32_t kRuntimeShaderFlags = 1u << 11;
+
+// The compiler id Shader puts in its keys (d3dcompiler_<D3D_COMPILER_VERSION>);
+// fxc loads the same DLL. Override with --compiler-id for other compilers.
+constexpr const char* kRuntimeShaderCompiler = "d3dcompiler_47";
+
+// Builds a compiler that runs an external fxc-compatible executable. Files are
+// named after the permutation key, so parallel compiles never collide.
+ogde::graphics::ShaderCompileFunction MakeCommandCompiler(const std::string& command, const std::string& directory) {
+    return [command, directory](const ogde::graphics::ShaderCompileRequest& request,
+                                std::vector<uint8_t>& bytecode, std::string& errors) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx",
+                      static_cast<unsigned long long>(ogde::graphics::ShaderCache::computeKey(request)));
+        const std::filesystem::path base = std::filesystem::path(directory) / name;
+        const std::string input = base.string() + ".hlsl";
+        const std::string output = base.string() + ".cso";
+        const std::string log = base.string() + ".log";
+        {
+            std::ofstream source(input, std::ios::binary);
+            source << request.source;
+        }
+
+        std::string commandLine = command + " /nologo /Ges /T " + request.target + " /E " + request.entryPoint;
+        for (const ogde::graphics::ShaderDefine& define : request.defines) {
+            commandLine += " /D \"" + define.name + "=" + define.value + "\"";
+        }
+        commandLine += " /Fo \"" + output + "\" \"" + input + "\" > \"" + log + "\" 2>&1";
+        const bool succeeded = std::system(commandLine.c_str()) == 0;
+
+        std::ifstream result(output, std::ios::binary);
+        if (succeeded && result) {
+            bytecode.assign(std::istreambuf_iterator<char>(result), std::istreambuf_iterator<char>());
+        } else {
+            std::ifstream messages(log);
+            errors.assign(std::istreambuf_iterator<char>(messages), std::istreambuf_iterator<char>());
+        }
+        result.close();
+
+        std::error_code ignored;
+        std::filesystem::remove(input, ignored);
+        std::filesystem::remove(output, ignored);
+        std::filesystem::remove(log, ignored);
+        return succeeded && !bytecode.empty();
+    };
+}
+
+// Parses NAME=VALUE (value may be empty)
+ogde::graphics::ShaderDefine ParseDefine(const std::string& text) {
+    const size_t equals = text.find('=');
+    if (equals == std::string::npos) {
+        return { text, "1" };
+    }
+    return { text.substr(0, equals), text.substr(equals + 1) };
+}
+
+int RunShaders(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage();
+        return 1;
+    }
+
+    ogde::graphics::ShaderCompileRequest base;
+    base.name = argv[2];
+    base.flags = kRuntimeShaderFlags;
+    base.compiler = kRuntimeShaderCompiler;
+    const std::string cacheDirectory = argv[3];
+    std::vector<ogde::graphics::ShaderOption> options;
+    std::string compilerCommand;
+    for (int i = 4; i < argc; ++i) {
+        std::string option = argv[i];
+        std::string value = (i + 1 < argc) ? argv[i + 1] : "";
+        if (option == "--entry" && !value.empty()) {
+            base.entryPoint = value;
+        } else if (option == "--target" && !value.empty()) {
+            base.target = value;
+        } else if (option == "-D" && !value.empty()) {
+            base.defines.push_back(ParseDefine(value));
+        } else if (option == "--option" && !value.empty()) {
+            // NAME=A,B,C; a trailing or leading comma adds the "undefined" variant
+            ogde::graphics::ShaderDefine axis = ParseDefine(value);
+            ogde::graphics::ShaderOption permutation;
+            permutation.name = axis.name;
+            size_t start = 0;
+            for (;;) {
+                const size_t comma = axis.value.find(',', start);
+                permutation.values.push_back(axis.value.substr(start, comma - start));
+                if (comma == std::string::npos) {
+                    break;
+                }
+                start = comma + 1;
+            }
+            options.push_back(permutation);
+        } else if (option == "--compiler" && !value.empty()) {
+            compilerCommand = value;
+        } else if (option == "--compiler-id" && !value.empty()) {
+            base.compiler = value;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+        ++i;
+    }
+    if (base.entryPoint.empty() || base.target.empty()) {
+        std::cerr << "shaders needs --entry and --target" << std::endl;
+        return 1;
+    }
+
+    std::ifstream sourceFile(argv[2], std::ios::binary);
+    if (!sourceFile) {
+        std::cerr << "Failed to read " << argv[2] << std::endl;
+        return 1;
+    }
+    base.source.assign(std::istreambuf_iterator<char>(sourceFile), std::istreambuf_iterator<char>());
+
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+    ogde::graphics::ShaderCompileFunction compiler;
+    if (!compilerCommand.empty()) {
+        compiler = MakeCommandCompiler(compilerCommand, cacheDirectory);
+    } else {
+#ifdef _WIN32
+        compiler = &ogde::graphics::Shader::compileBytecode;
+#else
+        std::cerr << "No built-in shader compiler on this platform; pass --compiler (e.g. fxc)" << std::endl;
+        return 1;
+#endif
+    }
+
+    ogde::graphics::ShaderCache cache(cacheDirectory);
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<ogde::graphics::ShaderPermutation> results = ogde::graphics::compileShaderPermutations(
+        cache, base, options, compiler, &ogde::core::JobSystem::shared());
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    int failures = 0;
+    for (const ogde::graphics::ShaderPermutation& result : results) {
+        std::string defines;
+        for (const ogde::graphics::ShaderDefine& define : result.defines) {
+            defines += " " + define.name + "=" + define.value;
+        }
+        if (result.compiled) {
+            std::printf("  %016llx %6zu bytes%s\n", static_cast<unsigned long long>(result.key),
+                        result.bytecode.size(), defines.c_str());
+        } else {
+            ++failures;
+            std::fprintf(stderr, "  failed:%s\n%s\n", defines.c_str(), result.errors.c_str());
+        }
+    }
+
+    const ogde::graphics::ShaderCacheStats stats = cache.getStats();
+    std::printf("%s %s/%s: %zu permutations, %llu cached, %llu compiled, %d failed in %.1f ms\n",
+                argv[2], base.entryPoint.c_str(), base.target.c_str(), results.size(),
+                static_cast<unsigned long long>(stats.memoryHits + stats.diskHits),
+                static_cast<unsigned long long>(stats.misses - stats.compileFailures), failures, ms);
+    return failures == 0 ? 0 : 1;
+}
+
+int RunMesh(int argc, char* argv[]) {
+    if (argc < 4) {
+        PrintUsage();
+        return 1;
+    }
+
+    bool optimize = true;
+    OGDE::Graphics::MeshOptimizeSettings optimizeSettings;
+    OGDE::Graphics::LodSettings lodSettings;
+    lodSettings.maxLevels = 1;
+    bool meshlets = false;
+    for (int i = 4; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-optimize") == 0) {
+            optimize = false;
+        } else if (std::strcmp(argv[i], "--quantize") == 0) {
+            optimizeSettings.quantize = true;
+        } else if (std::strcmp(argv[i], "--cache-size") == 0 && i + 1 < argc) {
+            optimizeSettings.cacheSize = static_cast<uint32_t>(std::max(3, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--meshlets") == 0) {
+            meshlets = true;
+        } else if (std::strcmp(argv[i], "--lods") == 0 && i + 1 < argc) {
+            lodSettings.maxLevels = static_cast<uint32_t>(std::clamp(std::atoi(argv[++i]), 1, 16));
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+    if (!optimize) {
+        optimizeSettings.vertexCache = false;
+        optimizeSettings.overdraw = false;
+        optimizeSettings.vertexFetch = false;
+    }
+
+    OGDE::Graphics::ObjLoadSettings settings;
+    settings.jobSystem = &ogde::core::JobSystem::shared();
+    OGDE::Graphics::ObjLoadStats stats;
+    OGDE::Graphics::MeshData mesh;
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!OGDE::Graphics::ObjLoader::Load(argv[2], mesh, settings, &stats)) {
+        return 1;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    const size_t sourceTriangles = mesh.GetTriangleCount();
+    uint32_t levels = 1;
+    double lodMs = 0.0;
+    if (lodSettings.maxLevels > 1) {
+        start = std::chrono::high_resolution_clock::now();
+        levels = OGDE::Graphics::MeshSimplifier::GenerateLods(mesh, lodSettings);
+        end = std::chrono::high_resolution_clock::now();
+        lodMs = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    OGDE::Graphics::MeshOptimizeReport report;
+    start = std::chrono::high_resolution_clock::now();
+    OGDE::Graphics::MeshOptimizer::Optimize(mesh, optimizeSettings, &report);
+    end = std::chrono::high_resolution_clock::now();
+    double optimizeMs = std::chrono::duration<double, std::milli>(end - start).count();
+    size_t meshletCount = 0;
+    double meshletMs = 0.0;
+    if (meshlets) {
+        start = std::chrono::high_resolution_clock::now();
+        meshletCount = OGDE::Graphics::MeshletBuilder::Build(mesh);
+        end = std::chrono::high_resolution_clock::now();
+        meshletMs = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    if (!OGDE::Graphics::MeshContainer::Write(argv[3], mesh)) {
+        return 1;
+    }
+
+    std::printf("%s: %zu triangles, %zu vertices (from %u corners), %zu sub-meshes, %u skipped triangles, %.1f ms\n",
+                argv[3], sourceTriangles, mesh.vertices.size(), stats.corners, mesh.subMeshes.size(),
+                stats.skippedTriangles, ms);
+    if (levels > 1) {
+        std::printf("  %u levels of detail in %.1f ms, errors:", levels, lodMs);
+        for (float error : mesh.lodErrors) {
+            std::printf(" %g", error);
+        }
+        std::printf("\n");
+    }
+    std::printf("  ACMR %.3f -> %.3f, ATVR %.3f -> %.3f (cache size %u), %u overdraw clusters, %.1f ms\n",
+                report.acmrBefore, report.acmrAfter, report.atvrBefore, report.atvrAfter, optimizeSettings.cacheSize,
+                report.clusters, optimizeMs);
+    std::printf("  vertices %u -> %u, vertex data %zu -> %zu bytes (%.0f%%)\n", report.verticesBefore,
+                report.verticesAfter, report.vertexBytesBefore, report.vertexBytesAfter,
+                report.vertexBytesBefore ? 100.0 * report.vertexBytesAfter / report.vertexBytesBefore : 0.0);
+    if (meshlets) {
+        std::printf("  %zu meshlets (%.1f triangles each) in %.1f ms\n", meshletCount,
+                    meshletCount ? static_cast<double>(mesh.GetTriangleCount()) / meshletCount : 0.0, meshletMs);
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage();
+        return 0;
+    }
+
+    std::string command = argv[1];
+    if (command == "mips") {
+        return RunMips(argc, argv);
+    }
+    if (command == "compress") {
+        return RunCompress(argc, argv);
+    }
+    if (command == "texture") {
+        return RunTexture(argc, argv);
+    }
+    if (command == "atlas") {
+        return RunAtlas(argc, argv);
+    }
+    if (command == "shaders") {
+        return RunShaders(argc, argv);
+    }
+    if (command == "mesh") {
+        return RunMesh(argc, argv);
+    }
+
+    std::cerr << "Unknown command: " << command << std::endl;
+    PrintUsage();
+    return 1;
+}
@@ -0,0 +1,1460 @@
+/**
+ * Graphics Benchmarks
+ * CPU-side performance measurements for graphics systems
+ *
+ * Usage: GraphicsBenchmarks [filter]
+ * Runs every benchmark whose name contains the filter string.
+ */
+
+#include "ogde/graphics/Camera.h"
+#include "ogde/graphics/CameraSet.h"
+#include "ogde/graphics/Frustum.h"
+#include "ogde/graphics/OcclusionCuller.h"
+#include "ogde/graphics/MipGenerator.h"
+#include "ogde/graphics/BlockCompression.h"
+#include "ogde/graphics/Texture.h"
+#include "ogde/graphics/TextureContainer.h"
+#include "ogde/graphics/PixelConvert.h"
+#include "ogde/graphics/ImageDecoder.h"
+#include "ogde/graphics/Material.h"
+#include "ogde/graphics/MaterialInstance.h"
+#include "ogde/graphics/RenderQueue.h"
+#include "ogde/graphics/RendererSoftware.h"
+#include "ogde/graphics/ObjLoader.h"
+#include "ogde/graphics/MeshContainer.h"
+#include "ogde/graphics/MeshOptimizer.h"
+#include "ogde/graphics/MeshSimplifier.h"
+#include "ogde/graphics/LodSelector.h"
+#include "ogde/graphics/MeshletBuilder.h"
+#include "ogde/graphics/MeshletCuller.h"
+#include "ogde/core/JobSystem.h"
+#include "../../external/stb_image.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::high_resolution_clock;
+
+// Run fn `iterations` times and return the best time in milliseconds
+double measureBestMs(int iterations, const std::function<void()>& fn) {
+    double best = 1e30;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = Clock::now();
+        fn();
+        auto end = Clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// Frustum culling
+// ---------------------------------------------------------------------------
+
+void benchFrustumCulling() {
+    const uint32_t objectCount = 262144;
+
+    ogde::graphics::Camera camera;
+    camera.setPerspective(70.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    camera.lookAt(0.0f, 64.0f, 0.0f, 100.0f, 40.0f, 100.0f);
+    camera.update();
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+
+    ogde::graphics::AabbBatch boxes;
+    ogde::graphics::SphereBatch spheres;
+    boxes.reserve(objectCount);
+    spheres.reserve(objectCount);
+    for (uint32_t i = 0; i < objectCount; ++i) {
+        float x = position(rng);
+        float y = position(rng) * 0.1f;
+        float z = position(rng);
+        boxes.add(x, y, z, x + 16.0f, y + 16.0f, z + 16.0f);
+        spheres.add(x + 8.0f, y + 8.0f, z + 8.0f, 13.9f);
+    }
+
+    std::vector<uint32_t> visible(objectCount);
+    uint32_t visibleCount = 0;
+
+    double aabbMs = measureBestMs(20, [&]() {
+        visibleCount = ogde::graphics::cullAabbs(camera.getFrustum(), boxes, visible.data());
+    });
+    std::printf("  cullAabbs:   %u objects, %u visible, %.3f ms\n", objectCount, visibleCount, aabbMs);
+
+    double sphereMs = measureBestMs(20, [&]() {
+        visibleCount = ogde::graphics::cullSpheres(camera.getFrustum(), spheres, visible.data());
+    });
+    std::printf("  cullSpheres: %u objects, %u visible, %.3f ms\n", objectCount, visibleCount, sphereMs);
+
+    const ogde::graphics::Frustum& frustum = camera.getFrustum();
+    double scalarMs = measureBestMs(20, [&]() {
+        visibleCount = 0;
+        for (uint32_t i = 0; i < objectCount; ++i) {
+            float minX = boxes.centerX()[i] - boxes.extentX()[i];
+            float minY = boxes.centerY()[i] - boxes.extentY()[i];
+            float minZ = boxes.centerZ()[i] - boxes.extentZ()[i];
+            float maxX = boxes.centerX()[i] + boxes.extentX()[i];
+            float maxY = boxes.centerY()[i] + boxes.extentY()[i];
+            float maxZ = boxes.centerZ()[i] + boxes.extentZ()[i];
+            if (frustum.intersectsAabb(minX, minY, minZ, maxX, maxY, maxZ)) {
+                visible[visibleCount++] = i;
+            }
+        }
+    });
+    std::printf("  scalar AABB: %u objects, %u visible, %.3f ms\n", objectCount, visibleCount, scalarMs);
+}
+
+// ---------------------------------------------------------------------------
+// Multi-view culling
+// ---------------------------------------------------------------------------
+
+void benchMultiViewCulling() {
+    const uint32_t objectCount = 262144;
+
+    ogde::graphics::CameraSet views;
+    uint32_t main = views.addView(ogde::graphics::ViewType::Main);
+    views.getCamera(main).setPerspective(70.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    views.getCamera(main).lookAt(0.0f, 64.0f, 0.0f, 100.0f, 40.0f, 100.0f);
+    views.update();
+    views.addShadowCascades(4);
+    views.updateShadowCascades(views.getCamera(main), 0.4f, -1.0f, 0.3f, 0.75f, 400.0f);
+    views.update();
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+    ogde::graphics::AabbBatch boxes;
+    boxes.reserve(objectCount);
+    for (uint32_t i = 0; i < objectCount; ++i) {
+        float x = position(rng);
+        float y = position(rng) * 0.1f;
+        float z = position(rng);
+        boxes.add(x, y, z, x + 16.0f, y + 16.0f, z + 16.0f);
+    }
+
+    std::vector<uint32_t> masks;
+    double singlePassMs = measureBestMs(20, [&]() {
+        views.cull(boxes, masks);
+    });
+
+    std::vector<uint32_t> visible(objectCount);
+    double separateMs = measureBestMs(20, [&]() {
+        for (uint32_t v = 0; v < views.getViewCount(); ++v) {
+            ogde::graphics::cullAabbs(views.getCamera(v).getFrustum(), boxes, visible.data());
+        }
+    });
+
+    std::printf("  %u views, %u objects\n", views.getViewCount(), objectCount);
+    std::printf("  single pass:     %.3f ms\n", singlePassMs);
+    std::printf("  separate passes: %.3f ms\n", separateMs);
+}
+
+// ---------------------------------------------------------------------------
+// Occlusion culling
+// ---------------------------------------------------------------------------
+
+void benchOcclusionCulling() {
+    const uint32_t objectCount = 65536;
+    const uint32_t buildingCount = 400;
+
+    ogde::graphics::Camera camera;
+    camera.setPerspective(70.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    camera.lookAt(0.0f, 2.0f, 0.0f, 100.0f, 2.0f, 100.0f);
+    camera.update();
+
+    // City blocks: a grid of tall buildings with small props scattered between them
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> buildingHeight(10.0f, 60.0f);
+    std::vector<float> buildings;
+    for (uint32_t i = 0; i < buildingCount; ++i) {
+        float x = static_cast<float>(i % 20) * 50.0f - 500.0f + 5.0f;
+        float z = static_cast<float>(i / 20) * 50.0f - 500.0f + 5.0f;
+        buildings.insert(buildings.end(), { x, 0.0f, z, x + 35.0f, buildingHeight(rng), z + 35.0f });
+    }
+
+    ogde::graphics::AabbBatch boxes;
+    boxes.reserve(objectCount);
+    for (uint32_t i = 0; i < objectCount; ++i) {
+        float x = position(rng);
+        float z = position(rng);
+        boxes.add(x, 0.0f, z, x + 2.0f, 3.0f, z + 2.0f);
+    }
+
+    std::vector<uint32_t> candidates(objectCount);
+    uint32_t candidateCount = ogde::graphics::cullAabbs(camera.getFrustum(), boxes, candidates.data());
+    std::vector<uint32_t> visible(candidateCount);
+
+    ogde::core::JobSystem& jobs = ogde::core::JobSystem::shared();
+    for (int threaded = 0; threaded < 2; ++threaded) {
+        ogde::graphics::OcclusionCuller culler(256, 128);
+        culler.setJobSystem(threaded ? &jobs : nullptr);
+        uint32_t visibleCount = 0;
+
+        double rasterMs = measureBestMs(20, [&]() {
+            culler.beginFrame(camera);
+            for (uint32_t b = 0; b < buildingCount; ++b) {
+                const float* bounds = &buildings[b * 6];
+                culler.addOccluderBox(bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5]);
+            }
+            culler.rasterize();
+        });
+        double testMs = measureBestMs(20, [&]() {
+            visibleCount = culler.testAabbs(boxes, candidates.data(), candidateCount, visible.data());
+        });
+
+        std::printf("  %s (%u threads)\n", threaded ? "threaded" : "serial", threaded ? jobs.getThreadCount() : 1);
+        std::printf("    rasterize: %u occluder triangles, %.3f ms\n",
+                    culler.getStats().rasterizedTriangles, rasterMs);
+        std::printf("    test:      %u in frustum, %u visible, %.3f ms\n", candidateCount, visibleCount, testMs);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Mip generation
+// ---------------------------------------------------------------------------
+
+void benchMipGeneration() {
+    const int size = 4096;
+
+    // Smooth gradients with noise, roughly like a photographic albedo map
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> noise(-12, 12);
+    std::vector<uint8_t> base(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            uint8_t* p = &base[(static_cast<size_t>(y) * size + x) * 4];
+            p[0] = static_cast<uint8_t>(std::min(255, std::max(0, (x >> 4) + noise(rng))));
+            p[1] = static_cast<uint8_t>(std::min(255, std::max(0, (y >> 4) + noise(rng))));
+            p[2] = static_cast<uint8_t>(std::min(255, std::max(0, ((x + y) >> 5) + noise(rng))));
+            p[3] = 255;
+        }
+    }
+
+    std::vector<uint8_t> pixels;
+    std::vector<OGDE::Graphics::MipLevel> levels;
+    const double megapixels = static_cast<double>(size) * size / 1e6;
+
+    struct Variant {
+        const char* name;
+        OGDE::Graphics::MipFilter filter;
+        bool srgb;
+    };
+    const Variant variants[] = {
+        { "box linear", OGDE::Graphics::MipFilter::Box, false },
+        { "box sRGB", OGDE::Graphics::MipFilter::Box, true },
+        { "kaiser sRGB", OGDE::Graphics::MipFilter::Kaiser, true },
+    };
+
+    std::printf("  %dx%d RGBA, full chain\n", size, size);
+    for (const Variant& variant : variants) {
+        OGDE::Graphics::MipSettings settings;
+        settings.filter = variant.filter;
+        settings.srgb = variant.srgb;
+        double serialMs = measureBestMs(3, [&]() {
+            OGDE::Graphics::MipGenerator::GenerateChain(base.data(), size, size, 4, settings, pixels, levels);
+        });
+        settings.jobSystem = &ogde::core::JobSystem::shared();
+        double threadedMs = measureBestMs(3, [&]() {
+            OGDE::Graphics::MipGenerator::GenerateChain(base.data(), size, size, 4, settings, pixels, levels);
+        });
+        std::printf("  %-12s %8.2f ms (%6.1f MP/s), %u threads: %8.2f ms\n", variant.name, serialMs,
+                    megapixels / (serialMs / 1000.0), settings.jobSystem->getThreadCount(), threadedMs);
+    }
+
+    // Reference: straightforward per-pixel sRGB box filter with pow() per sample
+    std::vector<uint8_t> level1(static_cast<size_t>(size / 2) * (size / 2) * 4);
+    double naiveMs = measureBestMs(1, [&]() {
+        auto toLinear = [](uint8_t v) {
+            double c = v / 255.0;
+            return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+        };
+        for (int y = 0; y < size / 2; ++y) {
+            for (int x = 0; x < size / 2; ++x) {
+                for (int c = 0; c < 4; ++c) {
+                    const uint8_t* p = &base[((static_cast<size_t>(y) * 2) * size + x * 2) * 4 + c];
+                    double sum = toLinear(p[0]) + toLinear(p[4]) + toLinear(p[size * 4]) + toLinear(p[size * 4 + 4]);
+                    double l = sum * 0.25;
+                    double e = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+                    level1[(static_cast<size_t>(y) * (size / 2) + x) * 4 + c] = static_cast<uint8_t>(e * 255.0 + 0.5);
+                }
+            }
+        }
+    });
+    std::printf("  naive sRGB box, first level only: %.2f ms\n", naiveMs);
+}
+
+// ---------------------------------------------------------------------------
+// Block compression
+// ---------------------------------------------------------------------------
+
+void benchBlockCompression() {
+    const int size = 1024;
+
+    // Gradients, noise, hard edges and an alpha ramp
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> noise(-10, 10);
+    std::vector<uint8_t> rgba(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            uint8_t* p = &rgba[(static_cast<size_t>(y) * size + x) * 4];
+            int edge = ((x / 37 + y / 23) & 1) ? 60 : 0;
+            p[0] = static_cast<uint8_t>(std::min(255, std::max(0, (x >> 2) + noise(rng))));
+            p[1] = static_cast<uint8_t>(std::min(255, std::max(0, (y >> 2) + edge + noise(rng) - 30)));
+            p[2] = static_cast<uint8_t>(std::min(255, std::max(0, ((x + y) >> 3) + edge)));
+            p[3] = static_cast<uint8_t>(x >> 2);
+        }
+    }
+
+    struct Variant {
+        const char* name;
+        OGDE::Graphics::BlockFormat format;
+    };
+    const Variant formats[] = {
+        { "BC1", OGDE::Graphics::BlockFormat::BC1 },
+        { "BC3", OGDE::Graphics::BlockFormat::BC3 },
+        { "BC4", OGDE::Graphics::BlockFormat::BC4 },
+        { "BC5", OGDE::Graphics::BlockFormat::BC5 },
+        { "BC7", OGDE::Graphics::BlockFormat::BC7 },
+    };
+    const char* qualityNames[] = { "fast", "normal", "high" };
+    const double megapixels = static_cast<double>(size) * size / 1e6;
+
+    std::vector<uint8_t> decoded(rgba.size());
+    ogde::core::JobSystem& jobs = ogde::core::JobSystem::shared();
+    std::printf("  %dx%d RGBA, %u threads\n", size, size, jobs.getThreadCount());
+    for (const Variant& variant : formats) {
+        std::vector<uint8_t> blocks(OGDE::Graphics::BlockCompressor::GetCompressedSize(variant.format, size, size));
+        for (int q = 0; q < 3; ++q) {
+            OGDE::Graphics::CompressionSettings settings;
+            settings.format = variant.format;
+            settings.quality = static_cast<OGDE::Graphics::CompressionQuality>(q);
+            double serialMs = measureBestMs(2, [&]() {
+                OGDE::Graphics::BlockCompressor::Encode(rgba.data(), size, size, 4, settings, blocks.data());
+            });
+            settings.jobSystem = &jobs;
+            double threadedMs = measureBestMs(2, [&]() {
+                OGDE::Graphics::BlockCompressor::Encode(rgba.data(), size, size, 4, settings, blocks.data());
+            });
+            OGDE::Graphics::BlockCompressor::Decode(blocks.data(), size, size, variant.format, decoded.data());
+            double psnr = OGDE::Graphics::BlockCompressor::ComputePsnr(
+                rgba.data(), decoded.data(), size, size, OGDE::Graphics::BlockCompressor::GetChannelCount(variant.format));
+            std::printf("  %s %-6s %8.2f ms (%6.1f MP/s), threaded %8.2f ms, PSNR %.2f dB\n", variant.name,
+                        qualityNames[q], serialMs, megapixels / (serialMs / 1000.0), threadedMs, psnr);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Texture loading: decode + mip generation vs a mapped .ogtex container
+// ---------------------------------------------------------------------------
+
+void benchTextureLoad() {
+    const int size = 2048;
+    std::vector<uint8_t> rgba(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            uint8_t* p = &rgba[(static_cast<size_t>(y) * size + x) * 4];
+            p[0] = static_cast<uint8_t>(x >> 3);
+            p[1] = static_cast<uint8_t>(y >> 3);
+            p[2] = static_cast<uint8_t>(((x / 64 + y / 64) & 1) ? 200 : 40);
+            p[3] = 255;
+        }
+    }
+
+    // Uncompressed 32-bit TGA (bottom-up BGRA) as the stb_image source
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string tgaPath = (dir / "ogde_bench.tga").string();
+    const std::string ogtexPath = (dir / "ogde_bench.ogtex").string();
+    {
+        uint8_t header[18] = {};
+        header[2] = 2;
+        header[12] = size & 0xFF;
+        header[13] = size >> 8;
+        header[14] = size & 0xFF;
+        header[15] = size >> 8;
+        header[16] = 32;
+        header[17] = 8;
+        std::vector<uint8_t> bgra(rgba.size());
+        for (size_t i = 0; i < rgba.size(); i += 4) {
+            bgra[i + 0] = rgba[i + 2];
+            bgra[i + 1] = rgba[i + 1];
+            bgra[i + 2] = rgba[i + 0];
+            bgra[i + 3] = rgba[i + 3];
+        }
+        std::ofstream tga(tgaPath, std::ios::binary);
+        tga.write(reinterpret_cast<const char*>(header), sizeof(header));
+        tga.write(reinterpret_cast<const char*>(bgra.data()), static_cast<std::streamsize>(bgra.size()));
+    }
+
+    OGDE::Graphics::Texture source;
+    source.LoadFromMemory(rgba.data(), size, size, 4);
+    source.GenerateMipmaps();
+    OGDE::Graphics::TextureContainer::Write(ogtexPath, source);
+
+    OGDE::Graphics::MipSettings settings;
+    settings.jobSystem = &ogde::core::JobSystem::shared();
+    double decodeMs = measureBestMs(3, [&]() {
+        OGDE::Graphics::Texture texture;
+        texture.LoadFromFile(tgaPath);
+        texture.GenerateMipmaps(settings);
+    });
+
+    double mapMs = measureBestMs(3, [&]() {
+        OGDE::Graphics::Texture texture;
+        texture.LoadFromFile(ogtexPath);
+    });
+
+    // Mapping is lazy; include reading every byte once to show the page-in cost
+    uint64_t checksum = 0;
+    double touchMs = measureBestMs(3, [&]() {
+        OGDE::Graphics::Texture texture;
+        texture.LoadFromFile(ogtexPath);
+        const OGDE::Graphics::MipLevel& last = texture.GetMipLevel(texture.GetMipLevelCount() - 1);
+        const uint8_t* data = texture.GetData();
+        for (size_t i = 0; i < last.offset + last.size; i += 64) {
+            checksum += data[i];
+        }
+    });
+
+    std::printf("  %dx%d RGBA with %d mips\n", size, size, source.GetMipLevelCount());
+    std::printf("  stb_image TGA + mips: %8.2f ms\n", decodeMs);
+    std::printf("  .ogtex map:           %8.3f ms (%.0fx)\n", mapMs, decodeMs / mapMs);
+    std::printf("  .ogtex map + read:    %8.2f ms (checksum %llu)\n", touchMs,
+                static_cast<unsigned long long>(checksum));
+
+    std::filesystem::remove(tgaPath);
+    std::filesystem::remove(ogtexPath);
+}
+
+// ---------------------------------------------------------------------------
+// Pixel format conversion
+// ---------------------------------------------------------------------------
+
+void benchPixelConversion() {
+    const size_t count = 2048 * 2048;
+    std::mt19937 rng(11);
+    std::vector<uint8_t> rgb(count * 3), rgba(count * 4), out(count * 4);
+    for (uint8_t& value : rgb) {
+        value = static_cast<uint8_t>(rng());
+    }
+    for (uint8_t& value : rgba) {
+        value = static_cast<uint8_t>(rng());
+    }
+    std::vector<float> floats(count * 4);
+    const double megapixels = count / 1e6;
+    auto report = [&](const char* name, double scalarMs, double simdMs) {
+        std::printf("  %-22s scalar %7.2f ms, SIMD %7.2f ms (%5.0f MP/s, %.1fx)\n", name, scalarMs, simdMs,
+                    megapixels / (simdMs / 1000.0), scalarMs / simdMs);
+    };
+
+    // The per-pixel loop Texture::InitializeD3D11 used before
+    double scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            out[i * 4 + 0] = rgb[i * 3 + 0];
+            out[i * 4 + 1] = rgb[i * 3 + 1];
+            out[i * 4 + 2] = rgb[i * 3 + 2];
+            out[i * 4 + 3] = 255;
+        }
+    });
+    double simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::RgbToRgba(rgb.data(), out.data(), count);
+    });
+    report("RGB -> RGBA", scalarMs, simdMs);
+
+    double inPlaceMs = measureBestMs(5, [&]() {
+        std::copy(rgb.begin(), rgb.end(), out.begin());
+        OGDE::Graphics::PixelConverter::RgbToRgbaInPlace(out.data(), count);
+    });
+    double copyMs = measureBestMs(5, [&]() { std::copy(rgb.begin(), rgb.end(), out.begin()); });
+    report("RGB -> RGBA in place", scalarMs, inPlaceMs - copyMs);
+
+    scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            out[i * 4 + 0] = rgba[i * 4 + 2];
+            out[i * 4 + 1] = rgba[i * 4 + 1];
+            out[i * 4 + 2] = rgba[i * 4 + 0];
+            out[i * 4 + 3] = rgba[i * 4 + 3];
+        }
+    });
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::SwizzleRgbaBgra(rgba.data(), out.data(), count);
+    });
+    report("RGBA <-> BGRA", scalarMs, simdMs);
+
+    scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t alpha = rgba[i * 4 + 3];
+            for (int c = 0; c < 3; ++c) {
+                out[i * 4 + c] = static_cast<uint8_t>((rgba[i * 4 + c] * alpha + 127) / 255);
+            }
+            out[i * 4 + 3] = static_cast<uint8_t>(alpha);
+        }
+    });
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::PremultiplyAlpha(rgba.data(), out.data(), count);
+    });
+    report("premultiply alpha", scalarMs, simdMs);
+
+    scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count * 4; ++i) {
+            floats[i] = rgba[i] / 255.0f;
+        }
+    });
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::UnormToFloat(rgba.data(), floats.data(), count * 4);
+    });
+    report("unorm8 -> float", scalarMs, simdMs);
+
+    scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count * 4; ++i) {
+            out[i] = static_cast<uint8_t>(std::min(1.0f, std::max(0.0f, floats[i])) * 255.0f + 0.5f);
+        }
+    });
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::FloatToUnorm(floats.data(), out.data(), count * 4);
+    });
+    report("float -> unorm8", scalarMs, simdMs);
+
+    scalarMs = measureBestMs(5, [&]() {
+        for (size_t i = 0; i < count * 4; ++i) {
+            float c = rgba[i] / 255.0f;
+            floats[i] = (i & 3) == 3 ? c : (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f));
+        }
+    });
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::SrgbToLinear(rgba.data(), floats.data(), count, 4);
+    });
+    report("sRGB -> linear float", scalarMs, simdMs);
+
+    simdMs = measureBestMs(5, [&]() {
+        OGDE::Graphics::PixelConverter::LinearToSrgb(floats.data(), out.data(), count, 4);
+    });
+    std::printf("  %-22s                   SIMD %7.2f ms (%5.0f MP/s)\n", "linear float -> sRGB", simdMs,
+                megapixels / (simdMs / 1000.0));
+}
+
+// ---------------------------------------------------------------------------
+// Image decoding: in-tree PNG / QOI vs stb_image on the same files
+// ---------------------------------------------------------------------------
+
+uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+void putBigEndian32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// zlib stream with greedy LZ77 (one hash candidate) and fixed Huffman codes;
+// enough to give the decoders realistic literal / match mixes
+std::vector<uint8_t> deflateFixed(const std::vector<uint8_t>& data) {
+    static const uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                             35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const uint16_t distBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+                                           513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    std::vector<uint8_t> out = { 0x78, 0x01 };
+    uint64_t bits = 0;
+    int count = 0;
+    auto put = [&](uint32_t value, int length) {
+        bits |= static_cast<uint64_t>(value) << count;
+        count += length;
+        while (count >= 8) {
+            out.push_back(static_cast<uint8_t>(bits));
+            bits >>= 8;
+            count -= 8;
+        }
+    };
+    auto putCode = [&](uint32_t code, int length) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < length; ++i) {
+            reversed = (reversed << 1) | ((code >> i) & 1);
+        }
+        put(reversed, length);
+    };
+    auto putSymbol = [&](int symbol) {
+        if (symbol < 144) {
+            putCode(0x30 + symbol, 8);
+        } else if (symbol < 256) {
+            putCode(0x190 + symbol - 144, 9);
+        } else if (symbol < 280) {
+            putCode(symbol - 256, 7);
+        } else {
+            putCode(0xC0 + symbol - 280, 8);
+        }
+    };
+
+    put(1, 1);  // Final block
+    put(1, 2);  // Fixed Huffman
+    std::vector<int64_t> head(1 << 16, -1);
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t bestLength = 0;
+        size_t distance = 0;
+        if (i + 3 <= data.size()) {
+            uint32_t hash = ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> 16;
+            int64_t candidate = head[hash];
+            head[hash] = static_cast<int64_t>(i);
+            if (candidate >= 0 && i - candidate <= 32768) {
+                size_t maxLength = std::min<size_t>(258, data.size() - i);
+                while (bestLength < maxLength && data[candidate + bestLength] == data[i + bestLength]) {
+                    ++bestLength;
+                }
+                distance = i - candidate;
+            }
+        }
+        if (bestLength < 3) {
+            putSymbol(data[i++]);
+            continue;
+        }
+        int lengthCode = 28;
+        while (lengthBase[lengthCode] > bestLength) {
+            --lengthCode;
+        }
+        putSymbol(257 + lengthCode);
+        put(static_cast<uint32_t>(bestLength - lengthBase[lengthCode]), lengthCode < 8 || lengthCode == 28 ? 0 : (lengthCode - 4) / 4);
+        int distCode = 29;
+        while (distBase[distCode] > distance) {
+            --distCode;
+        }
+        putCode(distCode, 5);
+        put(static_cast<uint32_t>(distance - distBase[distCode]), distCode < 4 ? 0 : (distCode - 2) / 2);
+        i += bestLength;
+    }
+    putSymbol(256);
+    put(0, 7);  // Flush to a byte boundary
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (uint8_t value : data) {
+        a = (a + value) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBigEndian32(out, (b << 16) | a);
+    return out;
+}
+
+// Every row Paeth-filtered, as PNG encoders typically choose for photos
+std::vector<uint8_t> encodePng(const std::vector<uint8_t>& pixels, int width, int height, int channels) {
+    const size_t stride = static_cast<size_t>(width) * channels;
+    std::vector<uint8_t> filtered;
+    filtered.reserve((stride + 1) * height);
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* row = &pixels[y * stride];
+        const uint8_t* prev = y > 0 ? row - stride : nullptr;
+        filtered.push_back(4);
+        for (size_t i = 0; i < stride; ++i) {
+            int a = i >= static_cast<size_t>(channels) ? row[i - channels] : 0;
+            int b = prev ? prev[i] : 0;
+            int c = prev && i >= static_cast<size_t>(channels) ? prev[i - channels] : 0;
+            int pa = std::abs(b - c), pb = std::abs(a - c), pc = std::abs(a + b - 2 * c);
+            int predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            filtered.push_back(static_cast<uint8_t>(row[i] - predictor));
+        }
+    }
+
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    auto chunk = [&](const char* type, const std::vector<uint8_t>& body) {
+        putBigEndian32(png, static_cast<uint32_t>(body.size()));
+        size_t start = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), body.begin(), body.end());
+        putBigEndian32(png, crc32(&png[start], png.size() - start));
+    };
+    std::vector<uint8_t> header;
+    putBigEndian32(header, static_cast<uint32_t>(width));
+    putBigEndian32(header, static_cast<uint32_t>(height));
+    header.insert(header.end(), { 8, static_cast<uint8_t>(channels == 4 ? 6 : 2), 0, 0, 0 });
+    chunk("IHDR", header);
+    chunk("IDAT", deflateFixed(filtered));
+    chunk("IEND", {});
+    return png;
+}
+
+std::vector<uint8_t> encodeQoi(const std::vector<uint8_t>& pixels, int width, int height, int channels) {
+    std::vector<uint8_t> out = { 'q', 'o', 'i', 'f' };
+    putBigEndian32(out, static_cast<uint32_t>(width));
+    putBigEndian32(out, static_cast<uint32_t>(height));
+    out.push_back(static_cast<uint8_t>(channels));
+    out.push_back(0);
+
+    uint8_t index[64][4] = {};
+    uint8_t prev[4] = { 0, 0, 0, 255 };
+    int run = 0;
+    const size_t count = static_cast<size_t>(width) * height;
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t px[4] = { pixels[i * channels], pixels[i * channels + 1], pixels[i * channels + 2],
+                          channels == 4 ? pixels[i * channels + 3] : prev[3] };
+        if (std::equal(px, px + 4, prev)) {
+            if (++run == 62 || i + 1 == count) {
+                out.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            out.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+            run = 0;
+        }
+        int hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+        if (std::equal(px, px + 4, index[hash])) {
+            out.push_back(static_cast<uint8_t>(hash));
+        } else {
+            std::copy(px, px + 4, index[hash]);
+            int dr = static_cast<int8_t>(px[0] - prev[0]);
+            int dg = static_cast<int8_t>(px[1] - prev[1]);
+            int db = static_cast<int8_t>(px[2] - prev[2]);
+            if (px[3] != prev[3]) {
+                out.insert(out.end(), { 0xFF, px[0], px[1], px[2], px[3] });
+            } else if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                out.push_back(static_cast<uint8_t>(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+            } else if (dg >= -32 && dg <= 31 && dr - dg >= -8 && dr - dg <= 7 && db - dg >= -8 && db - dg <= 7) {
+                out.push_back(static_cast<uint8_t>(0x80 | (dg + 32)));
+                out.push_back(static_cast<uint8_t>((dr - dg + 8) << 4 | (db - dg + 8)));
+            } else {
+                out.insert(out.end(), { 0xFE, px[0], px[1], px[2] });
+            }
+        }
+        std::copy(px, px + 4, prev);
+    }
+    out.insert(out.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+    return out;
+}
+
+void benchImageDecode() {
+    const int size = 2048;
+    std::mt19937 rng(5);
+
+    // Noisy gradients (photo-like) and flat tiles (UI / block art)
+    struct Source {
+        const char* name;
+        int channels;
+        std::vector<uint8_t> pixels;
+    };
+    Source sources[] = { { "photo RGBA", 4, {} }, { "photo RGB", 3, {} }, { "tiles RGBA", 4, {} } };
+    for (Source& source : sources) {
+        source.pixels.resize(static_cast<size_t>(size) * size * source.channels);
+        const bool tiles = source.name[0] == 't';
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                uint8_t* p = &source.pixels[(static_cast<size_t>(y) * size + x) * source.channels];
+                for (int c = 0; c < source.channels; ++c) {
+                    int value = tiles ? ((x / 32 * 7 + y / 32 * 13 + c * 40) & 0xFF)
+                                      : (x / 8 + y / 12 + c * 50 + static_cast<int>(rng() % 7));
+                    p[c] = static_cast<uint8_t>(c == 3 && !tiles ? 255 - (x >> 4) : value);
+                }
+            }
+        }
+    }
+
+    std::printf("  %dx%d, best of 5; MP/s of decoded pixels\n", size, size);
+    const double megapixels = size * static_cast<double>(size) / 1e6;
+    for (const Source& source : sources) {
+        const std::vector<uint8_t> png = encodePng(source.pixels, size, size, source.channels);
+        const std::vector<uint8_t> qoi = encodeQoi(source.pixels, size, size, source.channels);
+
+        OGDE::Graphics::ImageInfo info;
+        OGDE::Graphics::ImageDecoder::ReadInfo(png.data(), png.size(), info);
+        const size_t outSize = source.pixels.size();
+        bool match = true;
+
+        double stbMs = measureBestMs(5, [&]() {
+            int width, height, channels;
+            stbi_uc* pixels = stbi_load_from_memory(png.data(), static_cast<int>(png.size()), &width, &height, &channels, 0);
+            match = match && pixels && std::equal(pixels, pixels + outSize, source.pixels.begin());
+            stbi_image_free(pixels);
+        });
+        double pngMs = measureBestMs(5, [&]() {
+            std::unique_ptr<uint8_t[]> pixels(new uint8_t[outSize]);
+            match = match && OGDE::Graphics::ImageDecoder::Decode(png.data(), png.size(), pixels.get()) &&
+                    std::equal(pixels.get(), pixels.get() + outSize, source.pixels.begin());
+        });
+        double qoiMs = measureBestMs(5, [&]() {
+            std::unique_ptr<uint8_t[]> pixels(new uint8_t[outSize]);
+            match = match && OGDE::Graphics::ImageDecoder::Decode(qoi.data(), qoi.size(), pixels.get()) &&
+                    std::equal(pixels.get(), pixels.get() + outSize, source.pixels.begin());
+        });
+
+        std::printf("  %-10s PNG %5.2f MB: stb %7.2f ms (%5.0f MP/s), in-tree %7.2f ms (%5.0f MP/s, %.1fx)%s\n",
+                    source.name, png.size() / 1e6, stbMs, megapixels / (stbMs / 1000.0), pngMs,
+                    megapixels / (pngMs / 1000.0), stbMs / pngMs, match ? "" : " MISMATCH");
+        std::printf("  %-10s QOI %5.2f MB: in-tree %7.2f ms (%5.0f MP/s)\n", "", qoi.size() / 1e6, qoiMs,
+                    megapixels / (qoiMs / 1000.0));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Material instances
+// ---------------------------------------------------------------------------
+
+void benchMaterialInstances() {
+    const int variantCount = 10000;
+
+    OGDE::Graphics::Material material;
+    material.SetName("brick_wall_base");
+    for (int i = 0; i < 4; ++i) {
+        material.SetTexture(static_cast<OGDE::Graphics::Material::TextureType>(i),
+                            std::make_shared<OGDE::Graphics::Texture>());
+    }
+    OGDE::Graphics::MaterialTable table;
+    OGDE::Graphics::MaterialHandle base = table.Import(material,
+        [](const std::shared_ptr<OGDE::Graphics::Texture>&) { return OGDE::Graphics::TextureHandle(1); });
+
+    std::vector<OGDE::Graphics::Material> copies;
+    std::vector<OGDE::Graphics::MaterialInstance> instances;
+    double copyMs = measureBestMs(5, [&]() {
+        copies.clear();
+        copies.reserve(variantCount);
+        for (int i = 0; i < variantCount; ++i) {
+            copies.push_back(material);
+            copies.back().SetDiffuseColor(i / float(variantCount), 0.5f, 0.5f);
+        }
+    });
+    double instanceMs = measureBestMs(5, [&]() {
+        instances.clear();
+        instances.reserve(variantCount);
+        for (int i = 0; i < variantCount; ++i) {
+            instances.emplace_back(table, base);
+            instances.back().SetDiffuseColor(i / float(variantCount), 0.5f, 0.5f);
+        }
+    });
+    std::printf("  create %d tinted variants: Material copy %6.2f ms, instance %6.2f ms (%.1fx)\n",
+                variantCount, copyMs, instanceMs, copyMs / instanceMs);
+
+    float sink = 0.0f;
+    double rebuildMs = measureBestMs(5, [&]() {
+        table.SetOpacity(base, 1.0f);
+        for (const OGDE::Graphics::MaterialInstance& instance : instances) {
+            sink += instance.Resolve().diffuseColor[0];
+        }
+    });
+    double cachedMs = measureBestMs(5, [&]() {
+        for (const OGDE::Graphics::MaterialInstance& instance : instances) {
+            sink += instance.Resolve().diffuseColor[0];
+        }
+    });
+    std::printf("  resolve all: after parent edit %6.3f ms, cached %6.3f ms (sink %.0f)\n",
+                rebuildMs, cachedMs, sink);
+}
+
+// ---------------------------------------------------------------------------
+// Render queue
+// ---------------------------------------------------------------------------
+
+// Counts what the queue emits, standing in for a backend
+class CountingSink : public ogde::graphics::RenderQueueSink {
+public:
+    void bindPass(uint32_t) override { ++binds; }
+    void bindShader(uint32_t) override { ++binds; }
+    void bindMaterial(uint32_t) override { ++binds; }
+    void bindGeometry(uint32_t) override { ++binds; }
+    void draw(const ogde::graphics::DrawItem&) override { ++draws; }
+
+    uint64_t binds = 0;
+    uint64_t draws = 0;
+};
+
+void benchRenderQueue() {
+    const uint32_t itemCount = 1000000;
+    using ogde::graphics::RenderQueue;
+
+    // A scene-like mix: 4 passes, 64 shaders, 2048 materials, 4096 meshes, random depth
+    std::mt19937 rng(41);
+    std::vector<ogde::graphics::DrawItem> items(itemCount);
+    for (uint32_t i = 0; i < itemCount; ++i) {
+        ogde::graphics::DrawItem& item = items[i];
+        item.pass = rng() % 4;
+        item.shader = rng() % 64;
+        item.material = item.shader * 32 + rng() % 32;
+        item.geometry = rng() % 4096;
+        item.vertexCount = 36;
+        item.userData = i;
+        const float depth = (rng() & 0xFFFFFF) / float(0x1000000);
+        item.key = item.pass == 3
+            ? ogde::graphics::RenderKey::translucent(item.pass, 0, item.shader, item.material, depth)
+            : ogde::graphics::RenderKey::opaque(item.pass, 0, item.shader, item.material, depth);
+    }
+
+    RenderQueue queue;
+    queue.reserve(itemCount);
+    double addMs = measureBestMs(5, [&]() {
+        queue.clear();
+        for (const ogde::graphics::DrawItem& item : items) {
+            queue.add(item);
+        }
+    });
+
+    std::vector<RenderQueue::SortEntry> unsorted(itemCount), entries, scratch;
+    for (uint32_t i = 0; i < itemCount; ++i) {
+        unsorted[i] = { items[i].key, i, 0 };
+    }
+    double stdMs = measureBestMs(5, [&]() {
+        entries = unsorted;
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const RenderQueue::SortEntry& a, const RenderQueue::SortEntry& b) { return a.key < b.key; });
+    });
+    double copyMs = measureBestMs(5, [&]() {
+        entries = unsorted;
+    });
+    double radixMs = measureBestMs(5, [&]() {
+        entries = unsorted;
+        RenderQueue::radixSort(entries, scratch);
+    });
+    std::printf("  sort %u keys: std::stable_sort %7.2f ms, radix %6.2f ms (%.1fx, %.0f M keys/s)\n",
+                itemCount, stdMs - copyMs, radixMs - copyMs, (stdMs - copyMs) / (radixMs - copyMs),
+                itemCount / ((radixMs - copyMs) * 1000.0));
+
+    queue.sort();
+    CountingSink unsortedSink, sortedSink;
+    for (size_t i = 0; i + 1 < items.size(); ++i) {
+        // State changes if submitted in the original order
+        const ogde::graphics::DrawItem& a = items[i];
+        const ogde::graphics::DrawItem& b = items[i + 1];
+        unsortedSink.binds += (a.pass != b.pass) ? 4 : (a.shader != b.shader) + (a.material != b.material) +
+                                                       (a.geometry != b.geometry);
+    }
+    double submitMs = measureBestMs(5, [&]() {
+        sortedSink = CountingSink();
+        queue.submit(sortedSink);
+    });
+    std::printf("  add %6.2f ms, submit %6.2f ms; binds unsorted %llu, sorted %llu\n", addMs, submitMs,
+                static_cast<unsigned long long>(unsortedSink.binds),
+                static_cast<unsigned long long>(sortedSink.binds));
+}
+
+// ---------------------------------------------------------------------------
+// Software rasterizer
+// ---------------------------------------------------------------------------
+
+void benchSoftwareRasterizer() {
+    const uint32_t width = 1280;
+    const uint32_t height = 720;
+
+    // A 40x40 field of 36-triangle cubes in front of the camera (57.6K triangles)
+    std::vector<float> vertices;
+    const float corners[8][3] = { {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1},
+                                  {-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1} };
+    const int faces[12][3] = { {0, 1, 2}, {0, 2, 3}, {4, 6, 5}, {4, 7, 6}, {0, 4, 5}, {0, 5, 1},
+                               {3, 2, 6}, {3, 6, 7}, {0, 3, 7}, {0, 7, 4}, {1, 5, 6}, {1, 6, 2} };
+    for (int gz = 0; gz < 40; ++gz) {
+        for (int gx = 0; gx < 40; ++gx) {
+            for (int repeat = 0; repeat < 3; ++repeat) {
+                const float cx = (gx - 20) * 3.0f + repeat * 0.7f;
+                const float cz = 5.0f + gz * 3.0f + repeat * 0.5f;
+                for (const auto& face : faces) {
+                    for (int corner : face) {
+                        vertices.push_back(cx + corners[corner][0] * 0.6f);
+                        vertices.push_back(-2.0f + corners[corner][1] * 0.6f + repeat * 0.8f);
+                        vertices.push_back(cz + corners[corner][2] * 0.6f);
+                    }
+                }
+            }
+        }
+    }
+    const uint32_t vertexCount = static_cast<uint32_t>(vertices.size() / 3);
+
+    ogde::graphics::Camera camera;
+    camera.setPerspective(70.0f, float(width) / height, 0.5f, 500.0f);
+    camera.lookAt(0.0f, 4.0f, -4.0f, 0.0f, -2.0f, 40.0f);
+    camera.update();
+
+    ogde::graphics::RendererSoftware renderer;
+    renderer.initialize(width, height);
+    renderer.setViewProjection(camera.getViewProjectionMatrix());
+    renderer.setVertexBuffer(renderer.createVertexBuffer(vertices.data(), vertexCount));
+
+    auto frame = [&]() {
+        renderer.beginFrame();
+        renderer.clear(0.1f, 0.1f, 0.15f, 1.0f);
+        renderer.draw(vertexCount);
+        renderer.endFrame();
+    };
+
+    renderer.setJobSystem(nullptr);
+    double serialMs = measureBestMs(5, frame);
+    renderer.setJobSystem(&ogde::core::JobSystem::shared());
+    double parallelMs = measureBestMs(5, frame);
+    const ogde::graphics::SoftwareRenderStats& stats = renderer.getStats();
+
+    std::printf("  %ux%u, %u triangles (%u rasterized, %u tile bins, %.1f M pixels written)\n",
+                width, height, vertexCount / 3, stats.trianglesRasterized, stats.tileBinEntries,
+                stats.pixelsWritten / 1e6);
+    std::printf("  frame: 1 thread %7.2f ms (%.1f M tris/s), %u threads %7.2f ms (%.1fx)\n",
+                serialMs, vertexCount / 3 / (serialMs * 1000.0),
+                ogde::core::JobSystem::shared().getThreadCount(), parallelMs, serialMs / parallelMs);
+}
+
+// ---------------------------------------------------------------------------
+// Instanced batching
+// ---------------------------------------------------------------------------
+
+void benchInstancing() {
+    const uint32_t propCount = 200000;
+
+    // A forest: 16 meshes x 8 materials, props queued in random order
+    std::mt19937 rng(46);
+    ogde::graphics::RenderQueue queue;
+    queue.reserve(propCount);
+    for (uint32_t i = 0; i < propCount; ++i) {
+        ogde::graphics::DrawItem item;
+        item.geometry = rng() % 16;
+        item.material = rng() % 8;
+        item.key = ogde::graphics::RenderKey::instanced(0, 0, 0, item.material, item.geometry);
+        item.indexCount = 1500;
+        item.userData = i;
+        queue.add(item);
+    }
+    queue.sort();
+
+    ogde::graphics::CommandBuffer perDraw, instanced;
+    std::vector<uint32_t> instanceIds;
+    ogde::graphics::RenderQueueStats plainStats, batchStats;
+    double plainMs = measureBestMs(5, [&]() {
+        perDraw.clear();
+        plainStats = queue.submit(perDraw);
+    });
+    double batchMs = measureBestMs(5, [&]() {
+        instanced.clear();
+        batchStats = queue.submitInstanced(instanced, instanceIds);
+    });
+    std::printf("  %u props: per-draw %6.2f ms, %u draws, %.1f MB of commands\n", propCount, plainMs,
+                plainStats.draws, perDraw.getSize() / (1024.0 * 1024.0));
+    std::printf("  instanced %6.2f ms, %u draws, %.1f KB of commands + %.1f KB of instance ids\n", batchMs,
+                batchStats.draws, instanced.getSize() / 1024.0, instanceIds.size() * sizeof(uint32_t) / 1024.0);
+}
+
+// ---------------------------------------------------------------------------
+// OBJ loading
+// ---------------------------------------------------------------------------
+
+// Line-by-line loader as commonly written: getline, strtof, a map keyed on the corner text
+size_t loadObjNaive(const std::string& path) {
+    std::ifstream file(path);
+    std::vector<float> positions, texCoords, normals;
+    std::vector<OGDE::Graphics::MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+    std::unordered_map<std::string, uint32_t> corners;
+    std::string line;
+    while (std::getline(file, line)) {
+        const char* p = line.c_str();
+        char* end = nullptr;
+        if (line.compare(0, 2, "v ") == 0) {
+            for (int i = 0, offset = 2; i < 3; ++i, offset = static_cast<int>(end - line.c_str())) {
+                positions.push_back(std::strtof(p + offset, &end));
+            }
+        } else if (line.compare(0, 3, "vt ") == 0) {
+            texCoords.push_back(std::strtof(p + 3, &end));
+            texCoords.push_back(std::strtof(end, &end));
+        } else if (line.compare(0, 3, "vn ") == 0) {
+            normals.push_back(std::strtof(p + 3, &end));
+            normals.push_back(std::strtof(end, &end));
+            normals.push_back(std::strtof(end, &end));
+        } else if (line.compare(0, 2, "f ") == 0) {
+            std::vector<uint32_t> polygon;
+            size_t start = 2;
+            while (start < line.size()) {
+                size_t stop = line.find(' ', start);
+                stop = stop == std::string::npos ? line.size() : stop;
+                const std::string token = line.substr(start, stop - start);
+                start = stop + 1;
+                auto it = corners.find(token);
+                if (it == corners.end()) {
+                    const long v = std::strtol(token.c_str(), &end, 10);
+                    const long vt = std::strtol(end + 1, &end, 10);
+                    const long vn = std::strtol(end + 1, &end, 10);
+                    OGDE::Graphics::MeshVertex vertex;
+                    std::copy_n(&positions[(v - 1) * 3], 3, vertex.position);
+                    std::copy_n(&normals[(vn - 1) * 3], 3, vertex.normal);
+                    std::copy_n(&texCoords[(vt - 1) * 2], 2, vertex.texCoord);
+                    it = corners.emplace(token, static_cast<uint32_t>(vertices.size())).first;
+                    vertices.push_back(vertex);
+                }
+                polygon.push_back(it->second);
+            }
+            for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                indices.insert(indices.end(), { polygon[0], polygon[i], polygon[i + 1] });
+            }
+        }
+    }
+    return indices.size() / 3;
+}
+
+void benchObjLoader() {
+    const int columns = 1200;
+    const int rows = 1000;
+
+    // A displaced grid with per-vertex vt and vn, as exported by DCC tools
+    const std::filesystem::path dir = std::filesystem::temp_directory_path();
+    const std::string objPath = (dir / "ogde_bench.obj").string();
+    const std::string meshPath = (dir / "ogde_bench.ogmesh").string();
+    {
+        std::string text;
+        char line[128];
+        for (int y = 0; y <= rows; ++y) {
+            for (int x = 0; x <= columns; ++x) {
+                const float height = 0.25f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+                std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\n", x * 0.01f, height, y * 0.01f);
+                text += line;
+            }
+        }
+        for (int y = 0; y <= rows; ++y) {
+            for (int x = 0; x <= columns; ++x) {
+                std::snprintf(line, sizeof(line), "vt %.6f %.6f\n", x / float(columns), y / float(rows));
+                text += line;
+            }
+        }
+        for (int y = 0; y <= rows; ++y) {
+            for (int x = 0; x <= columns; ++x) {
+                std::snprintf(line, sizeof(line), "vn %.4f %.4f %.4f\n", 0.1f * std::cos(x * 0.05f), 0.99f,
+                              0.1f * std::sin(y * 0.07f));
+                text += line;
+            }
+        }
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < columns; ++x) {
+                const int a = y * (columns + 1) + x + 1;
+                const int b = a + 1;
+                const int c = a + columns + 2;
+                const int d = a + columns + 1;
+                std::snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b, b, b, c, c, c,
+                              d, d, d);
+                text += line;
+            }
+        }
+        std::ofstream file(objPath, std::ios::binary);
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+    const double fileMb = std::filesystem::file_size(objPath) / (1024.0 * 1024.0);
+
+    size_t naiveTriangles = 0;
+    double naiveMs = measureBestMs(1, [&]() { naiveTriangles = loadObjNaive(objPath); });
+
+    OGDE::Graphics::MeshData mesh;
+    OGDE::Graphics::ObjLoadStats stats;
+    double serialMs = measureBestMs(3, [&]() {
+        OGDE::Graphics::ObjLoader::Load(objPath, mesh, OGDE::Graphics::ObjLoadSettings(), &stats);
+    });
+    OGDE::Graphics::ObjLoadSettings settings;
+    settings.jobSystem = &ogde::core::JobSystem::shared();
+    double parallelMs = measureBestMs(3, [&]() { OGDE::Graphics::ObjLoader::Load(objPath, mesh, settings); });
+
+    OGDE::Graphics::MeshContainer::Write(meshPath, mesh);
+    OGDE::Graphics::MeshData loaded;
+    double containerMs = measureBestMs(3, [&]() { OGDE::Graphics::MeshContainer::Read(meshPath, loaded); });
+    const double meshMb = std::filesystem::file_size(meshPath) / (1024.0 * 1024.0);
+    std::filesystem::remove(objPath);
+    std::filesystem::remove(meshPath);
+
+    std::printf("  %.1f MB OBJ, %zu triangles, %zu vertices (%u chunks)\n", fileMb, mesh.GetTriangleCount(),
+                mesh.vertices.size(), stats.chunks);
+    std::printf("  getline + strtof + string map %8.1f ms (%zu triangles)\n", naiveMs, naiveTriangles);
+    std::printf("  ObjLoader 1 thread            %8.1f ms (%.0f MB/s, %.1fx)\n", serialMs, fileMb / (serialMs / 1000.0),
+                naiveMs / serialMs);
+    std::printf("  ObjLoader %2u threads          %8.1f ms (%.0f MB/s, %.1fx)\n",
+                ogde::core::JobSystem::shared().getThreadCount(), parallelMs, fileMb / (parallelMs / 1000.0),
+                naiveMs / parallelMs);
+    std::printf("  .ogmesh read                  %8.1f ms (%.1f MB, %.0fx faster than parsing)\n", containerMs, meshMb,
+                parallelMs / containerMs);
+}
+
+// ---------------------------------------------------------------------------
+// Mesh optimization
+// ---------------------------------------------------------------------------
+
+// Depth-passing samples summed over six axis views (lower is less overdraw)
+uint64_t measureOverdraw(const OGDE::Graphics::MeshData& mesh) {
+    ogde::graphics::RendererSoftware renderer;
+    renderer.initialize(512, 512);
+    ogde::graphics::SoftwareVertexFormat format;
+    format.stride = sizeof(OGDE::Graphics::MeshVertex);
+    format.normalOffset = offsetof(OGDE::Graphics::MeshVertex, normal);
+    const uint32_t geometry =
+        renderer.createVertexBuffer(mesh.vertices.data(), static_cast<uint32_t>(mesh.vertices.size()), format);
+    renderer.setIndexBuffer(geometry, mesh.indices.data(), static_cast<uint32_t>(mesh.indices.size()));
+    renderer.setVertexBuffer(geometry);
+
+    const float eyes[6][3] = { {4, 0, 0}, {-4, 0, 0}, {0, 4, 0.01f}, {0, -4, 0.01f}, {0, 0, 4}, {0, 0, -4} };
+    uint64_t samples = 0;
+    for (const auto& eye : eyes) {
+        ogde::graphics::Camera camera;
+        camera.setPerspective(60.0f, 1.0f, 0.1f, 20.0f);
+        camera.lookAt(eye[0], eye[1], eye[2], 0.0f, 0.0f, 0.0f);
+        camera.update();
+        renderer.setViewProjection(camera.getViewProjectionMatrix());
+        renderer.beginFrame();
+        renderer.clear();
+        renderer.drawIndexed(static_cast<uint32_t>(mesh.indices.size()));
+        renderer.endFrame();
+        samples += renderer.getStats().pixelsWritten;
+    }
+    return samples;
+}
+
+// Bumpy sphere with rings x segments quads and a texture seam
+OGDE::Graphics::MeshData makeBumpySphere(int rings, int segments) {
+    const float pi = 3.14159265f;
+    OGDE::Graphics::MeshData mesh;
+    for (int r = 0; r <= rings; ++r) {
+        for (int s = 0; s <= segments; ++s) {
+            const float theta = pi * r / rings;
+            const float phi = 2.0f * pi * s / segments;
+            const float radius = 1.0f + 0.25f * std::sin(7.0f * theta) * std::sin(9.0f * phi);
+            OGDE::Graphics::MeshVertex vertex = {};
+            vertex.position[0] = radius * std::sin(theta) * std::cos(phi);
+            vertex.position[1] = radius * std::cos(theta);
+            vertex.position[2] = radius * std::sin(theta) * std::sin(phi);
+            std::copy(vertex.position, vertex.position + 3, vertex.normal);
+            vertex.texCoord[0] = static_cast<float>(s) / segments;
+            vertex.texCoord[1] = static_cast<float>(r) / rings;
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (int r = 0; r < rings; ++r) {
+        for (int s = 0; s < segments; ++s) {
+            const uint32_t a = r * (segments + 1) + s;
+            const uint32_t b = a + segments + 1;
+            triangles.push_back({ a, a + 1, b });
+            triangles.push_back({ a + 1, b + 1, b });
+        }
+    }
+    for (const auto& triangle : triangles) {
+        mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+    }
+    mesh.hasNormals = mesh.hasTexCoords = true;
+    mesh.ComputeBounds();
+    return mesh;
+}
+
+void benchMeshOptimizer() {
+    // Triangles in random order, like a mesh after an unordered export
+    OGDE::Graphics::MeshData mesh = makeBumpySphere(320, 640);
+    std::vector<std::array<uint32_t, 3>> triangles(mesh.indices.size() / 3);
+    std::memcpy(triangles.data(), mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(48));
+    std::memcpy(mesh.indices.data(), triangles.data(), mesh.indices.size() * sizeof(uint32_t));
+
+    OGDE::Graphics::MeshData cacheOnly = mesh;
+    OGDE::Graphics::MeshOptimizeSettings cacheSettings;
+    cacheSettings.overdraw = false;
+    OGDE::Graphics::MeshOptimizeReport cacheReport;
+    OGDE::Graphics::MeshOptimizer::Optimize(cacheOnly, cacheSettings, &cacheReport);
+
+    OGDE::Graphics::MeshOptimizeSettings settings;
+    settings.quantize = true;
+    OGDE::Graphics::MeshOptimizeReport report;
+    OGDE::Graphics::MeshData optimized;
+    double optimizeMs = measureBestMs(3, [&]() {
+        optimized = mesh;
+        OGDE::Graphics::MeshOptimizer::Optimize(optimized, settings, &report);
+    });
+
+    const uint64_t shuffledSamples = measureOverdraw(mesh);
+    const uint64_t cacheSamples = measureOverdraw(cacheOnly);
+    const uint64_t optimizedSamples = measureOverdraw(optimized);
+
+    std::printf("  %zu triangles, %u vertices, optimized in %.1f ms (%.1f M tris/s, %u overdraw clusters)\n",
+                mesh.GetTriangleCount(), report.verticesBefore, optimizeMs,
+                mesh.GetTriangleCount() / (optimizeMs * 1000.0), report.clusters);
+    std::printf("  ACMR %.3f -> %.3f (vertex cache only %.3f), ATVR %.3f -> %.3f\n", report.acmrBefore,
+                report.acmrAfter, cacheReport.acmrAfter, report.atvrBefore, report.atvrAfter);
+    std::printf("  depth-passing samples over 6 views: shuffled %llu, vertex cache %llu, + overdraw %llu (%.1f%%)\n",
+                static_cast<unsigned long long>(shuffledSamples), static_cast<unsigned long long>(cacheSamples),
+                static_cast<unsigned long long>(optimizedSamples),
+                100.0 * (static_cast<double>(optimizedSamples) / cacheSamples - 1.0));
+    std::printf("  vertex data %.1f MB -> %.1f MB quantized\n", report.vertexBytesBefore / (1024.0 * 1024.0),
+                report.vertexBytesAfter / (1024.0 * 1024.0));
+}
+
+// ---------------------------------------------------------------------------
+// LOD generation and selection
+// ---------------------------------------------------------------------------
+
+void benchMeshLod() {
+    OGDE::Graphics::MeshData mesh = makeBumpySphere(320, 640);
+    const size_t sourceTriangles = mesh.GetTriangleCount();
+    OGDE::Graphics::LodSettings settings;
+    settings.maxLevels = 6;
+    uint32_t levels = 0;
+    double generateMs = measureBestMs(1, [&]() { levels = OGDE::Graphics::MeshSimplifier::GenerateLods(mesh, settings); });
+
+    std::vector<size_t> triangles(levels, 0);
+    for (const OGDE::Graphics::SubMesh& subMesh : mesh.subMeshes) {
+        triangles[subMesh.lod] += subMesh.indexCount / 3;
+    }
+    std::printf("  %zu triangles -> %u levels in %.1f ms (%.2f M source tris/s)\n", sourceTriangles, levels,
+                generateMs, sourceTriangles / (generateMs * 1000.0));
+    for (uint32_t level = 0; level < levels; ++level) {
+        std::printf("    LOD %u: %8zu triangles, error %.5f (%.3f%% of the radius)\n", level, triangles[level],
+                    mesh.lodErrors[level], 100.0f * mesh.lodErrors[level]);
+    }
+
+    // 1M instances at log-uniform distances from 2 to 500 units, so every level gets its share
+    const uint32_t instanceCount = 1000000;
+    std::vector<float> spheres(static_cast<size_t>(instanceCount) * 4);
+    std::mt19937 rng(49);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (uint32_t i = 0; i < instanceCount; ++i) {
+        const float distance = 2.0f * std::pow(250.0f, unit(rng));
+        const float angle = 6.2831853f * unit(rng);
+        spheres[i * 4 + 0] = distance * std::cos(angle);
+        spheres[i * 4 + 1] = distance * (unit(rng) - 0.5f) * 0.1f;
+        spheres[i * 4 + 2] = distance * std::sin(angle);
+        spheres[i * 4 + 3] = 1.25f;
+    }
+    ogde::graphics::Camera camera;
+    camera.setPerspective(70.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+    camera.update();
+    ogde::graphics::LodSelector selector;
+    selector.setCamera(camera, 1080.0f);
+    std::vector<uint8_t> selected(instanceCount);
+    double selectMs = measureBestMs(5, [&]() {
+        selector.selectBatch(spheres.data(), instanceCount, mesh.lodErrors.data(), levels, selected.data());
+    });
+    uint64_t drawnTriangles = 0;
+    std::vector<uint32_t> histogram(levels, 0);
+    for (uint8_t level : selected) {
+        ++histogram[level];
+        drawnTriangles += triangles[level];
+    }
+    std::printf("  selected %u instances in %.2f ms (1 px threshold at 1080p):", instanceCount, selectMs);
+    for (uint32_t level = 0; level < levels; ++level) {
+        std::printf(" L%u=%u", level, histogram[level]);
+    }
+    std::printf("\n  %.1f G triangles at LOD 0 -> %.2f G with selection\n",
+                static_cast<double>(sourceTriangles) * instanceCount / 1e9, drawnTriangles / 1e9);
+}
+
+// ---------------------------------------------------------------------------
+// Meshlet building and per-cluster culling
+// ---------------------------------------------------------------------------
+
+void benchMeshlets() {
+    OGDE::Graphics::MeshData mesh = makeBumpySphere(320, 640);
+    OGDE::Graphics::SubMesh whole;
+    whole.indexCount = static_cast<uint32_t>(mesh.indices.size());
+    mesh.subMeshes.push_back(whole);
+    OGDE::Graphics::MeshOptimizer::Optimize(mesh);
+    const uint32_t triangleCount = static_cast<uint32_t>(mesh.GetTriangleCount());
+
+    size_t meshletCount = 0;
+    double buildMs = measureBestMs(3, [&]() { meshletCount = OGDE::Graphics::MeshletBuilder::Build(mesh); });
+    uint32_t culledCones = 0;
+    for (const OGDE::Graphics::Meshlet& meshlet : mesh.meshlets) {
+        culledCones += meshlet.coneCutoff < 1.0f;
+    }
+    std::printf("  %u triangles -> %zu meshlets in %.1f ms (%.1f vertices, %.1f triangles each, %.0f%% with a usable cone)\n",
+                triangleCount, meshletCount, buildMs, static_cast<double>(mesh.meshletVertices.size()) / meshletCount,
+                static_cast<double>(triangleCount) / meshletCount, 100.0 * culledCones / meshletCount);
+
+    // Orbit close to the surface, so both the frustum and the cones have work to do
+    ogde::graphics::Camera camera;
+    camera.setPerspective(45.0f, 16.0f / 9.0f, 0.05f, 100.0f);
+    ogde::graphics::MeshletCuller culler;
+    std::vector<uint32_t> visible(mesh.indices.size());
+    const int frames = 32;
+    auto orbit = [&](int frame) {
+        const float angle = 6.2831853f * frame / frames;
+        camera.lookAt(1.8f * std::cos(angle), 0.5f, 1.8f * std::sin(angle), 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);
+        camera.update();
+        culler.setCamera(camera);
+    };
+
+    uint64_t visibleTriangles = 0, frustumCulled = 0, backfaceCulled = 0;
+    for (int frame = 0; frame < frames; ++frame) {
+        orbit(frame);
+        culler.cull(mesh, mesh.subMeshes[0], visible.data());
+        visibleTriangles += culler.getStats().visibleTriangles;
+        frustumCulled += culler.getStats().frustumCulled;
+        backfaceCulled += culler.getStats().backfaceCulled;
+    }
+    double serialMs = measureBestMs(3, [&]() {
+        for (int frame = 0; frame < frames; ++frame) {
+            orbit(frame);
+            culler.cull(mesh, mesh.subMeshes[0], visible.data());
+        }
+    }) / frames;
+    culler.setJobSystem(&ogde::core::JobSystem::shared());
+    double parallelMs = measureBestMs(3, [&]() {
+        for (int frame = 0; frame < frames; ++frame) {
+            orbit(frame);
+            culler.cull(mesh, mesh.subMeshes[0], visible.data());
+        }
+    }) / frames;
+
+    std::printf("  per frame: %.1f%% of meshlets outside the frustum, %.1f%% backfacing\n",
+                100.0 * frustumCulled / (static_cast<double>(meshletCount) * frames),
+                100.0 * backfaceCulled / (static_cast<double>(meshletCount) * frames));
+    std::printf("  submitted %.0f of %u triangles (%.1f%%), cull + compaction %.3f ms (%.3f ms with %u threads)\n",
+                static_cast<double>(visibleTriangles) / frames, triangleCount,
+                100.0 * visibleTriangles / (static_cast<double>(triangleCount) * frames), serialMs, parallelMs,
+                ogde::core::JobSystem::shared().getThreadCount());
+}
+
+struct Benchmark {
+    const char* name;
+    void (*run)();
+};
+
+const Benchmark kBenchmarks[] = {
+    { "frustum_culling", benchFrustumCulling },
+    { "multi_view_culling", benchMultiViewCulling },
+    { "occlusion_culling", benchOcclusionCulling },
+    { "mip_generation", benchMipGeneration },
+    { "block_compression", benchBlockCompression },
+    { "texture_load", benchTextureLoad },
+    { "pixel_conversion", benchPixelConversion },
+    { "image_decode", benchImageDecode },
+    { "material_instances", benchMaterialInstances },
+    { "render_queue", benchRenderQueue },
+    { "software_rasterizer", benchSoftwareRasterizer },
+    { "instancing", benchInstancing },
+    { "obj_loader", benchObjLoader },
+    { "mesh_optimizer", benchMeshOptimizer },
+    { "mesh_lod", benchMeshLod },
+    { "meshlets", benchMeshlets },
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter = argc > 1 ? argv[1] : "";
+
+    std::printf("=== Graphics Benchmarks ===\n");
+    for (const Benchmark& benchmark : kBenchmarks) {
+        if (!filter.empty() && std::string(benchmark.name).find(filter) == std::string::npos) {
+            continue;
+        }
+        std::printf("\n--- %s ---\n", benchmark.name);
+        benchmark.run();
+    }
+    return 0;
+}